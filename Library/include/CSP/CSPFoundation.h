@@ -280,6 +280,18 @@ public:
     /// @return csp::common::String : The description of the feature flag
     static csp::common::String GetFeatureFlagDescription(EFeatureFlag Flag);
 
+    /// @brief Starts recording profiling events, discarding anything recorded previously.
+    /// Instrumentation is always compiled in, and costs very little while not recording, so this can be used with release builds.
+    static void StartProfiling();
+
+    /// @brief Stops recording profiling events. Recorded events are kept until profiling is next started.
+    static void StopProfiling();
+
+    /// @brief Exports the recorded profiling events in the Chrome trace event JSON format.
+    /// The output can be loaded into chrome://tracing or https://ui.perfetto.dev.
+    /// @return csp::common::String : The recorded events as a JSON document
+    static csp::common::String ExportProfilingTrace();
+
     // This is a utility function that allows flags to be added for testing purposes
     CSP_NO_EXPORT static void __AddFeatureFlagForTesting(EFeatureFlag Type, bool IsEnabled, const csp::common::String Description);
 
@@ -159,6 +159,52 @@ public:
         throw InvalidInterfaceUseError("Illegal use of \"abstract\" type.");
     }
 
+    /**
+     * @brief Post the same message to a callback in each of a set of contexts, in a single call.
+     * Each callback is invoked as `Callback(Message, MessageParamsJson, Value)`, with Value passed as a native number rather than
+     * being serialized into script text. Contexts that no longer exist, and callbacks that aren't currently functions, are skipped.
+     * @param ContextIds const int64_t* : The Ids of the CSP script contexts to post the message to.
+     * @param CallbackNames const String* : The global function, or dotted path to one, to invoke in each context. Parallel to ContextIds.
+     * @param Count size_t : The number of entries in ContextIds and CallbackNames.
+     * @param Message const String& : The message being posted, passed as the first argument to each callback.
+     * @param MessageParamsJson const String& : A JSON formatted string of parameters, passed as the second argument to each callback.
+     * @param Value double : A numeric value passed as the third argument to each callback.
+     */
+    CSP_NO_EXPORT virtual void PostMessageToContexts(const int64_t* /*ContextIds*/, const String* /*CallbackNames*/, size_t /*Count*/,
+        const String& /*Message*/, const String& /*MessageParamsJson*/, double /*Value*/)
+    {
+        throw InvalidInterfaceUseError("Illegal use of \"abstract\" type.");
+    }
+
+    /**
+     * @brief Check that a named callback in a context is a function, and split its name into interned atoms for later calls to
+     * InvokeCallback and PostMessageToContexts, so they never need to parse the name or compile a script.
+     * No function handle is kept. Each call reads the name again, so a script that assigns a different function to the name has the new
+     * function called. The atoms are released when the context is reset or destroyed.
+     * @param ContextId int64_t : The Id of the CSP script context containing the callback.
+     * @param CallbackName const String& : The name of a global function in the context, or a dotted path to one, such as `Handlers.onTick`.
+     * @return Whether the name resolved to a function. If not, InvokeCallback will attempt to resolve it again when called.
+     */
+    CSP_NO_EXPORT virtual bool ResolveCallback(int64_t /*ContextId*/, const String& /*CallbackName*/)
+    {
+        throw InvalidInterfaceUseError("Illegal use of \"abstract\" type.");
+    }
+
+    /**
+     * @brief Invoke a named callback in a context as `Callback(Message, MessageParamsJson)`, passing the arguments as native strings
+     * rather than compiling a script to make the call.
+     * @param ContextId int64_t : The Id of the CSP script context containing the callback.
+     * @param CallbackName const String& : The name of a global function in the context, or a dotted path to one, such as `Handlers.onTick`.
+     * @param Message const String& : The message being posted, passed as the first argument to the callback.
+     * @param MessageParamsJson const String& : A JSON formatted string of parameters, passed as the second argument to the callback.
+     * @return Whether the callback was found and called. Callers may fall back to RunScript if this returns false.
+     */
+    CSP_NO_EXPORT virtual bool InvokeCallback(
+        int64_t /*ContextId*/, const String& /*CallbackName*/, const String& /*Message*/, const String& /*MessageParamsJson*/)
+    {
+        throw InvalidInterfaceUseError("Illegal use of \"abstract\" type.");
+    }
+
 protected:
     IJSScriptRunner() = default;
 };
@@ -343,6 +343,32 @@ public:
         (void)Entity;
     }
 
+    /// @brief Notifies the engine that an entity's name has changed, so that name based lookups stay current.
+    /// This method is called by the entity after its name has been updated, either locally or from a remote patch.
+    /// @param Entity csp::multiplayer::SpaceEntity* : The Entity that was renamed
+    /// @param OldName const csp::common::String& : The name the entity had before the change
+    CSP_NO_EXPORT virtual void OnEntityNameChanged(csp::multiplayer::SpaceEntity* Entity, const csp::common::String& OldName)
+    {
+        throw InvalidInterfaceUseError("Illegal use of \"abstract\" type.");
+
+        // Avoiding unused params, see comment in top method
+        (void)Entity;
+        (void)OldName;
+    }
+
+    /// @brief Notifies the engine that an entity's script has started or stopped handling the entity tick message.
+    /// Only entities with a tick handler are visited when the engine ticks scripts.
+    /// @param Entity csp::multiplayer::SpaceEntity* : The Entity whose script changed
+    /// @param HasTickHandler bool : Whether the entity's script now has a tick handler
+    CSP_NO_EXPORT virtual void OnEntityTickHandlerChanged(csp::multiplayer::SpaceEntity* Entity, bool HasTickHandler)
+    {
+        throw InvalidInterfaceUseError("Illegal use of \"abstract\" type.");
+
+        // Avoiding unused params, see comment in top method
+        (void)Entity;
+        (void)HasTickHandler;
+    }
+
     /// @brief Set Callback that notifies when the OnlineRealtimeEngine is in a valid state
     /// after entering a space, and entity mutation can begin. Users should not mutate entities before receiving this callback.
     /// This callback should be emitted in response to FetchAllEntitiesAndPopulateBuffers completing, either syncronously or asyncronously.
@@ -204,9 +204,28 @@ private:
     /// @return const char*
     const char* Get() const;
 
-private:
-    class Impl;
-    Impl* ImplPtr;
+    CSP_START_IGNORE
+    // Strings up to this many characters are stored in InlineText and never touch the heap.
+    static constexpr size_t InlineCapacity = 22;
+
+    // Points the string at a copy of Source. Expects the string to be holding no heap memory.
+    void Assign(const char* Source, size_t SourceLength);
+
+    // Makes room for at least NewCapacity characters plus the terminator, keeping the current contents.
+    void Reserve(size_t NewCapacity);
+
+    // Frees any heap buffer and leaves the string empty and inline.
+    void Reset();
+
+    bool IsInline() const;
+
+    // Either InlineText or a single heap allocation of TextCapacity + 1 bytes. Always null terminated.
+    // All allocation and freeing happens inside the library, so the buffer is safe to pass across the DLL boundary.
+    char* Text;
+    size_t TextLength;
+    size_t TextCapacity;
+    char InlineText[InlineCapacity + 1];
+    CSP_END_IGNORE
 };
 
 } // namespace csp::common
@@ -24,6 +24,8 @@
 namespace csp::common
 {
 
+class AsyncLogSink;
+
 /// @brief A Connected Spaces Platform level Logger for debugging or printing to console, also handles logging to a file.
 /// Contains a callback system that allows clients to react to specific logs or events.
 class CSP_API LogSystem
@@ -43,15 +45,19 @@ public:
     /// @param InLogCallback The callback to execute when a log occurs.
     CSP_EVENT void SetLogCallback(LogCallbackHandler InLogCallback);
 
-    /// @brief Set a callback for handling an event log. Can be used to debug Connected Spaces Platform within a client application.
+    /// @brief Set a callback for handling an event log, which is called for events passed to LogEvent.
+    /// Connected Spaces Platform doesn't log events through this itself. Its profiling events are recorded by CSPFoundation::StartProfiling instead.
     /// @param InEventCallback The callback to execute when an event log occurs.
     CSP_EVENT void SetEventCallback(EventCallbackHandler InEventCallback);
 
-    /// @brief Set a callback for handling a begin marker event. Can be used to debug Connected Spaces Platform within a client application.
+    /// @brief Set a callback for handling a begin marker event, which is called for markers passed to BeginMarker.
+    /// Connected Spaces Platform doesn't emit markers through this itself. Its profiling scopes are recorded by CSPFoundation::StartProfiling
+    /// instead, and can be exported with CSPFoundation::ExportProfilingTrace.
     /// @param InBeginCallback The callback to execute when the marker begins.
     CSP_EVENT void SetBeginMarkerCallback(BeginMarkerCallbackHandler InBeginCallback);
 
-    /// @brief Set a callback for handling an end marker event. Can be used to debug Connected Spaces Platform within a client application.
+    /// @brief Set a callback for handling an end marker event, which is called when EndMarker is called.
+    /// As with begin markers, Connected Spaces Platform doesn't emit these itself.
     /// @param InEndCallback The callback to execute when the marker ends.
     CSP_EVENT void SetEndMarkerCallback(EndMarkerCallbackHandler InEndCallback);
 
@@ -70,18 +76,28 @@ public:
     /// @param Level The level to log this message at.
     /// @param InMessage The message to be logged.
     void LogMsg(const csp::common::LogLevel Level, const csp::common::String& InMessage);
-    /// @brief Log an event.
+    /// @brief Log an event, passing it to the event callback.
     /// @param InEvent The event to be logged.
     void LogEvent(const csp::common::String& InEvent);
 
     /// @brief Specify a 'Marker' event which can be used to communicate a certain process occurring, usually for debugging.
+    /// The marker is only passed to the begin marker callback. It isn't recorded by the Connected Spaces Platform profiler.
     void BeginMarker(const csp::common::String& InMarker);
-    /// @brief End a 'Marker' event.
+    /// @brief End a 'Marker' event, calling the end marker callback.
     void EndMarker();
 
     /// @brief Clears all logging callbacks.
     void ClearAllCallbacks();
 
+    /// @brief Format and deliver messages logged through CSP_LOG_FMT on a background thread, rather than on the thread that logged them.
+    /// While enabled, the log callback will be called from that thread. Messages passed directly to LogMsg are unaffected.
+    /// @param Enabled bool : Whether to log asynchronously. Disabling waits for any queued messages to be logged.
+    CSP_NO_EXPORT void SetAsyncLoggingEnabled(bool Enabled);
+
+    /// @brief Get the sink that deferred messages should be queued on.
+    /// @return The sink, or nullptr if asynchronous logging is disabled.
+    CSP_NO_EXPORT AsyncLogSink* GetAsyncLogSink() const;
+
 private:
     csp::common::LogLevel SystemLevel = LogLevel::All;
 
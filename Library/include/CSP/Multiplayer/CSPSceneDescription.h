@@ -18,6 +18,11 @@
 #include "CSP/Common/Interfaces/IRealtimeEngine.h"
 #include "CSP/Multiplayer/SpaceEntity.h"
 
+namespace csp
+{
+class TaskExecutor;
+}
+
 namespace csp::multiplayer
 {
 /// @brief CSPSceneDescription which represents all entities that exists for a scene.
@@ -42,11 +47,13 @@ public:
     /// @param RealtimeEngine csp::common::IRealtimeEngine& : The RealtimeEngine for this session.
     /// @param LogSystem csp::common::LogSystem& : The SpaceEntitySystem for this session.
     /// @param RemoteScriptRunner csp::common::IJSScriptRunner& : The ScriptRunner for this session.
-    CSP_NO_EXPORT csp::common::Array<csp::multiplayer::SpaceEntity*> CreateEntities(
-        csp::common::IRealtimeEngine& RealtimeEngine, csp::common::LogSystem& LogSystem, csp::common::IJSScriptRunner& RemoteScriptRunner) const;
+    /// @param DecodeExecutor csp::TaskExecutor* : When given, the json for batches of entities is decoded across its workers and the calling
+    /// thread. Entities are always constructed on the calling thread.
+    CSP_NO_EXPORT csp::common::Array<csp::multiplayer::SpaceEntity*> CreateEntities(csp::common::IRealtimeEngine& RealtimeEngine,
+        csp::common::LogSystem& LogSystem, csp::common::IJSScriptRunner& RemoteScriptRunner, csp::TaskExecutor* DecodeExecutor = nullptr) const;
 
 private:
-    csp::common::String SceneDescriptionJson;
+    csp::common::List<csp::common::String> SceneDescriptionJson;
 };
 
 }
@@ -43,6 +43,7 @@ namespace csp::multiplayer
 class SpaceEntity;
 class ComponentSchema;
 class ComponentScriptInterface;
+class ComponentPropertyIndex;
 
 /// @brief Represents the type of component.
 ///
@@ -92,6 +93,7 @@ class CSP_API ComponentBase
     friend class OnlineRealtimeEngine;
     friend class ComponentScriptInterface;
     friend class EntityScriptInterface;
+    friend class SpaceEntityStatePatcher;
 #ifdef CSP_TESTS
     friend class ::CSPEngine_SerialisationTests_SpaceEntityUserSignalRSerialisationTest_Test;
     friend class ::CSPEngine_SerialisationTests_SpaceEntityUserSignalRDeserialisationTest_Test;
@@ -191,11 +193,19 @@ public:
     /// Silently ignored if the key is absent from this component's schema or the value type does not match the schema definition.
     void SetProperty(uint16_t Key, const csp::common::ReplicatedValue& Value);
 
+    /// @brief Get the slot index over the property map, for reading and writing schema properties without walking the map.
+    CSP_NO_EXPORT const ComponentPropertyIndex& GetPropertyIndex() const;
+
+    /// @brief Whether the property has been changed locally since the component was last sent in a patch.
+    CSP_NO_EXPORT bool IsPropertyDirty(uint32_t Key) const;
+
 protected:
     ComponentBase();
     ComponentBase(uint64_t TypeId, csp::common::LogSystem* LogSystem, SpaceEntity* Parent);
 
     const csp::common::ReplicatedValue& GetPropertyDirect(uint32_t Key) const;
+    bool HasPropertyDirect(uint32_t Key) const;
+    size_t GetPropertyCount() const;
     bool GetBooleanProperty(uint32_t Key) const;
     int64_t GetIntegerProperty(uint32_t Key) const;
     float GetFloatProperty(uint32_t Key) const;
@@ -227,7 +237,10 @@ protected:
     SpaceEntity* Parent;
     uint16_t Id;
     uint64_t Type;
+
+    // Add and remove keys through SetPropertyDirect and RemoveProperty, which keep PropertyIndex in step with the map.
     csp::common::Map<uint32_t, csp::common::ReplicatedValue> Properties;
+    // Unused. Dirty state is tracked by PropertyIndex.
     csp::common::Map<uint32_t, csp::common::ReplicatedValue> DirtyProperties;
 
     std::unique_ptr<ComponentScriptInterface> ScriptInterface;
@@ -240,7 +253,10 @@ protected:
     std::unique_ptr<ComponentSchema> CachedSchema;
 
 private:
-    void InitialiseProperties();
+    void InitialiseProperties(const ComponentSchema* Schema);
+
+    // Laid out from the component's schema, so that reading or writing a schema property needs no map lookup.
+    std::unique_ptr<ComponentPropertyIndex> PropertyIndex;
 };
 
 } // namespace csp::multiplayer
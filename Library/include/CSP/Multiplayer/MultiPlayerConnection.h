@@ -152,6 +152,10 @@ public:
     /// @return bool : true if connected, false otherwise
     CSP_NO_EXPORT bool IsConnected() const { return Connected; }
 
+    /// @brief Indicates whether messages are being sent faster than the connection can write them out
+    /// @return bool : true if the outgoing queue is over its byte budget, and callers should hold back what they can
+    CSP_NO_EXPORT bool IsSendBackPressured() const;
+
     /// @brief Getter for the signalR connection
     /// @return ISignalRConnection* : pointer to the signalR connection
     CSP_NO_EXPORT csp::multiplayer::ISignalRConnection* GetSignalRConnection() { return Connection; };
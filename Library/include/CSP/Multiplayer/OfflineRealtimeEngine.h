@@ -40,7 +40,10 @@ namespace csp::multiplayer
 {
 class CSPSceneDescription;
 class EntityScriptBinding;
+class SpaceEntityHierarchy;
+class SpaceEntityIndex;
 class SpaceEntityStatePatcher;
+class SpaceEntityTickList;
 
 /// @brief Class for creating and managing objects in an offline context.
 ///
@@ -51,6 +54,7 @@ class CSP_API OfflineRealtimeEngine : public csp::common::IRealtimeEngine
     CSP_START_IGNORE
     /** @cond DO_NOT_DOCUMENT */
     friend class ::CSPEngine_OfflineRealtimeEngineTests_SelectEntity_Test;
+    friend class OfflineSpaceEntityEventHandler;
     /** @endcond */
     CSP_END_IGNORE
 
@@ -222,6 +226,16 @@ public:
     /// @param Entity csp::multiplayer::SpaceEntity* : The Entity to resolve
     CSP_NO_EXPORT virtual void ResolveEntityHierarchy(csp::multiplayer::SpaceEntity* Entity) override;
 
+    /// @brief Updates the name lookup for an entity that has been renamed.
+    /// @param Entity csp::multiplayer::SpaceEntity* : The Entity that was renamed
+    /// @param OldName const csp::common::String& : The name the entity had before the change
+    CSP_NO_EXPORT virtual void OnEntityNameChanged(csp::multiplayer::SpaceEntity* Entity, const csp::common::String& OldName) override;
+
+    /// @brief Notifies the engine that an entity's script has started or stopped handling the entity tick message.
+    /// @param Entity csp::multiplayer::SpaceEntity* : The Entity whose script changed
+    /// @param HasTickHandler bool : Whether the entity's script now has a tick handler
+    CSP_NO_EXPORT virtual void OnEntityTickHandlerChanged(csp::multiplayer::SpaceEntity* Entity, bool HasTickHandler) override;
+
     /***** ENTITY PROCESSING *************************************************/
 
     /**
@@ -290,7 +304,15 @@ private:
     csp::common::List<SpaceEntity*> Avatars;
     csp::common::List<SpaceEntity*> Objects;
     csp::common::List<SpaceEntity*> SelectedEntities;
-    csp::common::List<SpaceEntity*> RootHierarchyEntities;
+
+    // Id and name lookups for everything in Entities. Guarded by EntitiesLock.
+    std::unique_ptr<SpaceEntityIndex> EntityIndex;
+
+    // Root (unparented) entities, backing GetRootHierarchyEntities. Guarded by EntitiesLock.
+    std::unique_ptr<SpaceEntityHierarchy> RootHierarchy;
+
+    // Entities whose scripts handle the tick message. Guards itself.
+    std::unique_ptr<SpaceEntityTickList> TickList;
 
     std::recursive_mutex EntitiesLock;
 
@@ -35,6 +35,7 @@
 #include <mutex>
 #include <optional>
 #include <set>
+#include <vector>
 
 namespace async
 {
@@ -76,6 +77,19 @@ class MultiplayerConnection;
 class ISignalRConnection;
 class NetworkEventBus;
 class ScopeLeadershipManager;
+class IncomingPatchBatch;
+class OutgoingPatchScheduler;
+class SpaceEntityHierarchy;
+class SpaceEntityIndex;
+class SpaceEntityTickList;
+
+CSP_START_IGNORE
+namespace mcs
+{
+    class ObjectMessage;
+    class ObjectPatch;
+}
+CSP_END_IGNORE
 
 /// @brief Class for creating and managing multiplayer objects known as space entities.
 ///
@@ -252,6 +266,16 @@ public:
     /// @param Entity csp::multiplayer::SpaceEntity* : The Entity to resolve
     CSP_NO_EXPORT virtual void ResolveEntityHierarchy(csp::multiplayer::SpaceEntity* Entity) override;
 
+    /// @brief Updates the name lookup for an entity that has been renamed.
+    /// @param Entity csp::multiplayer::SpaceEntity* : The Entity that was renamed
+    /// @param OldName const csp::common::String& : The name the entity had before the change
+    CSP_NO_EXPORT virtual void OnEntityNameChanged(csp::multiplayer::SpaceEntity* Entity, const csp::common::String& OldName) override;
+
+    /// @brief Notifies the engine that an entity's script has started or stopped handling the entity tick message.
+    /// @param Entity csp::multiplayer::SpaceEntity* : The Entity whose script changed
+    /// @param HasTickHandler bool : Whether the entity's script now has a tick handler
+    CSP_NO_EXPORT virtual void OnEntityTickHandlerChanged(csp::multiplayer::SpaceEntity* Entity, bool HasTickHandler) override;
+
     /***** ENTITY PROCESSING *************************************************/
 
     /**
@@ -367,6 +391,42 @@ public:
     /// \endrst
     void SetEntityPatchRateLimitEnabled(bool Enabled);
 
+    /// @brief Set the minimum interval between patches sent for an entity, for entities without a more specific rate.
+    /// Changes to entity properties (such as the transform) and to components without a component type rate are always limited to this rate.
+    /// @param RateMs uint32_t : The interval in milliseconds. Defaults to 90.
+    void SetDefaultEntityPatchRate(uint32_t RateMs);
+
+    /// @brief Retrieve the minimum interval between patches sent for an entity, for entities without a more specific rate.
+    /// @return The interval in milliseconds.
+    uint32_t GetDefaultEntityPatchRate() const;
+
+    /// @brief Override the minimum interval between patches sent for a specific entity.
+    /// This takes precedence over both the default and component type rates.
+    /// The override is removed along with the entity, and when all entities are destroyed on leaving the space.
+    /// @param EntityId uint64_t : The id of the entity to override the rate of.
+    /// @param RateMs uint32_t : The interval in milliseconds.
+    void SetEntityPatchRate(uint64_t EntityId, uint32_t RateMs);
+
+    /// @brief Remove a rate override previously set via SetEntityPatchRate.
+    /// @param EntityId uint64_t : The id of the entity to remove the override from.
+    void ClearEntityPatchRate(uint64_t EntityId);
+
+    /// @brief Set the minimum interval between patches sent for entities with a dirty component of the given type.
+    /// When an entity has several kinds of change pending, the fastest applicable rate is used, so a slow rate on a rarely changing component
+    /// never holds back a transform change made alongside it.
+    /// @param Type ComponentType : The component type to set the rate of.
+    /// @param RateMs uint32_t : The interval in milliseconds.
+    void SetComponentTypePatchRate(ComponentType Type, uint32_t RateMs);
+
+    /// @brief Remove a rate previously set via SetComponentTypePatchRate.
+    /// @param Type ComponentType : The component type to remove the rate of.
+    void ClearComponentTypePatchRate(ComponentType Type);
+
+    /// @brief Set the maximum number of entity patches sent to Magnopus Connected Services in a single request.
+    /// Larger sets of patches are split across several requests.
+    /// @param MaxPatches uint32_t : The maximum number of patches per request. Defaults to 64, and must be at least 1.
+    void SetMaxEntityPatchesPerBatch(uint32_t MaxPatches);
+
     /// @brief "Refreshes" (ie, turns on an off again), the multiplayer connection, in order to refresh scopes.
     /// This shouldn't be neccesary, we should devote some effort to checking if it still is at some point
     /// @param SpaceId csp::Common:String& : The Id of the space to refresh
@@ -420,7 +480,15 @@ protected:
     csp::common::List<SpaceEntity*> Avatars;
     csp::common::List<SpaceEntity*> Objects;
     csp::common::List<SpaceEntity*> SelectedEntities;
-    csp::common::List<SpaceEntity*> RootHierarchyEntities;
+
+    // Id and name lookups for everything in Entities. Guarded by EntitiesLock.
+    std::unique_ptr<SpaceEntityIndex> EntityIndex;
+
+    // Root (unparented) entities, backing GetRootHierarchyEntities. Guarded by EntitiesLock.
+    std::unique_ptr<SpaceEntityHierarchy> RootHierarchy;
+
+    // Entities whose scripts handle the tick message. Guards itself.
+    std::unique_ptr<SpaceEntityTickList> TickList;
 
     std::recursive_mutex* EntitiesLock;
 
@@ -437,7 +505,6 @@ private:
     /// @param Entity SpaceEntity : The entity to be destroyed locally.
     void LocalDestroyEntity(SpaceEntity* Entity);
 
-    using PatchMessageQueue = std::deque<signalr::value*>;
     using SpaceEntitySet = std::set<SpaceEntity*>;
 
     EntityCreatedCallback RemoteSpaceEntityCreatedCallback;
@@ -457,7 +524,7 @@ private:
 
     void AddPendingEntity(SpaceEntity* EntityToAdd);
     void RemovePendingEntity(SpaceEntity* EntityToRemove);
-    void ApplyIncomingPatch(const signalr::value*);
+    void ApplyIncomingPatch(const mcs::ObjectPatch& Patch);
     void HandleException(const std::exception_ptr& Except, const std::string& ExceptionDescription);
 
     bool EntityIsInRootHierarchy(SpaceEntity* Entity);
@@ -471,11 +538,13 @@ private:
 
     bool IsLocalClientLeader() const;
 
-    void SendPatches(const csp::common::List<SpaceEntity*> PendingEntities);
+    // Sends patches for the given entities, split into batches of at most MaxPatchesPerBatch per SEND_OBJECT_PATCHES invocation.
+    void SendPatches(const std::vector<SpaceEntity*>& PendingEntities);
 
     // Used in OnObjectMessage as well as in the initial entity fetch. Uses CreateEntity to make entities when instructed to from the server, via
     // signalR message.
     SpaceEntity* CreateRemotelyRetrievedEntity(const signalr::value& EntityMessage);
+    SpaceEntity* CreateRemotelyRetrievedEntity(const mcs::ObjectMessage& Message);
 
     // CreateAvatar Continuations
     CSP_START_IGNORE
@@ -506,14 +575,13 @@ private:
 
     std::deque<csp::multiplayer::SpaceEntity*>* PendingAdds;
     std::deque<csp::multiplayer::SpaceEntity*>* PendingRemoves;
-    std::set<csp::multiplayer::SpaceEntity*>* PendingOutgoingUpdateUniqueSet;
-    PatchMessageQueue* PendingIncomingUpdates;
+    OutgoingPatchScheduler* PendingOutgoingUpdates;
+    IncomingPatchBatch* PendingIncomingUpdates;
 
     bool EnableEntityTick;
     std::list<SpaceEntity*> TickUpdateEntities;
 
     std::chrono::system_clock::time_point LastTickTime;
-    std::chrono::milliseconds EntityPatchRate;
 
     bool EntityPatchRateLimitEnabled = true;
 
@@ -104,6 +104,8 @@ public:
     CSP_NO_EXPORT void SubscribeToPropertyChange(int32_t ComponentId, int32_t PropertyKey, csp::common::String Message);
 
     /// @brief Sets up a subscription where the given callback in the script will be run when given message is posted to the script.
+    /// Subscribing to a message again replaces its callback. The callback is looked up by name each time the message is posted, so a script
+    /// that assigns a new function to the callback's name has the new function called without subscribing again.
     /// @param Message csp::common::String : The message to subscribe to.
     /// @param OnMessageCallback csp::common::String : The callback that will be run in the script.
     CSP_NO_EXPORT void SubscribeToMessage(const csp::common::String Message, const csp::common::String OnMessageCallback);
@@ -113,6 +115,12 @@ public:
     /// @param MessageParamsJson csp::common::String : A JSON formatted string of parameters to be passed to the callback.
     void PostMessageToScript(const csp::common::String Message, const csp::common::String MessageParamsJson = "");
 
+    /// @brief Gets the callback the script subscribed to the given message with, if any.
+    /// @param Message csp::common::String : The message to look up.
+    /// @param OutCallback csp::common::String : Set to the name of the callback if there is a subscription.
+    /// @return True if the script has subscribed to the message.
+    CSP_NO_EXPORT bool TryGetMessageCallback(const csp::common::String& Message, csp::common::String& OutCallback) const;
+
     /// @brief Resets binding, context and subscriptions when the source is changed for the script.
     /// @param InScriptSource csp::common::String : The new source for the script.
     void OnSourceChanged(const csp::common::String& InScriptSource);
@@ -138,6 +146,7 @@ private:
     EntityScript(); // Just to appease the generator :(
 
     void CheckBinding();
+    bool ShouldRunScriptsLocally() const;
 
     SpaceEntity* Entity;
     ScriptSpaceComponent* EntityScriptComponent;
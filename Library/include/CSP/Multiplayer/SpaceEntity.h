@@ -193,6 +193,20 @@ public:
     /// @return Whether a new value was set, may fail if not modifiable, or if a dirty property is already set to this value.
     bool SetScale(const csp::common::Vector3& Value);
 
+    /// @brief Get the global transforms of many entities in a single call.
+    /// Any stale global transforms are recomputed together as a batch, which is much cheaper than querying a large or deep hierarchy entity by
+    /// entity.
+    /// @param Entities const csp::common::Array<SpaceEntity*>& : The entities to get the global transforms of.
+    /// @return The global transform of each entity, in the same order as Entities. Null entries get the identity transform.
+    static csp::common::Array<SpaceTransform> GetGlobalTransforms(const csp::common::Array<SpaceEntity*>& Entities);
+
+    /// @brief Get the inverses of the global transforms of many entities in a single call.
+    /// These take a global position into the local space of each entity. Rotations are expected to be normalized, and the result is only exact
+    /// for entities whose global scale is uniform.
+    /// @param Entities const csp::common::Array<SpaceEntity*>& : The entities to get the inverse global transforms of.
+    /// @return The inverse global transform of each entity, in the same order as Entities. Null entries get the identity transform.
+    static csp::common::Array<SpaceTransform> GetInverseGlobalTransforms(const csp::common::Array<SpaceEntity*>& Entities);
+
     /// @brief Get whether the space is transient or persistent.
     /// @return returns True if the space is transient and false if it is marked as persistent.
     bool GetIsTransient() const;
@@ -410,6 +424,14 @@ public:
     /// @brief Resolve the relationship between the parent and the child
     CSP_NO_EXPORT void ResolveParentChildRelationship();
 
+    /// @brief Refreshes any stale cached global transforms for this entity and all of its descendants.
+    CSP_NO_EXPORT void UpdateWorldTransforms();
+
+    /// @brief Refreshes any stale cached global transforms in the hierarchies under the given root entities, as a single batch.
+    /// Called once per tick by the realtime engines, so global transform queries made during the frame are cache hits.
+    /// @param RootEntities const csp::common::List<SpaceEntity*>& : The roots of the hierarchies to refresh.
+    CSP_NO_EXPORT static void UpdateWorldTransforms(const csp::common::List<SpaceEntity*>& RootEntities);
+
     // The state patcher. This is the object that handles dirty/pending properties,
     // another way of thinking about this is the "network patch manager" or something like that.
     // If this is null, then the space entity does immediate updates without any deferred patching.
@@ -463,6 +485,23 @@ private:
 
     void AddChildEntity(SpaceEntity* ChildEntity);
 
+    // Lets the owning realtime engine re-key its name lookups after Name has been updated.
+    void NotifyNameChanged(const csp::common::String& OldName);
+
+    // Returns a copy of the cached global transform, recomputing it (and any stale ancestors) if it has been marked dirty.
+    // Safe to call from several threads at once, as the getters that use it are const.
+    SpaceTransform GetCachedGlobalTransform() const;
+
+    // The caches of an engine's entities are guarded by one lock, see LockGlobalTransforms. These expect it to be held.
+    // MarkGlobalTransformDirtyLocked flags the cached global transform of this entity and all of its descendants as stale, and must be
+    // called whenever the local transform or the parent changes.
+    void MarkGlobalTransformDirtyLocked();
+    const SpaceTransform& RefreshGlobalTransform() const;
+
+    // Recomputes every stale global transform under the given roots, one hierarchy level at a time, using the batch transform kernels.
+    // The parents of the roots must have up to date global transforms, and the global transform lock of their engine must be held.
+    static void RefreshGlobalTransforms(SpaceEntity* const* Roots, size_t RootCount);
+
     csp::common::IRealtimeEngine* EntitySystem;
 
     SpaceEntityType Type;
@@ -480,6 +519,12 @@ private:
     SpaceEntity* Parent = nullptr;
     csp::common::List<SpaceEntity*> ChildEntities;
 
+    // Global transform derived from Transform and the parent chain. Only valid while IsGlobalTransformDirty is false.
+    // A dirty entity always has dirty descendants, which lets MarkGlobalTransformDirtyLocked stop early.
+    // Both are guarded by the global transform lock, so that const getters can refresh them from any thread.
+    mutable SpaceTransform GlobalTransform;
+    mutable bool IsGlobalTransformDirty = true;
+
     LockType EntityLock;
 
     UpdateCallback EntityUpdateCallback;
@@ -504,9 +549,14 @@ private:
     std::recursive_mutex EntityMutexLock;
     std::recursive_mutex PropertiesLock;
     std::recursive_mutex ComponentsLock;
+
+    // Locks the global transform caches of the entities sharing this entity's realtime engine. The local transforms and parents the caches
+    // are derived from are written under it, so that a refresh never reads them part way through a write.
+    std::unique_lock<std::mutex> LockGlobalTransforms() const;
+    std::mutex& GetGlobalTransformMutex() const;
     CSP_END_IGNORE
 
-    /// @brief Setter for the parent entity
+    /// @brief Setter for the parent entity, which marks the global transforms of this entity and its descendants as stale
     /// @param InParent SpaceEntity : the parent entity to set
     void SetParent(SpaceEntity* InParent);
 
@@ -527,7 +577,18 @@ void SpaceEntity::SetPropertyDirect(P& Property, const V& Value, SpaceEntityUpda
     // We cast the value to the property type to get around issues with type <-> ReplicatedValue conversions,
     // as ReplicatedValues can only hold specific types.
     // This is quite brittle, so we are finding a better way to handle this.
-    Property = static_cast<P>(Value);
+    if (Flag & (UPDATE_FLAGS_POSITION | UPDATE_FLAGS_ROTATION | UPDATE_FLAGS_SCALE))
+    {
+        const auto GlobalTransformLock = LockGlobalTransforms();
+
+        Property = static_cast<P>(Value);
+        MarkGlobalTransformDirtyLocked();
+    }
+    else
+    {
+        Property = static_cast<P>(Value);
+    }
+
     if (CallNotifyingCallback && EntityUpdateCallback)
     {
         csp::common::Array<ComponentUpdateInfo> Empty;
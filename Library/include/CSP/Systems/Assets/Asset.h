@@ -22,12 +22,14 @@
 #include "CSP/Systems/WebService.h"
 
 #include <functional>
+#include <memory>
 
 namespace csp::web
 {
 
 struct IWebClient;
 class HttpPayload;
+class HttpResponseSink;
 class WebClient;
 
 } // namespace csp::web
@@ -193,6 +195,73 @@ private:
     csp::common::String MimeType = "application/octet-stream";
 };
 
+/// @brief Callback receiving a part of an asset's data as it is downloaded.
+/// @param Data const void* : the downloaded bytes. Only valid for the duration of the call.
+/// @param DataLength size_t : the number of bytes in Data.
+/// @param Offset uint64_t : where in the asset's data these bytes belong. This is 0 again if the download is restarted after a failure.
+typedef std::function<void(const void* Data, size_t DataLength, uint64_t Offset)> AssetDataChunkCallback;
+
+/// @ingroup Asset System
+/// @brief Interface for a destination that downloaded asset data is streamed into as it arrives, rather than being held in memory.
+CSP_INTERFACE class CSP_API AssetDataSink
+{
+public:
+    CSP_NO_EXPORT virtual std::shared_ptr<csp::web::HttpResponseSink> CreateResponseSink() const = 0;
+
+protected:
+    virtual ~AssetDataSink() = default;
+};
+
+/// @ingroup Asset System
+/// @brief A file based destination for downloaded asset data. The file is created, or overwritten if it already exists.
+class CSP_API FileAssetDataSink : public AssetDataSink
+{
+public:
+    /** @name Data Values
+     *
+     *   @{ */
+    csp::common::String FilePath;
+    /** @} */
+
+private:
+    CSP_NO_EXPORT std::shared_ptr<csp::web::HttpResponseSink> CreateResponseSink() const override;
+};
+
+/// @ingroup Asset System
+/// @brief A buffer based destination for downloaded asset data, such as a memory-mapped region.
+/// The download fails if the asset's data is larger than the buffer. The buffer must remain valid until the download completes.
+class CSP_API BufferAssetDataSink : public AssetDataSink
+{
+public:
+    BufferAssetDataSink();
+
+    /** @name Data Values
+     *
+     *   @{ */
+    void* Buffer;
+    size_t BufferLength;
+    /** @} */
+
+private:
+    CSP_NO_EXPORT std::shared_ptr<csp::web::HttpResponseSink> CreateResponseSink() const override;
+};
+
+/// @ingroup Asset System
+/// @brief A callback based destination for downloaded asset data, which is handed each part of the data as it arrives.
+/// The callback is called from a web request thread, not the thread the download was started from.
+class CSP_API CallbackAssetDataSink : public AssetDataSink
+{
+public:
+    /** @name Data Values
+     *
+     *   @{ */
+    AssetDataChunkCallback Callback;
+    /** @} */
+
+private:
+    CSP_NO_EXPORT std::shared_ptr<csp::web::HttpResponseSink> CreateResponseSink() const override;
+};
+
 /// @ingroup Asset System
 /// @brief Data class used to contain information when creating an asset.
 class CSP_API AssetResult : public csp::systems::ResultBase
@@ -272,6 +272,31 @@ public:
     CSP_ASYNC_RESULT void DownloadAssetDataEx(
         const Asset& Asset, csp::common::CancellationToken& CancellationToken, AssetDataResultCallback Callback);
 
+    /// @brief Downloads data for a given Asset from CHS, streaming it into the given sink as it arrives rather than holding it all in memory.
+    /// Prefer this to DownloadAssetDataEx for large assets, such as GLB models and Gaussian splats.
+    /// If the download has to be restarted, the sink is written to again from the beginning.
+    /// @param Asset Asset : asset to download data for
+    /// @param AssetDataSink AssetDataSink : destination for the asset data
+    /// AssetDataSink is an interface. A derived class must be passed.
+    /// @param CancellationToken csp::common::CancellationToken : token for cancelling download
+    /// @param Callback UInt64ResultCallback : callback when asynchronous task finishes, containing the number of bytes written to the sink
+    CSP_ASYNC_RESULT void DownloadAssetDataToSink(const Asset& Asset, const AssetDataSink& AssetDataSink,
+        csp::common::CancellationToken& CancellationToken, UInt64ResultCallback Callback);
+
+    /// @brief Downloads data for a given Asset from CHS to a file, requesting several byte ranges of it at once.
+    /// For large assets, such as Gaussian splats and video, this is much faster than a single request over high latency connections.
+    /// Progress is saved next to the file, so if the download fails or is cancelled, calling this again with the same file path resumes it.
+    /// Once complete, the file's size is checked against the server's, as is its MD5 checksum if the server declares one.
+    /// Assets too small to be worth splitting, or served without byte range support, are downloaded with a single request.
+    /// @param Asset Asset : asset to download data for
+    /// @param FilePath csp::common::String : path of the file to download the asset data to. It is created, or overwritten if it already exists
+    /// and there is no download to resume.
+    /// @param MaxConcurrentRanges uint32_t : the most byte ranges to request at once. Passing 1 downloads the asset with a single request.
+    /// @param CancellationToken csp::common::CancellationToken : token for cancelling download
+    /// @param Callback UInt64ResultCallback : callback when asynchronous task finishes, containing the size of the downloaded file
+    CSP_ASYNC_RESULT void DownloadAssetDataToFile(const Asset& Asset, const csp::common::String& FilePath, uint32_t MaxConcurrentRanges,
+        csp::common::CancellationToken& CancellationToken, UInt64ResultCallback Callback);
+
     /// @brief Get the size of the data associated with an Asset.
     /// @param Asset Asset : asset to get data size for
     /// @param Callback UInt64ResultCallback : callback when asynchronous task finishes
@@ -91,6 +91,11 @@ public:
     csp::common::String GetModuleSource(csp::common::String ModuleUrl);
     size_t GetNumImportedModules(int64_t ContextId) const;
     const char* GetImportedModule(int64_t ContextId, size_t Index) const;
+    void PostMessageToContexts(const int64_t* ContextIds, const csp::common::String* CallbackNames, size_t Count, const csp::common::String& Message,
+        const csp::common::String& MessageParamsJson, double Value) override;
+    bool ResolveCallback(int64_t ContextId, const csp::common::String& CallbackName) override;
+    bool InvokeCallback(int64_t ContextId, const csp::common::String& CallbackName, const csp::common::String& Message,
+        const csp::common::String& MessageParamsJson) override;
     CSP_END_IGNORE
 
 private:
@@ -24,6 +24,7 @@
 #include "CSP/Systems/ServiceStatus.h"
 #include "CSP/Systems/SystemsManager.h"
 #include "CSP/version.h"
+#include "Common/TaskExecutor.h"
 #include "Common/UUIDGenerator.h"
 #include "Common/Wrappers.h"
 #include "Debug/Logging.h"
@@ -511,6 +512,7 @@ bool CSPFoundation::Shutdown()
     csp::events::EventSystem::Get().ProcessEvents();
     csp::events::EventSystem::Get().UnRegisterAllListeners();
     csp::systems::SystemsManager::Destroy();
+    csp::DestroyDecodeExecutor();
 
     delete (Tenant);
     delete (Endpoints);
@@ -605,6 +607,17 @@ csp::common::String CSPFoundation::GetFeatureFlagDescription(EFeatureFlag Flag)
     }
 }
 
+void CSPFoundation::StartProfiling() { csp::profile::Profiler::Start(); }
+
+void CSPFoundation::StopProfiling() { csp::profile::Profiler::Stop(); }
+
+csp::common::String CSPFoundation::ExportProfilingTrace()
+{
+    const std::string Trace = csp::profile::Profiler::ExportChromeTrace();
+
+    return csp::common::String(Trace.c_str(), Trace.size());
+}
+
 void CSPFoundation::__AddFeatureFlagForTesting(EFeatureFlag Type, bool IsEnabled, const csp::common::String Description)
 {
     csp::common::Array<FeatureFlag> NewFeatureFlags(FeatureFlags.Size() + 1);
@@ -15,9 +15,230 @@
  */
 #include "Common/Scheduler.h"
 
+#include <algorithm>
+#include <assert.h>
+
 namespace csp
 {
 
+namespace
+{
+
+// Once cancelled entries outnumber live ones by this factor (and there are enough of them to matter), the heap is rebuilt.
+constexpr size_t StaleEntryCompactionFactor = 2;
+constexpr size_t StaleEntryCompactionMinimum = 64;
+
+} // namespace
+
+Scheduler::Scheduler(size_t InWorkerCount)
+    : StaleEntryCount(0)
+    , SequenceCounter(0)
+    , Thread(nullptr)
+    , Workers(nullptr)
+    , WorkerCount(std::max<size_t>(InWorkerCount, 1))
+    , IdCounter(1)
+    , ShouldExit(false)
+{
+}
+
+Scheduler::~Scheduler() { Shutdown(); }
+
+void Scheduler::Initialise()
+{
+    assert(Thread == nullptr);
+
+    {
+        std::scoped_lock<std::mutex> Locker(Mutex);
+        ShouldExit = false;
+    }
+
+    Workers = std::make_unique<TaskExecutor>(WorkerCount);
+    Thread = std::make_unique<std::thread>([this]() { ThreadLoop(); });
+}
+
+void Scheduler::Shutdown()
+{
+    if (Thread == nullptr)
+    {
+        return;
+    }
+
+    {
+        std::scoped_lock<std::mutex> Locker(Mutex);
+        ShouldExit = true;
+    }
+
+    WakeCondition.notify_all();
+    Thread->join();
+    Thread = nullptr;
+
+    // Lets any tasks that have already been handed to the workers finish before we tear them down.
+    Workers->Shutdown();
+    Workers = nullptr;
+}
+
+ScheduledTaskId Scheduler::ScheduleAt(const std::chrono::system_clock::time_point& Time, std::function<void()> Func)
+{
+    return AddTask(ToSteadyTime(Time), Clock::duration::zero(), std::move(Func));
+}
+
+ScheduledTaskId Scheduler::ScheduleAt(const csp::common::DateTime& Time, std::function<void()> Func)
+{
+    return ScheduleAt(Time.GetTimePoint(), std::move(Func));
+}
+
+ScheduledTaskId Scheduler::ScheduleEvery(std::chrono::system_clock::duration Interval, std::function<void()> Func)
+{
+    const auto SteadyInterval = std::chrono::duration_cast<Clock::duration>(Interval);
+
+    return AddTask(Clock::now() + SteadyInterval, SteadyInterval, std::move(Func));
+}
+
+void Scheduler::CancelTask(ScheduledTaskId Id)
+{
+    std::scoped_lock<std::mutex> Locker(Mutex);
+
+    auto It = Tasks.find(Id);
+
+    if (It == Tasks.end())
+    {
+        return;
+    }
+
+    const bool Queued = It->second.Queued;
+    Tasks.erase(It);
+
+    if (Queued)
+    {
+        ++StaleEntryCount;
+        CompactHeapIfNeeded();
+    }
+}
+
+size_t Scheduler::GetPendingTaskCount() const
+{
+    std::scoped_lock<std::mutex> Locker(Mutex);
+
+    return Tasks.size();
+}
+
+ScheduledTaskId Scheduler::AddTask(Clock::time_point Deadline, Clock::duration Interval, std::function<void()>&& Func)
+{
+    const ScheduledTaskId Id = IdCounter++;
+
+    std::scoped_lock<std::mutex> Locker(Mutex);
+
+    auto It = Tasks.emplace(Id, ScheduledTask { std::make_shared<std::function<void()>>(std::move(Func)), Interval, false }).first;
+    PushEntry(Deadline, Id, It->second);
+
+    return Id;
+}
+
+void Scheduler::PushEntry(Clock::time_point Deadline, ScheduledTaskId Id, ScheduledTask& Task)
+{
+    Task.Queued = true;
+    Heap.push_back(HeapEntry { Deadline, SequenceCounter++, Id });
+    std::push_heap(Heap.begin(), Heap.end(), std::greater<HeapEntry>());
+
+    // The timer thread only needs waking if it's now sleeping past the earliest deadline.
+    if (Heap.front().Id == Id)
+    {
+        WakeCondition.notify_one();
+    }
+}
+
+void Scheduler::CompactHeapIfNeeded()
+{
+    const size_t LiveEntryCount = Heap.size() - StaleEntryCount;
+
+    if (StaleEntryCount < StaleEntryCompactionMinimum || StaleEntryCount < LiveEntryCount * StaleEntryCompactionFactor)
+    {
+        return;
+    }
+
+    Heap.erase(std::remove_if(Heap.begin(), Heap.end(), [this](const HeapEntry& Entry) { return Tasks.count(Entry.Id) == 0; }), Heap.end());
+    std::make_heap(Heap.begin(), Heap.end(), std::greater<HeapEntry>());
+
+    StaleEntryCount = 0;
+}
+
+void Scheduler::Dispatch(ScheduledTaskId Id, std::shared_ptr<std::function<void()>> Func, bool Repeating)
+{
+    Workers->Enqueue(
+        [this, Id, Func = std::move(Func), Repeating]()
+        {
+            (*Func)();
+
+            if (Repeating)
+            {
+                std::scoped_lock<std::mutex> Locker(Mutex);
+
+                // Only reschedule if the task wasn't cancelled while it was running.
+                if (auto It = Tasks.find(Id); It != Tasks.end() && ShouldExit == false)
+                {
+                    PushEntry(Clock::now() + It->second.Interval, Id, It->second);
+                }
+            }
+        });
+}
+
+void Scheduler::ThreadLoop()
+{
+    std::unique_lock<std::mutex> Lock(Mutex);
+
+    while (ShouldExit == false)
+    {
+        if (Heap.empty())
+        {
+            WakeCondition.wait(Lock, [this]() { return ShouldExit || Heap.empty() == false; });
+            continue;
+        }
+
+        const Clock::time_point NextDeadline = Heap.front().Deadline;
+
+        if (Clock::now() < NextDeadline)
+        {
+            // Woken either by the deadline passing, or by an earlier task being pushed. Either way we re-evaluate the front.
+            WakeCondition.wait_until(Lock, NextDeadline);
+            continue;
+        }
+
+        std::pop_heap(Heap.begin(), Heap.end(), std::greater<HeapEntry>());
+        const ScheduledTaskId Id = Heap.back().Id;
+        Heap.pop_back();
+
+        auto It = Tasks.find(Id);
+
+        if (It == Tasks.end())
+        {
+            // Cancelled after it was scheduled.
+            --StaleEntryCount;
+            continue;
+        }
+
+        It->second.Queued = false;
+
+        const bool Repeating = It->second.Interval > Clock::duration::zero();
+        std::shared_ptr<std::function<void()>> Func = It->second.Func;
+
+        // One-shot tasks are done with once they're dispatched. Repeating ones stay live and are re-pushed when the run completes.
+        if (Repeating == false)
+        {
+            Tasks.erase(It);
+        }
+
+        Lock.unlock();
+        Dispatch(Id, std::move(Func), Repeating);
+        Lock.lock();
+    }
+}
+
+Scheduler::Clock::time_point Scheduler::ToSteadyTime(const std::chrono::system_clock::time_point& Time)
+{
+    // Deadlines are tracked against the steady clock so that wall clock adjustments don't cause tasks to fire early or late.
+    return Clock::now() + std::chrono::duration_cast<Clock::duration>(Time - std::chrono::system_clock::now());
+}
+
 static Scheduler* SchedulerPtr = nullptr;
 
 Scheduler* GetScheduler()
@@ -16,169 +16,100 @@
 #pragma once
 
 #include "Common/DateTime.h"
+#include "Common/TaskExecutor.h"
 
-#include <assert.h>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <functional>
-#include <future>
-#include <list>
 #include <memory>
-#include <queue>
-#include <sstream>
+#include <mutex>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace csp
 {
 
 using ScheduledTaskId = uint32_t;
 
-struct FunctionTimer
-{
-    std::function<void()> Func;
-    std::chrono::system_clock::time_point Time;
-    ScheduledTaskId Id;
-
-    FunctionTimer() { }
-
-    FunctionTimer(std::function<void()>&& InFunc, const std::chrono::system_clock::time_point& InTime, ScheduledTaskId InId)
-        : Func(InFunc)
-        , Time(InTime)
-        , Id(InId)
-    {
-    }
-
-    bool operator<(const FunctionTimer& Rhs) const { return Time > Rhs.Time; }
-
-    bool operator==(const FunctionTimer& Rhs) const { return Id == Rhs.Id; }
-
-    void Get() { Func(); }
-
-    void operator()() { Func(); }
+/*
+    Runs functions at a point in time, or repeatedly on an interval.
 
-    uint32_t GetId() const { return Id; }
-};
+    Pending tasks are kept in a min-heap ordered by deadline. A single timer thread sleeps on a condition variable until the
+    earliest deadline (or until an earlier task is scheduled), and hands fired tasks to a fixed size worker pool, so a burst of
+    timers firing together never spins up more than WorkerCount threads.
 
+    Cancellation just drops the task from the live task map. Its heap entry is left in place and skipped when it reaches the
+    front, with the heap being compacted if cancelled entries start to dominate it.
+*/
 class Scheduler
 {
 public:
-    Scheduler()
-        : Thread(nullptr)
-        , IdCounter(1)
-        , ShouldExit(false)
-    {
-    }
+    static constexpr size_t DefaultWorkerCount = 4;
 
-    ~Scheduler() { Shutdown(); }
+    explicit Scheduler(size_t InWorkerCount = DefaultWorkerCount);
+    ~Scheduler();
 
-    void Initialise()
-    {
-        assert(Thread == nullptr);
-        ShouldExit = false;
-        Thread = new std::thread([this]() { ThreadLoop(); });
-    }
+    void Initialise();
+    void Shutdown();
 
-    void Shutdown()
-    {
-        if (Thread != nullptr)
-        {
-            ShouldExit = true;
-            Thread->join();
-            delete (Thread);
-            Thread = nullptr;
-        }
-    }
-
-    ScheduledTaskId ScheduleAt(const std::chrono::system_clock::time_point& Time, std::function<void()> Func)
-    {
-        std::function<void()> threadFunc = [Func]()
-        {
-            std::thread Thread(Func);
-            Thread.detach();
-        };
+    ScheduledTaskId ScheduleAt(const std::chrono::system_clock::time_point& Time, std::function<void()> Func);
+    ScheduledTaskId ScheduleAt(const csp::common::DateTime& Time, std::function<void()> Func);
 
-        return ScheduleAtIntern(Time, std::move(threadFunc));
-    }
+    // Runs Func every Interval. The next run is scheduled once the previous one has finished, so runs of the same task never overlap.
+    ScheduledTaskId ScheduleEvery(std::chrono::system_clock::duration Interval, std::function<void()> Func);
 
-    void ScheduleEvery(std::chrono::system_clock::duration Interval, std::function<void()> Func)
-    {
-        std::function<void()> threadFunc = [Func]()
-        {
-            std::thread Thread(Func);
-            Thread.detach();
-        };
+    // Stops a task from running. If it is already executing it is allowed to finish, but a repeating task will not run again.
+    void CancelTask(ScheduledTaskId Id);
 
-        this->ScheduleEveryIntern(Interval, threadFunc);
-    }
+    // Number of tasks that are scheduled and have not yet been run or cancelled. Repeating tasks count until cancelled.
+    size_t GetPendingTaskCount() const;
 
-    ScheduledTaskId ScheduleAt(const csp::common::DateTime& Time, std::function<void()> Func)
-    {
-        return ScheduleAt(Time.GetTimePoint(), std::move(Func));
-    }
+private:
+    using Clock = std::chrono::steady_clock;
 
-    void CancelTask(ScheduledTaskId Id)
+    struct ScheduledTask
     {
-        std::scoped_lock<std::mutex> ListLocker(ListLock);
-
-        auto it = std::remove_if(Tasks.begin(), Tasks.end(), [Id](const FunctionTimer& Func) { return Func.Id == Id; });
-
-        Tasks.erase(it, Tasks.end());
-    }
+        std::shared_ptr<std::function<void()>> Func;
+        Clock::duration Interval;
+        // Whether the task currently has an entry in the heap. Repeating tasks don't while they are running.
+        bool Queued;
+    };
 
-private:
-    ScheduledTaskId ScheduleAtIntern(const std::chrono::system_clock::time_point& Time, std::function<void()>&& Func)
+    struct HeapEntry
     {
-        ScheduledTaskId Id = IdCounter++;
-
-        {
-            std::scoped_lock<std::mutex> ListLocker(ListLock);
-            Tasks.push_back(FunctionTimer(std::move(Func), Time, Id));
-            Tasks.sort();
-        }
-
-        return Id;
-    }
+        Clock::time_point Deadline;
+        // Tie breaker so tasks with equal deadlines run in the order they were scheduled.
+        uint64_t Sequence;
+        ScheduledTaskId Id;
 
-    void ScheduleEveryIntern(std::chrono::system_clock::duration Interval, std::function<void()> Func)
-    {
-        std::function<void()> waitFunc = [this, Interval, Func]()
-        {
-            Func();
-            this->ScheduleEveryIntern(Interval, Func);
-        };
+        bool operator>(const HeapEntry& Rhs) const { return Deadline != Rhs.Deadline ? Deadline > Rhs.Deadline : Sequence > Rhs.Sequence; }
+    };
 
-        ScheduleAtIntern(std::chrono::system_clock::now() + Interval, std::move(waitFunc));
-    }
+    ScheduledTaskId AddTask(Clock::time_point Deadline, Clock::duration Interval, std::function<void()>&& Func);
 
-    void ThreadLoop()
-    {
-        while (!ShouldExit)
-        {
-            {
-                std::scoped_lock<std::mutex> ListLocker(ListLock);
+    // Pushes a heap entry for the task and wakes the timer thread if it is now the earliest. Expects Mutex to be held.
+    void PushEntry(Clock::time_point Deadline, ScheduledTaskId Id, ScheduledTask& Task);
+    void CompactHeapIfNeeded();
 
-                auto now = std::chrono::system_clock::now();
+    void Dispatch(ScheduledTaskId Id, std::shared_ptr<std::function<void()>> Func, bool Repeating);
+    void ThreadLoop();
 
-                if (Tasks.size() > 0 && Tasks.front().Time <= now)
-                {
-                    FunctionTimer Func;
+    static Clock::time_point ToSteadyTime(const std::chrono::system_clock::time_point& Time);
 
-                    {
-                        Func = Tasks.front();
-                        Tasks.pop_front();
-                    }
+    mutable std::mutex Mutex;
+    std::condition_variable WakeCondition;
 
-                    Func.Get();
-                }
-            }
+    std::vector<HeapEntry> Heap;
+    std::unordered_map<ScheduledTaskId, ScheduledTask> Tasks;
+    size_t StaleEntryCount;
+    uint64_t SequenceCounter;
 
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
-        }
-    }
+    std::unique_ptr<std::thread> Thread;
+    std::unique_ptr<TaskExecutor> Workers;
+    size_t WorkerCount;
 
-private:
-    std::mutex ListLock;
-    std::list<FunctionTimer> Tasks;
-    std::thread* Thread;
     std::atomic_uint32_t IdCounter;
     bool ShouldExit;
 
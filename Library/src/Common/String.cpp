@@ -26,256 +26,237 @@ namespace csp::common
                 Custom string class that we can use safely across a DLL boundary
  */
 
-/// @brief Internal implementation for DLL safe string class
-class String::Impl
+namespace
 {
-public:
-    ~Impl() { delete[] Text; }
 
-    explicit Impl(char const* const InText)
-        : Text(nullptr)
-        , Length(0)
-    {
-        const char* _InText = InText;
+// Growth policy for appends. Doubling keeps repeated Append calls amortised O(1) rather than reallocating every time.
+size_t GrowCapacity(size_t CurrentCapacity, size_t RequiredCapacity)
+{
+    return RequiredCapacity <= CurrentCapacity ? CurrentCapacity : std::max(RequiredCapacity, CurrentCapacity * 2);
+}
 
-        if (InText == nullptr)
-        {
-            _InText = "";
-        }
+} // namespace
 
-        const size_t Len = strlen(_InText);
+String::String()
+    : Text(InlineText)
+    , TextLength(0)
+    , TextCapacity(InlineCapacity)
+{
+    InlineText[0] = '\0';
+}
 
-        char* NewText = new char[Len + 1];
+String::String(char const* const InText, size_t Length)
+    : String()
+{
+    if (InText == nullptr || Length == 0)
+    {
+        return;
+    }
 
-        if (Len > 0)
-        {
-            memcpy((void*)NewText, _InText, Len * sizeof(char));
-        }
+    Assign(InText, Length);
+}
 
-        NewText[Len] = 0;
+String::String(size_t Length)
+    : String()
+{
+    Reserve(Length);
 
-        Text = NewText;
-        Length = Len;
-    }
+    Text[Length] = '\0';
+    TextLength = Length;
+}
 
-    Impl(char const* const InText, size_t Len)
-        : Text(nullptr)
-        , Length(0)
+String::String(const char* InText)
+    : String()
+{
+    if (InText == nullptr)
     {
-        const char* _InText = InText;
+        return;
+    }
 
-        if (InText == nullptr || Len == 0)
-        {
-            _InText = "";
-            Len = 0;
-        }
+    Assign(InText, strlen(InText));
+}
 
-        char* NewText = new char[Len + 1];
+String::String(String const& Other)
+    : String()
+{
+    Assign(Other.Text, Other.TextLength);
+}
 
-        if (Len > 0)
-        {
-            memcpy((void*)NewText, _InText, Len * sizeof(char));
-        }
+String::String(String&& Other)
+    : String()
+{
+    *this = std::move(Other);
+}
 
-        NewText[Len] = 0;
+String::~String() { Reset(); }
 
-        Text = NewText;
-        Length = Len;
-    }
+void String::Assign(const char* Source, size_t SourceLength)
+{
+    Reserve(SourceLength);
 
-    explicit Impl(size_t Len)
-        : Text(nullptr)
-        , Length(0)
+    if (SourceLength > 0)
     {
-        char* NewText = new char[Len + 1];
-
-        NewText[Len] = 0;
-        Text = NewText;
-        Length = Len;
+        memcpy(Text, Source, SourceLength);
     }
 
-    Impl* Clone() const { return new Impl(Text, Length); }
+    Text[SourceLength] = '\0';
+    TextLength = SourceLength;
+}
 
-    inline void Append(const char* Other, size_t OtherLength)
+void String::Reserve(size_t NewCapacity)
+{
+    if (NewCapacity <= TextCapacity)
     {
-        if (Other == nullptr || OtherLength == 0)
-        {
-            return;
-        }
+        return;
+    }
 
-        auto NewLength = Length + OtherLength;
-        auto NewText = new char[NewLength + 1];
-        memcpy(NewText, Text, Length);
-        memcpy(NewText + Length, Other, OtherLength);
-        NewText[NewLength] = '\0';
+    char* NewText = new char[NewCapacity + 1];
+    memcpy(NewText, Text, TextLength + 1);
 
+    if (!IsInline())
+    {
         delete[] Text;
-        Text = NewText;
-        Length = NewLength;
     }
 
-    void Append(const Impl& Other) { Append(Other.Text, Other.Length); }
+    Text = NewText;
+    TextCapacity = NewCapacity;
+}
 
-    void Append(const char* Other)
+void String::Reset()
+{
+    if (!IsInline())
     {
-        if (Other == nullptr)
-        {
-            return;
-        }
-
-        auto OtherLength = strlen(Other);
-        Append(Other, OtherLength);
+        delete[] Text;
     }
 
-    List<String> Split(char Separator)
-    {
-        List<String> Parts;
+    Text = InlineText;
+    TextLength = 0;
+    TextCapacity = InlineCapacity;
+    InlineText[0] = '\0';
+}
 
-        // NOTE: Don't use strtok here because it ignores empty entries!
-        auto Index = strchr(Text, Separator);
+bool String::IsInline() const { return Text == InlineText; }
 
-        if (Index == nullptr)
-        {
-            Parts.Append(Text);
+List<String> String::Split(char Separator) const
+{
+    List<String> Parts;
 
-            return Parts;
-        }
+    const char* Start = Text;
+    const char* End = Text + TextLength;
 
-        auto Start = Text;
+    // NOTE: Don't use strtok here because it ignores empty entries!
+    for (;;)
+    {
+        auto Index = static_cast<const char*>(memchr(Start, Separator, End - Start));
 
-        for (;;)
+        if (Index == nullptr)
         {
-            Parts.Append(String(Start, Index - Start));
-            Start = Index + 1;
-            Index = strchr(Start, Separator);
-
-            // Also look for null-terminator
-            if (Index == nullptr)
-            {
-                Index = strchr(Start, '\0');
-                Parts.Append(String(Start, Index - Start));
-                break;
-            }
+            Parts.Append(String(Start, End - Start));
+            break;
         }
 
-        return Parts;
+        Parts.Append(String(Start, Index - Start));
+        Start = Index + 1;
     }
 
-    char* Text;
-    size_t Length;
-};
-
-String::String()
-    : ImplPtr(new Impl(""))
-{
+    return Parts;
 }
 
-String::String(char const* const Text, size_t Length)
-    : ImplPtr(new Impl(Text, Length))
-{
-}
-
-String::String(size_t Length)
-    : ImplPtr(new Impl(Length))
-{
-}
-
-String::String(const char* Text)
-    : ImplPtr(new Impl(Text))
-{
-}
-
-String::String(String const& Other)
-    : ImplPtr(Other.ImplPtr->Clone())
-{
-}
-
-String::String(String&& Other)
-{
-    ImplPtr = Other.ImplPtr;
-    Other.ImplPtr = nullptr;
-}
-
-List<String> String::Split(char Separator) const { return ImplPtr->Split(Separator); }
-
 String& String::swap(String& Other)
 {
-    std::swap(ImplPtr, Other.ImplPtr);
+    String Temp(std::move(Other));
+    Other = std::move(*this);
+    *this = std::move(Temp);
+
     return *this;
 }
 
 String& String::operator=(const String& Rhs)
 {
-    if (ImplPtr != nullptr)
+    if (this != &Rhs)
     {
-        delete (ImplPtr);
+        // Reuses our existing buffer if it's big enough.
+        Assign(Rhs.Text, Rhs.TextLength);
     }
 
-    ImplPtr = Rhs.ImplPtr->Clone();
     return *this;
 }
 
 String& String::operator=(String&& Rhs)
 {
-    if (ImplPtr != nullptr)
+    if (this == &Rhs)
+    {
+        return *this;
+    }
+
+    if (Rhs.IsInline())
     {
-        delete (ImplPtr);
+        Assign(Rhs.Text, Rhs.TextLength);
     }
+    else
+    {
+        Reset();
+
+        Text = Rhs.Text;
+        TextLength = Rhs.TextLength;
+        TextCapacity = Rhs.TextCapacity;
+
+        Rhs.Text = Rhs.InlineText;
+    }
+
+    Rhs.Reset();
 
-    ImplPtr = Rhs.ImplPtr;
-    Rhs.ImplPtr = nullptr;
     return *this;
 }
 
-String& String::operator=(char const* const Text)
+String& String::operator=(char const* const InText)
 {
-    if (ImplPtr != nullptr)
+    if (InText == nullptr)
     {
-        delete (ImplPtr);
+        Assign("", 0);
+    }
+    else if (InText >= Text && InText <= Text + TextLength)
+    {
+        // Assigning from our own buffer, take a copy first as Assign may reallocate.
+        String Copy(InText);
+        *this = std::move(Copy);
+    }
+    else
+    {
+        Assign(InText, strlen(InText));
     }
 
-    ImplPtr = new Impl(Text);
     return *this;
 }
 
-const char* String::Get() const { return ImplPtr->Text; }
+const char* String::Get() const { return Text; }
 
-size_t String::Length() const { return ImplPtr->Length; }
+size_t String::Length() const { return TextLength; }
 
-size_t String::AllocatedMemorySize() const { return ImplPtr->Length + 1; }
+size_t String::AllocatedMemorySize() const { return TextLength + 1; }
 
-bool String::IsEmpty() const { return ImplPtr->Length == 0; }
+bool String::IsEmpty() const { return TextLength == 0; }
 
 bool String::operator==(const String& Other) const
 {
-    if (ImplPtr->Length == 0 && Other.Length() == 0)
-    {
-        return true;
-    }
-
-    if (ImplPtr->Length == 0 || Other.Length() == 0)
+    if (TextLength != Other.TextLength)
     {
         return false;
     }
 
-    return strcmp(Get(), Other.Get()) == 0;
+    return memcmp(Text, Other.Text, TextLength) == 0;
 }
 
 bool String::operator==(const char* Other) const
 {
     auto OtherLength = strlen(Other);
 
-    if (ImplPtr->Length == 0 && OtherLength == 0)
-    {
-        return true;
-    }
-
-    if (ImplPtr->Length == 0 || OtherLength == 0)
+    if (TextLength != OtherLength)
     {
         return false;
     }
 
-    return strcmp(Get(), Other) == 0;
+    return memcmp(Text, Other, TextLength) == 0;
 }
 
 bool String::operator!=(const String& Other) const { return !(*this == Other); }
@@ -284,17 +265,58 @@ bool String::operator!=(const char* Other) const { return !(*this == Other); }
 
 bool String::operator<(const String& Other) const { return strcmp(Get(), Other.Get()) < 0; }
 
-String::~String()
+void String::Append(const String& Other)
 {
-    if (ImplPtr != nullptr)
+    if (Other.TextLength == 0)
     {
-        delete (ImplPtr);
+        return;
     }
+
+    if (&Other == this)
+    {
+        String Copy(Other);
+        Append(Copy);
+
+        return;
+    }
+
+    const size_t NewLength = TextLength + Other.TextLength;
+    Reserve(GrowCapacity(TextCapacity, NewLength));
+
+    memcpy(Text + TextLength, Other.Text, Other.TextLength);
+    Text[NewLength] = '\0';
+    TextLength = NewLength;
 }
 
-void String::Append(const String& Other) { ImplPtr->Append(*Other.ImplPtr); }
+void String::Append(const char* Other)
+{
+    if (Other == nullptr)
+    {
+        return;
+    }
+
+    const size_t OtherLength = strlen(Other);
+
+    if (OtherLength == 0)
+    {
+        return;
+    }
+
+    if (Other >= Text && Other <= Text + TextLength)
+    {
+        // Appending part of ourselves, which Reserve may be about to free.
+        Append(String(Other, OtherLength));
 
-void String::Append(const char* Other) { ImplPtr->Append(Other); }
+        return;
+    }
+
+    const size_t NewLength = TextLength + OtherLength;
+    Reserve(GrowCapacity(TextCapacity, NewLength));
+
+    memcpy(Text + TextLength, Other, OtherLength);
+    Text[NewLength] = '\0';
+    TextLength = NewLength;
+}
 
 String& String::operator+=(const String& Other)
 {
@@ -314,44 +336,44 @@ String String::Trim() const
 {
     static char Whitespace[] = { ' ', '\r', '\n', '\t' };
 
-    auto Length = ImplPtr->Length;
-    auto Text = ImplPtr->Text;
+    auto TrimmedLength = TextLength;
+    auto TrimmedText = Text;
 
     // Trim leading whitespace
-    while (Length > 0)
+    while (TrimmedLength > 0)
     {
-        auto IsWhitespace = std::find(std::begin(Whitespace), std::end(Whitespace), Text[0]) != std::end(Whitespace);
+        auto IsWhitespace = std::find(std::begin(Whitespace), std::end(Whitespace), TrimmedText[0]) != std::end(Whitespace);
 
         if (!IsWhitespace)
             break;
 
-        ++Text;
-        --Length;
+        ++TrimmedText;
+        --TrimmedLength;
     }
 
     // Trim trailing whitespace
-    while (Length > 0)
+    while (TrimmedLength > 0)
     {
-        auto IsWhitespace = std::find(std::begin(Whitespace), std::end(Whitespace), Text[Length - 1]) != std::end(Whitespace);
+        auto IsWhitespace = std::find(std::begin(Whitespace), std::end(Whitespace), TrimmedText[TrimmedLength - 1]) != std::end(Whitespace);
 
         if (!IsWhitespace)
             break;
 
-        --Length;
+        --TrimmedLength;
     }
 
-    return String(Text, Length);
+    return String(TrimmedText, TrimmedLength);
 }
 
 String String::ToLower() const
 {
     String Copy = *this;
-    auto Length = Copy.ImplPtr->Length;
-    auto Text = Copy.ImplPtr->Text;
+    auto LowerLength = Copy.TextLength;
+    auto LowerText = Copy.Text;
 
-    for (size_t i = 0; i < Length; ++i)
+    for (size_t i = 0; i < LowerLength; ++i)
     {
-        Text[i] = static_cast<char>(std::tolower(Text[i]));
+        LowerText[i] = static_cast<char>(std::tolower(LowerText[i]));
     }
 
     return Copy;
@@ -423,7 +445,7 @@ bool String::Contains(const String& Substring) const
 
 bool String::StartsWith(const String& Prefix) const
 {
-    if (Prefix.Length() == 0 || Prefix.Length() > ImplPtr->Length)
+    if (Prefix.Length() == 0 || Prefix.Length() > TextLength)
     {
         return false;
     }
@@ -433,26 +455,26 @@ bool String::StartsWith(const String& Prefix) const
 
 bool String::EndsWith(const String& Postfix) const
 {
-    if (Postfix.Length() == 0 || Postfix.Length() > ImplPtr->Length)
+    if (Postfix.Length() == 0 || Postfix.Length() > TextLength)
     {
         return false;
     }
 
-    return std::memcmp(Get() + (ImplPtr->Length - Postfix.Length()), Postfix.Get(), Postfix.Length()) == 0;
+    return std::memcmp(Get() + (TextLength - Postfix.Length()), Postfix.Get(), Postfix.Length()) == 0;
 }
 
 String String::SubString(size_t Offset, Optional<size_t> Length)
 {
-    if (Offset >= ImplPtr->Length)
+    if (Offset >= TextLength)
     {
         return "";
     }
 
-    size_t MaxSubStringLength = ImplPtr->Length - Offset;
+    size_t MaxSubStringLength = TextLength - Offset;
 
     size_t SubstringLength = Length.HasValue() ? std::min(*Length, MaxSubStringLength) : MaxSubStringLength;
 
-    return String(ImplPtr->Text + Offset, SubstringLength);
+    return String(Text + Offset, SubstringLength);
 }
 
 String String::Join(const std::initializer_list<String>& Parts, Optional<char> Separator)
@@ -0,0 +1,186 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Common/Systems/Log/AsyncLogSink.h"
+
+#include "CSP/Common/Systems/Log/LogSystem.h"
+
+#if defined(_MSC_VER)
+// atomic_queue deliberately aligns its members to cache lines, don't warn about the resulting padding.
+#pragma warning(disable : 4324)
+#endif
+
+#include <atomic_queue/atomic_queue.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace csp::common
+{
+
+namespace
+{
+
+// The sink is woken explicitly when a message is queued while it sleeps. This is only a backstop in case a wake is missed.
+constexpr std::chrono::milliseconds SINK_IDLE_WAIT { 100 };
+
+} // namespace
+
+class AsyncLogSink::Impl
+{
+public:
+    Impl(LogSystem& InLogSystem, uint32_t Capacity)
+        : Log(InLogSystem)
+        , Queue(Capacity)
+    {
+        Thread = std::thread([this]() { Run(); });
+    }
+
+    ~Impl()
+    {
+        {
+            std::scoped_lock<std::mutex> Lock(Mutex);
+            Stopping.store(true);
+        }
+
+        WakeCondition.notify_one();
+        Thread.join();
+    }
+
+    void Enqueue(LogLevel Level, FormatFunction Format)
+    {
+        Record NewRecord { Level, std::move(Format) };
+
+        if (Queue.try_push(std::move(NewRecord)) == false)
+        {
+            // Don't block the caller, and don't drop the message. It will just be out of order with anything still queued.
+            Log.LogMsg(NewRecord.Level, NewRecord.Format());
+            return;
+        }
+
+        QueuedCount.fetch_add(1);
+
+        // Pairs with the sink storing Sleeping before it checks the queue, so either it sees this message or we see it sleeping.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (Sleeping.load())
+        {
+            std::scoped_lock<std::mutex> Lock(Mutex);
+            WakeCondition.notify_one();
+        }
+    }
+
+    void Flush()
+    {
+        const uint64_t Target = QueuedCount.load();
+
+        if (LoggedCount.load() >= Target)
+        {
+            return;
+        }
+
+        FlushWaiters.fetch_add(1);
+
+        {
+            std::unique_lock<std::mutex> Lock(Mutex);
+            WakeCondition.notify_one();
+            FlushedCondition.wait(Lock, [this, Target]() { return LoggedCount.load() >= Target; });
+        }
+
+        FlushWaiters.fetch_sub(1);
+    }
+
+private:
+    struct Record
+    {
+        LogLevel Level = LogLevel::NoLogging;
+        FormatFunction Format;
+    };
+
+    void Run()
+    {
+        Record Next;
+
+        while (true)
+        {
+            if (Queue.try_pop(Next))
+            {
+                Log.LogMsg(Next.Level, Next.Format());
+                Next.Format = nullptr;
+
+                LoggedCount.fetch_add(1);
+
+                if (FlushWaiters.load() > 0)
+                {
+                    std::scoped_lock<std::mutex> Lock(Mutex);
+                    FlushedCondition.notify_all();
+                }
+
+                continue;
+            }
+
+            std::unique_lock<std::mutex> Lock(Mutex);
+
+            if (Stopping.load())
+            {
+                // Producers have stopped by the time we're destroyed, so an empty queue here means everything has been logged.
+                if (Queue.was_empty())
+                {
+                    break;
+                }
+
+                continue;
+            }
+
+            Sleeping.store(true);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            WakeCondition.wait_for(Lock, SINK_IDLE_WAIT, [this]() { return Queue.was_empty() == false || Stopping.load(); });
+
+            Sleeping.store(false);
+        }
+    }
+
+    LogSystem& Log;
+    atomic_queue::AtomicQueueB2<Record> Queue;
+
+    std::atomic<uint64_t> QueuedCount { 0 };
+    std::atomic<uint64_t> LoggedCount { 0 };
+    std::atomic<uint32_t> FlushWaiters { 0 };
+    std::atomic<bool> Sleeping { false };
+    std::atomic<bool> Stopping { false };
+
+    std::mutex Mutex;
+    std::condition_variable WakeCondition;
+    std::condition_variable FlushedCondition;
+    std::thread Thread;
+};
+
+AsyncLogSink::AsyncLogSink(LogSystem& InLogSystem, uint32_t Capacity)
+    : SinkImpl(std::make_unique<Impl>(InLogSystem, Capacity))
+{
+}
+
+AsyncLogSink::~AsyncLogSink() = default;
+
+void AsyncLogSink::Enqueue(LogLevel Level, FormatFunction Format) { SinkImpl->Enqueue(Level, std::move(Format)); }
+
+void AsyncLogSink::Flush() { SinkImpl->Flush(); }
+
+} // namespace csp::common
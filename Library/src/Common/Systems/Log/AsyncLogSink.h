@@ -0,0 +1,66 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CSP/Common/String.h"
+#include "CSP/Common/Systems/Log/LogLevels.h"
+
+#include <functional>
+#include <memory>
+
+namespace csp::common
+{
+
+class LogSystem;
+
+/// @brief Formats and delivers log messages on a background thread, so that the thread doing the logging only pays for queueing them.
+///
+/// Messages are queued as a level and a function that produces the text, and are handed to LogSystem::LogMsg in the order they were
+/// queued. Queueing never blocks: if the queue is full the message is formatted and logged on the calling thread instead.
+/// Log callbacks registered with the LogSystem will be called from the sink's thread.
+class AsyncLogSink
+{
+public:
+    using FormatFunction = std::function<csp::common::String()>;
+
+    /// @brief Starts the sink's thread.
+    /// @param InLogSystem LogSystem& : The log system that formatted messages are passed to. Must outlive the sink.
+    /// @param Capacity uint32_t : The number of messages that can be queued before falling back to logging on the calling thread.
+    explicit AsyncLogSink(LogSystem& InLogSystem, uint32_t Capacity = DEFAULT_CAPACITY);
+
+    /// @brief Logs anything still queued, then stops the sink's thread.
+    ~AsyncLogSink();
+
+    AsyncLogSink(const AsyncLogSink&) = delete;
+    AsyncLogSink& operator=(const AsyncLogSink&) = delete;
+
+    /// @brief Queues a message to be formatted and logged on the sink's thread. Safe to call from any thread.
+    /// @param Level LogLevel : The level to log the message at.
+    /// @param Format FormatFunction : Produces the message text. Must only reference data it owns.
+    void Enqueue(LogLevel Level, FormatFunction Format);
+
+    /// @brief Blocks until every message queued before the call has been logged.
+    void Flush();
+
+    static constexpr uint32_t DEFAULT_CAPACITY = 4096;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> SinkImpl;
+};
+
+} // namespace csp::common
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CSP/Common/String.h"
+#include "CSP/Common/Systems/Log/LogLevels.h"
+#include "CSP/Common/Systems/Log/LogSystem.h"
+#include "CSP/Common/fmt_Formatters.h"
+#include "Common/Systems/Log/AsyncLogSink.h"
+
+#include <fmt/format.h>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/*
+ * Level gated, deferred logging for code that is handed a LogSystem rather than going through the SystemsManager.
+ *
+ *   CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Verbose, "Entity {} moved to {}", Entity->GetId(), Position);
+ *
+ * The log system may be passed as a pointer (which may be null) or a reference. None of the format arguments are evaluated unless the
+ * level is enabled, so it is safe to pass arguments that are expensive to compute. If the log system has asynchronous logging enabled,
+ * the arguments are copied and the message is formatted on the sink's thread instead of the caller's.
+ */
+#define CSP_LOG_FMT(LOG_SYSTEM, LEVEL, ...)                                                                                                          \
+    do                                                                                                                                               \
+    {                                                                                                                                                \
+        csp::common::LogSystem* const CspLogFmtSystem = csp::common::log::AsLogSystemPtr(LOG_SYSTEM);                                                \
+        const csp::common::LogLevel CspLogFmtLevel = (LEVEL);                                                                                        \
+                                                                                                                                                     \
+        if (CspLogFmtSystem != nullptr && CspLogFmtSystem->LoggingEnabled(CspLogFmtLevel))                                                           \
+        {                                                                                                                                            \
+            csp::common::log::LogFormatted(*CspLogFmtSystem, CspLogFmtLevel, __VA_ARGS__);                                                           \
+        }                                                                                                                                            \
+    } while (false)
+
+namespace csp::common::log
+{
+
+inline LogSystem* AsLogSystemPtr(LogSystem* InLogSystem) { return InLogSystem; }
+inline LogSystem* AsLogSystemPtr(LogSystem& InLogSystem) { return &InLogSystem; }
+
+// Converts a format argument into something that is still valid once the caller has returned.
+// Strings passed by pointer or view are copied into a std::string, and anything that can't be copied (such as a HttpRequest) is formatted
+// up front. Everything else is copied as-is.
+template <typename T> auto DetachArgument(T&& Argument)
+{
+    using ArgumentType = std::decay_t<T>;
+
+    if constexpr (std::is_same_v<ArgumentType, const char*> || std::is_same_v<ArgumentType, char*>
+        || std::is_same_v<ArgumentType, std::string_view>)
+    {
+        return std::string(Argument);
+    }
+    else if constexpr (std::is_copy_constructible_v<ArgumentType> == false)
+    {
+        return fmt::format("{}", Argument);
+    }
+    else
+    {
+        return ArgumentType(std::forward<T>(Argument));
+    }
+}
+
+/// @brief Format and log a message, or queue it to be formatted on the log system's async sink if it has one.
+/// @pre The level has already been checked with LoggingEnabled. Use CSP_LOG_FMT rather than calling this directly.
+template <typename... Args> void LogFormatted(LogSystem& InLogSystem, LogLevel Level, fmt::format_string<Args...> Format, Args&&... Arguments)
+{
+    if (AsyncLogSink* Sink = InLogSystem.GetAsyncLogSink())
+    {
+        // The format string is always a literal, so it's fine to hold on to its view.
+        Sink->Enqueue(Level,
+            [FormatView = Format.get(), DetachedArguments = std::make_tuple(DetachArgument(std::forward<Args>(Arguments))...)]()
+            {
+                return std::apply(
+                    [FormatView](const auto&... Detached)
+                    {
+                        const std::string Message = fmt::format(fmt::runtime(FormatView), Detached...);
+                        return csp::common::String(Message.c_str(), Message.size());
+                    },
+                    DetachedArguments);
+            });
+
+        return;
+    }
+
+    const std::string Message = fmt::format(Format, std::forward<Args>(Arguments)...);
+    InLogSystem.LogMsg(Level, csp::common::String(Message.c_str(), Message.size()));
+}
+
+} // namespace csp::common::log
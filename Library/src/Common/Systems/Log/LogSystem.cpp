@@ -16,6 +16,10 @@
 #include "CSP/Common/Systems/Log/LogSystem.h"
 
 #include "Common/Logger.h"
+#include "Common/Systems/Log/AsyncLogSink.h"
+
+#include <atomic>
+#include <memory>
 
 #if defined(CSP_ANDROID)
 #include <android/log.h>
@@ -38,6 +42,11 @@ struct LogCallbacks
     LogSystem::EventCallbackHandler EventCallback;
     LogSystem::BeginMarkerCallbackHandler BeginMarkerCallback;
     LogSystem::EndMarkerCallbackHandler EndMarkerCallback;
+
+    // Created the first time asynchronous logging is enabled, and kept until the log system is destroyed so that a thread that has
+    // just fetched it can't be left holding a dangling pointer when it's disabled.
+    std::unique_ptr<AsyncLogSink> AsyncSink;
+    std::atomic<AsyncLogSink*> ActiveAsyncSink { nullptr };
 };
 
 LogSystem::LogSystem()
@@ -46,7 +55,14 @@ LogSystem::LogSystem()
     Callbacks = new LogCallbacks();
 }
 
-LogSystem::~LogSystem() { delete Callbacks; }
+LogSystem::~LogSystem()
+{
+    // The sink logs anything still queued when it's destroyed, which needs the callbacks to still be around.
+    Callbacks->ActiveAsyncSink.store(nullptr);
+    Callbacks->AsyncSink.reset();
+
+    delete Callbacks;
+}
 
 void LogSystem::SetLogCallback(LogCallbackHandler InLogCallback) { Callbacks->LogCallback = std::move(InLogCallback); }
 
@@ -120,4 +136,23 @@ void LogSystem::LogToFile(const csp::common::LogLevel Level, const csp::common::
 
 void LogSystem::ClearAllCallbacks() { Callbacks->Clear(); }
 
+void LogSystem::SetAsyncLoggingEnabled(bool Enabled)
+{
+    if (Enabled)
+    {
+        if (Callbacks->AsyncSink == nullptr)
+        {
+            Callbacks->AsyncSink = std::make_unique<AsyncLogSink>(*this);
+        }
+
+        Callbacks->ActiveAsyncSink.store(Callbacks->AsyncSink.get());
+    }
+    else if (Callbacks->ActiveAsyncSink.exchange(nullptr) != nullptr)
+    {
+        Callbacks->AsyncSink->Flush();
+    }
+}
+
+AsyncLogSink* LogSystem::GetAsyncLogSink() const { return Callbacks->ActiveAsyncSink.load(std::memory_order_acquire); }
+
 } // namespace csp::systems
@@ -0,0 +1,300 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Common/TaskExecutor.h"
+
+#include "Debug/Logging.h"
+
+#include <algorithm>
+#include <exception>
+
+namespace csp
+{
+
+namespace
+{
+
+// Lets Enqueue tell whether it is being called from one of the executor's own workers, and which one.
+thread_local const TaskExecutor* CurrentExecutor = nullptr;
+thread_local size_t CurrentWorkerIndex = 0;
+
+// Decoding is bursty (entering a space, loading a scene), so a handful of workers is plenty, and leaves cores for everything else.
+constexpr size_t DECODE_WORKER_COUNT = 3;
+
+std::mutex DecodeExecutorMutex;
+TaskExecutor* DecodeExecutorPtr = nullptr;
+
+// An exception escaping a worker would terminate the process, so a task that throws is logged and the worker carries on.
+void RunTask(const std::function<void()>& Work)
+{
+    try
+    {
+        Work();
+    }
+    catch (const std::exception& Ex)
+    {
+        CSP_LOG_ERROR_FORMAT("TaskExecutor: Task threw: %s", Ex.what());
+    }
+    catch (...)
+    {
+        CSP_LOG_ERROR_MSG("TaskExecutor: Task threw an unknown exception.");
+    }
+}
+
+} // namespace
+
+TaskExecutor::TaskExecutor(size_t WorkerCount)
+    : PendingCount(0)
+    , NextWorker(0)
+    , SleepingCount(0)
+    , ShutdownFlag(false)
+{
+    WorkerCount = std::max<size_t>(WorkerCount, 1);
+
+    Queues.reserve(WorkerCount);
+
+    for (size_t i = 0; i < WorkerCount; ++i)
+    {
+        Queues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    AsyncSchedulers.reserve(PriorityCount);
+
+    for (size_t Priority = 0; Priority < PriorityCount; ++Priority)
+    {
+        AsyncSchedulers.emplace_back(*this, static_cast<TaskPriority>(Priority));
+    }
+
+    Threads.reserve(WorkerCount);
+
+    for (size_t i = 0; i < WorkerCount; ++i)
+    {
+        Threads.emplace_back([this, i]() { WorkerLoop(i); });
+    }
+}
+
+TaskExecutor::~TaskExecutor() { Shutdown(); }
+
+void TaskExecutor::Enqueue(std::function<void()> Work, TaskPriority Priority, std::optional<size_t> AffinityHint)
+{
+    size_t WorkerIndex;
+
+    if (AffinityHint.has_value())
+    {
+        WorkerIndex = *AffinityHint % Queues.size();
+    }
+    else if (CurrentExecutor == this)
+    {
+        WorkerIndex = CurrentWorkerIndex;
+    }
+    else
+    {
+        WorkerIndex = NextWorker.fetch_add(1, std::memory_order_relaxed) % Queues.size();
+    }
+
+    WorkerQueue& Queue = *Queues[WorkerIndex];
+    const size_t PriorityIndex = static_cast<size_t>(Priority);
+
+    // Counted before the push so the count never dips below zero if a worker takes the task straight away.
+    // This also pairs with a worker bumping SleepingCount before it checks PendingCount, so either it sees this task,
+    // or we see it asleep and wake it.
+    PendingCount.fetch_add(1);
+
+    // Once shut down the workers may already have exited, so a task queued from outside them is run here rather than dropped.
+    // Workers check PendingCount after seeing the shutdown, so having counted this task, either one of them is still there to
+    // run it, or we see the shutdown here. Tasks queued by the workers themselves are always run by them before they exit.
+    if (ShutdownFlag && CurrentExecutor != this)
+    {
+        PendingCount.fetch_sub(1);
+        RunTask(Work);
+
+        return;
+    }
+
+    {
+        std::scoped_lock<std::mutex> QueueLocker(Queue.Mutex);
+
+        Queue.Tasks[PriorityIndex].push_back(std::move(Work));
+        Queue.Sizes[PriorityIndex].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (SleepingCount.load() > 0)
+    {
+        std::scoped_lock<std::mutex> SleepLocker(SleepMutex);
+        SleepCondition.notify_one();
+    }
+}
+
+void TaskExecutor::Shutdown()
+{
+    {
+        std::scoped_lock<std::mutex> SleepLocker(SleepMutex);
+
+        if (ShutdownFlag)
+        {
+            return;
+        }
+
+        ShutdownFlag = true;
+    }
+
+    SleepCondition.notify_all();
+
+    for (auto& Thread : Threads)
+    {
+        Thread.join();
+    }
+
+    Threads.clear();
+}
+
+size_t TaskExecutor::GetWorkerCount() const { return Queues.size(); }
+
+size_t TaskExecutor::GetPendingTaskCount() const { return PendingCount.load(); }
+
+TaskExecutor::AsyncScheduler::AsyncScheduler(TaskExecutor& InExecutor, TaskPriority InPriority)
+    : Executor(&InExecutor)
+    , Priority(InPriority)
+{
+}
+
+void TaskExecutor::AsyncScheduler::schedule(async::task_run_handle Task)
+{
+    // task_run_handle is move only, so it travels through the copyable std::function as a raw pointer.
+    void* TaskPtr = Task.to_void_ptr();
+
+    Executor->Enqueue([TaskPtr]() { async::task_run_handle::from_void_ptr(TaskPtr).run(); }, Priority);
+}
+
+TaskExecutor::AsyncScheduler& TaskExecutor::GetAsyncScheduler(TaskPriority Priority) { return AsyncSchedulers[static_cast<size_t>(Priority)]; }
+
+void TaskExecutor::WorkerLoop(size_t WorkerIndex)
+{
+    CurrentExecutor = this;
+    CurrentWorkerIndex = WorkerIndex;
+
+    std::function<void()> Work;
+
+    for (;;)
+    {
+        if (TryTakeTask(WorkerIndex, Work))
+        {
+            PendingCount.fetch_sub(1);
+
+            RunTask(Work);
+            Work = nullptr;
+
+            continue;
+        }
+
+        std::unique_lock<std::mutex> SleepLock(SleepMutex);
+
+        ++SleepingCount;
+        SleepCondition.wait(SleepLock, [this]() { return PendingCount.load() > 0 || ShutdownFlag; });
+        --SleepingCount;
+
+        // Everything queued before (or during) shutdown is run before the workers exit.
+        if (ShutdownFlag && PendingCount.load() == 0)
+        {
+            break;
+        }
+    }
+
+    CurrentExecutor = nullptr;
+}
+
+bool TaskExecutor::TryTakeTask(size_t WorkerIndex, std::function<void()>& OutWork)
+{
+    const size_t WorkerCount = Queues.size();
+
+    for (size_t Priority = 0; Priority < PriorityCount; ++Priority)
+    {
+        if (TryPop(*Queues[WorkerIndex], Priority, false, OutWork))
+        {
+            return true;
+        }
+
+        for (size_t Offset = 1; Offset < WorkerCount; ++Offset)
+        {
+            WorkerQueue& Victim = *Queues[(WorkerIndex + Offset) % WorkerCount];
+
+            if (Victim.Sizes[Priority].load(std::memory_order_relaxed) > 0 && TryPop(Victim, Priority, true, OutWork))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+bool TaskExecutor::TryPop(WorkerQueue& Queue, size_t Priority, bool Steal, std::function<void()>& OutWork)
+{
+    std::scoped_lock<std::mutex> QueueLocker(Queue.Mutex);
+
+    auto& Tasks = Queue.Tasks[Priority];
+
+    if (Tasks.empty())
+    {
+        return false;
+    }
+
+    // Owners take the oldest task, thieves the newest, so a busy worker's queue is worked from both ends.
+    if (Steal)
+    {
+        OutWork = std::move(Tasks.back());
+        Tasks.pop_back();
+    }
+    else
+    {
+        OutWork = std::move(Tasks.front());
+        Tasks.pop_front();
+    }
+
+    Queue.Sizes[Priority].fetch_sub(1, std::memory_order_relaxed);
+
+    return true;
+}
+
+TaskExecutor* GetDecodeExecutor()
+{
+#ifdef CSP_WASM
+    return nullptr;
+#else
+    std::scoped_lock<std::mutex> DecodeExecutorLocker(DecodeExecutorMutex);
+
+    if (DecodeExecutorPtr == nullptr)
+    {
+        DecodeExecutorPtr = new TaskExecutor(DECODE_WORKER_COUNT);
+    }
+
+    return DecodeExecutorPtr;
+#endif
+}
+
+void DestroyDecodeExecutor()
+{
+    TaskExecutor* Executor = nullptr;
+
+    {
+        std::scoped_lock<std::mutex> DecodeExecutorLocker(DecodeExecutorMutex);
+        std::swap(Executor, DecodeExecutorPtr);
+    }
+
+    delete (Executor);
+}
+
+} // namespace csp
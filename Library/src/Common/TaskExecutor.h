@@ -0,0 +1,139 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CSP/Common/CSPAsyncScheduler.h"
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace csp
+{
+
+enum class TaskPriority : uint8_t
+{
+    High,
+    Normal,
+    Low,
+    Num
+};
+
+/*
+    A fixed size pool of worker threads, each with its own task queues.
+
+    Tasks are pushed onto a single worker's queues, so producers and workers only ever contend on that one worker's lock rather
+    than a pool wide one. A worker runs its own tasks in the order they were queued, and when it runs out it steals from the back
+    of the other workers' queues before going to sleep.
+
+    Higher priority tasks are always taken first, from the worker's own queue and then from the others, before any lower priority
+    task is considered. Within a priority there is no ordering guarantee across workers.
+
+    A task that throws is logged, and doesn't take its worker down with it.
+
+    An affinity hint picks the worker a task is queued on, which keeps related tasks together (and in order) while that worker is
+    keeping up, but they may still be stolen by an idle worker. Without a hint, tasks queued from a worker stay on that worker,
+    and tasks queued from any other thread are spread across the workers in turn.
+*/
+class TaskExecutor
+{
+public:
+    explicit TaskExecutor(size_t WorkerCount);
+    ~TaskExecutor();
+
+    TaskExecutor(const TaskExecutor&) = delete;
+    TaskExecutor& operator=(const TaskExecutor&) = delete;
+
+    void Enqueue(std::function<void()> Work, TaskPriority Priority = TaskPriority::Normal, std::optional<size_t> AffinityHint = std::nullopt);
+
+    // Waits for everything already queued (including anything those tasks queue) to run, then joins the workers. Safe to call more than once.
+    // Anything queued from another thread once shutdown has started is run inline on that thread.
+    void Shutdown();
+
+    [[nodiscard]] size_t GetWorkerCount() const;
+
+    // Number of tasks queued but not yet picked up by a worker.
+    [[nodiscard]] size_t GetPendingTaskCount() const;
+
+    /*
+        Adapts the executor to the async++ scheduler concept, so continuations can be run on the workers:
+            Task.then(Executor.GetAsyncScheduler(), [](...) { ... });
+        The default scheduler (see CSPAsyncScheduler.h) is left inline, as WASM builds depend on that.
+    */
+    class AsyncScheduler
+    {
+    public:
+        AsyncScheduler(TaskExecutor& InExecutor, TaskPriority InPriority);
+
+        void schedule(async::task_run_handle Task);
+
+    private:
+        TaskExecutor* Executor;
+        TaskPriority Priority;
+    };
+
+    [[nodiscard]] AsyncScheduler& GetAsyncScheduler(TaskPriority Priority = TaskPriority::Normal);
+
+private:
+    static constexpr size_t PriorityCount = static_cast<size_t>(TaskPriority::Num);
+
+    struct WorkerQueue
+    {
+        std::mutex Mutex;
+        std::array<std::deque<std::function<void()>>, PriorityCount> Tasks;
+        // Mirrors the size of each deque, so other workers can skip empty queues without taking the lock.
+        std::array<std::atomic<size_t>, PriorityCount> Sizes {};
+    };
+
+    void WorkerLoop(size_t WorkerIndex);
+    bool TryTakeTask(size_t WorkerIndex, std::function<void()>& OutWork);
+    bool TryPop(WorkerQueue& Queue, size_t Priority, bool Steal, std::function<void()>& OutWork);
+
+    std::vector<std::unique_ptr<WorkerQueue>> Queues;
+    std::vector<std::thread> Threads;
+
+    // One per priority. async++ takes schedulers by reference, so these need to live as long as the executor.
+    std::vector<AsyncScheduler> AsyncSchedulers;
+
+    std::atomic<size_t> PendingCount;
+    std::atomic<size_t> NextWorker;
+
+    // Only used to park idle workers. Producers touch it only when a worker is asleep.
+    std::mutex SleepMutex;
+    std::condition_variable SleepCondition;
+    std::atomic<size_t> SleepingCount;
+    std::atomic<bool> ShutdownFlag;
+};
+
+/*
+    The executor entity and scene data is decoded on. It is shared by every realtime engine, rather than each spinning up threads of
+    its own, and is created on first use. Null in WASM builds, which decode on the calling thread.
+*/
+TaskExecutor* GetDecodeExecutor();
+
+// Joins the decode executor's workers. Called when foundation shuts down, so nothing may still be decoding on it.
+void DestroyDecodeExecutor();
+
+} // namespace csp
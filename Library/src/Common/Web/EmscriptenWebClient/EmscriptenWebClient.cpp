@@ -58,7 +58,19 @@ void OnFetchSuccessOrError(emscripten_fetch_t* Fetch)
     auto* Request = reinterpret_cast<csp::web::HttpRequest*>(Fetch->userData);
     Request->SetResponseCode(static_cast<csp::web::EResponseCodes>(Fetch->status));
 
-    if (Fetch->numBytes)
+    csp::web::HttpResponseSink* Sink = Request->GetPayload().GetResponseSink().get();
+
+    if (Sink != nullptr && Request->GetResponse().GetResponseCode() == csp::web::EResponseCodes::ResponseOK)
+    {
+        // Fetch has already buffered the whole body, so the sink is given it in one go.
+        const size_t DataLength = static_cast<size_t>(Fetch->numBytes);
+
+        if (Sink->Begin(DataLength) == false || Sink->Write(Fetch->data, DataLength) == false || Sink->End() == false)
+        {
+            Request->SetResponseSinkFailed();
+        }
+    }
+    else if (Fetch->numBytes)
     {
         Request->SetResponseData(Fetch->data, Fetch->numBytes);
     }
@@ -135,6 +147,12 @@ std::string EmscriptenWebClient::MD5Hash(const void* /*Data*/, const size_t /*Si
     return "MD5Hash Not Implemented";
 }
 
+std::string EmscriptenWebClient::MD5HashFile(const char* /*FilePath*/)
+{
+    assert(false && "Not implemented!");
+    return "MD5HashFile Not Implemented";
+}
+
 void EmscriptenWebClient::SetFileUploadContentFromFile(
     HttpPayload* /*Payload*/, const char* /*FilePath*/, const char* /*Version*/, const csp::common::String& /*MediaType*/)
 {
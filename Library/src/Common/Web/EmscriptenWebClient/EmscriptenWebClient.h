@@ -30,6 +30,7 @@ public:
     virtual ~EmscriptenWebClient() {};
 
     std::string MD5Hash(const void* Data, const size_t Size) override;
+    std::string MD5HashFile(const char* FilePath) override;
     void SetFileUploadContentFromFile(HttpPayload* Payload, const char* FilePath, const char* Version, const csp::common::String& MediaType) override;
     void SetFileUploadContentFromString(HttpPayload* Payload, const csp::common::String& StringSource, const csp::common::String& FileName,
         const char* Version, const csp::common::String& MediaType) override;
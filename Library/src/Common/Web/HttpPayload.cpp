@@ -51,17 +51,29 @@ HttpPayload::~HttpPayload() { }
 
 void HttpPayload::SetContent(const rapidjson::Document& InJson) { SetContent(JsonDocToString(InJson)); }
 
-void HttpPayload::SetContent(const csp::common::String& InContent) { Content = InContent; }
+void HttpPayload::SetContent(const csp::common::String& InContent)
+{
+    Content = InContent;
+    ContentSource.reset();
+}
 
-void HttpPayload::AddContent(const csp::common::String& InContent) { Content = InContent; }
+void HttpPayload::AddContent(const csp::common::String& InContent) { SetContent(InContent); }
 
 const csp::common::String& HttpPayload::GetContent() const { return Content; }
 
 const csp::common::String& HttpPayload::ToJson() const { return Content; }
 
-void HttpPayload::SetContent(const char* Data, size_t DataLength) { Content = csp::common::String(Data, DataLength); }
+void HttpPayload::SetContent(const char* Data, size_t DataLength)
+{
+    Content = csp::common::String(Data, DataLength);
+    ContentSource.reset();
+}
 
-void HttpPayload::AllocateContent(size_t DataLength) { Content = csp::common::String(DataLength); }
+void HttpPayload::AllocateContent(size_t DataLength)
+{
+    Content = csp::common::String(DataLength);
+    ContentSource.reset();
+}
 
 /// @brief Write content to the payload from the specified buffer
 /// @param Offset
@@ -92,6 +104,11 @@ void HttpPayload::WriteContent(size_t Offset, const char* Data, size_t DataLengt
 /// @return
 size_t HttpPayload::ReadContent(size_t Offset, void* Data, size_t DataLength) const
 {
+    if (ContentSource)
+    {
+        return ContentSource->Read(Offset, Data, DataLength);
+    }
+
     const size_t Length = Content.Length();
 
     if (Offset > Length)
@@ -110,6 +127,20 @@ size_t HttpPayload::ReadContent(size_t Offset, void* Data, size_t DataLength) co
     return LengthToCopy;
 }
 
+void HttpPayload::SetContentSource(const std::shared_ptr<HttpPayloadContentSource>& InContentSource)
+{
+    Content = csp::common::String("");
+    ContentSource = InContentSource;
+}
+
+bool HttpPayload::HasContentSource() const { return ContentSource != nullptr; }
+
+size_t HttpPayload::GetContentLength() const { return ContentSource ? ContentSource->GetLength() : Content.Length(); }
+
+void HttpPayload::SetResponseSink(const std::shared_ptr<HttpResponseSink>& InResponseSink) { ResponseSink = InResponseSink; }
+
+const std::shared_ptr<HttpResponseSink>& HttpPayload::GetResponseSink() const { return ResponseSink; }
+
 void HttpPayload::AddHeader(const csp::common::String& Key, const csp::common::String& Value)
 {
     if (Headers.find(Key.c_str()) == Headers.end())
@@ -152,6 +183,8 @@ void HttpPayload::RefreshBearerToken()
 void HttpPayload::Reset()
 {
     Content = csp::common::String("");
+    ContentSource.reset();
+    ResponseSink.reset();
     RequiresBearerToken = false;
     Headers.clear();
 }
@@ -162,7 +195,14 @@ void HttpPayload::AddFormParam(const char* /*Name*/, const std::shared_ptr<csp::
     std::string BoundaryText = "multipart/form-data; boundary=" + std::string(formFile->Boundary.c_str());
     AddHeader(CSP_TEXT("Content-Type"), CSP_TEXT(BoundaryText.c_str()));
 
-    SetContent(formFile->GetContent());
+    if (formFile->HasContentSource())
+    {
+        SetContentSource(formFile->ContentSource);
+    }
+    else
+    {
+        SetContent(formFile->GetContent());
+    }
 }
 
 void HttpPayload::SetBoundary(const csp::common::String& InBoundary) { Boundary = InBoundary; }
@@ -19,11 +19,41 @@
 #include "Common/Web/Json.h"
 
 #include <map>
+#include <memory>
+#include <optional>
 #include <rapidjson/document.h>
 
 namespace csp::web
 {
 
+/// Supplies the content of a payload on demand as it is sent, so large bodies never have to be held in memory.
+/// Reads are made from one thread at a time, but not necessarily in order, as a request may be resent from the start.
+class HttpPayloadContentSource
+{
+public:
+    virtual ~HttpPayloadContentSource() = default;
+
+    /// Returns the total length of the content in bytes
+    virtual size_t GetLength() const = 0;
+    /// Reads up to DataLength bytes of content from Offset, returning the number of bytes read. Returns 0 past the end or on failure.
+    virtual size_t Read(size_t Offset, void* Data, size_t DataLength) = 0;
+};
+
+/// Receives the body of a response as it arrives, so large downloads never have to be held in memory.
+/// Calls are made from one thread at a time. If the request is retried, Begin is called again and anything written before should be discarded.
+class HttpResponseSink
+{
+public:
+    virtual ~HttpResponseSink() = default;
+
+    /// Called before any of the body is written. ContentLength is empty if the server didn't send one, as with chunked transfer encoding.
+    virtual bool Begin(const std::optional<size_t>& ContentLength) = 0;
+    /// Called with each part of the body in order
+    virtual bool Write(const char* Data, size_t DataLength) = 0;
+    /// Called once the whole body has been written
+    virtual bool End() = 0;
+};
+
 /// Headers and Content for a HttpRequest or Response
 class HttpPayload
 {
@@ -49,6 +79,17 @@ public:
     void WriteContent(size_t Offset, const char* Data, size_t DataLength);
     size_t ReadContent(size_t Offset, void* Data, size_t DataLength) const;
 
+    /// Streams the content from the given source when sent, instead of from memory. Setting content directly clears the source.
+    void SetContentSource(const std::shared_ptr<HttpPayloadContentSource>& InContentSource);
+    bool HasContentSource() const;
+    /// Returns the length of the content, whether it is held in memory or streamed from a content source
+    size_t GetContentLength() const;
+
+    /// When set on the payload of a request, a successful response body is streamed into the sink instead of the response payload.
+    /// Any method returning false fails the request.
+    void SetResponseSink(const std::shared_ptr<HttpResponseSink>& InResponseSink);
+    const std::shared_ptr<HttpResponseSink>& GetResponseSink() const;
+
     void AddHeader(const csp::common::String& Key, const csp::common::String& Value);
 
     void AddFormParam(const char* Name, const std::shared_ptr<csp::web::HttpPayload>& formFile);
@@ -74,6 +115,8 @@ private:
     HeadersMap Headers;
     csp::common::String Content;
     csp::common::String Boundary;
+    std::shared_ptr<HttpPayloadContentSource> ContentSource;
+    std::shared_ptr<HttpResponseSink> ResponseSink;
 
     bool RequiresBearerToken = false;
 };
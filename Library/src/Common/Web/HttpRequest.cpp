@@ -30,6 +30,7 @@ HttpRequest::HttpRequest(WebClient* InClient, ERequestVerb InVerb, const csp::we
     , Response(this)
     , IsCallbackAsync(CallbackIsAsync)
     , IsAutoRetryEnabled(true)
+    , IsTokenRefresh(false)
     , RetryCount(0)
     , RefCount(0)
     , SendDelay(0)
@@ -86,6 +87,15 @@ void HttpRequest::WriteResponseData(size_t Offset, const char* Data, size_t Data
     Response.GetMutablePayload().WriteContent(Offset, Data, DataLength);
 }
 
+void HttpRequest::SetResponseSinkFailed()
+{
+    // Retrying won't help if the data can't be stored, so fail straight away.
+    SetResponseCode(EResponseCodes::ResponseInsufficientStorage);
+    std::string ResponseBody = "{\"errors\": {\"\": [\"Response data could not be written.\"]}}";
+    SetResponseData(ResponseBody.c_str(), ResponseBody.length());
+    EnableAutoRetry(false);
+}
+
 void HttpRequest::SetResponseProgress(float ReponseProgress)
 {
     Response.GetProgress().SetProgressPercentage(ReponseProgress);
@@ -177,6 +187,10 @@ void HttpRequest::SetSendDelay(const std::chrono::milliseconds InSendDelay) { Se
 
 std::chrono::milliseconds HttpRequest::GetSendDelay() { return SendDelay; }
 
+void HttpRequest::SetIsTokenRefresh(bool InIsTokenRefresh) { IsTokenRefresh = InIsTokenRefresh; }
+
+bool HttpRequest::GetIsTokenRefresh() const { return IsTokenRefresh; }
+
 void HttpRequest::EnableAutoRetry(bool Enable) { IsAutoRetryEnabled = Enable; }
 
 void HttpRequest::Cancel() { CancellationToken->Cancel(); }
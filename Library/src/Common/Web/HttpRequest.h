@@ -82,6 +82,8 @@ public:
 
     void AllocateResponseData(size_t DataLength);
     void WriteResponseData(size_t Offset, const char* Data, size_t DataLength);
+    /// Fails the request because its response body could not be written to the response sink set on its payload
+    void SetResponseSinkFailed();
     void SetResponseProgress(float Progress);
     void SetRequestProgress(float Progress);
     float GetRequestProgressPercentage() const;
@@ -101,6 +103,10 @@ public:
     void SetSendDelay(const std::chrono::milliseconds InSendDelay);
     std::chrono::milliseconds GetSendDelay();
 
+    /// Marks this as the request refreshing the access token, which has to be let through while other requests wait on it
+    void SetIsTokenRefresh(bool InIsTokenRefresh);
+    bool GetIsTokenRefresh() const;
+
     void Cancel();
     bool Cancelled();
 
@@ -118,6 +124,7 @@ private:
 
     bool IsCallbackAsync;
     bool IsAutoRetryEnabled;
+    bool IsTokenRefresh;
     uint32_t RetryCount;
     std::atomic_uint32_t RefCount;
 
@@ -0,0 +1,275 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CSP_WASM
+
+#include "Common/Web/POCOWebClient/HTTPSessionPool.h"
+
+#include <Poco/Exception.h>
+#include <Poco/Net/HTTPSessionFactory.h>
+#include <Poco/Net/Socket.h>
+
+#include <algorithm>
+#include <iterator>
+
+using namespace std::chrono;
+
+namespace csp::web
+{
+
+namespace
+{
+
+// Pooled sessions are expired by the pool itself, so stop Poco from silently reconnecting a session it considers stale underneath us.
+const Poco::Timespan kPocoKeepAliveTimeout(24 * 60 * 60, 0);
+
+} // namespace
+
+HTTPSessionPool::Lease::Lease(
+    HTTPSessionPool* InPool, std::string InKey, Poco::URI InUri, std::unique_ptr<Poco::Net::HTTPClientSession> InSession, bool InReused)
+    : Pool(InPool)
+    , Key(std::move(InKey))
+    , Uri(std::move(InUri))
+    , Session(std::move(InSession))
+    , Reused(InReused)
+{
+}
+
+HTTPSessionPool::Lease::Lease(Lease&& Other) noexcept
+    : Pool(Other.Pool)
+    , Key(std::move(Other.Key))
+    , Uri(std::move(Other.Uri))
+    , Session(std::move(Other.Session))
+    , Reused(Other.Reused)
+{
+    Other.Pool = nullptr;
+}
+
+HTTPSessionPool::Lease& HTTPSessionPool::Lease::operator=(Lease&& Other) noexcept
+{
+    if (this != &Other)
+    {
+        Pool = Other.Pool;
+        Key = std::move(Other.Key);
+        Uri = std::move(Other.Uri);
+        Session = std::move(Other.Session);
+        Reused = Other.Reused;
+        Other.Pool = nullptr;
+    }
+
+    return *this;
+}
+
+HTTPSessionPool::Lease::~Lease() = default;
+
+void HTTPSessionPool::Lease::Renew()
+{
+    Session = Pool->CreateSession(Uri);
+    Reused = false;
+
+    std::scoped_lock Lock(Pool->Mutex);
+    ++Pool->PoolStats.Misses;
+}
+
+void HTTPSessionPool::Lease::Release(bool Reusable)
+{
+    if (Pool != nullptr && Session != nullptr)
+    {
+        Pool->Release(Key, std::move(Session), Reused, Reusable);
+    }
+
+    Session.reset();
+}
+
+HTTPSessionPool::HTTPSessionPool()
+    : MaxSessionsPerHost(DEFAULT_MAX_SESSIONS_PER_HOST)
+    , IdleTimeout(DEFAULT_IDLE_TIMEOUT)
+    , LastEviction(steady_clock::now())
+{
+}
+
+HTTPSessionPool::Lease HTTPSessionPool::Acquire(const Poco::URI& Uri, bool ReuseIdle)
+{
+    std::string Key = MakeKey(Uri);
+
+    // Sessions are closed outside of the lock, as closing a TLS session has to talk to the server.
+    std::vector<IdleSession> Discarded;
+
+    {
+        std::scoped_lock Lock(Mutex);
+
+        const steady_clock::time_point Now = steady_clock::now();
+        auto HostIt = ReuseIdle ? IdleSessions.find(Key) : IdleSessions.end();
+
+        if (HostIt != IdleSessions.end())
+        {
+            std::vector<IdleSession>& Sessions = HostIt->second;
+
+            // Most recently used first, as it is the most likely to still be open.
+            while (Sessions.empty() == false)
+            {
+                IdleSession Idle = std::move(Sessions.back());
+                Sessions.pop_back();
+
+                if (IsHealthy(Idle, Now))
+                {
+                    ++PoolStats.Hits;
+                    return Lease(this, std::move(Key), Uri, std::move(Idle.Session), true);
+                }
+
+                ++PoolStats.Evictions;
+                Discarded.push_back(std::move(Idle));
+            }
+        }
+
+        ++PoolStats.Misses;
+    }
+
+    return Lease(this, std::move(Key), Uri, CreateSession(Uri), false);
+}
+
+void HTTPSessionPool::SetMaxSessionsPerHost(size_t MaxSessions)
+{
+    std::vector<IdleSession> Discarded;
+
+    std::scoped_lock Lock(Mutex);
+    MaxSessionsPerHost = MaxSessions;
+
+    for (auto& [Key, Sessions] : IdleSessions)
+    {
+        while (Sessions.size() > MaxSessionsPerHost)
+        {
+            Discarded.push_back(std::move(Sessions.front()));
+            Sessions.erase(Sessions.begin());
+        }
+    }
+}
+
+void HTTPSessionPool::SetIdleTimeout(milliseconds Timeout)
+{
+    std::scoped_lock Lock(Mutex);
+    IdleTimeout = Timeout;
+}
+
+void HTTPSessionPool::Clear()
+{
+    std::unordered_map<std::string, std::vector<IdleSession>> Discarded;
+
+    std::scoped_lock Lock(Mutex);
+    Discarded.swap(IdleSessions);
+}
+
+HTTPSessionPool::Stats HTTPSessionPool::GetStats() const
+{
+    std::scoped_lock Lock(Mutex);
+
+    Stats Result = PoolStats;
+    Result.IdleSessions = 0;
+
+    for (const auto& [Key, Sessions] : IdleSessions)
+    {
+        Result.IdleSessions += Sessions.size();
+    }
+
+    return Result;
+}
+
+std::string HTTPSessionPool::MakeKey(const Poco::URI& Uri) { return Uri.getScheme() + "://" + Uri.getHost() + ":" + std::to_string(Uri.getPort()); }
+
+std::unique_ptr<Poco::Net::HTTPClientSession> HTTPSessionPool::CreateSession(const Poco::URI& Uri) const
+{
+    // HTTPSessionFactory returns an unmanaged raw pointer - unique_ptr ensures the session is safely cleaned up after use.
+    std::unique_ptr<Poco::Net::HTTPClientSession> Session(Poco::Net::HTTPSessionFactory::defaultFactory().createClientSession(Uri));
+    Session->setKeepAlive(true);
+    Session->setKeepAliveTimeout(kPocoKeepAliveTimeout);
+
+    return Session;
+}
+
+bool HTTPSessionPool::IsHealthy(const IdleSession& Idle, steady_clock::time_point Now) const
+{
+    if (Now - Idle.IdleSince >= IdleTimeout || Idle.Session->connected() == false)
+    {
+        return false;
+    }
+
+    try
+    {
+        // Nothing should arrive on an idle connection. If it is readable, the server has closed it (or sent something we can't
+        // pair with a request), either way it can't be reused.
+        return Idle.Session->socket().poll(Poco::Timespan(0), Poco::Net::Socket::SELECT_READ | Poco::Net::Socket::SELECT_ERROR) == false;
+    }
+    catch (const Poco::Exception&)
+    {
+        return false;
+    }
+}
+
+void HTTPSessionPool::Release(const std::string& Key, std::unique_ptr<Poco::Net::HTTPClientSession> Session, bool Reused, bool Reusable)
+{
+    std::vector<IdleSession> Discarded;
+
+    std::scoped_lock Lock(Mutex);
+
+    const steady_clock::time_point Now = steady_clock::now();
+
+    if (Reused && Reusable)
+    {
+        ++PoolStats.HandshakesAvoided;
+    }
+
+    if (Now - LastEviction >= IdleTimeout)
+    {
+        EvictExpired(Now, Discarded);
+        LastEviction = Now;
+    }
+
+    if (Reusable == false || MaxSessionsPerHost == 0 || Session->connected() == false)
+    {
+        Discarded.push_back(IdleSession { std::move(Session), Now });
+        return;
+    }
+
+    std::vector<IdleSession>& Sessions = IdleSessions[Key];
+    Sessions.push_back(IdleSession { std::move(Session), Now });
+
+    if (Sessions.size() > MaxSessionsPerHost)
+    {
+        Discarded.push_back(std::move(Sessions.front()));
+        Sessions.erase(Sessions.begin());
+    }
+}
+
+void HTTPSessionPool::EvictExpired(steady_clock::time_point Now, std::vector<IdleSession>& OutDiscarded)
+{
+    for (auto HostIt = IdleSessions.begin(); HostIt != IdleSessions.end();)
+    {
+        std::vector<IdleSession>& Sessions = HostIt->second;
+
+        // Sessions are pushed in release order, so the expired ones are all at the front.
+        auto FirstLive
+            = std::find_if(Sessions.begin(), Sessions.end(), [this, Now](const IdleSession& Idle) { return Now - Idle.IdleSince < IdleTimeout; });
+        PoolStats.Evictions += static_cast<uint64_t>(std::distance(Sessions.begin(), FirstLive));
+        std::move(Sessions.begin(), FirstLive, std::back_inserter(OutDiscarded));
+        Sessions.erase(Sessions.begin(), FirstLive);
+
+        HostIt = Sessions.empty() ? IdleSessions.erase(HostIt) : std::next(HostIt);
+    }
+}
+
+} // namespace csp::web
+
+#endif
@@ -0,0 +1,150 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef CSP_WASM
+
+#include <Poco/Net/HTTPClientSession.h>
+#include <Poco/URI.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace csp::web
+{
+
+/// @brief Keeps HTTP/1.1 keep-alive sessions open between requests, so requests to the same host can skip the TCP and TLS handshakes.
+///
+/// Sessions are pooled per scheme, host and port. A session is only returned to the pool once its response has been fully read and the
+/// server has agreed to keep the connection alive. Before a pooled session is handed out again, it is health checked: sessions that
+/// have been idle for longer than the idle timeout, have been closed, or have unexpected data waiting on them (usually the server
+/// closing the connection) are discarded instead.
+///
+/// The per host limit caps how many sessions are kept open, not how many can be in use. Acquire never blocks, if the pool has no healthy
+/// session it creates a new one, and any sessions released beyond the limit are closed.
+class HTTPSessionPool
+{
+public:
+    struct Stats
+    {
+        // Requests served by a pooled session.
+        uint64_t Hits = 0;
+        // Requests that needed a new session.
+        uint64_t Misses = 0;
+        // Requests on a pooled session that completed without the connection having to be re-established.
+        uint64_t HandshakesAvoided = 0;
+        // Pooled sessions that were discarded, either for being idle too long, or for failing a health check.
+        uint64_t Evictions = 0;
+        // Sessions currently idle in the pool, across all hosts.
+        size_t IdleSessions = 0;
+    };
+
+    /// @brief An acquired session. Returns the session to the pool when released as reusable, otherwise closes it.
+    class Lease
+    {
+    public:
+        Lease() = default;
+        Lease(Lease&& Other) noexcept;
+        Lease& operator=(Lease&& Other) noexcept;
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+
+        /// Closes the session, if it was not released.
+        ~Lease();
+
+        Poco::Net::HTTPClientSession* Get() const { return Session.get(); }
+        Poco::Net::HTTPClientSession* operator->() const { return Session.get(); }
+        Poco::Net::HTTPClientSession& operator*() const { return *Session; }
+
+        /// @brief Whether this session came from the pool, rather than being newly created.
+        bool IsReused() const { return Reused; }
+
+        /// @brief Replaces the session with a newly created one, for retrying a request after a pooled connection turned out to be dead.
+        void Renew();
+
+        /// @brief Hands the session back. If Reusable is false, or the session has been closed, it is closed rather than pooled.
+        void Release(bool Reusable);
+
+    private:
+        friend class HTTPSessionPool;
+
+        Lease(HTTPSessionPool* InPool, std::string InKey, Poco::URI InUri, std::unique_ptr<Poco::Net::HTTPClientSession> InSession, bool InReused);
+
+        HTTPSessionPool* Pool = nullptr;
+        std::string Key;
+        Poco::URI Uri;
+        std::unique_ptr<Poco::Net::HTTPClientSession> Session;
+        bool Reused = false;
+    };
+
+    static constexpr size_t DEFAULT_MAX_SESSIONS_PER_HOST = 8;
+    static constexpr std::chrono::seconds DEFAULT_IDLE_TIMEOUT { 30 };
+
+    HTTPSessionPool();
+
+    /// @brief Returns a healthy pooled session for the URI's host if there is one, otherwise a new session.
+    /// @param ReuseIdle If false, always returns a new session. Used for requests that can't safely be resent should a pooled connection
+    /// turn out to have been closed by the server. The session is still pooled once released, so later requests can reuse it.
+    Lease Acquire(const Poco::URI& Uri, bool ReuseIdle = true);
+
+    /// @brief Sets the maximum number of idle sessions kept per host. Setting this to 0 disables pooling.
+    void SetMaxSessionsPerHost(size_t MaxSessions);
+
+    /// @brief Sets how long a session may sit idle in the pool before it is closed.
+    void SetIdleTimeout(std::chrono::milliseconds Timeout);
+
+    /// @brief Closes all idle sessions.
+    void Clear();
+
+    Stats GetStats() const;
+
+private:
+    struct IdleSession
+    {
+        std::unique_ptr<Poco::Net::HTTPClientSession> Session;
+        std::chrono::steady_clock::time_point IdleSince;
+    };
+
+    static std::string MakeKey(const Poco::URI& Uri);
+    std::unique_ptr<Poco::Net::HTTPClientSession> CreateSession(const Poco::URI& Uri) const;
+    bool IsHealthy(const IdleSession& Idle, std::chrono::steady_clock::time_point Now) const;
+
+    void Release(const std::string& Key, std::unique_ptr<Poco::Net::HTTPClientSession> Session, bool Reused, bool Reusable);
+
+    // Expects Mutex to be held. Evicted sessions are moved to OutDiscarded, to be closed once the lock is released.
+    void EvictExpired(std::chrono::steady_clock::time_point Now, std::vector<IdleSession>& OutDiscarded);
+
+    mutable std::mutex Mutex;
+
+    // Host key -> idle sessions, most recently used last.
+    std::unordered_map<std::string, std::vector<IdleSession>> IdleSessions;
+
+    size_t MaxSessionsPerHost;
+    std::chrono::milliseconds IdleTimeout;
+    std::chrono::steady_clock::time_point LastEviction;
+
+    Stats PoolStats;
+};
+
+} // namespace csp::web
+
+#endif
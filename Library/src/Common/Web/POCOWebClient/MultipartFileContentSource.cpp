@@ -0,0 +1,170 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef CSP_WASM
+
+#include "Common/Web/POCOWebClient/MultipartFileContentSource.h"
+
+#include <Poco/MD5Engine.h>
+#include <Poco/Net/MultipartWriter.h>
+#include <Poco/Path.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+
+/// @brief Size of the heap buffer a stream is read through when computing its checksum
+constexpr size_t kChecksumChunkSize = 64 * 1024;
+
+size_t CopyFromString(const std::string& Source, size_t Offset, char* Data, size_t DataLength)
+{
+    const size_t LengthToCopy = std::min(DataLength, Source.size() - Offset);
+    memcpy(Data, Source.data() + Offset, LengthToCopy);
+
+    return LengthToCopy;
+}
+
+} // namespace
+
+namespace csp::web
+{
+
+std::string MD5HashStream(std::istream& Stream, size_t* OutLength)
+{
+    Poco::MD5Engine MD5Hasher;
+    std::vector<char> Buffer(kChecksumChunkSize);
+    size_t Length = 0;
+
+    while (Stream.read(Buffer.data(), Buffer.size()) || Stream.gcount() > 0)
+    {
+        MD5Hasher.update(Buffer.data(), static_cast<unsigned>(Stream.gcount()));
+        Length += static_cast<size_t>(Stream.gcount());
+    }
+
+    if (Stream.bad())
+    {
+        return {};
+    }
+
+    if (OutLength != nullptr)
+    {
+        *OutLength = Length;
+    }
+
+    return Poco::DigestEngine::digestToHex(MD5Hasher.digest());
+}
+
+MultipartFileContentSource::MultipartFileContentSource(const std::string& FilePath, const std::string& MediaType, const std::string& Version)
+    : File(FilePath, std::ios::in | std::ios::binary)
+    , FileLength(0)
+    , FilePosition(0)
+    , Boundary(Poco::Net::MultipartWriter::createBoundary())
+{
+    if (File.is_open() == false)
+    {
+        return;
+    }
+
+    Checksum = MD5HashStream(File, &FileLength);
+
+    if (Checksum.empty())
+    {
+        File.close();
+        return;
+    }
+
+    // Leave the file at the start, ready to be sent.
+    File.clear();
+    File.seekg(0);
+
+    const std::string FileName = Poco::Path(FilePath).getFileName();
+
+    Header = "--" + Boundary + "\r\nContent-Disposition: form-data; name=\"Checksum\"\r\n\r\n" + Checksum + "\r\n--" + Boundary
+        + "\r\nContent-Disposition: form-data; name=\"Version\"\r\n\r\n" + Version + "\r\n--" + Boundary
+        + "\r\nContent-Disposition: form-data; name=\"FormFile\"; filename=\"" + FileName + "\"\r\nContent-Type: " + MediaType + "\r\n\r\n";
+    Footer = "\r\n--" + Boundary + "--\r\n";
+}
+
+bool MultipartFileContentSource::IsValid() const { return File.is_open(); }
+
+const std::string& MultipartFileContentSource::GetBoundary() const { return Boundary; }
+
+const std::string& MultipartFileContentSource::GetChecksum() const { return Checksum; }
+
+size_t MultipartFileContentSource::GetLength() const { return Header.size() + FileLength + Footer.size(); }
+
+size_t MultipartFileContentSource::Read(size_t Offset, void* Data, size_t DataLength)
+{
+    const size_t FileStart = Header.size();
+    const size_t FooterStart = FileStart + FileLength;
+    const size_t Length = GetLength();
+
+    char* Out = static_cast<char*>(Data);
+    size_t TotalRead = 0;
+
+    while (TotalRead < DataLength && Offset < Length)
+    {
+        size_t Read = 0;
+
+        if (Offset < FileStart)
+        {
+            Read = CopyFromString(Header, Offset, Out + TotalRead, DataLength - TotalRead);
+        }
+        else if (Offset < FooterStart)
+        {
+            Read = ReadFile(Offset - FileStart, Out + TotalRead, std::min(DataLength - TotalRead, FooterStart - Offset));
+        }
+        else
+        {
+            Read = CopyFromString(Footer, Offset - FooterStart, Out + TotalRead, DataLength - TotalRead);
+        }
+
+        if (Read == 0)
+        {
+            // The file has changed or become unreadable since it was checksummed, so the rest of the body can't be produced.
+            break;
+        }
+
+        Offset += Read;
+        TotalRead += Read;
+    }
+
+    return TotalRead;
+}
+
+size_t MultipartFileContentSource::ReadFile(size_t Offset, char* Data, size_t DataLength)
+{
+    if (Offset != FilePosition)
+    {
+        File.clear();
+        File.seekg(static_cast<std::streamoff>(Offset));
+        FilePosition = Offset;
+    }
+
+    File.read(Data, static_cast<std::streamsize>(DataLength));
+    const size_t Read = static_cast<size_t>(File.gcount());
+    FilePosition += Read;
+
+    return Read;
+}
+
+} // namespace csp::web
+
+#endif
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#ifndef CSP_WASM
+
+#include "Common/Web/HttpPayload.h"
+
+#include <fstream>
+#include <istream>
+#include <string>
+
+namespace csp::web
+{
+
+/// @brief Computes the MD5 of the rest of the stream, reading it a chunk at a time, so that large files needn't be held in memory.
+/// @param OutLength If not null, set to the number of bytes hashed.
+/// @return The hex digest, or an empty string if the stream couldn't be read.
+std::string MD5HashStream(std::istream& Stream, size_t* OutLength = nullptr);
+
+/// @brief Produces the multipart/form-data body of an asset file upload as it is sent, reading the file a chunk at a time.
+///
+/// The body holds Checksum and Version fields followed by the file itself as FormFile, laid out the same as Poco's HTMLForm would write
+/// them. The MD5 checksum is computed by streaming the file once on construction, so at no point is the whole file held in memory.
+class MultipartFileContentSource : public HttpPayloadContentSource
+{
+public:
+    /// Opens the file and computes its checksum. Check IsValid afterwards, as this fails if the file can't be read.
+    MultipartFileContentSource(const std::string& FilePath, const std::string& MediaType, const std::string& Version);
+
+    bool IsValid() const;
+
+    const std::string& GetBoundary() const;
+    const std::string& GetChecksum() const;
+
+    size_t GetLength() const override;
+    size_t Read(size_t Offset, void* Data, size_t DataLength) override;
+
+private:
+    size_t ReadFile(size_t Offset, char* Data, size_t DataLength);
+
+    std::ifstream File;
+    size_t FileLength;
+    // Where the next read from File will start, so that sequential reads don't need to seek
+    size_t FilePosition;
+
+    std::string Boundary;
+    std::string Checksum;
+    // Everything before the file data, and everything after it
+    std::string Header;
+    std::string Footer;
+};
+
+} // namespace csp::web
+
+#endif
@@ -18,32 +18,37 @@
 
 #include "POCOWebClient.h"
 
+#include "Common/Systems/Log/LogFormat.h"
+#include "Common/Web/POCOWebClient/MultipartFileContentSource.h"
 #include "Debug/Logging.h"
 
 #include "CSP/Common/Systems/Log/LogSystem.h"
 #include "CSP/Common/fmt_Formatters.h"
 
+#include <Poco/Exception.h>
 #include <Poco/File.h>
 #include <Poco/MD5Engine.h>
 #include <Poco/Net/AcceptCertificateHandler.h>
 #include <Poco/Net/Context.h>
-#include <Poco/Net/FilePartSource.h>
 #include <Poco/Net/HTMLForm.h>
 #include <Poco/Net/HTTPRequest.h>
 #include <Poco/Net/HTTPResponse.h>
 #include <Poco/Net/HTTPSSessionInstantiator.h>
 #include <Poco/Net/HTTPSessionFactory.h>
 #include <Poco/Net/HTTPSessionInstantiator.h>
+#include <Poco/Net/NetException.h>
 #include <Poco/Net/SSLManager.h>
 #include <Poco/Net/StringPartSource.h>
 #include <Poco/StreamCopier.h>
 #include <Poco/URI.h>
 #include <chrono>
 #include <codecvt>
+#include <fstream>
 #include <iostream>
 #include <istream>
 #include <string>
 #include <thread>
+#include <vector>
 
 namespace
 {
@@ -56,10 +61,8 @@ void LogHttpResponseIfLoglevelVeryVerbose(
     // If the LogSystem LogLevel has been set to VeryVerbose, log the response.
     if (LogSystem != nullptr && LogSystem->GetSystemLevel() == csp::common::LogLevel::VeryVerbose)
     {
-        LogSystem->LogMsg(csp::common::LogLevel::VeryVerbose,
-            fmt::format("HTTP Response\n{0} {1}\nStatus: {2} - {3}", Verb, Request.GetUri().GetAsString(), static_cast<int>(PocoResponse.getStatus()),
-                PocoResponse.getReason())
-                .c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::VeryVerbose, "HTTP Response\n{0} {1}\nStatus: {2} - {3}", Verb, Request.GetUri().GetAsString(),
+            static_cast<int>(PocoResponse.getStatus()), PocoResponse.getReason());
     }
 }
 
@@ -79,6 +82,22 @@ void CopyResponseHeaders(const Poco::Net::HTTPResponse& PocoResponse, csp::web::
     }
 }
 
+/// @brief Whether sending the request twice has the same effect on the server as sending it once.
+bool IsIdempotent(csp::web::ERequestVerb Verb)
+{
+    switch (Verb)
+    {
+    case csp::web::ERequestVerb::Get:
+    case csp::web::ERequestVerb::Put:
+    case csp::web::ERequestVerb::Delete:
+    case csp::web::ERequestVerb::Head:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
 } // namespace
 
 namespace csp::web
@@ -87,6 +106,10 @@ namespace csp::web
 /// @brief Size of stack space used for async streaming upload and download
 const uint32_t kPOCOAsyncBufferSize = 2 * 1024;
 
+/// @brief Largest amount of unread response body we will read and discard in order to return a session to the pool.
+/// Anything larger is cheaper to abandon, along with the connection, than to download.
+const std::streamsize kPOCOMaxDrainSize = 64 * 1024;
+
 EResponseCodes GetOlyResponseCode(Poco::Net::HTTPResponse::HTTPStatus PocoResponseCode) { return (EResponseCodes)PocoResponseCode; }
 
 /// @brief Prepares a Poco HTTPRequest by copying headers and cookies from the provided HttpRequest.
@@ -112,7 +135,7 @@ bool POCOWebClient::PrepareAndSendRequest(
     case ERequestBodyMode::Streamed:
     {
         // The request body is being sent as a stream, which allows for progress tracking and cancellation support
-        size_t ContentLength = Request.GetPayload().GetContent().Length();
+        size_t ContentLength = Request.GetPayload().GetContentLength();
         PocoRequest.setContentLength(ContentLength);
         std::ostream& RequestStream = ClientSession->sendRequest(PocoRequest);
         ProcessRequestAsync(*ClientSession, PocoRequest, RequestStream, Request);
@@ -157,6 +180,59 @@ std::istream& POCOWebClient::ReceiveResponse(Poco::Net::HTTPClientSession* Clien
     return ResponseStream;
 }
 
+std::istream* POCOWebClient::SendAndReceive(HttpRequest& Request, const Poco::Net::HTTPRequest& PocoRequest, HTTPSessionPool::Lease& ClientSession,
+    ERequestBodyMode SendBodyMode, Poco::Net::HTTPResponse& PocoResponse)
+{
+    for (;;)
+    {
+        try
+        {
+            if (!PrepareAndSendRequest(Request, PocoRequest, ClientSession.Get(), SendBodyMode))
+            {
+                return nullptr;
+            }
+
+            return &ReceiveResponse(ClientSession.Get(), PocoResponse, Request);
+        }
+        catch (const Poco::Net::NetException&)
+        {
+            // A pooled connection can be closed by the server between passing its health check and us writing to it.
+            // We can't tell whether the server saw any of the request before the connection dropped, so only requests that are safe
+            // to repeat are sent again on a fresh connection, and only once. Requests that aren't safe to repeat are never given a pooled
+            // connection, so they fail here only when a new connection would have too.
+            if (ClientSession.IsReused() == false || IsIdempotent(Request.GetVerb()) == false || Request.Cancelled())
+            {
+                throw;
+            }
+
+            ClientSession.Renew();
+        }
+    }
+}
+
+void POCOWebClient::ReleaseSession(
+    HTTPSessionPool::Lease& ClientSession, const Poco::Net::HTTPResponse& PocoResponse, std::istream& ResponseStream, HttpRequest& Request)
+{
+    bool Reusable = Request.Cancelled() == false && PocoResponse.getKeepAlive();
+
+    if (Reusable)
+    {
+        // The next request on this connection can only be sent once this response has been read in full, so read whatever the
+        // verb handler didn't need (error bodies, mostly).
+        char Buffer[kPOCOAsyncBufferSize];
+        std::streamsize TotalDrained = 0;
+
+        while (TotalDrained <= kPOCOMaxDrainSize && ResponseStream.read(Buffer, sizeof(Buffer)).gcount() > 0)
+        {
+            TotalDrained += ResponseStream.gcount();
+        }
+
+        Reusable = ResponseStream.eof() && ResponseStream.bad() == false && TotalDrained <= kPOCOMaxDrainSize;
+    }
+
+    ClientSession.Release(Reusable);
+}
+
 POCOWebClient::POCOWebClient(const Port InPort, const ETransferProtocol Tp, csp::common::LogSystem* LogSystem, bool AutoRefresh)
     : WebClient(InPort, Tp, LogSystem, AutoRefresh)
 {
@@ -186,6 +262,8 @@ POCOWebClient::POCOWebClient(
 
 POCOWebClient::~POCOWebClient() { delete Cookies; }
 
+HTTPSessionPool& POCOWebClient::GetSessionPool() { return SessionPool; }
+
 void POCOWebClient::Send(HttpRequest& Request)
 {
     try
@@ -262,20 +340,25 @@ void POCOWebClient::Get(HttpRequest& Request)
 
     Poco::URI Uri(Request.GetUri().GetAsStdString());
 
-    // HTTPSessionFactory returns an unmanaged raw pointer - unique_ptr ensures the session is safely cleaned up after use.
-    std::unique_ptr<Poco::Net::HTTPClientSession> ClientSession(Poco::Net::HTTPSessionFactory::defaultFactory().createClientSession(Uri));
+    HTTPSessionPool::Lease ClientSession = SessionPool.Acquire(Uri, IsIdempotent(Request.GetVerb()));
     Poco::Net::HTTPRequest PocoRequest(Poco::Net::HTTPRequest::HTTP_GET, Uri.getPathAndQuery(), Poco::Net::HTTPRequest::HTTP_1_1);
 
-    PrepareAndSendRequest(Request, PocoRequest, ClientSession.get(), ERequestBodyMode::None);
-
     Poco::Net::HTTPResponse PocoResponse;
-    std::istream& ResponseStream = ReceiveResponse(ClientSession.get(), PocoResponse, Request);
+    std::istream* ResponseStream = SendAndReceive(Request, PocoRequest, ClientSession, ERequestBodyMode::None, PocoResponse);
 
-    if (PocoResponse.getStatus() == Poco::Net::HTTPResponse::HTTP_OK)
+    if (ResponseStream == nullptr)
+    {
+        return;
+    }
+
+    // Ranged requests are answered with partial content, which carries a body just like a full response.
+    if (PocoResponse.getStatus() == Poco::Net::HTTPResponse::HTTP_OK || PocoResponse.getStatus() == Poco::Net::HTTPResponse::HTTP_PARTIAL_CONTENT)
     {
-        ProcessResponseAsync(*ClientSession, PocoResponse, ResponseStream, Request);
+        ProcessResponseAsync(*ClientSession, PocoResponse, *ResponseStream, Request);
     }
 
+    ReleaseSession(ClientSession, PocoResponse, *ResponseStream, Request);
+
     LogHttpResponseIfLoglevelVeryVerbose(LogSystem, "GET", Request, PocoResponse);
 }
 
@@ -285,26 +368,27 @@ void POCOWebClient::Post(HttpRequest& Request)
 
     Poco::URI Uri(Request.GetUri().GetAsStdString());
 
-    // HTTPSessionFactory returns an unmanaged raw pointer - unique_ptr ensures the session is safely cleaned up after use.
-    std::unique_ptr<Poco::Net::HTTPClientSession> ClientSession(Poco::Net::HTTPSessionFactory::defaultFactory().createClientSession(Uri));
+    HTTPSessionPool::Lease ClientSession = SessionPool.Acquire(Uri, IsIdempotent(Request.GetVerb()));
     Poco::Net::HTTPRequest PocoRequest(Poco::Net::HTTPRequest::HTTP_POST, Uri.getPathAndQuery(), Poco::Net::HTTPRequest::HTTP_1_1);
 
-    if (!PrepareAndSendRequest(Request, PocoRequest, ClientSession.get(), ERequestBodyMode::Streamed))
+    Poco::Net::HTTPResponse PocoResponse;
+    std::istream* ResponseStream = SendAndReceive(Request, PocoRequest, ClientSession, ERequestBodyMode::Streamed, PocoResponse);
+
+    if (ResponseStream == nullptr)
     {
         return;
     }
 
-    Poco::Net::HTTPResponse PocoResponse;
-    std::istream& ResponseStream = ReceiveResponse(ClientSession.get(), PocoResponse, Request);
-
     std::string ResponseString;
-    Poco::StreamCopier::copyToString(ResponseStream, ResponseString);
+    Poco::StreamCopier::copyToString(*ResponseStream, ResponseString);
     Request.SetResponseData(ResponseString.c_str(), ResponseString.length());
     auto& Payload = ((HttpResponse&)Request.GetResponse()).GetMutablePayload();
 
     // Get all response headers
     CopyResponseHeaders(PocoResponse, Payload);
 
+    ReleaseSession(ClientSession, PocoResponse, *ResponseStream, Request);
+
     LogHttpResponseIfLoglevelVeryVerbose(LogSystem, "POST", Request, PocoResponse);
 }
 
@@ -314,25 +398,26 @@ void POCOWebClient::Put(HttpRequest& Request)
 
     Poco::URI Uri(Request.GetUri().GetAsStdString());
 
-    // HTTPSessionFactory returns an unmanaged raw pointer - unique_ptr ensures the session is safely cleaned up after use.
-    std::unique_ptr<Poco::Net::HTTPClientSession> ClientSession(Poco::Net::HTTPSessionFactory::defaultFactory().createClientSession(Uri));
+    HTTPSessionPool::Lease ClientSession = SessionPool.Acquire(Uri, IsIdempotent(Request.GetVerb()));
     Poco::Net::HTTPRequest PocoRequest(Poco::Net::HTTPRequest::HTTP_PUT, Uri.getPathAndQuery(), Poco::Net::HTTPRequest::HTTP_1_1);
 
-    if (!PrepareAndSendRequest(Request, PocoRequest, ClientSession.get(), ERequestBodyMode::Streamed))
+    Poco::Net::HTTPResponse PocoResponse;
+    std::istream* ResponseStream = SendAndReceive(Request, PocoRequest, ClientSession, ERequestBodyMode::Streamed, PocoResponse);
+
+    if (ResponseStream == nullptr)
     {
         return;
     }
 
-    Poco::Net::HTTPResponse PocoResponse;
-    std::istream& ResponseStream = ReceiveResponse(ClientSession.get(), PocoResponse, Request);
-
     if (PocoResponse.getStatus() == Poco::Net::HTTPResponse::HTTP_OK)
     {
         std::string ResponseString;
-        Poco::StreamCopier::copyToString(ResponseStream, ResponseString);
+        Poco::StreamCopier::copyToString(*ResponseStream, ResponseString);
         Request.SetResponseData(ResponseString.c_str(), ResponseString.length());
     }
 
+    ReleaseSession(ClientSession, PocoResponse, *ResponseStream, Request);
+
     LogHttpResponseIfLoglevelVeryVerbose(LogSystem, "PUT", Request, PocoResponse);
 }
 
@@ -342,22 +427,26 @@ void POCOWebClient::Delete(HttpRequest& Request)
 
     Poco::URI Uri(Request.GetUri().GetAsStdString());
 
-    // HTTPSessionFactory returns an unmanaged raw pointer - unique_ptr ensures the session is safely cleaned up after use.
-    std::unique_ptr<Poco::Net::HTTPClientSession> ClientSession(Poco::Net::HTTPSessionFactory::defaultFactory().createClientSession(Uri));
+    HTTPSessionPool::Lease ClientSession = SessionPool.Acquire(Uri, IsIdempotent(Request.GetVerb()));
     Poco::Net::HTTPRequest PocoRequest(Poco::Net::HTTPRequest::HTTP_DELETE, Uri.getPathAndQuery(), Poco::Net::HTTPRequest::HTTP_1_1);
 
-    PrepareAndSendRequest(Request, PocoRequest, ClientSession.get(), ERequestBodyMode::Inline);
-
     Poco::Net::HTTPResponse PocoResponse;
-    std::istream& ResponseStream = ReceiveResponse(ClientSession.get(), PocoResponse, Request);
+    std::istream* ResponseStream = SendAndReceive(Request, PocoRequest, ClientSession, ERequestBodyMode::Inline, PocoResponse);
+
+    if (ResponseStream == nullptr)
+    {
+        return;
+    }
 
     if (PocoResponse.getStatus() == Poco::Net::HTTPResponse::HTTP_OK)
     {
         std::string ResponseString;
-        Poco::StreamCopier::copyToString(ResponseStream, ResponseString);
+        Poco::StreamCopier::copyToString(*ResponseStream, ResponseString);
         Request.SetResponseData(ResponseString.c_str(), ResponseString.length());
     }
 
+    ReleaseSession(ClientSession, PocoResponse, *ResponseStream, Request);
+
     LogHttpResponseIfLoglevelVeryVerbose(LogSystem, "DELETE", Request, PocoResponse);
 }
 
@@ -367,20 +456,24 @@ void POCOWebClient::Head(HttpRequest& Request)
 
     Poco::URI Uri(Request.GetUri().GetAsStdString());
 
-    // HTTPSessionFactory returns an unmanaged raw pointer - unique_ptr ensures the session is safely cleaned up after use.
-    std::unique_ptr<Poco::Net::HTTPClientSession> ClientSession(Poco::Net::HTTPSessionFactory::defaultFactory().createClientSession(Uri));
+    HTTPSessionPool::Lease ClientSession = SessionPool.Acquire(Uri, IsIdempotent(Request.GetVerb()));
     Poco::Net::HTTPRequest PocoRequest(Poco::Net::HTTPRequest::HTTP_HEAD, Uri.getPathAndQuery(), Poco::Net::HTTPRequest::HTTP_1_1);
 
-    PrepareAndSendRequest(Request, PocoRequest, ClientSession.get(), ERequestBodyMode::None);
-
     Poco::Net::HTTPResponse PocoResponse;
-    std::istream& ResponseStream = ReceiveResponse(ClientSession.get(), PocoResponse, Request);
+    std::istream* ResponseStream = SendAndReceive(Request, PocoRequest, ClientSession, ERequestBodyMode::None, PocoResponse);
+
+    if (ResponseStream == nullptr)
+    {
+        return;
+    }
 
     if (PocoResponse.getStatus() == Poco::Net::HTTPResponse::HTTP_OK)
     {
-        ProcessResponseAsync(*ClientSession, PocoResponse, ResponseStream, Request);
+        ProcessResponseAsync(*ClientSession, PocoResponse, *ResponseStream, Request);
     }
 
+    ReleaseSession(ClientSession, PocoResponse, *ResponseStream, Request);
+
     LogHttpResponseIfLoglevelVeryVerbose(LogSystem, "HEAD", Request, PocoResponse);
 }
 
@@ -390,26 +483,27 @@ void POCOWebClient::Patch(HttpRequest& Request)
 
     Poco::URI Uri(Request.GetUri().GetAsStdString());
 
-    // HTTPSessionFactory returns an unmanaged raw pointer - unique_ptr ensures the session is safely cleaned up after use.
-    std::unique_ptr<Poco::Net::HTTPClientSession> ClientSession(Poco::Net::HTTPSessionFactory::defaultFactory().createClientSession(Uri));
+    HTTPSessionPool::Lease ClientSession = SessionPool.Acquire(Uri, IsIdempotent(Request.GetVerb()));
     Poco::Net::HTTPRequest PocoRequest(Poco::Net::HTTPRequest::HTTP_PATCH, Uri.getPathAndQuery(), Poco::Net::HTTPRequest::HTTP_1_1);
 
-    if (!PrepareAndSendRequest(Request, PocoRequest, ClientSession.get(), ERequestBodyMode::Streamed))
+    Poco::Net::HTTPResponse PocoResponse;
+    std::istream* ResponseStream = SendAndReceive(Request, PocoRequest, ClientSession, ERequestBodyMode::Streamed, PocoResponse);
+
+    if (ResponseStream == nullptr)
     {
         return;
     }
 
-    Poco::Net::HTTPResponse PocoResponse;
-    std::istream& ResponseStream = ReceiveResponse(ClientSession.get(), PocoResponse, Request);
-
     std::string ResponseString;
-    Poco::StreamCopier::copyToString(ResponseStream, ResponseString);
+    Poco::StreamCopier::copyToString(*ResponseStream, ResponseString);
     Request.SetResponseData(ResponseString.c_str(), ResponseString.length());
     auto& Payload = ((HttpResponse&)Request.GetResponse()).GetMutablePayload();
 
     // Get all response headers
     CopyResponseHeaders(PocoResponse, Payload);
 
+    ReleaseSession(ClientSession, PocoResponse, *ResponseStream, Request);
+
     LogHttpResponseIfLoglevelVeryVerbose(LogSystem, "PATCH", Request, PocoResponse);
 }
 
@@ -419,19 +513,37 @@ void POCOWebClient::ProcessResponseAsync(
     CSP_PROFILE_SCOPED();
 
     std::streamsize ContentLength = PocoResponse.getContentLength();
+    HttpResponseSink* Sink = Request.GetPayload().GetResponseSink().get();
 
-    if (ContentLength == Poco::Net::HTTPMessage::UNKNOWN_CONTENT_LENGTH || ContentLength == 0)
+    // A sink is still told about an empty body, so that it ends up holding one.
+    if (ContentLength == 0 && Sink == nullptr)
     {
         return;
     }
 
-    std::streamsize TotalRead = 0;
+    // Chunked responses don't give their length up front, so are read until the stream ends instead.
+    const bool HasContentLength = ContentLength != Poco::Net::HTTPMessage::UNKNOWN_CONTENT_LENGTH;
 
-    Request.AllocateResponseData(ContentLength);
+    if (Sink != nullptr)
+    {
+        if (Sink->Begin(HasContentLength ? std::optional<size_t>(ContentLength) : std::nullopt) == false)
+        {
+            ClientSession.abort();
+            Request.SetResponseSinkFailed();
+            return;
+        }
+    }
+    else if (HasContentLength)
+    {
+        Request.AllocateResponseData(ContentLength);
+    }
+
+    std::streamsize TotalRead = 0;
+    std::string UnknownLengthBody;
 
     char Buffer[kPOCOAsyncBufferSize];
 
-    while (ResponseStream.good() && TotalRead < ContentLength)
+    while (ResponseStream.good() && (HasContentLength == false || TotalRead < ContentLength))
     {
         if (Request.Cancelled())
         {
@@ -441,12 +553,57 @@ void POCOWebClient::ProcessResponseAsync(
 
         ResponseStream.read(Buffer, sizeof(Buffer));
         std::streamsize Read = ResponseStream.gcount();
-        Request.WriteResponseData(TotalRead, Buffer, Read);
+
+        if (Sink != nullptr)
+        {
+            if (Read > 0 && Sink->Write(Buffer, Read) == false)
+            {
+                ClientSession.abort();
+                Request.SetResponseSinkFailed();
+                return;
+            }
+        }
+        else if (HasContentLength)
+        {
+            Request.WriteResponseData(TotalRead, Buffer, Read);
+        }
+        else
+        {
+            UnknownLengthBody.append(Buffer, Read);
+        }
 
         TotalRead += Read;
-        float Progress = 100.0f * static_cast<float>(TotalRead) / ContentLength;
-        // RWD_FORMATTED_LOG("Response Progress %f %d %d\n", Progress, TotalRead, ContentLength);
-        Request.SetResponseProgress(Progress);
+
+        if (HasContentLength)
+        {
+            float Progress = 100.0f * static_cast<float>(TotalRead) / ContentLength;
+            // RWD_FORMATTED_LOG("Response Progress %f %d %d\n", Progress, TotalRead, ContentLength);
+            Request.SetResponseProgress(Progress);
+        }
+    }
+
+    if (Sink != nullptr)
+    {
+        // A sink may well be writing somewhere that outlives the request, so a truncated body is treated as a failed download.
+        if (ResponseStream.bad() || (HasContentLength && TotalRead < ContentLength))
+        {
+            throw Poco::Net::MessageException("Response body ended before its content length was reached");
+        }
+
+        if (Sink->End() == false)
+        {
+            Request.SetResponseSinkFailed();
+            return;
+        }
+    }
+    else if (HasContentLength == false)
+    {
+        Request.SetResponseData(UnknownLengthBody.c_str(), UnknownLengthBody.length());
+    }
+
+    if (HasContentLength == false)
+    {
+        Request.SetResponseProgress(100.0f);
     }
 
     auto& Response = Request.GetResponse();
@@ -471,7 +628,7 @@ void POCOWebClient::ProcessRequestAsync(
 {
     CSP_PROFILE_SCOPED();
 
-    size_t ContentLength = Request.GetPayload().GetContent().Length();
+    size_t ContentLength = Request.GetPayload().GetContentLength();
 
     if (ContentLength == 0)
     {
@@ -492,6 +649,13 @@ void POCOWebClient::ProcessRequestAsync(
 
         size_t Length = Request.GetPayload().ReadContent(TotalWritten, buffer, sizeof(buffer));
 
+        if (Length == 0)
+        {
+            // A streamed body (e.g. a file being uploaded) has stopped short of its declared length, so the request can't be completed.
+            ClientSession.abort();
+            throw Poco::IOException("Request body ended before its content length was reached");
+        }
+
         RequestStream.write(buffer, Length);
         TotalWritten += Length;
 
@@ -513,20 +677,39 @@ std::string POCOWebClient::MD5Hash(const void* Data, const size_t Size)
     return DigestHex;
 }
 
+std::string POCOWebClient::MD5HashFile(const char* FilePath)
+{
+    std::ifstream File(FilePath, std::ios::in | std::ios::binary);
+
+    if (File.is_open() == false)
+    {
+        return {};
+    }
+
+    return MD5HashStream(File);
+}
+
 void POCOWebClient::SetFileUploadContentFromFile(
     HttpPayload* Payload, const char* FilePath, const char* Version, const csp::common::String& MediaType)
 {
-    Poco::File* File = new Poco::File(FilePath);
-    if (File->exists())
+    Poco::File File(FilePath);
+    if (File.exists() == false)
     {
-        /// @note this must be newed as it is deleted by the HTMLForm
-        Poco::Net::FilePartSource* Source = new Poco::Net::FilePartSource(FilePath, MediaType.c_str());
-        SetFileUploadContent(Payload, Source, Version);
+        CSP_LOG_WARN_FORMAT("File not found. Path given: %s", FilePath);
+        return;
     }
-    else
+
+    // The body is produced from the file as the request is sent, rather than being built in memory up front.
+    auto Source = std::make_shared<MultipartFileContentSource>(FilePath, MediaType.c_str(), Version);
+
+    if (Source->IsValid() == false)
     {
-        CSP_LOG_WARN_FORMAT("File not found. Path given: %s", FilePath);
+        CSP_LOG_WARN_FORMAT("File could not be read. Path given: %s", FilePath);
+        return;
     }
+
+    Payload->SetContentSource(Source);
+    Payload->SetBoundary(CSP_TEXT(Source->GetBoundary().c_str()));
 }
 
 void POCOWebClient::SetFileUploadContentFromString(HttpPayload* Payload, const csp::common::String& StringSource, const csp::common::String& FileName,
@@ -604,7 +787,8 @@ void POCOWebClient::SetFileUploadContent(HttpPayload* Payload, Poco::Net::PartSo
     std::stringstream strm;
     Form.write(strm);
 
-    Payload->SetContent(strm.str().c_str(), strm.str().size());
+    const std::string Body = strm.str();
+    Payload->SetContent(Body.c_str(), Body.size());
     Payload->SetBoundary(CSP_TEXT(Form.boundary().c_str()));
 }
 
@@ -17,6 +17,7 @@
 
 #ifndef CSP_WASM
 
+#include "Common/Web/POCOWebClient/HTTPSessionPool.h"
 #include "Common/Web/WebClient.h"
 
 #include <Poco/Net/HTTPCookie.h>
@@ -58,6 +59,7 @@ public:
     using WebClient::WebClient;
 
     std::string MD5Hash(const void* Data, const size_t Size) override;
+    std::string MD5HashFile(const char* FilePath) override;
 
     void SetFileUploadContentFromFile(HttpPayload* Payload, const char* FilePath, const char* Version, const csp::common::String& MediaType) override;
     void SetFileUploadContentFromString(HttpPayload* Payload, const csp::common::String& StringSource, const csp::common::String& FileName,
@@ -69,6 +71,9 @@ public:
     POCOWebClient(const Port InPort, const ETransferProtocol Tp, csp::common::LogSystem* LogSystem, bool AutoRefresh = true);
     POCOWebClient(const Port InPort, const ETransferProtocol Tp, csp::common::IAuthContext& AuthContext, csp::common::LogSystem* LogSystem, bool AutoRefresh = true);
 
+    // The pool of keep-alive sessions requests are sent on. Exposed for configuration and for its statistics.
+    HTTPSessionPool& GetSessionPool();
+
 protected:
     void SetFileUploadContent(HttpPayload* Payload, Poco::Net::PartSource* Source, const char* Version);
 
@@ -107,8 +112,20 @@ private:
     bool PrepareAndSendRequest(
         HttpRequest& Request, Poco::Net::HTTPRequest PocoRequest, Poco::Net::HTTPClientSession* ClientSession, ERequestBodyMode SendBodyMode);
 
+    // Sends the request and receives the response head. If a pooled session turns out to have been closed by the server,
+    // idempotent requests (GET, HEAD, PUT, DELETE) are retried once on a new session. Returns null if the request was cancelled
+    // while sending its body.
+    std::istream* SendAndReceive(HttpRequest& Request, const Poco::Net::HTTPRequest& PocoRequest, HTTPSessionPool::Lease& ClientSession,
+        ERequestBodyMode SendBodyMode, Poco::Net::HTTPResponse& PocoResponse);
+
+    // Returns the session to the pool if the connection can carry another request, otherwise closes it.
+    void ReleaseSession(
+        HTTPSessionPool::Lease& ClientSession, const Poco::Net::HTTPResponse& PocoResponse, std::istream& ResponseStream, HttpRequest& Request);
+
     std::istream& ReceiveResponse(
         Poco::Net::HTTPClientSession* ClientSession, Poco::Net::HTTPResponse& PocoResponse, HttpRequest& Request);
+
+    HTTPSessionPool SessionPool;
 };
 
 } // namespace csp::web
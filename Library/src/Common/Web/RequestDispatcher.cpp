@@ -0,0 +1,324 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CSP_WASM
+
+#include "Common/Web/RequestDispatcher.h"
+
+#include "Debug/Logging.h"
+
+#include <algorithm>
+#include <exception>
+#include <optional>
+
+namespace csp::web
+{
+
+RequestDispatcher::RequestDispatcher(csp::TaskExecutor& InExecutor, size_t InMaxInFlight)
+    : Executor(InExecutor)
+    , MaxInFlight(std::max<size_t>(InMaxInFlight, 1))
+    , NextSequence(0)
+    , InFlight(0)
+    , ReadyCount(0)
+    , GateOpen(true)
+    , ShutdownFlag(false)
+{
+    TimerThread = std::thread([this]() { TimerLoop(); });
+}
+
+RequestDispatcher::~RequestDispatcher() { Shutdown(); }
+
+void RequestDispatcher::Dispatch(std::function<void()> Work, csp::TaskPriority Priority, std::chrono::milliseconds Delay, bool WaitsForGate)
+{
+    std::vector<Item> Admitted;
+    bool WakeTimer = false;
+
+    {
+        std::scoped_lock<std::mutex> Locker(Mutex);
+
+        Item Entry { std::move(Work), Priority, WaitsForGate };
+
+        if (Delay > std::chrono::milliseconds(0))
+        {
+            const uint64_t Sequence = NextSequence++;
+
+            Timers.push_back({ Clock::now() + Delay, Sequence, std::move(Entry) });
+            std::push_heap(Timers.begin(), Timers.end(), LaterDeadline);
+
+            // The timer only needs waking if it would otherwise sleep past this deadline.
+            WakeTimer = Timers.front().Sequence == Sequence;
+        }
+        else
+        {
+            MakeReadyLocked(std::move(Entry));
+            AdmitLocked(Admitted);
+        }
+    }
+
+    if (WakeTimer)
+    {
+        TimerCondition.notify_one();
+    }
+
+    Run(Admitted);
+}
+
+void RequestDispatcher::CloseGate(std::chrono::milliseconds Timeout)
+{
+    {
+        std::scoped_lock<std::mutex> Locker(Mutex);
+
+        GateOpen = false;
+        GateDeadline = Clock::now() + Timeout;
+    }
+
+    TimerCondition.notify_one();
+}
+
+void RequestDispatcher::OpenGate()
+{
+    std::vector<Item> Admitted;
+
+    {
+        std::scoped_lock<std::mutex> Locker(Mutex);
+
+        GateOpen = true;
+        ReleaseGatedLocked();
+        AdmitLocked(Admitted);
+    }
+
+    Run(Admitted);
+}
+
+bool RequestDispatcher::IsGateOpen() const
+{
+    std::scoped_lock<std::mutex> Locker(Mutex);
+    return GateOpen;
+}
+
+void RequestDispatcher::ReleaseParked()
+{
+    std::vector<Item> Admitted;
+
+    {
+        std::scoped_lock<std::mutex> Locker(Mutex);
+
+        GateOpen = true;
+        ReleaseGatedLocked();
+        ReleaseDueLocked(Clock::time_point::max());
+        AdmitLocked(Admitted);
+    }
+
+    Run(Admitted);
+}
+
+void RequestDispatcher::Shutdown()
+{
+    {
+        std::scoped_lock<std::mutex> Locker(Mutex);
+
+        if (ShutdownFlag)
+        {
+            return;
+        }
+
+        ShutdownFlag = true;
+    }
+
+    TimerCondition.notify_all();
+
+    if (TimerThread.joinable())
+    {
+        TimerThread.join();
+    }
+}
+
+size_t RequestDispatcher::GetInFlightCount() const
+{
+    std::scoped_lock<std::mutex> Locker(Mutex);
+    return InFlight;
+}
+
+size_t RequestDispatcher::GetReadyCount() const
+{
+    std::scoped_lock<std::mutex> Locker(Mutex);
+    return ReadyCount;
+}
+
+size_t RequestDispatcher::GetParkedCount() const
+{
+    std::scoped_lock<std::mutex> Locker(Mutex);
+    return Timers.size() + Gated.size();
+}
+
+bool RequestDispatcher::LaterDeadline(const TimedItem& Lhs, const TimedItem& Rhs)
+{
+    // Ties go to whichever was parked first, so equal delays keep their order.
+    if (Lhs.Deadline != Rhs.Deadline)
+    {
+        return Lhs.Deadline > Rhs.Deadline;
+    }
+
+    return Lhs.Sequence > Rhs.Sequence;
+}
+
+void RequestDispatcher::TimerLoop()
+{
+    std::unique_lock<std::mutex> Locker(Mutex);
+
+    while (ShutdownFlag == false)
+    {
+        const Clock::time_point Now = Clock::now();
+
+        if (GateOpen == false && Now >= GateDeadline)
+        {
+            GateOpen = true;
+            ReleaseGatedLocked();
+        }
+
+        ReleaseDueLocked(Now);
+
+        std::vector<Item> Admitted;
+        AdmitLocked(Admitted);
+
+        if (Admitted.empty() == false)
+        {
+            Locker.unlock();
+            Run(Admitted);
+            Locker.lock();
+
+            continue;
+        }
+
+        std::optional<Clock::time_point> WakeAt;
+
+        if (Timers.empty() == false)
+        {
+            WakeAt = Timers.front().Deadline;
+        }
+
+        if (GateOpen == false && (WakeAt.has_value() == false || GateDeadline < *WakeAt))
+        {
+            WakeAt = GateDeadline;
+        }
+
+        if (WakeAt.has_value())
+        {
+            TimerCondition.wait_until(Locker, *WakeAt);
+        }
+        else
+        {
+            TimerCondition.wait(Locker);
+        }
+    }
+}
+
+void RequestDispatcher::MakeReadyLocked(Item&& Entry)
+{
+    if (Entry.WaitsForGate && GateOpen == false)
+    {
+        Gated.push_back(std::move(Entry));
+        return;
+    }
+
+    Ready[static_cast<size_t>(Entry.Priority)].push_back(std::move(Entry));
+    ++ReadyCount;
+}
+
+void RequestDispatcher::ReleaseGatedLocked()
+{
+    std::vector<Item> Released;
+    Released.swap(Gated);
+
+    for (Item& Entry : Released)
+    {
+        MakeReadyLocked(std::move(Entry));
+    }
+}
+
+void RequestDispatcher::ReleaseDueLocked(Clock::time_point Now)
+{
+    while (Timers.empty() == false && Timers.front().Deadline <= Now)
+    {
+        std::pop_heap(Timers.begin(), Timers.end(), LaterDeadline);
+        Item Entry = std::move(Timers.back().Entry);
+        Timers.pop_back();
+
+        MakeReadyLocked(std::move(Entry));
+    }
+}
+
+void RequestDispatcher::AdmitLocked(std::vector<Item>& OutAdmitted)
+{
+    for (auto& Queue : Ready)
+    {
+        while (InFlight < MaxInFlight && Queue.empty() == false)
+        {
+            OutAdmitted.push_back(std::move(Queue.front()));
+            Queue.pop_front();
+
+            --ReadyCount;
+            ++InFlight;
+        }
+    }
+}
+
+void RequestDispatcher::Run(std::vector<Item>& Admitted)
+{
+    for (Item& Entry : Admitted)
+    {
+        Executor.Enqueue(
+            [this, Work = std::move(Entry.Work)]()
+            {
+                // The slot has to be given back however the work ends, or the dispatcher would eventually stop admitting anything.
+                try
+                {
+                    Work();
+                }
+                catch (const std::exception& Ex)
+                {
+                    CSP_LOG_ERROR_FORMAT("RequestDispatcher: Dispatched work threw: %s", Ex.what());
+                }
+                catch (...)
+                {
+                    CSP_LOG_ERROR_MSG("RequestDispatcher: Dispatched work threw an unknown exception.");
+                }
+
+                OnComplete();
+            },
+            Entry.Priority);
+    }
+
+    Admitted.clear();
+}
+
+void RequestDispatcher::OnComplete()
+{
+    std::vector<Item> Admitted;
+
+    {
+        std::scoped_lock<std::mutex> Locker(Mutex);
+
+        --InFlight;
+        AdmitLocked(Admitted);
+    }
+
+    Run(Admitted);
+}
+
+} // namespace csp::web
+
+#endif
@@ -0,0 +1,137 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef CSP_WASM
+
+#include "Common/TaskExecutor.h"
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace csp::web
+{
+
+/// @brief Admits web requests onto a TaskExecutor by priority, without letting more than a fixed number run at once.
+///
+/// Requests that can't be sent yet don't take up a worker while they wait. Requests with a send delay (e.g. retries backing off) are
+/// parked on a timer, and requests that need a valid access token are held back behind a gate while the token is being refreshed.
+/// Both are moved onto the ready queues once they can go, and from there are admitted highest priority first, in the order they became
+/// ready, whenever fewer than the concurrency limit are running.
+///
+/// The gate is closed with a timeout, so if a refresh never reports back, held requests are eventually let through rather than stalling
+/// all traffic.
+class RequestDispatcher
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    RequestDispatcher(csp::TaskExecutor& InExecutor, size_t InMaxInFlight);
+    ~RequestDispatcher();
+
+    RequestDispatcher(const RequestDispatcher&) = delete;
+    RequestDispatcher& operator=(const RequestDispatcher&) = delete;
+
+    /// @brief Queue work to be run on the executor.
+    /// @param Work The work to run. Counts against the concurrency limit until it returns.
+    /// @param Priority Higher priority work is admitted before anything of a lower priority that is ready.
+    /// @param Delay How long to park the work for before it becomes ready.
+    /// @param WaitsForGate Whether the work should be held back while the gate is closed.
+    void Dispatch(std::function<void()> Work, csp::TaskPriority Priority = csp::TaskPriority::Normal,
+        std::chrono::milliseconds Delay = std::chrono::milliseconds(0), bool WaitsForGate = true);
+
+    /// @brief Hold back gated work until OpenGate is called, or the timeout passes.
+    void CloseGate(std::chrono::milliseconds Timeout);
+    /// @brief Let any held back work through, and stop holding back new work.
+    void OpenGate();
+    [[nodiscard]] bool IsGateOpen() const;
+
+    /// @brief Make everything parked on the timer or held behind the gate ready straight away, and open the gate. Used when shutting
+    /// down, so cancelled requests don't have to sit out their delays.
+    void ReleaseParked();
+
+    /// @brief Stops the timer thread. Anything still parked stays parked. Safe to call more than once.
+    void Shutdown();
+
+    [[nodiscard]] size_t GetInFlightCount() const;
+    // Number of items ready to run, but waiting on the concurrency limit.
+    [[nodiscard]] size_t GetReadyCount() const;
+    // Number of items parked on the timer or held behind the gate.
+    [[nodiscard]] size_t GetParkedCount() const;
+
+private:
+    static constexpr size_t PriorityCount = static_cast<size_t>(csp::TaskPriority::Num);
+
+    struct Item
+    {
+        std::function<void()> Work;
+        csp::TaskPriority Priority;
+        bool WaitsForGate;
+    };
+
+    struct TimedItem
+    {
+        Clock::time_point Deadline;
+        uint64_t Sequence;
+        Item Entry;
+    };
+
+    static bool LaterDeadline(const TimedItem& Lhs, const TimedItem& Rhs);
+
+    void TimerLoop();
+
+    // The following expect Mutex to be held.
+    void MakeReadyLocked(Item&& Entry);
+    void ReleaseGatedLocked();
+    void ReleaseDueLocked(Clock::time_point Now);
+    void AdmitLocked(std::vector<Item>& OutAdmitted);
+
+    // Hands admitted items to the executor. Must be called without Mutex held.
+    void Run(std::vector<Item>& Admitted);
+    void OnComplete();
+
+    csp::TaskExecutor& Executor;
+    const size_t MaxInFlight;
+
+    mutable std::mutex Mutex;
+    std::condition_variable TimerCondition;
+
+    std::array<std::deque<Item>, PriorityCount> Ready;
+    // Min-heap on deadline, see LaterDeadline.
+    std::vector<TimedItem> Timers;
+    std::vector<Item> Gated;
+    uint64_t NextSequence;
+    size_t InFlight;
+    size_t ReadyCount;
+
+    bool GateOpen;
+    Clock::time_point GateDeadline;
+
+    bool ShutdownFlag;
+    std::thread TimerThread;
+};
+
+} // namespace csp::web
+
+#endif
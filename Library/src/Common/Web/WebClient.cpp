@@ -17,6 +17,8 @@
 #include "CSP/Common/Interfaces/IAuthContext.h"
 #include "CSP/Common/Systems/Log/LogSystem.h"
 #include "CSP/Common/fmt_Formatters.h"
+#include "Common/Systems/Log/LogFormat.h"
+#include "Debug/Profiler.h"
 #include "Json.h"
 #include "Services/ApiBase/ApiBase.h"
 
@@ -29,17 +31,31 @@ using namespace std::chrono_literals;
 namespace csp::web
 {
 
+#ifndef CSP_WASM
+namespace
+{
+
+// How long requests are held back waiting for a token refresh before being let through regardless.
+constexpr std::chrono::milliseconds kRefreshGateTimeout = 30s;
+
+// Set while a client is asking its auth context for a token refresh, so the request that makes isn't held back behind its own refresh.
+thread_local bool IssuingTokenRefresh = false;
+thread_local uint32_t TokenRefreshRequestCount = 0;
+
+} // namespace
+#endif
+
 WebClient::WebClient(
     const Port InPort, const ETransferProtocol /*Tp*/, csp::common::IAuthContext& AuthContext, csp::common::LogSystem* LogSystem, bool AutoRefresh)
     : RootPort(InPort)
     , AuthContext { &AuthContext }
     , LogSystem(LogSystem)
     , RefreshNeeded(false)
-    , RefreshStarted(false)
     , AutoRefreshEnabled(AutoRefresh)
 #ifndef CSP_WASM
     , RequestCount(0)
-    , ThreadPool(CSP_MAX_CONCURRENT_REQUESTS)
+    , RequestExecutor(CSP_MAX_CONCURRENT_REQUESTS)
+    , Dispatcher(RequestExecutor, CSP_MAX_CONCURRENT_REQUESTS)
 #endif
 {
 }
@@ -49,11 +65,11 @@ WebClient::WebClient(const Port InPort, const ETransferProtocol /*Tp*/, csp::com
     , AuthContext(nullptr)
     , LogSystem(LogSystem)
     , RefreshNeeded(false)
-    , RefreshStarted(false)
     , AutoRefreshEnabled(AutoRefresh)
 #ifndef CSP_WASM
     , RequestCount(0)
-    , ThreadPool(CSP_MAX_CONCURRENT_REQUESTS)
+    , RequestExecutor(CSP_MAX_CONCURRENT_REQUESTS)
+    , Dispatcher(RequestExecutor, CSP_MAX_CONCURRENT_REQUESTS)
 #endif
 {
 }
@@ -89,6 +105,9 @@ WebClient::~WebClient()
     }
     RequestsMutex.unlock();
 
+    // Don't leave cancelled requests sitting out a retry delay or waiting on a token refresh
+    Dispatcher.ReleaseParked();
+
     // Wait for all cancelled requests to be processed
     while ((RequestCount > 0) && (WaitCounter < kMaxWaitCounter))
     {
@@ -115,7 +134,8 @@ WebClient::~WebClient()
 
     PollRequests.Close();
 
-    ThreadPool.Shutdown();
+    Dispatcher.Shutdown();
+    RequestExecutor.Shutdown();
 #endif
 }
 
@@ -135,7 +155,19 @@ void WebClient::RefreshIfExpired()
         }
         WasmRequestsMutex.unlock();
 #else
-        RefreshNeeded = true;
+        // Only one caller gets to start the refresh
+        bool Expected = false;
+
+        if (RefreshNeeded.compare_exchange_strong(Expected, true) == false)
+        {
+            return;
+        }
+
+        // Hold back new requests until the refresh completes, they would only be sent with the expiring token
+        Dispatcher.CloseGate(kRefreshGateTimeout);
+
+        IssuingTokenRefresh = true;
+        TokenRefreshRequestCount = 0;
 #endif
 
         AuthContext->RefreshToken(
@@ -158,8 +190,8 @@ void WebClient::RefreshIfExpired()
                     WasmRequestsMutex.unlock();
 #else
                     RefreshNeeded = false;
+                    Dispatcher.OpenGate();
 #endif
-                    RefreshStarted = false;
                 }
                 else
                 {
@@ -167,15 +199,30 @@ void WebClient::RefreshIfExpired()
 
                     // reset the state of the web client to prevent indefinite freeze when enqueuing a request
                     RefreshNeeded = true;
-                    RefreshStarted = false;
+#ifndef CSP_WASM
+                    Dispatcher.OpenGate();
+#endif
                 }
             });
+
+#ifndef CSP_WASM
+        IssuingTokenRefresh = false;
+
+        // The auth context didn't send a refresh request (e.g. it isn't logged in), so nothing will open the gate
+        if (TokenRefreshRequestCount == 0 && Dispatcher.IsGateOpen() == false)
+        {
+            RefreshNeeded = false;
+            Dispatcher.OpenGate();
+        }
+#endif
     }
 }
 
 void WebClient::SendRequest(ERequestVerb Verb, const csp::web::Uri& InUri, HttpPayload& Payload, IHttpResponseHandler* ResponseCallback,
     csp::common::CancellationToken& CancellationToken, bool AsyncResponse)
 {
+    CSP_PROFILE_SCOPED();
+
     if (WAFBypassValue.has_value())
     {
         Payload.AddHeader(CSP_TEXT("X-WAF-Bypass"), CSP_TEXT(WAFBypassValue->c_str()));
@@ -185,7 +232,7 @@ void WebClient::SendRequest(ERequestVerb Verb, const csp::web::Uri& InUri, HttpP
 
     if (LogSystem != nullptr && LogSystem->GetSystemLevel() == csp::common::LogLevel::VeryVerbose)
     {
-        LogSystem->LogMsg(csp::common::LogLevel::VeryVerbose, fmt::format("{}", *Request).c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::VeryVerbose, "{}", *Request);
     }
 
 #ifdef CSP_WASM
@@ -243,25 +290,25 @@ void WebClient::AddRequest(HttpRequest* Request, [[maybe_unused]] std::chrono::m
         ++RequestCount;
         Request->IncRefCount();
         Request->SetSendDelay(SendDelay);
-        ThreadPool.Enqueue(
-            [this, Request](void*)
-            {
-                while (RefreshStarted)
-                {
-                    std::this_thread::sleep_for(10ns);
-                }
 
-                if (RefreshNeeded && !RefreshStarted)
-                {
-                    RefreshStarted = true;
-                }
+        if (IssuingTokenRefresh)
+        {
+            Request->SetIsTokenRefresh(true);
+            ++TokenRefreshRequestCount;
+        }
+
+        // Everything else waits on the token refresh, so it goes first, and isn't held back by it
+        const bool IsTokenRefresh = Request->GetIsTokenRefresh();
+        const csp::TaskPriority Priority = IsTokenRefresh ? csp::TaskPriority::High : csp::TaskPriority::Normal;
 
+        Dispatcher.Dispatch(
+            [this, Request]()
+            {
                 Request->RefreshAccessToken();
 
                 ProcessRequest(Request);
-
-                return nullptr;
-            });
+            },
+            Priority, SendDelay, IsTokenRefresh == false);
 #endif
     }
 }
@@ -269,6 +316,8 @@ void WebClient::AddRequest(HttpRequest* Request, [[maybe_unused]] std::chrono::m
 #ifndef CSP_WASM
 void WebClient::ProcessResponses(const uint32_t MaxNumResponses)
 {
+    CSP_PROFILE_SCOPED();
+
     uint32_t ResponseCount = 0;
 
     while ((PollRequests.IsEmpty() == false) && (ResponseCount < MaxNumResponses))
@@ -292,21 +341,17 @@ void WebClient::ProcessResponses(const uint32_t MaxNumResponses)
     }
 }
 
+void WebClient::EnqueueWork(std::function<void()> Work) { RequestExecutor.Enqueue(std::move(Work)); }
+
 void WebClient::ProcessRequest(HttpRequest* Request)
 {
+    CSP_PROFILE_SCOPED();
+
     if (Request)
     {
         auto& Payload = Request->GetMutablePayload();
         Payload.SetBearerToken();
 
-        const std::chrono::milliseconds SendDelay = Request->GetSendDelay();
-
-        if (SendDelay > std::chrono::milliseconds(0))
-        {
-            // Wait before sending if required (e.g. for Retries)
-            std::this_thread::sleep_for(SendDelay);
-        }
-
         try
         {
             if (!Request->Cancelled())
@@ -22,10 +22,12 @@
 #include "Uri.h"
 
 #ifndef CSP_WASM
-#include "Common/ThreadPool.h"
+#include "Common/TaskExecutor.h"
+#include "Common/Web/RequestDispatcher.h"
 #endif
 
 #include <atomic>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <unordered_set>
@@ -91,9 +93,16 @@ public:
     /// @brief Manually poll for responses that have been flagged as non-async
     /// @param MaxNumResponses Maximum number of responses to process in this call
     void ProcessResponses(const uint32_t MaxNumResponses = 64);
+
+    /// @brief Runs follow-up work on the executor requests are sent from, such as checking a downloaded file, so that it doesn't hold up
+    /// the thread that delivered a response.
+    /// @param Work The work to run. It isn't counted against the limit on requests in flight.
+    void EnqueueWork(std::function<void()> Work);
 #endif
 
     virtual std::string MD5Hash(const void* Data, const size_t Size) = 0;
+    /// @brief Hashes a file a chunk at a time, so that large files needn't be held in memory. Returns an empty string if the file can't be read.
+    virtual std::string MD5HashFile(const char* FilePath) = 0;
     virtual void SetFileUploadContentFromFile(HttpPayload* Payload, const char* FilePath, const char* Version, const csp::common::String& MediaType)
         = 0;
     virtual void SetFileUploadContentFromString(HttpPayload* Payload, const csp::common::String& StringSource, const csp::common::String& FileName,
@@ -131,7 +140,7 @@ protected:
 
 private:
 
-    std::atomic_bool RefreshNeeded, RefreshStarted;
+    std::atomic_bool RefreshNeeded;
     bool AutoRefreshEnabled;
     std::optional<std::string> WAFBypassValue;
 
@@ -143,7 +152,9 @@ private:
     void DestroyRequest(HttpRequest* Request);
 
     std::atomic_uint32_t RequestCount;
-    csp::ThreadPool ThreadPool;
+    csp::TaskExecutor RequestExecutor;
+    // Parks delayed and refresh-blocked requests off the executor's workers, and admits the rest by priority.
+    RequestDispatcher Dispatcher;
     csp::Queue<HttpRequest*> PollRequests;
     std::unordered_set<HttpRequest*> Requests;
     std::mutex RequestsMutex;
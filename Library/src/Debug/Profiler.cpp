@@ -0,0 +1,535 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Debug/Profiler.h"
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace csp::profile
+{
+
+namespace
+{
+
+enum class EventPhase : uint8_t
+{
+    Complete,
+    Begin,
+    End,
+    Instant
+};
+
+constexpr uint32_t NO_DETAIL = UINT32_MAX;
+
+struct ProfileEvent
+{
+    uint64_t Timestamp;
+    uint64_t Duration;
+    TagId Tag;
+    uint32_t DetailIndex;
+    EventPhase Phase;
+};
+
+struct EventDetail
+{
+    char Text[MAX_EVENT_DETAIL_LEN];
+};
+
+// An append only array that one thread writes to while others read from it.
+// Storage is allocated in fixed size chunks that never move, so readers can safely access anything below the published size.
+template <typename T> class AppendOnlyBuffer
+{
+public:
+    static constexpr size_t CHUNK_SIZE = 4096;
+    static constexpr size_t MAX_CHUNKS = 256;
+    static constexpr size_t CAPACITY = CHUNK_SIZE * MAX_CHUNKS;
+
+    ~AppendOnlyBuffer()
+    {
+        for (auto& Chunk : Chunks)
+        {
+            delete[] Chunk.load();
+        }
+    }
+
+    // Writer only. Returns the index of the new element, or CAPACITY if the buffer already holds Limit elements.
+    size_t Push(const T& Value, size_t Limit)
+    {
+        const size_t Index = Count.load(std::memory_order_relaxed);
+
+        if (Index >= std::min(Limit, CAPACITY))
+        {
+            return CAPACITY;
+        }
+
+        std::atomic<T*>& Chunk = Chunks[Index / CHUNK_SIZE];
+        T* ChunkData = Chunk.load(std::memory_order_relaxed);
+
+        if (ChunkData == nullptr)
+        {
+            ChunkData = new T[CHUNK_SIZE];
+            Chunk.store(ChunkData, std::memory_order_relaxed);
+        }
+
+        ChunkData[Index % CHUNK_SIZE] = Value;
+        Count.store(Index + 1, std::memory_order_release);
+
+        return Index;
+    }
+
+    // Writer only. Chunks below the limit are kept for reuse, and any beyond it (left from a higher limit) are freed.
+    void Reset(size_t Limit)
+    {
+        Count.store(0, std::memory_order_relaxed);
+
+        for (size_t i = (std::min(Limit, CAPACITY) + CHUNK_SIZE - 1) / CHUNK_SIZE; i < MAX_CHUNKS; ++i)
+        {
+            delete[] Chunks[i].exchange(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    size_t Size() const { return Count.load(std::memory_order_acquire); }
+
+    // Only valid for indices below a previously read Size.
+    const T& operator[](size_t Index) const { return Chunks[Index / CHUNK_SIZE].load(std::memory_order_relaxed)[Index % CHUNK_SIZE]; }
+
+private:
+    std::array<std::atomic<T*>, MAX_CHUNKS> Chunks {};
+    std::atomic<size_t> Count { 0 };
+};
+
+struct ThreadBuffer
+{
+    AppendOnlyBuffer<ProfileEvent> Events;
+    AppendOnlyBuffer<EventDetail> Details;
+    std::atomic<uint64_t> DroppedCount { 0 };
+
+    // The capture this buffer's contents belong to. The owning thread resets the buffer when it falls behind the current capture.
+    std::atomic<uint64_t> Epoch { 0 };
+
+    // Buffers outlive their threads. Once the previous owner has exited, and its events are no longer part of the current capture, a buffer
+    // is handed to a new thread.
+    std::atomic<bool> InUse { true };
+
+    uint32_t ThreadIndex = 0;
+    std::string ThreadName;
+};
+
+struct Tag
+{
+    std::string Name;
+    std::string Category;
+};
+
+class ProfilerState
+{
+public:
+    static ProfilerState& Get()
+    {
+        // Deliberately leaked, so that threads exiting during static destruction can still release their buffers.
+        static ProfilerState* Instance = new ProfilerState();
+        return *Instance;
+    }
+
+    ThreadBuffer* AcquireThreadBuffer()
+    {
+        std::scoped_lock<std::mutex> Lock(Mutex);
+
+        const uint64_t CurrentEpoch = Epoch.load();
+
+        for (auto& Buffer : ThreadBuffers)
+        {
+            // A buffer holding events from the current capture stays with the thread that recorded them until the capture is cleared,
+            // so that they're still exported under that thread.
+            if (Buffer->InUse.load() == false && (Buffer->Epoch.load() != CurrentEpoch || Buffer->Events.Size() == 0))
+            {
+                // Marking the contents as stale has the new owner reset them the first time it records.
+                Buffer->Epoch.store(0);
+                Buffer->InUse.store(true);
+                Buffer->ThreadIndex = NextThreadIndex++;
+                Buffer->ThreadName.clear();
+
+                return Buffer.get();
+            }
+        }
+
+        auto& Buffer = ThreadBuffers.emplace_back(std::make_unique<ThreadBuffer>());
+        Buffer->ThreadIndex = NextThreadIndex++;
+
+        return Buffer.get();
+    }
+
+    TagId InternTag(std::string_view Name, std::string_view Category)
+    {
+        std::scoped_lock<std::mutex> Lock(Mutex);
+
+        std::string Key;
+        Key.reserve(Category.size() + 1 + Name.size());
+        Key.append(Category).append(1, '\0').append(Name);
+
+        const auto It = TagIds.find(Key);
+
+        if (It != TagIds.end())
+        {
+            return It->second;
+        }
+
+        const TagId Id = static_cast<TagId>(Tags.size());
+        Tags.push_back({ std::string(Name), std::string(Category) });
+        TagIds.emplace(std::move(Key), Id);
+
+        return Id;
+    }
+
+    std::mutex Mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> ThreadBuffers;
+    std::deque<Tag> Tags;
+    std::unordered_map<std::string, TagId> TagIds;
+
+    std::atomic<uint64_t> Epoch { 1 };
+    std::atomic<size_t> MaxEventsPerThread { Profiler::DEFAULT_MAX_EVENTS_PER_THREAD };
+
+    // Every thread a buffer is handed to gets its own index, so that it shows up as a separate thread in traces.
+    uint32_t NextThreadIndex = 1;
+};
+
+// Returns the buffer back to the pool when its thread exits.
+struct ThreadBufferHandle
+{
+    ~ThreadBufferHandle()
+    {
+        if (Buffer != nullptr)
+        {
+            Buffer->InUse.store(false);
+        }
+    }
+
+    ThreadBuffer* Buffer = nullptr;
+};
+
+thread_local ThreadBufferHandle LocalBuffer;
+
+ThreadBuffer& GetThreadBuffer()
+{
+    if (LocalBuffer.Buffer == nullptr)
+    {
+        LocalBuffer.Buffer = ProfilerState::Get().AcquireThreadBuffer();
+    }
+
+    ThreadBuffer& Buffer = *LocalBuffer.Buffer;
+    ProfilerState& State = ProfilerState::Get();
+    const uint64_t CurrentEpoch = State.Epoch.load(std::memory_order_acquire);
+
+    if (Buffer.Epoch.load(std::memory_order_relaxed) != CurrentEpoch)
+    {
+        const size_t MaxEvents = State.MaxEventsPerThread.load(std::memory_order_relaxed);
+
+        Buffer.Events.Reset(MaxEvents);
+        Buffer.Details.Reset(MaxEvents);
+        Buffer.DroppedCount.store(0, std::memory_order_relaxed);
+        Buffer.Epoch.store(CurrentEpoch, std::memory_order_release);
+    }
+
+    return Buffer;
+}
+
+void Record(EventPhase Phase, TagId Tag, uint64_t Timestamp, uint64_t Duration, const char* Detail)
+{
+    ThreadBuffer& Buffer = GetThreadBuffer();
+    const size_t MaxEvents = ProfilerState::Get().MaxEventsPerThread.load(std::memory_order_relaxed);
+
+    uint32_t DetailIndex = NO_DETAIL;
+
+    if (Detail != nullptr)
+    {
+        EventDetail NewDetail;
+        strncpy(NewDetail.Text, Detail, MAX_EVENT_DETAIL_LEN - 1);
+        NewDetail.Text[MAX_EVENT_DETAIL_LEN - 1] = '\0';
+
+        const size_t Index = Buffer.Details.Push(NewDetail, MaxEvents);
+
+        if (Index != AppendOnlyBuffer<EventDetail>::CAPACITY)
+        {
+            DetailIndex = static_cast<uint32_t>(Index);
+        }
+    }
+
+    if (Buffer.Events.Push({ Timestamp, Duration, Tag, DetailIndex, Phase }, MaxEvents) == AppendOnlyBuffer<ProfileEvent>::CAPACITY)
+    {
+        Buffer.DroppedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+// Trims "ReturnType csp::systems::Class::Function(Args...)" down to "csp::systems::Class::Function".
+std::string_view TrimFunctionSignature(std::string_view Signature)
+{
+    const size_t ArgsStart = Signature.find('(');
+
+    if (ArgsStart != std::string_view::npos)
+    {
+        Signature = Signature.substr(0, ArgsStart);
+    }
+
+    const size_t CspStart = Signature.find("csp::");
+
+    if (CspStart != std::string_view::npos)
+    {
+        return Signature.substr(CspStart);
+    }
+
+    const size_t NameStart = Signature.find_last_of(' ');
+
+    return NameStart != std::string_view::npos ? Signature.substr(NameStart + 1) : Signature;
+}
+
+// "csp::multiplayer::SpaceEntity::Tick" is categorised as "multiplayer".
+std::string_view CategoryFromFunctionName(std::string_view Name)
+{
+    constexpr std::string_view CSP_NAMESPACE = "csp::";
+
+    if (Name.substr(0, CSP_NAMESPACE.size()) == CSP_NAMESPACE)
+    {
+        const std::string_view Rest = Name.substr(CSP_NAMESPACE.size());
+        const size_t End = Rest.find("::");
+
+        if (End != std::string_view::npos)
+        {
+            return Rest.substr(0, End);
+        }
+    }
+
+    return "csp";
+}
+
+} // namespace
+
+std::atomic<bool> Profiler::Recording { false };
+
+void Profiler::Start()
+{
+    Clear();
+    Recording.store(true);
+}
+
+void Profiler::Stop() { Recording.store(false); }
+
+void Profiler::Clear()
+{
+    ProfilerState& State = ProfilerState::Get();
+
+    // Each thread resets its own buffer the next time it records, so we never write to a buffer that another thread is appending to.
+    std::scoped_lock<std::mutex> Lock(State.Mutex);
+    State.Epoch.fetch_add(1);
+}
+
+std::string Profiler::ExportChromeTrace()
+{
+    ProfilerState& State = ProfilerState::Get();
+
+    // Holding the lock keeps the epoch stable, so no thread will reset its buffer while we're reading it.
+    std::scoped_lock<std::mutex> Lock(State.Mutex);
+
+    const uint64_t CurrentEpoch = State.Epoch.load();
+
+    struct BufferSnapshot
+    {
+        const ThreadBuffer* Buffer;
+        size_t EventCount;
+        size_t DetailCount;
+    };
+
+    std::vector<BufferSnapshot> Snapshots;
+    uint64_t FirstTimestamp = UINT64_MAX;
+    uint64_t DroppedCount = 0;
+
+    for (const auto& Buffer : State.ThreadBuffers)
+    {
+        if (Buffer->Epoch.load(std::memory_order_acquire) != CurrentEpoch)
+        {
+            continue;
+        }
+
+        // Read details first, so that every detail an event we read refers to has been published.
+        const size_t DetailCount = Buffer->Details.Size();
+        const size_t EventCount = Buffer->Events.Size();
+
+        // Complete events are appended when their scope ends, so the earliest start may be anywhere in the buffer.
+        for (size_t i = 0; i < EventCount; ++i)
+        {
+            FirstTimestamp = std::min(FirstTimestamp, Buffer->Events[i].Timestamp);
+        }
+
+        DroppedCount += Buffer->DroppedCount.load(std::memory_order_relaxed);
+        Snapshots.push_back({ Buffer.get(), EventCount, DetailCount });
+    }
+
+    rapidjson::StringBuffer Output;
+    rapidjson::Writer<rapidjson::StringBuffer> Writer(Output);
+
+    // Chrome trace timestamps are in microseconds, but may be fractional.
+    const auto WriteTime = [&Writer](uint64_t Nanoseconds) { Writer.Double(static_cast<double>(Nanoseconds) / 1000.0); };
+
+    Writer.StartObject();
+    Writer.Key("traceEvents");
+    Writer.StartArray();
+
+    for (const auto& Snapshot : Snapshots)
+    {
+        const ThreadBuffer& Buffer = *Snapshot.Buffer;
+
+        if (Buffer.ThreadName.empty() == false)
+        {
+            Writer.StartObject();
+            Writer.Key("name");
+            Writer.String("thread_name");
+            Writer.Key("ph");
+            Writer.String("M");
+            Writer.Key("pid");
+            Writer.Uint(1);
+            Writer.Key("tid");
+            Writer.Uint(Buffer.ThreadIndex);
+            Writer.Key("args");
+            Writer.StartObject();
+            Writer.Key("name");
+            Writer.String(Buffer.ThreadName.c_str(), static_cast<rapidjson::SizeType>(Buffer.ThreadName.size()));
+            Writer.EndObject();
+            Writer.EndObject();
+        }
+
+        for (size_t i = 0; i < Snapshot.EventCount; ++i)
+        {
+            const ProfileEvent& Event = Buffer.Events[i];
+
+            Writer.StartObject();
+
+            // End events close the most recent Begin event on the same thread, so don't carry a tag of their own.
+            if (Event.Phase != EventPhase::End)
+            {
+                const Tag& EventTag = State.Tags[Event.Tag];
+
+                Writer.Key("name");
+                Writer.String(EventTag.Name.c_str(), static_cast<rapidjson::SizeType>(EventTag.Name.size()));
+                Writer.Key("cat");
+                Writer.String(EventTag.Category.c_str(), static_cast<rapidjson::SizeType>(EventTag.Category.size()));
+            }
+
+            Writer.Key("ph");
+
+            switch (Event.Phase)
+            {
+            case EventPhase::Complete:
+                Writer.String("X");
+                break;
+            case EventPhase::Begin:
+                Writer.String("B");
+                break;
+            case EventPhase::End:
+                Writer.String("E");
+                break;
+            case EventPhase::Instant:
+                Writer.String("i");
+                Writer.Key("s");
+                Writer.String("t");
+                break;
+            }
+
+            Writer.Key("ts");
+            WriteTime(Event.Timestamp - FirstTimestamp);
+
+            if (Event.Phase == EventPhase::Complete)
+            {
+                Writer.Key("dur");
+                WriteTime(Event.Duration);
+            }
+
+            Writer.Key("pid");
+            Writer.Uint(1);
+            Writer.Key("tid");
+            Writer.Uint(Buffer.ThreadIndex);
+
+            if (Event.DetailIndex != NO_DETAIL && Event.DetailIndex < Snapshot.DetailCount)
+            {
+                Writer.Key("args");
+                Writer.StartObject();
+                Writer.Key("detail");
+                Writer.String(Buffer.Details[Event.DetailIndex].Text);
+                Writer.EndObject();
+            }
+
+            Writer.EndObject();
+        }
+    }
+
+    Writer.EndArray();
+
+    Writer.Key("displayTimeUnit");
+    Writer.String("ns");
+
+    Writer.Key("otherData");
+    Writer.StartObject();
+    Writer.Key("droppedEvents");
+    Writer.Uint64(DroppedCount);
+    Writer.EndObject();
+
+    Writer.EndObject();
+
+    return std::string(Output.GetString(), Output.GetSize());
+}
+
+void Profiler::SetMaxEventsPerThread(size_t MaxEvents) { ProfilerState::Get().MaxEventsPerThread.store(MaxEvents); }
+
+size_t Profiler::GetMaxEventsPerThread() { return ProfilerState::Get().MaxEventsPerThread.load(); }
+
+void Profiler::SetThreadName(const char* Name)
+{
+    ThreadBuffer& Buffer = GetThreadBuffer();
+
+    std::scoped_lock<std::mutex> Lock(ProfilerState::Get().Mutex);
+    Buffer.ThreadName = Name;
+}
+
+TagId Profiler::InternTag(const char* Name, const char* Category) { return ProfilerState::Get().InternTag(Name, Category); }
+
+TagId Profiler::InternFunctionTag(const char* Signature)
+{
+    const std::string_view Name = TrimFunctionSignature(Signature);
+
+    return ProfilerState::Get().InternTag(Name, CategoryFromFunctionName(Name));
+}
+
+void Profiler::RecordComplete(TagId Tag, uint64_t StartTime, uint64_t EndTime, const char* Detail)
+{
+    Record(EventPhase::Complete, Tag, StartTime, EndTime - StartTime, Detail);
+}
+
+void Profiler::RecordBegin(TagId Tag, const char* Detail) { Record(EventPhase::Begin, Tag, Now(), 0, Detail); }
+
+void Profiler::RecordEnd() { Record(EventPhase::End, 0, Now(), 0, nullptr); }
+
+void Profiler::RecordInstant(TagId Tag, const char* Detail) { Record(EventPhase::Instant, Tag, Now(), 0, Detail); }
+
+} // namespace csp::profile
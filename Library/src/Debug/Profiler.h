@@ -0,0 +1,321 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+/*
+ * A low overhead, always available profiler.
+ *
+ * Scopes are recorded into per-thread buffers that only the owning thread writes to, so recording never takes a lock. Each instrumented
+ * site interns its tag once, the first time it runs, and from then on a scope costs a relaxed atomic load while the profiler is idle,
+ * and two clock reads and an append while it is recording. Recorded events can be exported in the Chrome trace event JSON format,
+ * which can be loaded into chrome://tracing or https://ui.perfetto.dev.
+ *
+ * This header has no dependency on the SystemsManager, so it can be used from modules that are handed their dependencies.
+ */
+
+#if !defined(CSP_PROFILING_ENABLED)
+// Recording is off until Profiler::Start is called, so instrumentation is compiled in for all builds by default.
+// Define CSP_PROFILING_ENABLED to 0 to compile it out entirely.
+#define CSP_PROFILING_ENABLED 1
+#endif
+
+#if defined(__clang__) || defined(__GNUC__)
+#define CSP_FUNC_DEF __PRETTY_FUNCTION__
+#elif defined(_MSC_VER)
+#define CSP_FUNC_DEF __FUNCSIG__
+#else
+#error Compiler not supported
+#endif
+
+// Concat used to make scoped vars unique using __LINE__
+// e.g. CSP_CONCAT(ProfilerTag, __LINE__) becomes something like ProfilerTag128
+// Note the two nested macros are needed otherwise it becomes ProfilerTag__LINE__
+#define CSP_CONCAT_IMPL(x, y) x##y
+#define CSP_CONCAT(x, y) CSP_CONCAT_IMPL(x, y)
+
+namespace csp::profile
+{
+
+using TagId = uint32_t;
+
+// Maximum length of the optional detail text attached to an event, including the terminator. Longer text is truncated.
+constexpr size_t MAX_EVENT_DETAIL_LEN = 128;
+
+class Profiler
+{
+public:
+    // Enough for a few seconds of heavily instrumented frames, while keeping each thread's buffers to a few tens of megabytes.
+    static constexpr size_t DEFAULT_MAX_EVENTS_PER_THREAD = 256 * 1024;
+
+    /// @brief Discards anything previously recorded and starts recording.
+    static void Start();
+
+    /// @brief Stops recording. Anything already recorded is kept until the next call to Start or Clear.
+    static void Stop();
+
+    /// @brief Whether events are currently being recorded.
+    static bool IsRecording() { return Recording.load(std::memory_order_relaxed); }
+
+    /// @brief Discards everything recorded so far.
+    static void Clear();
+
+    /// @brief Exports everything recorded so far in the Chrome trace event JSON format.
+    /// Best called after Stop. Events recorded while the export is running may or may not be included.
+    static std::string ExportChromeTrace();
+
+    /// @brief Limits how many events each thread records per capture, so that a long capture that is never exported can't grow without bound.
+    /// Events past the limit are dropped, and counted as droppedEvents in the exported trace. Memory held for a higher limit is released when
+    /// the next capture starts.
+    static void SetMaxEventsPerThread(size_t MaxEvents);
+    static size_t GetMaxEventsPerThread();
+
+    /// @brief Names the calling thread in exported traces.
+    static void SetThreadName(const char* Name);
+
+    /// @brief Returns a stable id for a tag, registering it the first time it is seen.
+    /// @param Name const char* : The name shown for events with this tag.
+    /// @param Category const char* : The category shown for events with this tag.
+    static TagId InternTag(const char* Name, const char* Category = "csp");
+
+    /// @brief Interns a tag named after a function, given its __PRETTY_FUNCTION__ (or __FUNCSIG__) signature.
+    /// The return type and parameters are trimmed, and the category is taken from the function's namespace.
+    static TagId InternFunctionTag(const char* Signature);
+
+    /// @brief Timestamp used for events, in nanoseconds.
+    static uint64_t Now()
+    {
+        const auto SinceEpoch = std::chrono::steady_clock::now().time_since_epoch();
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(SinceEpoch).count());
+    }
+
+    static void RecordComplete(TagId Tag, uint64_t StartTime, uint64_t EndTime, const char* Detail = nullptr);
+    static void RecordBegin(TagId Tag, const char* Detail = nullptr);
+    static void RecordEnd();
+    static void RecordInstant(TagId Tag, const char* Detail = nullptr);
+
+private:
+    static std::atomic<bool> Recording;
+};
+
+// Formats detail text for an event into a fixed size buffer. Only called while recording.
+template <typename... Args> void FormatDetail(char (&Buffer)[MAX_EVENT_DETAIL_LEN], const char* FormatStr, Args... args)
+{
+#if defined(CSP_WINDOWS)
+    _snprintf_s<MAX_EVENT_DETAIL_LEN>(Buffer, MAX_EVENT_DETAIL_LEN - 1, FormatStr, args...);
+#else
+    snprintf(Buffer, MAX_EVENT_DETAIL_LEN, FormatStr, args...);
+#endif
+}
+
+// Records the time between construction and destruction as a single event.
+class ScopedProfileEvent
+{
+public:
+    explicit ScopedProfileEvent(TagId InTag)
+        : Tag(InTag)
+        , IsActive(Profiler::IsRecording())
+        , StartTime(IsActive ? Profiler::Now() : 0)
+    {
+        Detail[0] = '\0';
+    }
+
+    // For tags that aren't known until runtime. The tag is only interned if we're recording.
+    explicit ScopedProfileEvent(const char* DynamicTag)
+        : Tag(0)
+        , IsActive(Profiler::IsRecording())
+        , StartTime(0)
+    {
+        Detail[0] = '\0';
+
+        if (IsActive)
+        {
+            Tag = Profiler::InternTag(DynamicTag);
+            StartTime = Profiler::Now();
+        }
+    }
+
+    template <typename... Args>
+    ScopedProfileEvent(TagId InTag, const char* FormatStr, Args... args)
+        : Tag(InTag)
+        , IsActive(Profiler::IsRecording())
+        , StartTime(0)
+    {
+        Detail[0] = '\0';
+
+        if (IsActive)
+        {
+            FormatDetail(Detail, FormatStr, args...);
+            StartTime = Profiler::Now();
+        }
+    }
+
+    ~ScopedProfileEvent()
+    {
+        // Stopping mid-scope drops the event rather than recording one that ends after the capture did.
+        if (IsActive && Profiler::IsRecording())
+        {
+            Profiler::RecordComplete(Tag, StartTime, Profiler::Now(), Detail[0] != '\0' ? Detail : nullptr);
+        }
+    }
+
+    ScopedProfileEvent(const ScopedProfileEvent&) = delete;
+    ScopedProfileEvent& operator=(const ScopedProfileEvent&) = delete;
+
+private:
+    TagId Tag;
+    bool IsActive;
+    uint64_t StartTime;
+    char Detail[MAX_EVENT_DETAIL_LEN];
+};
+
+template <typename... Args> void BeginMarker(TagId Tag, const char* FormatStr, Args... args)
+{
+    if (Profiler::IsRecording())
+    {
+        char Detail[MAX_EVENT_DETAIL_LEN];
+        FormatDetail(Detail, FormatStr, args...);
+
+        Profiler::RecordBegin(Tag, Detail);
+    }
+}
+
+template <typename... Args> void InstantEvent(TagId Tag, const char* FormatStr, Args... args)
+{
+    if (Profiler::IsRecording())
+    {
+        char Detail[MAX_EVENT_DETAIL_LEN];
+        FormatDetail(Detail, FormatStr, args...);
+
+        Profiler::RecordInstant(Tag, Detail);
+    }
+}
+
+inline void BeginMarker(const char* DynamicTag)
+{
+    if (Profiler::IsRecording())
+    {
+        Profiler::RecordBegin(Profiler::InternTag(DynamicTag));
+    }
+}
+
+inline void EndMarker()
+{
+    if (Profiler::IsRecording())
+    {
+        Profiler::RecordEnd();
+    }
+}
+
+inline void InstantEvent(const char* DynamicTag)
+{
+    if (Profiler::IsRecording())
+    {
+        Profiler::RecordInstant(Profiler::InternTag(DynamicTag));
+    }
+}
+
+} // namespace csp::profile
+
+#if CSP_PROFILING_ENABLED
+
+// Declares a function local tag, interned the first time the enclosing code runs.
+#define CSP_PROFILE_STATIC_TAG(NAME, INTERN_EXPR) static const csp::profile::TagId NAME = INTERN_EXPR
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Scoped profiling event which automatically grabs current function name.
+//
+// Example:
+//		void Function()
+//		{
+//			CSP_PROFILE_SCOPED();
+//			... code ...
+//		}
+#define CSP_PROFILE_SCOPED()                                                                                                                         \
+    CSP_PROFILE_STATIC_TAG(CSP_CONCAT(ProfilerTagId, __LINE__), csp::profile::Profiler::InternFunctionTag(CSP_FUNC_DEF));                            \
+    csp::profile::ScopedProfileEvent CSP_CONCAT(ProfilerTag, __LINE__)(CSP_CONCAT(ProfilerTagId, __LINE__))
+
+// Scoped profiling event named after the format string, with the formatted text attached to the event as detail.
+// The text is only formatted while recording.
+#define CSP_PROFILE_SCOPED_FORMAT(FORMAT_STR, ...)                                                                                                   \
+    CSP_PROFILE_STATIC_TAG(CSP_CONCAT(ProfilerTagId, __LINE__), csp::profile::Profiler::InternTag(FORMAT_STR));                                      \
+    csp::profile::ScopedProfileEvent CSP_CONCAT(ProfilerTag, __LINE__)(CSP_CONCAT(ProfilerTagId, __LINE__), FORMAT_STR, __VA_ARGS__)
+
+// Scoped profiling event with a fixed name, for scopes that CSP_PROFILE_SCOPED can't name usefully, such as lambdas.
+#define CSP_PROFILE_SCOPED_NAME(NAME)                                                                                                                \
+    CSP_PROFILE_STATIC_TAG(CSP_CONCAT(ProfilerTagId, __LINE__), csp::profile::Profiler::InternTag(NAME));                                            \
+    csp::profile::ScopedProfileEvent CSP_CONCAT(ProfilerTag, __LINE__)(CSP_CONCAT(ProfilerTagId, __LINE__))
+
+// Scoped profiling event with a tag that may only be known at runtime.
+#define CSP_PROFILE_SCOPED_TAG(TAG) csp::profile::ScopedProfileEvent CSP_CONCAT(ProfilerTag, __LINE__)(static_cast<const char*>(TAG))
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Manual Begin/End profiling markers
+//
+// Example:
+//		void Function()
+//		{
+//			... code ...
+//			... code ...
+//			CSP_PROFILE_BEGIN("Subsection Tag");
+//			... subsection of code to profile...
+//			CSP_PROFILE_END();
+//			... code ...
+//		}
+#define CSP_PROFILE_BEGIN(TAG) csp::profile::BeginMarker(static_cast<const char*>(TAG))
+#define CSP_PROFILE_END() csp::profile::EndMarker()
+
+#define CSP_PROFILE_BEGIN_FORMAT(FORMAT_STR, ...)                                                                                                    \
+    do                                                                                                                                               \
+    {                                                                                                                                                \
+        CSP_PROFILE_STATIC_TAG(ProfilerTagId, csp::profile::Profiler::InternTag(FORMAT_STR));                                                        \
+        csp::profile::BeginMarker(ProfilerTagId, FORMAT_STR, __VA_ARGS__);                                                                           \
+    } while (false)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Instant events, for things that happen at a point in time rather than over a span.
+#define CSP_PROFILE_EVENT_TAG(TAG) csp::profile::InstantEvent(static_cast<const char*>(TAG))
+
+#define CSP_PROFILE_EVENT_FORMAT(FORMAT_STR, ...)                                                                                                    \
+    do                                                                                                                                               \
+    {                                                                                                                                                \
+        CSP_PROFILE_STATIC_TAG(ProfilerTagId, csp::profile::Profiler::InternTag(FORMAT_STR));                                                        \
+        csp::profile::InstantEvent(ProfilerTagId, FORMAT_STR, __VA_ARGS__);                                                                          \
+    } while (false)
+
+#else
+
+// Compile everything out for zero overhead when disabled
+
+#define CSP_PROFILE_SCOPED()
+#define CSP_PROFILE_SCOPED_FORMAT(FORMAT_STR, ...)
+#define CSP_PROFILE_SCOPED_NAME(NAME)
+#define CSP_PROFILE_SCOPED_TAG(TAG)
+
+#define CSP_PROFILE_BEGIN(TAG)
+#define CSP_PROFILE_END()
+#define CSP_PROFILE_BEGIN_FORMAT(FORMAT_STR, ...)
+
+#define CSP_PROFILE_EVENT_TAG(TAG)
+#define CSP_PROFILE_EVENT_FORMAT(FORMAT_STR, ...)
+
+#endif
@@ -37,6 +37,8 @@ public:
     float GetFloat(const char* Key) const;
     bool GetBool(const char* Key) const;
 
+    void Clear();
+
 private:
     enum EParamType
     {
@@ -144,6 +146,8 @@ void EventPayloadImpl::AddBool(const char* Key, const bool Value)
     Parameters.insert(ParamMap::value_type(Key, Param));
 }
 
+void EventPayloadImpl::Clear() { Parameters.clear(); }
+
 int EventPayloadImpl::GetInt(const char* Key) const
 {
     ParamMap::const_iterator it = Parameters.find(Key);
@@ -200,6 +204,12 @@ Event::Event(const EventId& InId)
 
 Event::~Event() { delete (Impl); }
 
+void Event::Reset(const EventId& InId)
+{
+    Id = InId;
+    Impl->Clear();
+}
+
 void Event::AddInt(const char* Key, const int Value) { Impl->AddInt(Key, Value); }
 
 void Event::AddString(const char* Key, const char* Value) { Impl->AddString(Key, Value); }
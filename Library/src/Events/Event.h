@@ -27,6 +27,7 @@ namespace csp::events
 class CSP_API Event
 {
     friend class EventSystem;
+    friend class EventSystemImpl;
 
 public:
     ~Event();
@@ -48,6 +49,9 @@ public:
 private:
     Event(const EventId& InId);
 
+    // Used when a processed event is taken back out of the event pool, so it can be reused without reallocating.
+    void Reset(const EventId& InId);
+
     EventId Id;
     class EventPayloadImpl* Impl;
 };
@@ -41,4 +41,12 @@ void EventDispatcher::Dispatch(const Event& InEvent)
     }
 }
 
+void EventDispatcher::Dispatch(const Event* const* InEvents, size_t Count)
+{
+    for (size_t i = 0; i < Count; ++i)
+    {
+        Dispatch(*InEvents[i]);
+    }
+}
+
 } // namespace csp::events
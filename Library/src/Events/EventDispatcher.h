@@ -18,6 +18,7 @@
 #include "Events/Event.h"
 #include "Events/EventListener.h"
 
+#include <cstddef>
 #include <list>
 
 namespace csp::events
@@ -35,6 +36,9 @@ public:
 
     void Dispatch(const Event& InEvent);
 
+    // Dispatches a run of events with this dispatcher's id, in order.
+    void Dispatch(const Event* const* InEvents, size_t Count);
+
 private:
     EventId Id;
     EventCallbackList CallbackList;
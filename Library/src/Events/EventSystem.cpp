@@ -15,10 +15,19 @@
  */
 #include "Events/EventSystem.h"
 
-#include "Common/Queue.h"
 #include "Events/EventDispatcher.h"
 
+#if defined(_MSC_VER)
+// atomic_queue deliberately aligns its members to cache lines, don't warn about the resulting padding.
+#pragma warning(disable : 4324)
+#endif
+
+#include <atomic_queue/atomic_queue.h>
+
+#include <atomic>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace std
 {
@@ -52,7 +61,9 @@ public:
 
     EventDispatcher& GetDispatcher(const EventId& Id);
 
-    void EnqueueEvent(const Event* InEvent);
+    Event* TakePooledEvent(const EventId& Id);
+
+    void EnqueueEvent(Event* InEvent);
 
     void RegisterListener(const EventId& Id, EventListener* InListener);
     void UnRegisterListener(const EventId& Id, EventListener* InListener);
@@ -60,7 +71,30 @@ public:
     void ProcessEvents();
 
 private:
-    csp::Queue<const Event*> EventQueue;
+    // Moves everything currently queued into OutEvents, in the order it was queued.
+    void DrainQueuedEvents(std::vector<Event*>& OutEvents);
+
+    // Returns a processed event to the pool, or frees it if the pool is full.
+    void ReleaseEvent(Event* InEvent);
+
+    // Enough for a few frames worth of events. Anything beyond this spills into OverflowEvents rather than blocking the producer,
+    // as producers can be the thread that calls ProcessEvents.
+    static constexpr unsigned EventQueueCapacity = 1024;
+    static constexpr unsigned EventPoolCapacity = 256;
+
+    // Multi-producer, single consumer (ProcessEvents).
+    // The B2 variants synchronise on a per-slot state, so the event contents written before a push are visible after the pop.
+    atomic_queue::AtomicQueueB2<Event*> EventQueue;
+
+    std::mutex OverflowLock;
+    std::vector<Event*> OverflowEvents;
+    // Once an event has spilled, later ones follow it into the overflow until it is drained, so events from one thread stay in order.
+    std::atomic<bool> HasOverflowEvents;
+
+    atomic_queue::AtomicQueueB2<Event*> EventPool;
+
+    // Reused between calls to ProcessEvents to avoid reallocating.
+    std::vector<Event*> EventBatch;
 
     // Define eastl map using above defined hasher and our custom allocator
     using DispatcherMap = std::unordered_map<EventId, EventDispatcher, std::hash<EventId>, std::equal_to<EventId>>;
@@ -68,9 +102,30 @@ private:
     DispatcherMap Dispatchers;
 };
 
-EventSystemImpl::EventSystemImpl() { }
+EventSystemImpl::EventSystemImpl()
+    : EventQueue(EventQueueCapacity)
+    , HasOverflowEvents(false)
+    , EventPool(EventPoolCapacity)
+{
+}
+
+EventSystemImpl::~EventSystemImpl()
+{
+    std::vector<Event*> UnprocessedEvents;
+    DrainQueuedEvents(UnprocessedEvents);
+
+    for (Event* UnprocessedEvent : UnprocessedEvents)
+    {
+        delete (UnprocessedEvent);
+    }
 
-EventSystemImpl::~EventSystemImpl() { }
+    Event* PooledEvent = nullptr;
+
+    while (EventPool.try_pop(PooledEvent))
+    {
+        delete (PooledEvent);
+    }
+}
 
 EventDispatcher& EventSystemImpl::GetDispatcher(const EventId& Id)
 {
@@ -88,7 +143,36 @@ EventDispatcher& EventSystemImpl::GetDispatcher(const EventId& Id)
     }
 }
 
-void EventSystemImpl::EnqueueEvent(const Event* InEvent) { EventQueue.Enqueue(InEvent); }
+Event* EventSystemImpl::TakePooledEvent(const EventId& Id)
+{
+    Event* PooledEvent = nullptr;
+
+    if (EventPool.try_pop(PooledEvent) == false)
+    {
+        return nullptr;
+    }
+
+    PooledEvent->Reset(Id);
+
+    return PooledEvent;
+}
+
+void EventSystemImpl::EnqueueEvent(Event* InEvent)
+{
+    if (InEvent == nullptr)
+    {
+        return;
+    }
+
+    if (HasOverflowEvents.load(std::memory_order_acquire) == false && EventQueue.try_push(InEvent))
+    {
+        return;
+    }
+
+    std::scoped_lock OverflowLocker(OverflowLock);
+    OverflowEvents.push_back(InEvent);
+    HasOverflowEvents.store(true, std::memory_order_release);
+}
 
 void EventSystemImpl::RegisterListener(const EventId& Id, EventListener* InListener)
 {
@@ -106,15 +190,70 @@ void EventSystemImpl::UnRegisterAllListeners() { Dispatchers.clear(); }
 
 void EventSystemImpl::ProcessEvents()
 {
-    while (EventQueue.IsEmpty() == false)
+    // Take the batch buffer for the duration, in case a listener ends up processing events itself.
+    std::vector<Event*> Batch;
+    Batch.swap(EventBatch);
+
+    // Listeners can queue further events, keep going until they've all been sent, as we always have.
+    for (DrainQueuedEvents(Batch); Batch.empty() == false; DrainQueuedEvents(Batch))
+    {
+        size_t RunStart = 0;
+
+        // Events are sent in the order they were queued, but a run of events with the same id only looks up its dispatcher once.
+        while (RunStart < Batch.size())
+        {
+            const EventId& Id = Batch[RunStart]->GetId();
+            size_t RunEnd = RunStart + 1;
+
+            while (RunEnd < Batch.size() && Batch[RunEnd]->GetId() == Id)
+            {
+                ++RunEnd;
+            }
+
+            // Events nobody has registered for are dropped, there's no need to create a dispatcher for them.
+            if (auto It = Dispatchers.find(Id); It != Dispatchers.end())
+            {
+                It->second.Dispatch(Batch.data() + RunStart, RunEnd - RunStart);
+            }
+
+            RunStart = RunEnd;
+        }
+
+        for (Event* ProcessedEvent : Batch)
+        {
+            ReleaseEvent(ProcessedEvent);
+        }
+
+        Batch.clear();
+    }
+
+    EventBatch.swap(Batch);
+}
+
+void EventSystemImpl::DrainQueuedEvents(std::vector<Event*>& OutEvents)
+{
+    Event* QueuedEvent = nullptr;
+
+    while (EventQueue.try_pop(QueuedEvent))
     {
-        auto QueuedItem = EventQueue.Dequeue();
+        OutEvents.push_back(QueuedEvent);
+    }
 
-        const Event* QueuedEvent = QueuedItem.value();
-        const EventId& Id = QueuedEvent->GetId();
-        GetDispatcher(Id).Dispatch(*QueuedEvent);
+    // Anything in the overflow was queued after what was in the ring at the time it spilled.
+    if (HasOverflowEvents.load(std::memory_order_acquire))
+    {
+        std::scoped_lock OverflowLocker(OverflowLock);
+        OutEvents.insert(OutEvents.end(), OverflowEvents.begin(), OverflowEvents.end());
+        OverflowEvents.clear();
+        HasOverflowEvents.store(false, std::memory_order_release);
+    }
+}
 
-        delete (QueuedEvent);
+void EventSystemImpl::ReleaseEvent(Event* InEvent)
+{
+    if (EventPool.try_push(InEvent) == false)
+    {
+        delete (InEvent);
     }
 }
 
@@ -133,9 +272,20 @@ EventSystem::EventSystem()
 
 EventSystem::~EventSystem() { delete (Impl); }
 
-Event* EventSystem::AllocateEvent(const EventId& Id) { return new Event(Id); }
+Event* EventSystem::AllocateEvent(const EventId& Id)
+{
+    if (Impl)
+    {
+        if (Event* PooledEvent = Impl->TakePooledEvent(Id))
+        {
+            return PooledEvent;
+        }
+    }
+
+    return new Event(Id);
+}
 
-void EventSystem::EnqueueEvent(const Event* InEvent)
+void EventSystem::EnqueueEvent(Event* InEvent)
 {
     if (Impl)
     {
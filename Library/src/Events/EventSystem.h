@@ -31,13 +31,14 @@ public:
     static EventSystem& Get();
 
     /// @brief Create a new event instance
-    /// @note The event will be deleted after it has been processed in ProcessEvents
+    /// @note Events are pooled, the event will be returned to the pool after it has been processed in ProcessEvents
+    /// This call is thread safe
     Event* AllocateEvent(const EventId& Id);
 
     /// @brief Enqueue an event to be sent later
-    /// @note This call is thread safe
+    /// @note This call is thread safe, and does not lock unless more events have been queued than the event queue can hold
     /// @param InEvent
-    void EnqueueEvent(const Event* InEvent);
+    void EnqueueEvent(Event* InEvent);
 
     void RegisterListener(const EventId& Id, EventListener* InListener);
     void UnRegisterListener(const EventId& Id, EventListener* InListener);
@@ -45,6 +46,7 @@ public:
     void UnRegisterAllListeners();
 
     /// @brief Process all queued events and send them to any listeners
+    /// @note Must only be called from one thread at a time
     void ProcessEvents();
 
 private:
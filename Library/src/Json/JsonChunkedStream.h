@@ -0,0 +1,110 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CSP/Common/List.h"
+#include "CSP/Common/String.h"
+
+#include <rapidjson/rapidjson.h>
+
+namespace csp::json
+{
+
+/// @brief A rapidjson input stream over json that has been split across a list of strings.
+/// @details Lets a reader consume the chunks in place, rather than the chunks being joined into one string first.
+/// The list must outlive the stream.
+class ChunkedStringStream
+{
+public:
+    using Ch = char;
+
+    explicit ChunkedStringStream(const csp::common::List<csp::common::String>& InChunks)
+        : Chunks(InChunks)
+        , NextChunkIndex(0)
+        , Current(nullptr)
+        , End(nullptr)
+        , Offset(0)
+    {
+        NextChunk();
+    }
+
+    Ch Peek() const { return Current != End ? *Current : '\0'; }
+
+    Ch Take()
+    {
+        if (Current == End)
+        {
+            return '\0';
+        }
+
+        const Ch Character = *Current++;
+        ++Offset;
+
+        if (Current == End)
+        {
+            NextChunk();
+        }
+
+        return Character;
+    }
+
+    size_t Tell() const { return Offset; }
+
+    // Only needed for in-situ parsing, which this stream doesn't support.
+    Ch* PutBegin()
+    {
+        RAPIDJSON_ASSERT(false);
+        return nullptr;
+    }
+
+    void Put(Ch) { RAPIDJSON_ASSERT(false); }
+
+    void Flush() { RAPIDJSON_ASSERT(false); }
+
+    size_t PutEnd(Ch*)
+    {
+        RAPIDJSON_ASSERT(false);
+        return 0;
+    }
+
+private:
+    // Moves to the next chunk that has any characters in it, leaving Current == End once they run out.
+    void NextChunk()
+    {
+        while (NextChunkIndex < Chunks.Size())
+        {
+            const csp::common::String& Chunk = Chunks[NextChunkIndex++];
+
+            if (Chunk.Length() > 0)
+            {
+                Current = Chunk.c_str();
+                End = Current + Chunk.Length();
+                return;
+            }
+        }
+
+        Current = End = nullptr;
+    }
+
+    const csp::common::List<csp::common::String>& Chunks;
+    size_t NextChunkIndex;
+    const Ch* Current;
+    const Ch* End;
+    size_t Offset;
+};
+
+} // namespace csp::json
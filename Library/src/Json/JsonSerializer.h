@@ -138,6 +138,19 @@ public:
         return true;
     }
 
+    /// @brief Converts an already parsed Json value into the specified object.
+    /// @details As above, for values that have been parsed elsewhere, such as elements read one at a time from a larger document.
+    /// @param Value const rapidjson::Value& : The json value to deserialize.
+    /// @param Object T& : The object to convert to.
+    template <typename T> static void Deserialize(const rapidjson::Value& Value, T& Object)
+    {
+        JsonDeserializer Deserializer;
+
+        Deserializer.ValueStack.push(&Value);
+        Deserializer.DeserializeValue(Object);
+        Deserializer.ValueStack.pop();
+    }
+
     /// @brief Should be called within custom FromJson function.
     /// @details This will deserialize a member with the given key.
     /// If the member is another custom type, this was internally call FromJson on that type.
@@ -184,6 +197,7 @@ public:
     void ExitMember() const;
 
 private:
+    JsonDeserializer() = default;
     JsonDeserializer(const char* Data) { Doc.Parse(Data); }
 
     template <typename T> inline void DeserializeValue(T& Value) const { FromJson(*this, Value); }
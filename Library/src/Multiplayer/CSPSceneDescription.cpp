@@ -15,42 +15,54 @@
  */
 
 #include "CSP/Multiplayer/CSPSceneDescription.h"
+#include "CSP/Common/Systems/Log/LogSystem.h"
 #include "Multiplayer/MCS/MCSSceneDescription.h"
 #include "Multiplayer/MCS/MCSTypes.h"
 #include "Multiplayer/SpaceEntityStatePatcher.h"
-#include "Json/JsonSerializer.h"
-#include <numeric>
+
+#include <memory>
+#include <vector>
 
 namespace csp::multiplayer
 {
+// The reason this JSON is packed into a list _at all_ is merely a wrapper generator workaround,
+// csp::common::Strings cannot be passed as heap objects, and these SceneDescriptions can be large
+// enough to blow the stack. The chunks are kept as they are, and read in place when creating entities.
 CSPSceneDescription::CSPSceneDescription(const csp::common::List<csp::common::String>& SceneDescriptionJson)
-
+    : SceneDescriptionJson(SceneDescriptionJson)
 {
-    // Unpack the list into a single JSON string.
-    // The reason this JSON is packed into a list _at all_ is merely a wrapper generator workaround,
-    // csp::common::Strings cannot be passed as heap objects, and these SceneDescriptions can be large
-    // enough to blow the stack
-    this->SceneDescriptionJson = std::accumulate(SceneDescriptionJson.begin(), SceneDescriptionJson.end(), csp::common::String {});
 }
 
-csp::common::Array<csp::multiplayer::SpaceEntity*> CSPSceneDescription::CreateEntities(
-    csp::common::IRealtimeEngine& RealtimeEngine, csp::common::LogSystem& LogSystem, csp::common::IJSScriptRunner& RemoteScriptRunner) const
+csp::common::Array<csp::multiplayer::SpaceEntity*> CSPSceneDescription::CreateEntities(csp::common::IRealtimeEngine& RealtimeEngine,
+    csp::common::LogSystem& LogSystem, csp::common::IJSScriptRunner& RemoteScriptRunner, csp::TaskExecutor* DecodeExecutor) const
 {
-    mcs::SceneDescription SceneDescription;
-    csp::json::JsonDeserializer::Deserialize(SceneDescriptionJson.c_str(), SceneDescription);
+    // Entities are created as each object is read, so the scene is never held as a whole json document.
+    // They stay owned here until the whole scene has decoded, so a failure or throw part way through releases them.
+    std::vector<std::unique_ptr<SpaceEntity>> Entities;
 
-    csp::common::Array<csp::multiplayer::SpaceEntity*> Entities { SceneDescription.Objects.size() };
+    const bool Succeeded = mcs::ReadSceneDescriptionObjects(
+        SceneDescriptionJson,
+        [&](mcs::ObjectMessage&& Object)
+        {
+            Entities.push_back(SpaceEntityStatePatcher::NewFromObjectMessage(Object, RealtimeEngine, RemoteScriptRunner, LogSystem));
+        },
+        DecodeExecutor);
 
-    size_t ObjectsIndex = 0;
-    for (const auto& Object : SceneDescription.Objects)
+    if (Succeeded == false)
     {
-        auto Entity = SpaceEntityStatePatcher::NewFromObjectMessage(Object, RealtimeEngine, RemoteScriptRunner, LogSystem);
+        LogSystem.LogMsg(csp::common::LogLevel::Error, "CSPSceneDescription: Failed to parse the scene description json.");
+
+        return {};
+    }
+
+    csp::common::Array<csp::multiplayer::SpaceEntity*> EntityArray { Entities.size() };
 
-        Entities[ObjectsIndex] = Entity.release();
-        ObjectsIndex++;
+    for (size_t i = 0; i < Entities.size(); ++i)
+    {
+        EntityArray[i] = Entities[i].release();
     }
 
-    return Entities;
+    return EntityArray;
 }
 
 }
@@ -21,7 +21,9 @@
 #include "CSP/Multiplayer/ComponentSchema.h"
 #include "CSP/Multiplayer/Script/EntityScript.h"
 #include "CSP/Multiplayer/SpaceEntity.h"
+#include "Common/Systems/Log/LogFormat.h"
 #include "ComponentBaseKeys.h"
+#include "Multiplayer/ComponentPropertyIndex.h"
 #include "Multiplayer/ComponentSchemaRegistry.h"
 #include "Multiplayer/RealtimeEngineUtils.h"
 #include "Multiplayer/Script/ComponentScriptHelpers.h"
@@ -42,7 +44,7 @@ ComponentBase::ComponentBase()
     , ScriptInterface(nullptr)
     , LogSystem(nullptr)
 {
-    InitialiseProperties();
+    InitialiseProperties(nullptr);
 }
 
 ComponentBase::ComponentBase(uint64_t TypeId, csp::common::LogSystem* LogSystem, SpaceEntity* Parent)
@@ -52,7 +54,7 @@ ComponentBase::ComponentBase(uint64_t TypeId, csp::common::LogSystem* LogSystem,
     , ScriptInterface(nullptr)
     , LogSystem(LogSystem)
 {
-    InitialiseProperties();
+    InitialiseProperties(nullptr);
 }
 
 ComponentBase::ComponentBase(ComponentType Type, csp::common::LogSystem* LogSystem, SpaceEntity* Parent)
@@ -61,14 +63,14 @@ ComponentBase::ComponentBase(ComponentType Type, csp::common::LogSystem* LogSyst
 }
 
 ComponentBase::ComponentBase(const ComponentSchema& Schema, csp::common::LogSystem* LogSystem, SpaceEntity* Parent)
-    : ComponentBase(Schema.TypeId, LogSystem, Parent)
+    : Parent(Parent)
+    , Id(0)
+    , Type(Schema.TypeId)
+    , ScriptInterface(nullptr)
+    , LogSystem(LogSystem)
+    , CachedSchema(std::make_unique<ComponentSchema>(Schema))
 {
-    this->CachedSchema = std::make_unique<ComponentSchema>(Schema);
-
-    for (const auto& Property : Schema.Properties)
-    {
-        Properties[Property.Key] = Property.DefaultValue;
-    }
+    InitialiseProperties(CachedSchema.get());
 
     if (IsScriptable(Schema))
     {
@@ -88,61 +90,62 @@ uint64_t ComponentBase::GetTypeId() const { return Type; }
 
 namespace
 {
-    const ComponentProperty* FindSchemaProperty(const ComponentSchema& Schema, uint16_t Key)
+    // Returns the layout slot for a property declared by the component's schema, or nullptr if the schema doesn't declare it.
+    const ComponentPropertyLayout::Slot* FindSchemaSlot(const ComponentPropertyLayout& Layout, uint16_t Key)
     {
-        const auto It
-            = std::find_if(Schema.Properties.begin(), Schema.Properties.end(), [Key](const ComponentProperty& Prop) { return Prop.Key == Key; });
-        return It != Schema.Properties.end() ? &*It : nullptr;
+        const uint16_t Slot = Layout.FindSlot(Key);
+
+        if (Slot == ComponentPropertyLayout::NO_SLOT || Layout.GetSlot(Slot).IsSchemaProperty == false)
+        {
+            return nullptr;
+        }
+
+        return &Layout.GetSlot(Slot);
     }
 } // namespace
 
 const csp::common::ReplicatedValue* ComponentBase::GetProperty(uint16_t Key) const
 {
-    if (!CachedSchema)
-    {
-        return nullptr;
-    }
-
-    if (!FindSchemaProperty(*CachedSchema, Key))
+    if (!FindSchemaSlot(PropertyIndex->GetLayout(), Key))
     {
         return nullptr;
     }
 
-    const auto& Value = GetPropertyDirect(Key);
-    return Value != InvalidValue ? &Value : nullptr;
+    const auto* Value = PropertyIndex->Find(Key);
+    return Value != nullptr && *Value != InvalidValue ? Value : nullptr;
 }
 
 void ComponentBase::SetProperty(uint16_t Key, const csp::common::ReplicatedValue& Value)
 {
-    if (!CachedSchema)
-    {
-        return;
-    }
-
-    if (const auto* Property = FindSchemaProperty(*CachedSchema, Key);
-        Property && Value.GetReplicatedValueType() == Property->DefaultValue.GetReplicatedValueType())
+    if (const auto* Slot = FindSchemaSlot(PropertyIndex->GetLayout(), Key);
+        Slot && Value.GetReplicatedValueType() == Slot->DefaultValue.GetReplicatedValueType())
     {
         SetPropertyDirect(Key, Value);
     }
 }
 
+const ComponentPropertyIndex& ComponentBase::GetPropertyIndex() const { return *PropertyIndex; }
+
+bool ComponentBase::IsPropertyDirty(uint32_t Key) const { return PropertyIndex->IsDirty(Key); }
+
 const csp::common::Map<uint32_t, csp::common::ReplicatedValue>* ComponentBase::GetProperties() const { return &Properties; }
 
 const csp::common::ReplicatedValue& ComponentBase::GetPropertyDirect(uint32_t Key) const
 {
-    if (Properties.HasKey(Key))
+    if (const auto* Value = PropertyIndex->Find(Key))
     {
-        return Properties[Key];
+        return *Value;
     }
 
-    if (LogSystem != nullptr)
-    {
-        LogSystem->LogMsg(csp::common::LogLevel::Error, fmt::format("No Property with this key: {}", Key).c_str());
-    }
+    CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error, "No Property with this key: {}", Key);
 
     return InvalidValue;
 }
 
+bool ComponentBase::HasPropertyDirect(uint32_t Key) const { return PropertyIndex->Contains(Key); }
+
+size_t ComponentBase::GetPropertyCount() const { return PropertyIndex->Size(); }
+
 bool ComponentBase::GetBooleanProperty(uint32_t Key) const
 {
     const auto& RepVal = GetPropertyDirect(Key);
@@ -281,40 +284,33 @@ const csp::common::Map<csp::common::String, csp::common::ReplicatedValue>& Compo
 
 void ComponentBase::SetPropertyDirect(uint32_t Key, const csp::common::ReplicatedValue& Value)
 {
-    if (Properties.HasKey(Key) && Value.GetReplicatedValueType() != Properties[Key].GetReplicatedValueType())
+    const csp::common::ReplicatedValue* ExistingValue = PropertyIndex->Find(Key);
+
+    if (ExistingValue != nullptr && Value.GetReplicatedValueType() != ExistingValue->GetReplicatedValueType())
     {
-        if (LogSystem != nullptr)
-        {
-            LogSystem->LogMsg(csp::common::LogLevel::Error,
-                fmt::format("ValueType is unexpected. Expected: {0} Received: {1}", static_cast<uint32_t>(Properties[Key].GetReplicatedValueType()),
-                    static_cast<uint32_t>(Value.GetReplicatedValueType()))
-                    .c_str());
-        }
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error, "ValueType is unexpected. Expected: {0} Received: {1}",
+            static_cast<uint32_t>(ExistingValue->GetReplicatedValueType()), static_cast<uint32_t>(Value.GetReplicatedValueType()));
     }
 
     // Ensure we can modify the entity. The criteria for this can be found on the specific RealtimeEngine::IsEntityModifiable overloads.
     ModifiableStatus Modifiable = GetParent()->IsModifiable();
     if (Modifiable != ModifiableStatus::Modifiable)
     {
-        if (LogSystem != nullptr)
-        {
-            LogSystem->LogMsg(csp::common::LogLevel::Warning,
-                fmt::format("Failed to set property on component: {0}, skipping update. Entity name: {1}",
-                    RealtimeEngineUtils::ModifiableStatusToString(Modifiable), GetParent()->GetName())
-                    .c_str());
-        }
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Warning, "Failed to set property on component: {0}, skipping update. Entity name: {1}",
+            RealtimeEngineUtils::ModifiableStatusToString(Modifiable), GetParent()->GetName());
 
         return;
     }
 
-    if (!Properties.HasKey(Key) || Properties[Key] != Value)
+    if (ExistingValue == nullptr || *ExistingValue != Value)
     {
         // Weird that this is instant and dosen't go through the regular lock/patch flow
         // I think it should ... note the lock above which every other SpaceEntity thing has in its setter methods.
         // This is the _one_ thing that in online mode, dosen't need ProcessPending() to be called ... _Weird_.
         // Note how `UpdateComponent` dosen't actually set the data, just does notification in this case. :(
         // TODO, fix. Look at `SetPropertyFromPatch` below, it's basically a `SetPropetyDirect`
-        Properties[Key] = Value;
+        PropertyIndex->Set(Key, Value);
+        PropertyIndex->MarkDirty(Key);
         Parent->UpdateComponent(this);
 
         // Hack alert
@@ -328,13 +324,14 @@ void ComponentBase::SetPropertyDirect(uint32_t Key, const csp::common::Replicate
 void ComponentBase::RemoveProperty(uint32_t Key)
 {
     // Weird that this is instant and dosen't go through the regular lock/patch flow
-    Properties.Remove(Key);
+    PropertyIndex->Remove(Key);
+    PropertyIndex->MarkDirty(Key);
     Parent->UpdateComponent(this);
 }
 
-void ComponentBase::SetProperties(const csp::common::Map<uint32_t, csp::common::ReplicatedValue>& Value) { Properties = Value; }
+void ComponentBase::SetProperties(const csp::common::Map<uint32_t, csp::common::ReplicatedValue>& Value) { PropertyIndex->Assign(Value); }
 
-void ComponentBase::SetPropertyFromPatch(uint32_t Key, const csp::common::ReplicatedValue& Value) { Properties[Key] = Value; }
+void ComponentBase::SetPropertyFromPatch(uint32_t Key, const csp::common::ReplicatedValue& Value) { PropertyIndex->Set(Key, Value); }
 
 void ComponentBase::OnCreated() { }
 
@@ -362,10 +359,7 @@ void ComponentBase::RegisterActionHandler(const csp::common::String& InAction, E
     else
     {
         // Already registered
-        if (LogSystem != nullptr)
-        {
-            LogSystem->LogMsg(csp::common::LogLevel::Error, fmt::format("Action {} already registered\n", InAction).c_str());
-        }
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error, "Action {} already registered\n", InAction);
     }
 }
 
@@ -377,10 +371,7 @@ void ComponentBase::UnregisterActionHandler(const csp::common::String& InAction)
     }
     else
     {
-        if (LogSystem != nullptr)
-        {
-            LogSystem->LogMsg(csp::common::LogLevel::Error, fmt::format("Action {} not found\n", InAction).c_str());
-        }
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error, "Action {} not found\n", InAction);
     }
 }
 
@@ -397,6 +388,11 @@ const csp::common::String& ComponentBase::GetComponentName() const { return GetS
 
 void ComponentBase::SetComponentName(const csp::common::String& Value) { SetPropertyDirect(COMPONENT_KEY_NAME, Value); }
 
-void ComponentBase::InitialiseProperties() { Properties[COMPONENT_KEY_NAME] = ""; }
+void ComponentBase::InitialiseProperties(const ComponentSchema* Schema)
+{
+    // Every layout includes the component name, which starts out empty.
+    PropertyIndex = std::make_unique<ComponentPropertyIndex>(
+        Schema != nullptr ? ComponentPropertyLayout::Get(*Schema) : ComponentPropertyLayout::GetBase(), Properties);
+}
 
 } // namespace csp::multiplayer
@@ -0,0 +1,322 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Multiplayer/ComponentPropertyIndex.h"
+
+#include "CSP/Multiplayer/ComponentSchema.h"
+#include "Multiplayer/ComponentBaseKeys.h"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+namespace csp::multiplayer
+{
+
+namespace
+{
+
+// The properties every component has, alongside the ones its schema declares.
+const std::pair<uint32_t, csp::common::ReplicatedValue>& GetBaseProperties()
+{
+    static const std::pair<uint32_t, csp::common::ReplicatedValue> BaseProperties { COMPONENT_KEY_NAME, csp::common::ReplicatedValue("") };
+    return BaseProperties;
+}
+
+} // namespace
+
+ComponentPropertyLayout::ComponentPropertyLayout(const ComponentSchema* Schema)
+{
+    // Later duplicates of a key replace earlier ones, as they did when defaults were written into a map.
+    std::map<uint32_t, std::pair<csp::common::ReplicatedValue, bool>> SortedProperties;
+
+    if (Schema != nullptr)
+    {
+        for (const auto& Property : Schema->Properties)
+        {
+            SortedProperties[Property.Key] = { Property.DefaultValue, true };
+        }
+    }
+
+    const auto& [BaseKey, BaseDefault] = GetBaseProperties();
+    SortedProperties.emplace(BaseKey, std::make_pair(BaseDefault, false));
+
+    Slots.reserve(SortedProperties.size());
+
+    for (const auto& [Key, Property] : SortedProperties)
+    {
+        const uint16_t Index = static_cast<uint16_t>(Slots.size());
+        Slots.push_back({ Key, Property.first, Property.second });
+
+        if (Property.second)
+        {
+            ++SchemaSlotCount;
+        }
+
+        if (Key < MAX_DENSE_KEY)
+        {
+            if (Key >= SlotsByKey.size())
+            {
+                SlotsByKey.resize(Key + 1, NO_SLOT);
+            }
+
+            SlotsByKey[Key] = Index;
+        }
+        else
+        {
+            SparseSlots.emplace_back(Key, Index);
+        }
+    }
+}
+
+std::shared_ptr<const ComponentPropertyLayout> ComponentPropertyLayout::Get(const ComponentSchema& Schema)
+{
+    static std::mutex CacheMutex;
+    static std::unordered_map<ComponentSchema::TypeIdType, std::shared_ptr<const ComponentPropertyLayout>> Cache;
+
+    std::scoped_lock<std::mutex> Lock(CacheMutex);
+
+    auto& Cached = Cache[Schema.TypeId];
+
+    // Schemas can be updated at runtime, in which case the next component built from it gets a new layout.
+    // Components built before the update keep hold of the layout they were built with.
+    if (Cached == nullptr || Cached->Matches(Schema) == false)
+    {
+        Cached = std::shared_ptr<const ComponentPropertyLayout>(new ComponentPropertyLayout(&Schema));
+    }
+
+    return Cached;
+}
+
+std::shared_ptr<const ComponentPropertyLayout> ComponentPropertyLayout::GetBase()
+{
+    static const std::shared_ptr<const ComponentPropertyLayout> BaseLayout(new ComponentPropertyLayout(nullptr));
+    return BaseLayout;
+}
+
+uint16_t ComponentPropertyLayout::FindSparseSlot(uint32_t Key) const
+{
+    const auto It = std::lower_bound(
+        SparseSlots.begin(), SparseSlots.end(), Key, [](const std::pair<uint32_t, uint16_t>& Entry, uint32_t Value) { return Entry.first < Value; });
+
+    return It != SparseSlots.end() && It->first == Key ? It->second : NO_SLOT;
+}
+
+bool ComponentPropertyLayout::Matches(const ComponentSchema& Schema) const
+{
+    if (Schema.Properties.Size() != SchemaSlotCount)
+    {
+        return false;
+    }
+
+    for (const auto& Property : Schema.Properties)
+    {
+        const uint16_t Index = FindSlot(Property.Key);
+
+        if (Index == NO_SLOT || Slots[Index].IsSchemaProperty == false || Slots[Index].DefaultValue != Property.DefaultValue)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+ComponentPropertyIndex::ComponentPropertyIndex(std::shared_ptr<const ComponentPropertyLayout> InLayout, ValueMap& InValues)
+    : Layout(std::move(InLayout))
+    , Values(InValues)
+    , SlotValues(Layout->GetSlotCount(), nullptr)
+    , DirtySlotBits((Layout->GetSlotCount() + 63) / 64, 0)
+{
+    // Every slot starts out present, holding its default value.
+    for (uint16_t Slot = 0; Slot < Layout->GetSlotCount(); ++Slot)
+    {
+        const auto& LayoutSlot = Layout->GetSlot(Slot);
+        auto& Value = Values[LayoutSlot.Key];
+
+        Value = LayoutSlot.DefaultValue;
+        SlotValues[Slot] = &Value;
+    }
+
+    PresentSlotCount = SlotValues.size();
+}
+
+const csp::common::ReplicatedValue* ComponentPropertyIndex::Find(uint32_t Key) const
+{
+    const uint16_t Slot = Layout->FindSlot(Key);
+
+    if (Slot != ComponentPropertyLayout::NO_SLOT)
+    {
+        return SlotValues[Slot];
+    }
+
+    // Only keys outside the layout need a lookup, and most components have none.
+    if (Values.Size() == PresentSlotCount)
+    {
+        return nullptr;
+    }
+
+    const auto It = Values.Find(Key);
+
+    return It != Values.end() ? &It->second : nullptr;
+}
+
+bool ComponentPropertyIndex::Set(uint32_t Key, const csp::common::ReplicatedValue& Value)
+{
+    const uint16_t Slot = Layout->FindSlot(Key);
+
+    if (Slot != ComponentPropertyLayout::NO_SLOT)
+    {
+        if (SlotValues[Slot] != nullptr)
+        {
+            if (*SlotValues[Slot] == Value)
+            {
+                return false;
+            }
+
+            *SlotValues[Slot] = Value;
+        }
+        else
+        {
+            auto& Stored = Values[Key];
+
+            Stored = Value;
+            SlotValues[Slot] = &Stored;
+            ++PresentSlotCount;
+        }
+
+        return true;
+    }
+
+    auto It = Values.Find(Key);
+
+    if (It == Values.end())
+    {
+        Values[Key] = Value;
+    }
+    else if (It->second == Value)
+    {
+        return false;
+    }
+    else
+    {
+        It->second = Value;
+    }
+
+    return true;
+}
+
+bool ComponentPropertyIndex::Remove(uint32_t Key)
+{
+    const uint16_t Slot = Layout->FindSlot(Key);
+
+    if (Slot != ComponentPropertyLayout::NO_SLOT)
+    {
+        if (SlotValues[Slot] == nullptr)
+        {
+            return false;
+        }
+
+        SlotValues[Slot] = nullptr;
+        --PresentSlotCount;
+    }
+    else if (Values.HasKey(Key) == false)
+    {
+        return false;
+    }
+    else
+    {
+        // Removed overflow values have nowhere to keep dirty state, and are picked up by the component being sent in full.
+        DirtyOverflowKeys.erase(Key);
+    }
+
+    Values.Remove(Key);
+
+    return true;
+}
+
+void ComponentPropertyIndex::Assign(const ValueMap& NewValues)
+{
+    // Map assignment frees its contents before copying, so assigning the map to itself has to be skipped.
+    if (&NewValues != &Values)
+    {
+        Values = NewValues;
+    }
+
+    DirtyOverflowKeys.clear();
+
+    ResolveSlots();
+}
+
+void ComponentPropertyIndex::ResolveSlots()
+{
+    PresentSlotCount = 0;
+
+    for (uint16_t Slot = 0; Slot < SlotValues.size(); ++Slot)
+    {
+        const auto It = Values.Find(Layout->GetSlot(Slot).Key);
+
+        SlotValues[Slot] = It != Values.end() ? &It->second : nullptr;
+
+        if (SlotValues[Slot] != nullptr)
+        {
+            ++PresentSlotCount;
+        }
+    }
+}
+
+void ComponentPropertyIndex::MarkDirty(uint32_t Key)
+{
+    const uint16_t Slot = Layout->FindSlot(Key);
+
+    if (Slot != ComponentPropertyLayout::NO_SLOT)
+    {
+        DirtySlotBits[Slot / 64] |= uint64_t { 1 } << (Slot % 64);
+        return;
+    }
+
+    if (Values.HasKey(Key))
+    {
+        DirtyOverflowKeys.insert(Key);
+    }
+}
+
+bool ComponentPropertyIndex::IsDirty(uint32_t Key) const
+{
+    const uint16_t Slot = Layout->FindSlot(Key);
+
+    if (Slot != ComponentPropertyLayout::NO_SLOT)
+    {
+        return (DirtySlotBits[Slot / 64] & (uint64_t { 1 } << (Slot % 64))) != 0;
+    }
+
+    return DirtyOverflowKeys.count(Key) > 0;
+}
+
+bool ComponentPropertyIndex::HasDirtyProperties() const
+{
+    const bool HasDirtySlots = std::any_of(DirtySlotBits.begin(), DirtySlotBits.end(), [](uint64_t Word) { return Word != 0; });
+
+    return HasDirtySlots || DirtyOverflowKeys.empty() == false;
+}
+
+void ComponentPropertyIndex::ClearDirty()
+{
+    std::fill(DirtySlotBits.begin(), DirtySlotBits.end(), 0);
+    DirtyOverflowKeys.clear();
+}
+
+} // namespace csp::multiplayer
@@ -0,0 +1,149 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CSP/Common/Map.h"
+#include "CSP/Common/ReplicatedValue.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace csp::multiplayer
+{
+class ComponentSchema;
+
+/*
+    The property slots shared by every component built from the same schema.
+    Each property the schema declares, plus the properties every component has (such as its name), is given a dense slot index,
+    in key order. Keys up to MAX_DENSE_KEY map straight to their slot through a flat table, so finding a slot never walks a tree.
+    Layouts are immutable once built, and are cached per component type so that instances share them.
+*/
+class ComponentPropertyLayout
+{
+public:
+    static constexpr uint16_t NO_SLOT = UINT16_MAX;
+
+    // Schema keys above this are looked up by binary search rather than through the flat table, to bound the table's size.
+    static constexpr uint32_t MAX_DENSE_KEY = 1024;
+
+    struct Slot
+    {
+        uint32_t Key;
+        csp::common::ReplicatedValue DefaultValue;
+
+        // False for the properties that every component has, which can't be read or written through the schema property API.
+        bool IsSchemaProperty;
+    };
+
+    // Returns the layout for the schema, building it the first time a schema with these properties is seen.
+    static std::shared_ptr<const ComponentPropertyLayout> Get(const ComponentSchema& Schema);
+
+    // Returns the layout for components that weren't built from a schema, which only holds the properties every component has.
+    static std::shared_ptr<const ComponentPropertyLayout> GetBase();
+
+    uint16_t FindSlot(uint32_t Key) const { return Key < SlotsByKey.size() ? SlotsByKey[Key] : FindSparseSlot(Key); }
+
+    const Slot& GetSlot(uint16_t Index) const { return Slots[Index]; }
+
+    size_t GetSlotCount() const { return Slots.size(); }
+
+private:
+    explicit ComponentPropertyLayout(const ComponentSchema* Schema);
+
+    uint16_t FindSparseSlot(uint32_t Key) const;
+
+    // Whether this layout was built from an identical set of schema properties.
+    bool Matches(const ComponentSchema& Schema) const;
+
+    std::vector<Slot> Slots;
+    std::vector<uint16_t> SlotsByKey;
+    std::vector<std::pair<uint32_t, uint16_t>> SparseSlots;
+    size_t SchemaSlotCount = 0;
+};
+
+/*
+    A flat index over a component's property map.
+    The map stays the one place values live, so views of it are always current. The index keeps a pointer to the map's value for every
+    slot of the layout, and the values of std::map nodes never move, so reading or writing a property declared by the schema is an index
+    into an array rather than a walk down the tree. Dirty state is kept as a bitmask alongside.
+    Keys the layout doesn't know about (such as custom component properties) are found in the map directly.
+    Keys must be added and removed through the index, so that its pointers stay in step with the map. Writing a new value to a key the map
+    already holds is seen by the index either way.
+*/
+class ComponentPropertyIndex
+{
+public:
+    using ValueMap = csp::common::Map<uint32_t, csp::common::ReplicatedValue>;
+
+    // Writes the layout's default values into the map, which must outlive the index.
+    ComponentPropertyIndex(std::shared_ptr<const ComponentPropertyLayout> InLayout, ValueMap& InValues);
+
+    // Returns nullptr if there's no value for the key.
+    const csp::common::ReplicatedValue* Find(uint32_t Key) const;
+
+    bool Contains(uint32_t Key) const { return Find(Key) != nullptr; }
+
+    size_t Size() const { return Values.Size(); }
+
+    // Returns whether the stored value changed.
+    bool Set(uint32_t Key, const csp::common::ReplicatedValue& Value);
+
+    // Returns whether there was a value to remove.
+    bool Remove(uint32_t Key);
+
+    // Replaces every stored value with the contents of the map.
+    void Assign(const ValueMap& NewValues);
+
+    // Dirty state is only changed explicitly, so that values applied from incoming patches aren't sent back out.
+    void MarkDirty(uint32_t Key);
+    bool IsDirty(uint32_t Key) const;
+    bool HasDirtyProperties() const;
+    void ClearDirty();
+
+    // Calls Callback(Key, Value) for every stored value, in key order.
+    template <typename Func> void ForEach(Func&& Callback) const;
+
+    const ComponentPropertyLayout& GetLayout() const { return *Layout; }
+
+private:
+    // Points every slot at its value in the map, after the map has been replaced.
+    void ResolveSlots();
+
+    std::shared_ptr<const ComponentPropertyLayout> Layout;
+    ValueMap& Values;
+
+    // The value of each slot in the map, or nullptr if the map doesn't hold it.
+    std::vector<csp::common::ReplicatedValue*> SlotValues;
+    size_t PresentSlotCount = 0;
+
+    std::vector<uint64_t> DirtySlotBits;
+    std::set<uint32_t> DirtyOverflowKeys;
+};
+
+template <typename Func> void ComponentPropertyIndex::ForEach(Func&& Callback) const
+{
+    for (const auto& [Key, Value] : Values)
+    {
+        Callback(Key, Value);
+    }
+}
+
+} // namespace csp::multiplayer
@@ -17,6 +17,7 @@
 #include "CSP/Multiplayer/ComponentSchema.h"
 #include "CSP/Common/Systems/Log/LogSystem.h"
 #include "Common/Convert.h"
+#include "Common/Systems/Log/LogFormat.h"
 #include "Json/JsonSerializer.h"
 
 #include <fmt/format.h>
@@ -279,8 +280,7 @@ namespace
         {
             if (LogSystem)
             {
-                LogSystem->LogMsg(
-                    csp::common::LogLevel::Warning, fmt::format("TryParseProperty: 'defaultValue' is not valid for type '{}'", Type).c_str());
+                CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Warning, "TryParseProperty: 'defaultValue' is not valid for type '{}'", Type);
             }
 
             return std::nullopt;
@@ -479,11 +479,8 @@ bool IsCompatible(const ComponentSchema& Original, const ComponentSchema& Update
 {
     if (Original.Name != Updated.Name)
     {
-        if (LogSystem != nullptr)
-        {
-            LogSystem->LogMsg(csp::common::LogLevel::Warning,
-                fmt::format("Schema name mismatch: expected '{}', got '{}'.", Original.Name.c_str(), Updated.Name.c_str()).c_str());
-        }
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Warning, "Schema name mismatch: expected '{}', got '{}'.", Original.Name.c_str(),
+            Updated.Name.c_str());
         return false;
     }
 
@@ -500,8 +497,8 @@ bool IsCompatible(const ComponentSchema& Original, const ComponentSchema& Update
             const auto Result = Predicate(Property);
             if (!Result && LogSystem != nullptr)
             {
-                LogSystem->LogMsg(csp::common::LogLevel::Warning,
-                    fmt::format("Incompatible property: key {}, name '{}'.", Property.Key, Property.Name.c_str()).c_str());
+                CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Warning, "Incompatible property: key {}, name '{}'.", Property.Key,
+                    Property.Name.c_str());
             }
             return Result;
         };
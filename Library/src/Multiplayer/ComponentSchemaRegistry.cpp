@@ -44,6 +44,7 @@
 #include "CSP/Multiplayer/Components/StaticModelSpaceComponent.h"
 #include "CSP/Multiplayer/Components/TextSpaceComponent.h"
 #include "CSP/Multiplayer/Components/VideoPlayerSpaceComponent.h"
+#include "Common/Systems/Log/LogFormat.h"
 
 #include <fmt/format.h>
 
@@ -63,8 +64,7 @@ ComponentSchemaRegistryImpl::ComponentSchemaRegistryImpl(
 
         if (DidReplace)
         {
-            LogSystem.LogMsg(
-                csp::common::LogLevel::Warning, fmt::format("Replaced a previously registered schema for TypeId: {}", Schema.TypeId).c_str());
+            CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Warning, "Replaced a previously registered schema for TypeId: {}", Schema.TypeId);
         }
     };
 
@@ -98,8 +98,8 @@ ComponentSchemaRegistryImpl::ComponentSchemaRegistryImpl(
     {
         if (const auto It = SchemaMap.find(Schema.TypeId); It != SchemaMap.end() && !IsCompatible(It->second, Schema, &LogSystem))
         {
-            LogSystem.LogMsg(csp::common::LogLevel::Warning,
-                fmt::format("Injected schema for TypeId {} is not compatible with the built-in schema and will be ignored.", Schema.TypeId).c_str());
+            CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Warning,
+                "Injected schema for TypeId {} is not compatible with the built-in schema and will be ignored.", Schema.TypeId);
             continue;
         }
 
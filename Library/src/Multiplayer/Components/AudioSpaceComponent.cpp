@@ -18,6 +18,7 @@
 #include "CSP/Common/Systems/Log/LogSystem.h"
 
 #include "CSP/Multiplayer/ComponentSchema.h"
+#include "Common/Systems/Log/LogFormat.h"
 #include "Multiplayer/Script/ComponentBinding/AudioSpaceComponentScriptInterface.h"
 
 #include <fmt/format.h>
@@ -207,10 +208,7 @@ void AudioSpaceComponent::SetVolume(float Value)
     }
     else
     {
-        if (LogSystem != nullptr)
-        {
-            LogSystem->LogMsg(csp::common::LogLevel::Error, fmt::format("Invalid value for volume ({:.2f}). Must be from 0.0 to 1.0", Value).c_str());
-        }
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error, "Invalid value for volume ({:.2f}). Must be from 0.0 to 1.0", Value);
     }
 }
 
@@ -82,7 +82,7 @@ bool CustomSpaceComponent::HasCustomProperty(const csp::common::String& Key) con
 {
     const uint32_t PropertyKey = GetCustomPropertySubscriptionKey(Key);
 
-    return Properties.HasKey(PropertyKey);
+    return HasPropertyDirect(PropertyKey);
 }
 
 const csp::common::ReplicatedValue& CustomSpaceComponent::GetCustomProperty(const csp::common::String& Key) const
@@ -97,7 +97,7 @@ void CustomSpaceComponent::SetCustomProperty(const csp::common::String& Key, con
     if (Value.GetReplicatedValueType() != csp::common::ReplicatedValueType::InvalidType)
     {
         const uint32_t PropertyKey = GetCustomPropertySubscriptionKey(Key);
-        if (!Properties.HasKey(PropertyKey))
+        if (!HasPropertyDirect(PropertyKey))
         {
             AddKey(Key);
         }
@@ -109,7 +109,7 @@ void CustomSpaceComponent::RemoveCustomProperty(const csp::common::String& Key)
 {
     const uint32_t PropertyKey = GetCustomPropertySubscriptionKey(Key);
 
-    if (Properties.HasKey(PropertyKey))
+    if (HasPropertyDirect(PropertyKey))
     {
         RemoveProperty(PropertyKey);
         RemoveKey(Key);
@@ -118,7 +118,7 @@ void CustomSpaceComponent::RemoveCustomProperty(const csp::common::String& Key)
 
 csp::common::List<csp::common::String> CustomSpaceComponent::GetCustomPropertyKeys() const
 {
-    if (Properties.HasKey(static_cast<uint32_t>(CustomComponentPropertyKeys::CustomPropertyList)))
+    if (HasPropertyDirect(static_cast<uint32_t>(CustomComponentPropertyKeys::CustomPropertyList)))
     {
         const auto& RepVal = GetPropertyDirect(static_cast<uint32_t>(CustomComponentPropertyKeys::CustomPropertyList));
 
@@ -133,19 +133,19 @@ csp::common::List<csp::common::String> CustomSpaceComponent::GetCustomPropertyKe
 
 int32_t CustomSpaceComponent::GetNumProperties() const
 {
-    if (Properties.HasKey(static_cast<uint32_t>(CustomComponentPropertyKeys::CustomPropertyList)))
+    if (HasPropertyDirect(static_cast<uint32_t>(CustomComponentPropertyKeys::CustomPropertyList)))
     {
-        return static_cast<uint32_t>(Properties.Size() - 1);
+        return static_cast<uint32_t>(GetPropertyCount() - 1);
     }
     else
     {
-        return static_cast<uint32_t>(Properties.Size());
+        return static_cast<uint32_t>(GetPropertyCount());
     }
 }
 
 void CustomSpaceComponent::AddKey(const csp::common::String& Value)
 {
-    if (Properties.HasKey(static_cast<uint32_t>(CustomComponentPropertyKeys::CustomPropertyList)))
+    if (HasPropertyDirect(static_cast<uint32_t>(CustomComponentPropertyKeys::CustomPropertyList)))
     {
         const auto& RepVal = GetPropertyDirect(static_cast<uint32_t>(CustomComponentPropertyKeys::CustomPropertyList));
 
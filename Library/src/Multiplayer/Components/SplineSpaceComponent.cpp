@@ -18,6 +18,7 @@
 #include "CSP/Common/fmt_Formatters.h"
 
 #include "CSP/Multiplayer/ComponentSchema.h"
+#include "Common/Systems/Log/LogFormat.h"
 #include "Multiplayer/Script/ComponentBinding/SplineSpaceComponentScriptInterface.h"
 
 #include "tinyspline.h"
@@ -99,11 +100,7 @@ csp::common::Vector3 SplineSpaceComponent::GetLocationAlongSpline(float Normalis
 
         if (Err != TS_SUCCESS)
         {
-            if (LogSystem != nullptr)
-            {
-                LogSystem->LogMsg(csp::common::LogLevel::Error,
-                    fmt::format("SplineSpaceComponent::GetLocationAlongSpline spline error: {}", Status.message).c_str());
-            }
+            CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error, "SplineSpaceComponent::GetLocationAlongSpline spline error: {}", Status.message);
 
             return {};
         }
@@ -113,11 +110,7 @@ csp::common::Vector3 SplineSpaceComponent::GetLocationAlongSpline(float Normalis
 
         if (Err != TS_SUCCESS)
         {
-            if (LogSystem != nullptr)
-            {
-                LogSystem->LogMsg(csp::common::LogLevel::Error,
-                    fmt::format("SplineSpaceComponent::GetLocationAlongSpline spline error: {}", Status.message).c_str());
-            }
+            CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error, "SplineSpaceComponent::GetLocationAlongSpline spline error: {}", Status.message);
 
             return {};
         }
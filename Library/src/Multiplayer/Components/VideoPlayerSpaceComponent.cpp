@@ -19,6 +19,7 @@
 #include "CSP/Multiplayer/SpaceEntity.h"
 
 #include "CSP/Multiplayer/ComponentSchema.h"
+#include "Common/Systems/Log/LogFormat.h"
 #include "Multiplayer/Script/ComponentBinding/VideoPlayerSpaceComponentScriptInterface.h"
 
 #include <fmt/format.h>
@@ -411,10 +412,7 @@ void VideoPlayerSpaceComponent::SetVolume(float Value)
     }
     else
     {
-        if (LogSystem != nullptr)
-        {
-            LogSystem->LogMsg(csp::common::LogLevel::Error, fmt::format("Invalid value for volume ({:.2f}). Must be from 0.0 to 1.0", Value).c_str());
-        }
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error, "Invalid value for volume ({:.2f}). Must be from 0.0 to 1.0", Value);
     }
 }
 
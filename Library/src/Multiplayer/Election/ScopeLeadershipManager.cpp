@@ -1,6 +1,7 @@
 #include "ScopeLeadershipManager.h"
 #include "CSP/Common/Systems/Log/LogSystem.h"
 #include "CSP/Multiplayer/MultiPlayerConnection.h"
+#include "Common/Systems/Log/LogFormat.h"
 #include "Multiplayer/SignalR/SignalRConnection.h"
 
 #include <fmt/format.h>
@@ -18,16 +19,15 @@ void ScopeLeadershipManager::RegisterScope(const std::string& ScopeId, const std
 {
     if (LeaderId.has_value())
     {
-        LogSystem.LogMsg(csp::common::LogLevel::Log,
-            fmt::format("ScopeLeadershipManager::RegisterScope Called for scope {0} with leader: {1}.", ScopeId, *LeaderId).c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Log, "ScopeLeadershipManager::RegisterScope Called for scope {0} with leader: {1}.", ScopeId,
+            *LeaderId);
 
         Scopes[ScopeId] = ScopeLeaderData {};
         Scopes[ScopeId]->LeaderClientId = *LeaderId;
     }
     else
     {
-        LogSystem.LogMsg(
-            csp::common::LogLevel::Log, fmt::format("ScopeLeadershipManager::RegisterScope Called for scope {0} with no leader.", ScopeId).c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Log, "ScopeLeadershipManager::RegisterScope Called for scope {0} with no leader.", ScopeId);
 
         Scopes[ScopeId] = std::nullopt;
     }
@@ -41,11 +41,9 @@ void ScopeLeadershipManager::OnElectedScopeLeader(const std::string& ScopeId, ui
 
     if (ScopeIt == Scopes.end())
     {
-        LogSystem.LogMsg(csp::common::LogLevel::Error,
-            fmt::format("ScopeLeadershipManager::OnElectedScopeLeader Event called for scope: {0} that isn't registered, for new "
-                        "leader: {1}.",
-                ScopeId, ClientId)
-                .c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error,
+            "ScopeLeadershipManager::OnElectedScopeLeader Event called for scope: {0} that isn't registered, for new leader: {1}.", ScopeId,
+            ClientId);
         return;
     }
 
@@ -53,15 +51,13 @@ void ScopeLeadershipManager::OnElectedScopeLeader(const std::string& ScopeId, ui
 
     if (Data.has_value())
     {
-        LogSystem.LogMsg(csp::common::LogLevel::Warning,
-            fmt::format("ScopeLeadershipManager::OnElectedScopeLeader Event called for scope: {0}, that already has the leader: {1}, for new leader: "
-                        "{2}. Overwriting old value.",
-                ScopeId, Data->LeaderClientId, ClientId)
-                .c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Warning,
+            "ScopeLeadershipManager::OnElectedScopeLeader Event called for scope: {0}, that already has the leader: {1}, for new leader: {2}. "
+            "Overwriting old value.", ScopeId, Data->LeaderClientId, ClientId);
     }
 
-    LogSystem.LogMsg(csp::common::LogLevel::Log,
-        fmt::format("ScopeLeadershipManager::OnElectedScopeLeader New leader: {0}, for scope: {1}.", ClientId, ScopeId).c_str());
+    CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Log, "ScopeLeadershipManager::OnElectedScopeLeader New leader: {0}, for scope: {1}.", ClientId,
+        ScopeId);
 
     Scopes[ScopeId] = { ClientId, std::chrono::steady_clock::time_point {} };
 }
@@ -72,8 +68,8 @@ void ScopeLeadershipManager::OnVacatedAsScopeLeader(const std::string& ScopeId)
 
     if (ScopeIt == Scopes.end())
     {
-        LogSystem.LogMsg(csp::common::LogLevel::Error,
-            fmt::format("ScopeLeadershipManager::OnVacatedAsScopeLeader Event called for scope: {0} that isn't registered.", ScopeId).c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error,
+            "ScopeLeadershipManager::OnVacatedAsScopeLeader Event called for scope: {0} that isn't registered.", ScopeId);
         return;
     }
 
@@ -86,13 +82,11 @@ void ScopeLeadershipManager::OnVacatedAsScopeLeader(const std::string& ScopeId)
     }
     else
     {
-        LogSystem.LogMsg(csp::common::LogLevel::Warning,
-            fmt::format("ScopeLeadershipManager::OnVacatedAsScopeLeader Event called for the scope: {0} that doesn't have a leader.", ScopeId)
-                .c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Warning,
+            "ScopeLeadershipManager::OnVacatedAsScopeLeader Event called for the scope: {0} that doesn't have a leader.", ScopeId);
     }
 
-    LogSystem.LogMsg(
-        csp::common::LogLevel::Log, fmt::format("ScopeLeadershipManager::OnVacatedAsScopeLeader Event called for scope: {}.", ScopeId).c_str());
+    CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Log, "ScopeLeadershipManager::OnVacatedAsScopeLeader Event called for scope: {}.", ScopeId);
 }
 
 void ScopeLeadershipManager::SendHeartbeatIfElectedScopeLeader()
@@ -124,8 +118,8 @@ std::optional<uint64_t> ScopeLeadershipManager::GetLeaderClientId(const std::str
 
     if (ScopeIt == Scopes.end())
     {
-        LogSystem.LogMsg(csp::common::LogLevel::Error,
-            fmt::format("ScopeLeadershipManager::GetLeaderClientId Event called for the scope: {} that isn't registered.", ScopeId).c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error,
+            "ScopeLeadershipManager::GetLeaderClientId Event called for the scope: {} that isn't registered.", ScopeId);
         return std::nullopt;
     }
 
@@ -180,24 +174,21 @@ void ScopeLeadershipManager::SendLeaderHeartbeat(const std::string& ScopeId)
                 }
                 catch (const std::exception& Exception)
                 {
-                    LogSystem.LogMsg(csp::common::LogLevel::Error,
-                        fmt::format("ScopeLeadershipManager::SendLeaderHeartbeat Failed to send heartbeat for scope: {0} with error: {1}", ScopeId,
-                            Exception.what())
-                            .c_str());
+                    CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error,
+                        "ScopeLeadershipManager::SendLeaderHeartbeat Failed to send heartbeat for scope: {0} with error: {1}", ScopeId,
+                        Exception.what());
                 }
                 catch (...)
                 {
-                    LogSystem.LogMsg(csp::common::LogLevel::Error,
-                        fmt::format(
-                            "ScopeLeadershipManager::SendLeaderHeartbeat Failed to send heartbeat for scope: {} with an unknown error.", ScopeId)
-                            .c_str());
+                    CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error,
+                        "ScopeLeadershipManager::SendLeaderHeartbeat Failed to send heartbeat for scope: {} with an unknown error.", ScopeId);
                 }
             }
             else
             {
                 // Successfuly sent the heartbeat.
-                LogSystem.LogMsg(csp::common::LogLevel::VeryVerbose,
-                    fmt::format("ScopeLeadershipManager::SendLeaderHeartbeat Heartbeat was successfuly sent for scope: {}", ScopeId).c_str());
+                CSP_LOG_FMT(LogSystem, csp::common::LogLevel::VeryVerbose,
+                    "ScopeLeadershipManager::SendLeaderHeartbeat Heartbeat was successfuly sent for scope: {}", ScopeId);
             }
         });
     }
@@ -0,0 +1,181 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Multiplayer/IncomingPatchBatch.h"
+
+#include "Multiplayer/SpaceEntityKeys.h"
+
+#include <algorithm>
+
+namespace csp::multiplayer
+{
+
+namespace
+{
+
+using ComponentDataMap = std::map<uint16_t, mcs::ItemComponentData>;
+
+// Runtime components are replicated as a map of their properties, which includes the component type.
+const ComponentDataMap* GetComponentProperties(const mcs::ItemComponentData& Component)
+{
+    return std::get_if<ComponentDataMap>(&Component.GetValue());
+}
+
+bool ComponentTypesMatch(const mcs::ItemComponentData& Existing, const mcs::ItemComponentData& Incoming)
+{
+    const ComponentDataMap* ExistingProperties = GetComponentProperties(Existing);
+    const ComponentDataMap* IncomingProperties = GetComponentProperties(Incoming);
+
+    if (ExistingProperties == nullptr || IncomingProperties == nullptr)
+    {
+        return false;
+    }
+
+    auto ExistingTypeIt = ExistingProperties->find(COMPONENT_KEY_COMPONENTTYPE);
+    auto IncomingTypeIt = IncomingProperties->find(COMPONENT_KEY_COMPONENTTYPE);
+
+    if (ExistingTypeIt == ExistingProperties->end() || IncomingTypeIt == IncomingProperties->end())
+    {
+        return false;
+    }
+
+    return ExistingTypeIt->second == IncomingTypeIt->second;
+}
+
+} // namespace
+
+void IncomingPatchBatch::Add(mcs::ObjectPatch&& Patch)
+{
+    const uint64_t EntityId = Patch.GetId();
+
+    if (auto It = LatestPatchIndexById.find(EntityId); It != LatestPatchIndexById.end() && CanMergeInto(It->second, Patch))
+    {
+        if (TryMerge(Patches[It->second], Patch))
+        {
+            if (Patches[It->second].GetShouldUpdateParent())
+            {
+                OrderingBarrierEnd = std::max(OrderingBarrierEnd, It->second + 1);
+            }
+
+            return;
+        }
+    }
+
+    Patches.push_back(std::move(Patch));
+    LatestPatchIndexById[EntityId] = Patches.size() - 1;
+
+    if (Patches.back().GetDestroy() || Patches.back().GetShouldUpdateParent())
+    {
+        OrderingBarrierEnd = Patches.size();
+    }
+}
+
+std::vector<mcs::ObjectPatch> IncomingPatchBatch::Flush()
+{
+    std::vector<mcs::ObjectPatch> FlushedPatches;
+    FlushedPatches.swap(Patches);
+    LatestPatchIndexById.clear();
+    OrderingBarrierEnd = 0;
+
+    return FlushedPatches;
+}
+
+void IncomingPatchBatch::Clear()
+{
+    Patches.clear();
+    LatestPatchIndexById.clear();
+    OrderingBarrierEnd = 0;
+}
+
+bool IncomingPatchBatch::IsEmpty() const { return Patches.empty(); }
+
+size_t IncomingPatchBatch::Size() const { return Patches.size(); }
+
+bool IncomingPatchBatch::CanMergeInto(size_t ExistingIndex, const mcs::ObjectPatch& Incoming) const
+{
+    // A destroy or parent change queued after the existing patch would end up applied before the incoming one.
+    // The existing patch being the barrier itself is fine, it belongs to the same entity.
+    if (ExistingIndex + 1 < OrderingBarrierEnd)
+    {
+        return false;
+    }
+
+    // Likewise, a parent change can't be moved ahead of patches queued since for other entities.
+    return Incoming.GetShouldUpdateParent() == false || ExistingIndex + 1 == Patches.size();
+}
+
+bool IncomingPatchBatch::TryMerge(mcs::ObjectPatch& Existing, mcs::ObjectPatch& Incoming)
+{
+    if (Existing.GetDestroy() || Incoming.GetDestroy())
+    {
+        return false;
+    }
+
+    auto& ExistingComponents = Existing.GetComponents();
+    auto& IncomingComponents = Incoming.GetComponents();
+
+    // Check everything can be merged before touching the existing patch, so a failed merge leaves it as it was.
+    if (ExistingComponents.has_value() && IncomingComponents.has_value())
+    {
+        for (const auto& [Key, IncomingComponent] : *IncomingComponents)
+        {
+            if (Key >= COMPONENT_KEY_END_COMPONENTS)
+            {
+                continue;
+            }
+
+            if (auto ExistingIt = ExistingComponents->find(Key);
+                ExistingIt != ExistingComponents->end() && ComponentTypesMatch(ExistingIt->second, IncomingComponent) == false)
+            {
+                return false;
+            }
+        }
+    }
+
+    ComponentDataMap MergedComponents = ExistingComponents.has_value() ? std::move(*ExistingComponents) : ComponentDataMap {};
+
+    if (IncomingComponents.has_value())
+    {
+        for (auto& [Key, IncomingComponent] : *IncomingComponents)
+        {
+            auto MergedIt = MergedComponents.find(Key);
+
+            if (MergedIt == MergedComponents.end() || Key >= COMPONENT_KEY_END_COMPONENTS)
+            {
+                // Entity properties, and components we haven't seen yet, are taken as they are.
+                MergedComponents[Key] = std::move(IncomingComponent);
+                continue;
+            }
+
+            // Same component, same type. Patches only carry the properties that changed, so keep the older ones and overwrite with the newer.
+            auto& MergedProperties = std::get<ComponentDataMap>(MergedIt->second.GetValue());
+
+            for (auto& [PropertyKey, PropertyValue] : std::get<ComponentDataMap>(IncomingComponent.GetValue()))
+            {
+                MergedProperties[PropertyKey] = std::move(PropertyValue);
+            }
+        }
+    }
+
+    // Owner and parent are always sent with their current values, so the newest wins. The parent update flag needs to
+    // survive the merge though, otherwise a reparent followed by a property change would never fire the parent update.
+    Existing = mcs::ObjectPatch { Existing.GetId(), Incoming.GetOwnerId(), false, Existing.GetShouldUpdateParent() || Incoming.GetShouldUpdateParent(),
+        Incoming.GetParentId(), std::move(MergedComponents) };
+
+    return true;
+}
+
+} // namespace csp::multiplayer
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Multiplayer/MCS/MCSTypes.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace csp::multiplayer
+{
+
+/*
+    Collects the object patches received from MCS between two ticks, coalescing them per entity.
+    Patches for an entity are merged into the one already queued for it, keeping the newest value for each property,
+    so an entity that was patched many times since the last tick has a single patch applied to it.
+
+    Patches are not merged when doing so would change what gets applied:
+    - Destroy patches are never merged, in either direction.
+    - A component that changes type between patches (which is how component deletion/replacement is replicated) starts a new patch.
+    In those cases the incoming patch is queued after the existing one, and they are applied in order.
+
+    A merge applies the newer patch at the position of the entity's first queued patch, ahead of anything other entities queued
+    in between. That must not reorder hierarchy changes across entities, so patches are also not merged across a destroy or
+    parent change queued for another entity, and a parent change is only merged into the most recently queued patch.
+
+    This does no locking of its own, callers are expected to hold the engine's entities lock.
+*/
+class IncomingPatchBatch
+{
+public:
+    void Add(mcs::ObjectPatch&& Patch);
+
+    // Returns the queued patches in arrival order, each merged patch taking the place of the first one it absorbed, leaving the batch empty.
+    [[nodiscard]] std::vector<mcs::ObjectPatch> Flush();
+
+    void Clear();
+
+    [[nodiscard]] bool IsEmpty() const;
+
+    // Number of patches that will be applied, after merging.
+    [[nodiscard]] size_t Size() const;
+
+private:
+    [[nodiscard]] bool CanMergeInto(size_t ExistingIndex, const mcs::ObjectPatch& Incoming) const;
+    static bool TryMerge(mcs::ObjectPatch& Existing, mcs::ObjectPatch& Incoming);
+
+    std::vector<mcs::ObjectPatch> Patches;
+
+    // Entity id -> index in Patches of the newest patch for that entity.
+    std::unordered_map<uint64_t, size_t> LatestPatchIndexById;
+
+    // One past the index in Patches of the newest destroy or parent change, nothing queued before it may be merged into.
+    size_t OrderingBarrierEnd = 0;
+};
+
+} // namespace csp::multiplayer
@@ -0,0 +1,503 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "MCSCompactTypes.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace csp::multiplayer::mcs
+{
+namespace
+{
+    // Convert from type to enum, matching the conversions used for ItemComponentData.
+    ItemComponentDataType GetComponentEnum(bool) { return ItemComponentDataType::BOOL; }
+    ItemComponentDataType GetComponentEnum(int64_t) { return ItemComponentDataType::INT64; }
+    ItemComponentDataType GetComponentEnum(uint64_t) { return ItemComponentDataType::UINT64; }
+    ItemComponentDataType GetComponentEnum(float) { return ItemComponentDataType::FLOAT; }
+    ItemComponentDataType GetComponentEnum(const InlineFloatArray&) { return ItemComponentDataType::FLOAT_ARRAY; }
+    ItemComponentDataType GetComponentEnum(double) { return ItemComponentDataType::DOUBLE; }
+    ItemComponentDataType GetComponentEnum(std::string_view) { return ItemComponentDataType::STRING; }
+    ItemComponentDataType GetComponentEnum(const CompactComponentMap&) { return ItemComponentDataType::UINT16_DICTIONARY; }
+    ItemComponentDataType GetComponentEnum(const CompactStringComponentMap&) { return ItemComponentDataType::STRING_DICTIONARY; }
+
+    template <typename T> void SerializeComponentData(SignalRSerializer& Serializer, const T& Value) { Serializer.WriteValue(Value); }
+
+    void SerializeComponentData(SignalRSerializer& Serializer, const InlineFloatArray& Value)
+    {
+        // Written element by element, in the same way as a std::vector<float>.
+        Serializer.StartWriteArray();
+
+        for (float Element : Value)
+        {
+            Serializer.WriteValue(Element);
+        }
+
+        Serializer.EndWriteArray();
+    }
+
+    template <class T> void DeserializeComponentDataInternal(SignalRDeserializer& Deserializer, CompactItemComponentDataVariant& OutVal)
+    {
+        // As with ItemComponentData, construct the exact type we want the variant to hold.
+        T DeserializedValue {};
+        Deserializer.ReadValue(DeserializedValue);
+        OutVal = DeserializedValue;
+    }
+
+    template <class MapType>
+    void DeserializeComponentMap(SignalRDeserializer& Deserializer, ComponentDataArena& Arena, CompactItemComponentDataVariant& OutVal)
+    {
+        MapType Map { Arena };
+
+        // If a dictionary is empty, we will receive null from MCS.
+        if (Deserializer.NextValueIsNull())
+        {
+            Deserializer.Skip();
+        }
+        else
+        {
+            Deserializer.ReadValue(Map);
+        }
+
+        OutVal = std::move(Map);
+    }
+
+    void DeserializeComponentData(
+        SignalRDeserializer& Deserializer, ItemComponentDataType Type, ComponentDataArena& Arena, CompactItemComponentDataVariant& OutVal)
+    {
+        switch (Type)
+        {
+        case ItemComponentDataType::BOOL:
+            DeserializeComponentDataInternal<bool>(Deserializer, OutVal);
+            break;
+        case ItemComponentDataType::INT64:
+            // We can't guarantee MCS will give us back a signed integer, even if one is sent.
+            if (Deserializer.NextValueIsInt())
+            {
+                DeserializeComponentDataInternal<int64_t>(Deserializer, OutVal);
+            }
+            else
+            {
+                DeserializeComponentDataInternal<uint64_t>(Deserializer, OutVal);
+            }
+            break;
+        case ItemComponentDataType::UINT64:
+            if (Deserializer.NextValueIsUint())
+            {
+                DeserializeComponentDataInternal<uint64_t>(Deserializer, OutVal);
+            }
+            else
+            {
+                DeserializeComponentDataInternal<int64_t>(Deserializer, OutVal);
+            }
+            break;
+        case ItemComponentDataType::DOUBLE:
+            DeserializeComponentDataInternal<double>(Deserializer, OutVal);
+            break;
+        case ItemComponentDataType::FLOAT:
+            DeserializeComponentDataInternal<float>(Deserializer, OutVal);
+            break;
+        case ItemComponentDataType::FLOAT_ARRAY:
+        {
+            size_t Count = 0;
+            Deserializer.StartReadArray(Count);
+
+            if (Count > InlineFloatArray::CAPACITY)
+            {
+                throw std::runtime_error("Unsupported float array size.");
+            }
+
+            float Values[InlineFloatArray::CAPACITY] {};
+
+            for (size_t i = 0; i < Count; ++i)
+            {
+                Deserializer.ReadValue(Values[i]);
+            }
+
+            Deserializer.EndReadArray();
+            OutVal = InlineFloatArray { Values, Count };
+            break;
+        }
+        case ItemComponentDataType::STRING:
+        {
+            std::string Value;
+            Deserializer.ReadValue(Value);
+            OutVal = Arena.CopyString(Value);
+            break;
+        }
+        case ItemComponentDataType::UINT16_DICTIONARY:
+            DeserializeComponentMap<CompactComponentMap>(Deserializer, Arena, OutVal);
+            break;
+        case ItemComponentDataType::STRING_DICTIONARY:
+            DeserializeComponentMap<CompactStringComponentMap>(Deserializer, Arena, OutVal);
+            break;
+        default:
+            throw std::invalid_argument("Trying to deserialize unsupported ItemComponentDataType");
+        }
+    }
+
+    // Lets map entries be read through SignalRDeserializer::ReadKeyValue, which has no way of passing the arena along.
+    class CompactItemComponentDataReader : public ISignalRDeserializable
+    {
+    public:
+        explicit CompactItemComponentDataReader(ComponentDataArena& Arena)
+            : Arena { Arena }
+        {
+        }
+
+        void Deserialize(SignalRDeserializer& Deserializer) override { Value.Deserialize(Deserializer, Arena); }
+
+        ComponentDataArena& Arena;
+        CompactItemComponentData Value;
+    };
+}
+
+ComponentDataArena::ComponentDataArena(size_t BlockSize)
+    : CurrentBlock { 0 }
+    , Offset { 0 }
+    , BlockSize { BlockSize }
+{
+}
+
+void* ComponentDataArena::Allocate(size_t Size, size_t Alignment)
+{
+    for (; CurrentBlock < Blocks.size(); ++CurrentBlock, Offset = 0)
+    {
+        Block& Current = Blocks[CurrentBlock];
+
+        const uintptr_t Base = reinterpret_cast<uintptr_t>(Current.Data.get());
+        const size_t AlignedOffset = static_cast<size_t>(((Base + Offset + Alignment - 1) & ~static_cast<uintptr_t>(Alignment - 1)) - Base);
+
+        if (AlignedOffset + Size <= Current.Size)
+        {
+            Offset = AlignedOffset + Size;
+            return Current.Data.get() + AlignedOffset;
+        }
+    }
+
+    // None of the remaining blocks have room, so add one. Oversized allocations get a block of their own.
+    const size_t NewBlockSize = std::max(BlockSize, Size + Alignment);
+    Blocks.push_back(Block { std::unique_ptr<unsigned char[]>(new unsigned char[NewBlockSize]), NewBlockSize });
+
+    return Allocate(Size, Alignment);
+}
+
+std::string_view ComponentDataArena::CopyString(std::string_view Value)
+{
+    if (Value.empty())
+    {
+        return {};
+    }
+
+    char* Copy = static_cast<char*>(Allocate(Value.size(), alignof(char)));
+    std::memcpy(Copy, Value.data(), Value.size());
+
+    return std::string_view { Copy, Value.size() };
+}
+
+void ComponentDataArena::Reset()
+{
+    CurrentBlock = 0;
+    Offset = 0;
+}
+
+size_t ComponentDataArena::GetBlockCount() const { return Blocks.size(); }
+
+InlineFloatArray::InlineFloatArray(std::initializer_list<float> Values)
+    : InlineFloatArray(Values.begin(), Values.size())
+{
+}
+
+InlineFloatArray::InlineFloatArray(const float* Values, size_t Count)
+{
+    if (Count > CAPACITY)
+    {
+        throw std::runtime_error("Unsupported float array size.");
+    }
+
+    std::copy(Values, Values + Count, this->Values.begin());
+    this->Count = static_cast<uint8_t>(Count);
+}
+
+size_t InlineFloatArray::Size() const { return Count; }
+
+const float* InlineFloatArray::Data() const { return Values.data(); }
+
+float InlineFloatArray::operator[](size_t Index) const { return Values[Index]; }
+
+const float* InlineFloatArray::begin() const { return Values.data(); }
+
+const float* InlineFloatArray::end() const { return Values.data() + Count; }
+
+bool InlineFloatArray::operator==(const InlineFloatArray& Other) const { return std::equal(begin(), end(), Other.begin(), Other.end()); }
+
+template <typename KeyType>
+CompactFlatMap<KeyType>::CompactFlatMap(ComponentDataArena& Arena)
+    : Entries { ArenaAllocator<EntryType> { Arena } }
+{
+}
+
+template <typename KeyType> void CompactFlatMap<KeyType>::Set(KeyType Key, CompactItemComponentData&& Value)
+{
+    // Keys are usually written in ascending order, so check for an append before searching.
+    if (Entries.empty() || Entries.back().first < Key)
+    {
+        Entries.emplace_back(Key, std::move(Value));
+        return;
+    }
+
+    auto It = std::lower_bound(
+        Entries.begin(), Entries.end(), Key, [](const EntryType& Entry, const KeyType& SearchKey) { return Entry.first < SearchKey; });
+
+    if (It != Entries.end() && It->first == Key)
+    {
+        It->second = std::move(Value);
+    }
+    else
+    {
+        Entries.emplace(It, Key, std::move(Value));
+    }
+}
+
+template <typename KeyType> const CompactItemComponentData* CompactFlatMap<KeyType>::Find(KeyType Key) const
+{
+    auto It = std::lower_bound(
+        Entries.begin(), Entries.end(), Key, [](const EntryType& Entry, const KeyType& SearchKey) { return Entry.first < SearchKey; });
+
+    return It != Entries.end() && It->first == Key ? &It->second : nullptr;
+}
+
+template <typename KeyType> size_t CompactFlatMap<KeyType>::Size() const { return Entries.size(); }
+
+template <typename KeyType> bool CompactFlatMap<KeyType>::IsEmpty() const { return Entries.empty(); }
+
+template <typename KeyType> void CompactFlatMap<KeyType>::Reserve(size_t Count) { Entries.reserve(Count); }
+
+template <typename KeyType> typename CompactFlatMap<KeyType>::const_iterator CompactFlatMap<KeyType>::begin() const { return Entries.begin(); }
+
+template <typename KeyType> typename CompactFlatMap<KeyType>::const_iterator CompactFlatMap<KeyType>::end() const { return Entries.end(); }
+
+template <typename KeyType> ComponentDataArena& CompactFlatMap<KeyType>::GetArena() const { return Entries.get_allocator().GetArena(); }
+
+template <typename KeyType> void CompactFlatMap<KeyType>::Serialize(SignalRSerializer& Serializer) const
+{
+    if constexpr (std::is_same_v<KeyType, std::string_view>)
+    {
+        Serializer.StartWriteStringMap();
+
+        for (const EntryType& Entry : Entries)
+        {
+            Serializer.WriteKeyValue(std::string { Entry.first }, Entry.second);
+        }
+
+        Serializer.EndWriteStringMap();
+    }
+    else
+    {
+        Serializer.StartWriteUintMap();
+
+        for (const EntryType& Entry : Entries)
+        {
+            Serializer.WriteKeyValue(Entry.first, Entry.second);
+        }
+
+        Serializer.EndWriteUintMap();
+    }
+}
+
+template <typename KeyType> void CompactFlatMap<KeyType>::Deserialize(SignalRDeserializer& Deserializer)
+{
+    ComponentDataArena& Arena = GetArena();
+    size_t MapSize = 0;
+
+    Entries.clear();
+
+    // Serialized maps are ordered by key, so entries can be appended as they are read.
+    if constexpr (std::is_same_v<KeyType, std::string_view>)
+    {
+        Deserializer.StartReadStringMap(MapSize);
+        Entries.reserve(MapSize);
+
+        for (size_t i = 0; i < MapSize; ++i)
+        {
+            std::pair<std::string, CompactItemComponentDataReader> Pair { std::string {}, CompactItemComponentDataReader { Arena } };
+            Deserializer.ReadKeyValue(Pair);
+            Entries.emplace_back(Arena.CopyString(Pair.first), std::move(Pair.second.Value));
+        }
+
+        Deserializer.EndReadStringMap();
+    }
+    else
+    {
+        Deserializer.StartReadUintMap(MapSize);
+        Entries.reserve(MapSize);
+
+        for (size_t i = 0; i < MapSize; ++i)
+        {
+            std::pair<KeyType, CompactItemComponentDataReader> Pair { KeyType {}, CompactItemComponentDataReader { Arena } };
+            Deserializer.ReadKeyValue(Pair);
+            Entries.emplace_back(Pair.first, std::move(Pair.second.Value));
+        }
+
+        Deserializer.EndReadUintMap();
+    }
+}
+
+template <typename KeyType> bool CompactFlatMap<KeyType>::operator==(const CompactFlatMap& Other) const { return Entries == Other.Entries; }
+
+template class CompactFlatMap<PropertyKeyType>;
+template class CompactFlatMap<std::string_view>;
+
+CompactItemComponentData::CompactItemComponentData(CompactItemComponentDataVariant&& Value)
+    : Value { std::move(Value) }
+{
+}
+
+void CompactItemComponentData::Serialize(SignalRSerializer& Serializer) const
+{
+    // Matches the layout written by ItemComponentData::Serialize: [Type, [Value]].
+    Serializer.StartWriteArray();
+    {
+        std::visit(
+            [&Serializer](const auto& ValueType)
+            {
+                Serializer.WriteValue(static_cast<uint64_t>(GetComponentEnum(ValueType)));
+
+                Serializer.StartWriteArray();
+                {
+                    SerializeComponentData(Serializer, ValueType);
+                }
+                Serializer.EndWriteArray();
+            },
+            Value);
+    }
+    Serializer.EndWriteArray();
+}
+
+void CompactItemComponentData::Deserialize(SignalRDeserializer& Deserializer, ComponentDataArena& Arena)
+{
+    size_t ArraySize = 0;
+    Deserializer.StartReadArray(ArraySize);
+    {
+        uint64_t RawType;
+        Deserializer.ReadValue(RawType);
+
+        size_t ValueArraySize = 0;
+        Deserializer.StartReadArray(ValueArraySize);
+        {
+            DeserializeComponentData(Deserializer, static_cast<ItemComponentDataType>(RawType), Arena, Value);
+        }
+        Deserializer.EndReadArray();
+    }
+    Deserializer.EndReadArray();
+}
+
+const CompactItemComponentDataVariant& CompactItemComponentData::GetValue() const { return Value; }
+
+ItemComponentData CompactItemComponentData::ToItemComponentData() const
+{
+    return std::visit(
+        [](const auto& ValueType) -> ItemComponentData
+        {
+            using T = std::decay_t<decltype(ValueType)>;
+
+            if constexpr (std::is_same_v<T, InlineFloatArray>)
+            {
+                return ItemComponentData { std::vector<float> { ValueType.begin(), ValueType.end() } };
+            }
+            else if constexpr (std::is_same_v<T, std::string_view>)
+            {
+                return ItemComponentData { std::string { ValueType } };
+            }
+            else if constexpr (std::is_same_v<T, CompactComponentMap>)
+            {
+                std::map<uint16_t, ItemComponentData> Map;
+
+                for (const auto& [Key, Entry] : ValueType)
+                {
+                    Map.emplace(Key, Entry.ToItemComponentData());
+                }
+
+                return ItemComponentData { Map };
+            }
+            else if constexpr (std::is_same_v<T, CompactStringComponentMap>)
+            {
+                std::map<std::string, ItemComponentData> Map;
+
+                for (const auto& [Key, Entry] : ValueType)
+                {
+                    Map.emplace(std::string { Key }, Entry.ToItemComponentData());
+                }
+
+                return ItemComponentData { Map };
+            }
+            else
+            {
+                return ItemComponentData { ValueType };
+            }
+        },
+        Value);
+}
+
+bool CompactItemComponentData::operator==(const CompactItemComponentData& Other) const { return Value == Other.Value; }
+
+CompactObjectPatch::CompactObjectPatch(uint64_t Id, uint64_t OwnerId, bool Destroy, bool ShouldUpdateParent, std::optional<uint64_t> ParentId,
+    CompactComponentMap&& Components)
+    : Id { Id }
+    , OwnerId { OwnerId }
+    , Destroy { Destroy }
+    , ShouldUpdateParent { ShouldUpdateParent }
+    , ParentId { ParentId }
+    , Components { std::move(Components) }
+{
+}
+
+void CompactObjectPatch::Serialize(SignalRSerializer& Serializer) const
+{
+    // Matches the layout written by ObjectPatch::Serialize.
+    Serializer.StartWriteArray();
+    {
+        Serializer.WriteValue(Id);
+        Serializer.WriteValue(OwnerId);
+        Serializer.WriteValue(Destroy);
+
+        // Parent changes need to be in a vector.
+        Serializer.StartWriteArray();
+        {
+            Serializer.WriteValue(ShouldUpdateParent);
+            Serializer.WriteValue(ParentId);
+        }
+        Serializer.EndWriteArray();
+
+        Serializer.WriteValue(Components);
+    }
+    Serializer.EndWriteArray();
+}
+
+uint64_t CompactObjectPatch::GetId() const { return Id; }
+
+uint64_t CompactObjectPatch::GetOwnerId() const { return OwnerId; }
+
+bool CompactObjectPatch::GetDestroy() const { return Destroy; }
+
+bool CompactObjectPatch::GetShouldUpdateParent() const { return ShouldUpdateParent; }
+
+std::optional<uint64_t> CompactObjectPatch::GetParentId() const { return ParentId; }
+
+const CompactComponentMap& CompactObjectPatch::GetComponents() const { return Components; }
+
+}
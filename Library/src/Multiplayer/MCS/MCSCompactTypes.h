@@ -0,0 +1,236 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include "Multiplayer/MCS/MCSTypes.h"
+
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+/*
+    Compact counterparts of the MCS component types, used when building outgoing patches.
+
+    ItemComponentData is convenient to work with, but every float array is a std::vector and every nested component
+    is a std::map, so packing a single transform update costs dozens of small heap allocations.
+    The types in this file produce exactly the same wire format, but:
+      - Float arrays (Vector2/3/4) are stored inline.
+      - Component maps are flat vectors sorted by key.
+      - Strings and map storage are taken from a ComponentDataArena owned by the caller, which is reset between patches,
+        so after the first few patches the arena's blocks are reused and packing allocates nothing.
+
+    Everything referencing an arena is only valid until that arena is reset or destroyed.
+*/
+
+namespace csp::multiplayer::mcs
+{
+
+/// @brief A bump allocator providing the storage for compact component data.
+/// @details Allocations are never freed individually. Reset rewinds the arena so its blocks are reused by later allocations.
+class ComponentDataArena
+{
+public:
+    static constexpr size_t DEFAULT_BLOCK_SIZE = 16 * 1024;
+
+    explicit ComponentDataArena(size_t BlockSize = DEFAULT_BLOCK_SIZE);
+
+    ComponentDataArena(const ComponentDataArena&) = delete;
+    ComponentDataArena& operator=(const ComponentDataArena&) = delete;
+
+    void* Allocate(size_t Size, size_t Alignment);
+
+    // Copies the string into the arena, returning a view of the copy.
+    std::string_view CopyString(std::string_view Value);
+
+    // Invalidates everything allocated from the arena, keeping its blocks for reuse.
+    void Reset();
+
+    // The number of blocks the arena has allocated from the heap, for diagnostics and tests.
+    size_t GetBlockCount() const;
+
+private:
+    struct Block
+    {
+        std::unique_ptr<unsigned char[]> Data;
+        size_t Size;
+    };
+
+    std::vector<Block> Blocks;
+    size_t CurrentBlock;
+    size_t Offset;
+    size_t BlockSize;
+};
+
+/// @brief Standard allocator adapter over ComponentDataArena, so standard containers can store their elements in an arena.
+template <typename T> class ArenaAllocator
+{
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(ComponentDataArena& Arena) noexcept
+        : Arena { &Arena }
+    {
+    }
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& Other) noexcept
+        : Arena { &Other.GetArena() }
+    {
+    }
+
+    T* allocate(size_t Count) { return static_cast<T*>(Arena->Allocate(Count * sizeof(T), alignof(T))); }
+
+    // Memory is reclaimed when the arena is reset.
+    void deallocate(T*, size_t) noexcept { }
+
+    ComponentDataArena& GetArena() const noexcept { return *Arena; }
+
+    template <typename U> bool operator==(const ArenaAllocator<U>& Other) const noexcept { return Arena == &Other.GetArena(); }
+    template <typename U> bool operator!=(const ArenaAllocator<U>& Other) const noexcept { return Arena != &Other.GetArena(); }
+
+private:
+    ComponentDataArena* Arena;
+};
+
+/// @brief A float array of up to four elements, stored inline. Used for Vector2, Vector3 and Vector4 values.
+class InlineFloatArray
+{
+public:
+    static constexpr size_t CAPACITY = 4;
+
+    InlineFloatArray() = default;
+    InlineFloatArray(std::initializer_list<float> Values);
+
+    // Throws std::runtime_error if Count exceeds CAPACITY.
+    InlineFloatArray(const float* Values, size_t Count);
+
+    size_t Size() const;
+    const float* Data() const;
+    float operator[](size_t Index) const;
+
+    const float* begin() const;
+    const float* end() const;
+
+    bool operator==(const InlineFloatArray& Other) const;
+
+private:
+    std::array<float, CAPACITY> Values {};
+    uint8_t Count = 0;
+};
+
+class CompactItemComponentData;
+
+/// @brief A map of component data stored as a vector sorted by key, with its storage taken from an arena.
+/// @details Serializes to the same uint or string map as the std::map used by ItemComponentData.
+/// String keys are views, so they must point at memory that outlives the map, such as a copy in the same arena.
+template <typename KeyType> class CompactFlatMap : public ISignalRSerializable, public ISignalRDeserializable
+{
+public:
+    using EntryType = std::pair<KeyType, CompactItemComponentData>;
+    using StorageType = std::vector<EntryType, ArenaAllocator<EntryType>>;
+    using const_iterator = typename StorageType::const_iterator;
+
+    explicit CompactFlatMap(ComponentDataArena& Arena);
+
+    // Inserts the value in key order, replacing any existing value for the key.
+    void Set(KeyType Key, CompactItemComponentData&& Value);
+
+    // Returns nullptr if the key is not in the map.
+    const CompactItemComponentData* Find(KeyType Key) const;
+
+    size_t Size() const;
+    bool IsEmpty() const;
+    void Reserve(size_t Count);
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    ComponentDataArena& GetArena() const;
+
+    void Serialize(SignalRSerializer& Serializer) const override;
+
+    // Reads a map written by either representation. Nested values are allocated from this map's arena.
+    void Deserialize(SignalRDeserializer& Deserializer) override;
+
+    bool operator==(const CompactFlatMap& Other) const;
+
+private:
+    StorageType Entries;
+};
+
+using CompactComponentMap = CompactFlatMap<PropertyKeyType>;
+using CompactStringComponentMap = CompactFlatMap<std::string_view>;
+
+/// @brief Variant holding the same MCS types as ItemComponentDataVariant, in their compact forms.
+using CompactItemComponentDataVariant = std::variant<bool, int64_t, uint64_t, float, InlineFloatArray, double, std::string_view,
+    CompactComponentMap, CompactStringComponentMap>;
+
+/// @brief Compact counterpart of ItemComponentData, serialized to the same type-value pair.
+class CompactItemComponentData : public ISignalRSerializable
+{
+public:
+    CompactItemComponentData() = default;
+    CompactItemComponentData(CompactItemComponentDataVariant&& Value);
+
+    void Serialize(SignalRSerializer& Serializer) const override;
+
+    // Reads a value written by either representation. Strings and nested maps are allocated from Arena.
+    void Deserialize(SignalRDeserializer& Deserializer, ComponentDataArena& Arena);
+
+    const CompactItemComponentDataVariant& GetValue() const;
+
+    // Converts to the heap allocated representation, e.g. to compare against or merge with incoming patches.
+    ItemComponentData ToItemComponentData() const;
+
+    bool operator==(const CompactItemComponentData& Other) const;
+
+private:
+    CompactItemComponentDataVariant Value;
+};
+
+/// @brief Compact counterpart of ObjectPatch, used to send local changes to MCS.
+/// @details Serializes to exactly the same structure as ObjectPatch, so it can be read back with ObjectPatch::Deserialize.
+class CompactObjectPatch : public ISignalRSerializable
+{
+public:
+    CompactObjectPatch(uint64_t Id, uint64_t OwnerId, bool Destroy, bool ShouldUpdateParent, std::optional<uint64_t> ParentId,
+        CompactComponentMap&& Components);
+
+    void Serialize(SignalRSerializer& Serializer) const override;
+
+    uint64_t GetId() const;
+    uint64_t GetOwnerId() const;
+    bool GetDestroy() const;
+    bool GetShouldUpdateParent() const;
+    std::optional<uint64_t> GetParentId() const;
+    const CompactComponentMap& GetComponents() const;
+
+private:
+    uint64_t Id;
+    uint64_t OwnerId;
+    bool Destroy;
+    bool ShouldUpdateParent;
+    std::optional<uint64_t> ParentId;
+    CompactComponentMap Components;
+};
+
+} // namespace csp::multiplayer::mcs
@@ -15,10 +15,17 @@
  */
 
 #include "MCSSceneDescription.h"
+#include "Common/TaskExecutor.h"
 #include "Services/ApiBase/ApiBase.h"
+#include "Json/JsonChunkedStream.h"
 #include "Json/JsonSerializer.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
 #include <map>
+#include <mutex>
+#include <rapidjson/reader.h>
 #include <string>
 #include <vector>
 
@@ -251,3 +258,331 @@ void FromJson(const csp::json::JsonDeserializer& Deserializer, csp::multiplayer:
 
     Obj = csp::multiplayer::mcs::ObjectMessage { Id, Type, IsTransferable, IsPersistent, OwnerId, ParentId, Components };
 }
+
+namespace csp::multiplayer::mcs
+{
+
+namespace
+{
+    // How many objects each worker is given to decode at a time when decoding in parallel.
+    constexpr size_t OBJECTS_PER_WORKER_BATCH = 64;
+
+    /*
+        Follows the SAX events for a scene description, tracking just enough of where they are in the document to pick out the elements
+        of data.objectMessages. When an element starts, the reader stops so the element can be captured, and while it is being captured
+        its events are forwarded to the document being built for it. Everything else in the scene description is skipped over.
+    */
+    class ObjectMessageCaptureHandler
+    {
+    public:
+        bool Null() { return Target != nullptr ? Target->Null() : true; }
+        bool Bool(bool Value) { return Target != nullptr ? Target->Bool(Value) : true; }
+        bool Int(int Value) { return Target != nullptr ? Target->Int(Value) : true; }
+        bool Uint(unsigned Value) { return Target != nullptr ? Target->Uint(Value) : true; }
+        bool Int64(int64_t Value) { return Target != nullptr ? Target->Int64(Value) : true; }
+        bool Uint64(uint64_t Value) { return Target != nullptr ? Target->Uint64(Value) : true; }
+        bool Double(double Value) { return Target != nullptr ? Target->Double(Value) : true; }
+        bool RawNumber(const char* Str, rapidjson::SizeType Length, bool Copy) { return Target != nullptr ? Target->RawNumber(Str, Length, Copy) : true; }
+        bool String(const char* Str, rapidjson::SizeType Length, bool Copy) { return Target != nullptr ? Target->String(Str, Length, Copy) : true; }
+
+        bool Key(const char* Str, rapidjson::SizeType Length, bool Copy)
+        {
+            if (Target != nullptr)
+            {
+                return Target->Key(Str, Length, Copy);
+            }
+
+            // Only keys in the root and data objects are needed to find the object messages.
+            if (Depth == 1 || (Depth == 2 && InData))
+            {
+                LastKey.assign(Str, Length);
+            }
+
+            return true;
+        }
+
+        bool StartObject()
+        {
+            if (Target != nullptr)
+            {
+                ++CaptureDepth;
+                return Target->StartObject();
+            }
+
+            ++Depth;
+
+            if (Depth == 2 && LastKey == "data")
+            {
+                InData = true;
+            }
+            else if (ObjectsDepth != 0 && Depth == ObjectsDepth + 1)
+            {
+                ObjectStarted = true;
+            }
+
+            return true;
+        }
+
+        bool EndObject(rapidjson::SizeType MemberCount)
+        {
+            if (Target != nullptr)
+            {
+                const bool Result = Target->EndObject(MemberCount);
+
+                if (--CaptureDepth == 0)
+                {
+                    Target = nullptr;
+                    --Depth;
+                }
+
+                return Result;
+            }
+
+            if (Depth == 2)
+            {
+                InData = false;
+            }
+
+            --Depth;
+            return true;
+        }
+
+        bool StartArray()
+        {
+            if (Target != nullptr)
+            {
+                ++CaptureDepth;
+                return Target->StartArray();
+            }
+
+            ++Depth;
+
+            if (Depth == 3 && InData && LastKey == "objectMessages")
+            {
+                ObjectsDepth = Depth;
+            }
+
+            return true;
+        }
+
+        bool EndArray(rapidjson::SizeType ElementCount)
+        {
+            if (Target != nullptr)
+            {
+                --CaptureDepth;
+                return Target->EndArray(ElementCount);
+            }
+
+            if (Depth == ObjectsDepth)
+            {
+                ObjectsDepth = 0;
+            }
+
+            --Depth;
+            return true;
+        }
+
+        // Returns whether the last event started an element of the object messages array, clearing the flag.
+        bool TakeObjectStarted()
+        {
+            const bool Started = ObjectStarted;
+            ObjectStarted = false;
+            return Started;
+        }
+
+        // Forwards events to Document until the element that has just started ends.
+        void BeginCapture(rapidjson::Document& Document)
+        {
+            Target = &Document;
+            CaptureDepth = 1;
+            Target->StartObject();
+        }
+
+        bool IsCapturing() const { return Target != nullptr; }
+
+    private:
+        rapidjson::Document* Target = nullptr;
+        int CaptureDepth = 0;
+
+        int Depth = 0;
+        bool InData = false;
+        int ObjectsDepth = 0;
+        bool ObjectStarted = false;
+        std::string LastKey;
+    };
+
+    void DecodeObjects(const std::vector<rapidjson::Document>& Documents, size_t Begin, size_t End, std::vector<ObjectMessage>& OutObjects)
+    {
+        for (size_t i = Begin; i < End; ++i)
+        {
+            csp::json::JsonDeserializer::Deserialize(Documents[i], OutObjects[i]);
+        }
+    }
+
+    // Decodes a batch of documents, splitting it across the executor's workers and the calling thread.
+    void DecodeObjectsInParallel(csp::TaskExecutor& Executor, const std::vector<rapidjson::Document>& Documents, std::vector<ObjectMessage>& OutObjects)
+    {
+        const size_t SliceCount = Executor.GetWorkerCount() + 1;
+        const size_t SliceSize = (Documents.size() + SliceCount - 1) / SliceCount;
+
+        std::mutex Mutex;
+        std::condition_variable Condition;
+        size_t Remaining = 0;
+        std::exception_ptr Error;
+
+        for (size_t Begin = SliceSize; Begin < Documents.size(); Begin += SliceSize)
+        {
+            const size_t End = std::min(Begin + SliceSize, Documents.size());
+
+            {
+                std::scoped_lock<std::mutex> Lock(Mutex);
+                ++Remaining;
+            }
+
+            Executor.Enqueue(
+                [&, Begin, End]()
+                {
+                    std::exception_ptr SliceError;
+
+                    try
+                    {
+                        DecodeObjects(Documents, Begin, End, OutObjects);
+                    }
+                    catch (...)
+                    {
+                        SliceError = std::current_exception();
+                    }
+
+                    std::scoped_lock<std::mutex> Lock(Mutex);
+
+                    if (SliceError && !Error)
+                    {
+                        Error = SliceError;
+                    }
+
+                    if (--Remaining == 0)
+                    {
+                        Condition.notify_one();
+                    }
+                });
+        }
+
+        std::exception_ptr LocalError;
+
+        try
+        {
+            DecodeObjects(Documents, 0, std::min(SliceSize, Documents.size()), OutObjects);
+        }
+        catch (...)
+        {
+            LocalError = std::current_exception();
+        }
+
+        std::unique_lock<std::mutex> Lock(Mutex);
+        Condition.wait(Lock, [&Remaining]() { return Remaining == 0; });
+
+        // Surface decode failures on the calling thread, as a non-streamed load would have.
+        if (LocalError)
+        {
+            std::rethrow_exception(LocalError);
+        }
+
+        if (Error)
+        {
+            std::rethrow_exception(Error);
+        }
+    }
+}
+
+bool ReadSceneDescriptionObjects(const csp::common::List<csp::common::String>& SceneDescriptionJson,
+    const std::function<void(ObjectMessage&&)>& OnObject, csp::TaskExecutor* DecodeExecutor)
+{
+    constexpr unsigned ParseFlags = rapidjson::kParseDefaultFlags;
+
+    csp::json::ChunkedStringStream Stream { SceneDescriptionJson };
+    rapidjson::Reader Reader;
+    ObjectMessageCaptureHandler Handler;
+
+    const size_t BatchSize = DecodeExecutor != nullptr ? (DecodeExecutor->GetWorkerCount() + 1) * OBJECTS_PER_WORKER_BATCH : 1;
+
+    // Each object gets its own document, so its memory is released as soon as the batch it is in has been handed off.
+    std::vector<rapidjson::Document> Documents;
+    std::vector<ObjectMessage> Objects;
+    Documents.reserve(BatchSize);
+
+    const auto FlushBatch = [&]()
+    {
+        Objects.resize(Documents.size());
+
+        if (DecodeExecutor != nullptr && Documents.size() > 1)
+        {
+            DecodeObjectsInParallel(*DecodeExecutor, Documents, Objects);
+        }
+        else
+        {
+            DecodeObjects(Documents, 0, Documents.size(), Objects);
+        }
+
+        for (ObjectMessage& Object : Objects)
+        {
+            OnObject(std::move(Object));
+        }
+
+        Documents.clear();
+        Objects.clear();
+    };
+
+    const auto CaptureObject = [&Reader, &Stream, &Handler](rapidjson::Document& Document)
+    {
+        Handler.BeginCapture(Document);
+
+        while (Handler.IsCapturing())
+        {
+            if (Reader.IterativeParseNext<ParseFlags>(Stream, Handler) == false)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    };
+
+    Reader.IterativeParseInit();
+
+    while (Reader.IterativeParseComplete() == false)
+    {
+        if (Reader.IterativeParseNext<ParseFlags>(Stream, Handler) == false)
+        {
+            break;
+        }
+
+        if (Handler.TakeObjectStarted())
+        {
+            Documents.emplace_back().Populate(CaptureObject);
+
+            if (Reader.HasParseError())
+            {
+                break;
+            }
+
+            if (Documents.size() == BatchSize)
+            {
+                FlushBatch();
+            }
+        }
+    }
+
+    if (Reader.HasParseError())
+    {
+        return false;
+    }
+
+    if (Documents.empty() == false)
+    {
+        FlushBatch();
+    }
+
+    return true;
+}
+
+} // namespace csp::multiplayer::mcs
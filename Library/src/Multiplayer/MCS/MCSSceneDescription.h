@@ -15,8 +15,17 @@
  */
 #pragma once
 
+#include "CSP/Common/List.h"
+#include "CSP/Common/String.h"
 #include "MCSTypes.h"
 
+#include <functional>
+
+namespace csp
+{
+class TaskExecutor;
+}
+
 namespace csp::multiplayer::mcs
 {
 /// @brief Internal mcs data structure which represents objects in a scene.
@@ -28,6 +37,16 @@ public:
     std::vector<ObjectMessage> Objects;
 };
 
+/// @brief Reads the object messages out of a scene description json, without building a document for the whole scene.
+/// @details The json is read straight from its chunks, so they never need to be joined, and only the objects currently being decoded
+/// are held as json documents.
+/// @param SceneDescriptionJson const csp::common::List<csp::common::String>& : The scene description json, split into any number of chunks.
+/// @param OnObject std::function<void(ObjectMessage&&)> : Called with each object message on the calling thread, in document order.
+/// @param DecodeExecutor csp::TaskExecutor* : When given, batches of objects are decoded across its workers and the calling thread.
+/// @return bool : False if the json could not be parsed. Objects before the error will already have been passed to OnObject.
+bool ReadSceneDescriptionObjects(const csp::common::List<csp::common::String>& SceneDescriptionJson,
+    const std::function<void(ObjectMessage&&)>& OnObject, csp::TaskExecutor* DecodeExecutor = nullptr);
+
 }
 
 void FromJson(const csp::json::JsonDeserializer& Deserializer, csp::multiplayer::mcs::SceneDescription& Obj);
@@ -224,6 +224,8 @@ void ItemComponentData::Deserialize(SignalRDeserializer& Deserializer)
 
 const ItemComponentDataVariant& ItemComponentData::GetValue() const { return Value; }
 
+ItemComponentDataVariant& ItemComponentData::GetValue() { return Value; }
+
 bool ItemComponentData::operator==(const ItemComponentData& Other) const { return Value == Other.Value; }
 
 ObjectMessage::ObjectMessage(uint64_t Id, uint64_t Type, bool IsTransferable, bool IsPersistent, uint64_t OwnerId, std::optional<uint64_t> ParentId,
@@ -290,13 +292,13 @@ std::optional<uint64_t> ObjectMessage::GetParentId() const { return ParentId; }
 const std::optional<std::map<PropertyKeyType, ItemComponentData>>& ObjectMessage::GetComponents() const { return Components; }
 
 ObjectPatch::ObjectPatch(uint64_t Id, uint64_t OwnerId, bool Destroy, bool ShouldUpdateParent, std::optional<uint64_t> ParentId,
-    const std::map<PropertyKeyType, ItemComponentData>& Components)
+    std::map<PropertyKeyType, ItemComponentData> Components)
     : Id { Id }
     , OwnerId { OwnerId }
     , Destroy { Destroy }
     , ShouldUpdateParent { ShouldUpdateParent }
     , ParentId { ParentId }
-    , Components { Components }
+    , Components { std::move(Components) }
 {
 }
 
@@ -365,4 +367,6 @@ std::optional<uint64_t> ObjectPatch::GetParentId() const { return ParentId; }
 
 const std::optional<std::map<PropertyKeyType, ItemComponentData>>& ObjectPatch::GetComponents() const { return Components; }
 
+std::optional<std::map<PropertyKeyType, ItemComponentData>>& ObjectPatch::GetComponents() { return Components; }
+
 }
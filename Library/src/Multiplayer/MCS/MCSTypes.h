@@ -130,6 +130,7 @@ public:
     void Deserialize(SignalRDeserializer& Deserializer) override;
 
     const ItemComponentDataVariant& GetValue() const;
+    ItemComponentDataVariant& GetValue();
 
     bool operator==(const ItemComponentData& Other) const;
 
@@ -179,7 +180,7 @@ class ObjectPatch : public ISignalRSerializable, public ISignalRDeserializable
 public:
     ObjectPatch() = default;
     ObjectPatch(uint64_t Id, uint64_t OwnerId, bool Destroy, bool ShouldUpdateParent, std::optional<uint64_t> ParentId,
-        const std::map<PropertyKeyType, ItemComponentData>& Components);
+        std::map<PropertyKeyType, ItemComponentData> Components);
 
     void Serialize(SignalRSerializer& Serializer) const override;
     void Deserialize(SignalRDeserializer& Deserializer) override;
@@ -192,6 +193,7 @@ public:
     bool GetShouldUpdateParent() const;
     std::optional<uint64_t> GetParentId() const;
     const std::optional<std::map<PropertyKeyType, ItemComponentData>>& GetComponents() const;
+    std::optional<std::map<PropertyKeyType, ItemComponentData>>& GetComponents();
 
 private:
     uint64_t Id = 0;
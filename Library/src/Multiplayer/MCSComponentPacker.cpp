@@ -1,5 +1,6 @@
 #include "MCSComponentPacker.h"
 #include "CSP/Multiplayer/ComponentBase.h"
+#include "ComponentPropertyIndex.h"
 #include "SpaceEntityKeys.h"
 
 namespace csp::multiplayer
@@ -42,6 +43,24 @@ uint64_t MCSComponentUnpacker::GetRuntimeComponentsCount() const
 
 const std::map<uint16_t, mcs::ItemComponentData>& MCSComponentPacker::GetComponents() const { return Components; }
 
+MCSCompactComponentPacker::MCSCompactComponentPacker(mcs::ComponentDataArena& Arena)
+    : Arena { Arena }
+    , Components { Arena }
+{
+}
+
+void MCSCompactComponentPacker::Reserve(size_t Count) { Components.Reserve(Count); }
+
+const mcs::CompactComponentMap& MCSCompactComponentPacker::GetComponents() const { return Components; }
+
+mcs::CompactComponentMap MCSCompactComponentPacker::TakeComponents()
+{
+    mcs::CompactComponentMap Taken { std::move(Components) };
+    Components = mcs::CompactComponentMap { Arena };
+
+    return Taken;
+}
+
 csp::common::ReplicatedValue ToReplicatedValue(double) { throw std::runtime_error("Unsupported"); }
 
 csp::common::ReplicatedValue ToReplicatedValue(uint64_t Value) { return csp::common::ReplicatedValue { static_cast<int64_t>(Value) }; }
@@ -98,12 +117,8 @@ mcs::ItemComponentData ToItemComponentData(ComponentBase* Value)
     ComponentPacker.WriteValue(COMPONENT_KEY_COMPONENTTYPE, Value->GetTypeId());
 
     // Our current component keys are stores as uint32s when they should really be stored as uint16, as this is what we support.
-    std::unique_ptr<common::Array<uint32_t>> Keys(const_cast<common::Array<uint32_t>*>(Value->GetProperties()->Keys()));
-
-    for (uint32_t Key : *Keys)
-    {
-        ComponentPacker.WriteValue(static_cast<uint16_t>(Key), (*Value->GetProperties())[static_cast<uint32_t>(Key)]);
-    }
+    Value->GetPropertyIndex().ForEach([&ComponentPacker](uint32_t Key, const csp::common::ReplicatedValue& Property)
+        { ComponentPacker.WriteValue(static_cast<uint16_t>(Key), Property); });
 
     return mcs::ItemComponentData { ComponentPacker.GetComponents() };
 }
@@ -154,4 +169,68 @@ mcs::ItemComponentData ToItemComponentData(const csp::common::Map<csp::common::S
     return mcs::ItemComponentData { Map };
 }
 
+mcs::CompactItemComponentData ToCompactItemComponentData(mcs::ComponentDataArena& Arena, ComponentBase* Value)
+{
+    // Mirrors ToItemComponentData(ComponentBase*), with the nested map taken from the arena.
+    MCSCompactComponentPacker ComponentPacker { Arena };
+    ComponentPacker.Reserve(Value->GetPropertyIndex().Size() + 1);
+
+    ComponentPacker.WriteValue(COMPONENT_KEY_COMPONENTTYPE, Value->GetTypeId());
+
+    Value->GetPropertyIndex().ForEach([&ComponentPacker](uint32_t Key, const csp::common::ReplicatedValue& Property)
+        { ComponentPacker.WriteValue(static_cast<uint16_t>(Key), Property); });
+
+    return mcs::CompactItemComponentData { ComponentPacker.TakeComponents() };
+}
+
+mcs::CompactItemComponentData ToCompactItemComponentData(mcs::ComponentDataArena& Arena, const csp::common::ReplicatedValue& Value)
+{
+    return std::visit([&Arena](const auto& InternalType) { return ToCompactItemComponentData(Arena, InternalType); }, Value.GetValue());
+}
+
+mcs::CompactItemComponentData ToCompactItemComponentData(mcs::ComponentDataArena&, bool Value) { return mcs::CompactItemComponentData { Value }; }
+
+mcs::CompactItemComponentData ToCompactItemComponentData(mcs::ComponentDataArena&, uint64_t Value) { return mcs::CompactItemComponentData { Value }; }
+
+mcs::CompactItemComponentData ToCompactItemComponentData(mcs::ComponentDataArena&, int64_t Value) { return mcs::CompactItemComponentData { Value }; }
+
+mcs::CompactItemComponentData ToCompactItemComponentData(mcs::ComponentDataArena&, float Value) { return mcs::CompactItemComponentData { Value }; }
+
+mcs::CompactItemComponentData ToCompactItemComponentData(mcs::ComponentDataArena& Arena, const csp::common::String& Value)
+{
+    return mcs::CompactItemComponentData { Arena.CopyString(std::string_view { Value.c_str(), Value.Length() }) };
+}
+
+mcs::CompactItemComponentData ToCompactItemComponentData(mcs::ComponentDataArena&, const csp::common::Vector3& Value)
+{
+    return mcs::CompactItemComponentData { mcs::InlineFloatArray { Value.X, Value.Y, Value.Z } };
+}
+
+mcs::CompactItemComponentData ToCompactItemComponentData(mcs::ComponentDataArena&, const csp::common::Vector4& Value)
+{
+    return mcs::CompactItemComponentData { mcs::InlineFloatArray { Value.X, Value.Y, Value.Z, Value.W } };
+}
+
+mcs::CompactItemComponentData ToCompactItemComponentData(mcs::ComponentDataArena&, const csp::common::Vector2& Value)
+{
+    return mcs::CompactItemComponentData { mcs::InlineFloatArray { Value.X, Value.Y } };
+}
+
+mcs::CompactItemComponentData ToCompactItemComponentData(
+    mcs::ComponentDataArena& Arena, const csp::common::Map<csp::common::String, csp::common::ReplicatedValue>& Value)
+{
+    mcs::CompactStringComponentMap Map { Arena };
+    std::unique_ptr<common::Array<csp::common::String>> Keys(const_cast<common::Array<csp::common::String>*>(Value.Keys()));
+
+    Map.Reserve(Keys->Size());
+
+    for (const auto& Key : (*Keys))
+    {
+        // Set keeps the map sorted, as the csp map makes no guarantees about key order.
+        Map.Set(Arena.CopyString(std::string_view { Key.c_str(), Key.Length() }), ToCompactItemComponentData(Arena, Value[Key]));
+    }
+
+    return mcs::CompactItemComponentData { std::move(Map) };
+}
+
 }
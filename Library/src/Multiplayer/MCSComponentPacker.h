@@ -19,6 +19,7 @@
 #include "CSP/Common/ReplicatedValue.h"
 #include "CSP/Common/String.h"
 #include "CSP/Common/Vector.h"
+#include "MCS/MCSCompactTypes.h"
 #include "MCS/MCSTypes.h"
 #include "Multiplayer/SpaceEntityKeys.h"
 
@@ -42,11 +43,35 @@ private:
     std::map<uint16_t, mcs::ItemComponentData> Components;
 };
 
+/// @brief Helper class to convert csp domain types to mcs CompactItemComponentData.
+/// @details Builds a component map compatible with mcs::CompactObjectPatch, without the per value heap allocations of MCSComponentPacker.
+/// All storage is taken from the given arena, which must outlive the packed components.
+class MCSCompactComponentPacker
+{
+public:
+    MCSCompactComponentPacker(mcs::ComponentDataArena& Arena);
+
+    template <class T> void WriteValue(uint16_t Key, const T& Value);
+    template <class T> void WriteValue(SpaceEntityComponentKey Key, const T& Value);
+
+    void Reserve(size_t Count);
+
+    const mcs::CompactComponentMap& GetComponents() const;
+
+    // Moves the packed components out of the packer, leaving it empty.
+    mcs::CompactComponentMap TakeComponents();
+
+private:
+    mcs::ComponentDataArena& Arena;
+    mcs::CompactComponentMap Components;
+};
+
 /// @brief Helper class to convert mcs domain types to csp types.
 /// @details Reads value from a components maps retrieved from a mcs::ObjectMessage or mcs::ObjectPatch.
 class MCSComponentUnpacker
 {
 public:
+    // Reads from the given map in place, so it must outlive the unpacker.
     MCSComponentUnpacker(const std::map<uint16_t, mcs::ItemComponentData>& Components);
 
     bool TryReadValue(uint16_t Key, csp::common::ReplicatedValue& Value) const;
@@ -55,7 +80,7 @@ public:
     uint64_t GetRuntimeComponentsCount() const;
 
 private:
-    std::map<uint16_t, mcs::ItemComponentData> Components;
+    const std::map<uint16_t, mcs::ItemComponentData>& Components;
 };
 
 template <class T> inline void MCSComponentPacker::WriteValue(SpaceEntityComponentKey Key, const T& Value)
@@ -63,6 +88,11 @@ template <class T> inline void MCSComponentPacker::WriteValue(SpaceEntityCompone
     WriteValue(static_cast<uint16_t>(Key), Value);
 }
 
+template <class T> inline void MCSCompactComponentPacker::WriteValue(SpaceEntityComponentKey Key, const T& Value)
+{
+    WriteValue(static_cast<uint16_t>(Key), Value);
+}
+
 template <typename T> csp::common::ReplicatedValue ToReplicatedValue(const T& Value) { return csp::common::ReplicatedValue { Value }; }
 
 template <typename T> std::enable_if_t<std::is_enum_v<T>, csp::common::ReplicatedValue> inline ToReplicatedValue(const T& Value)
@@ -96,4 +126,28 @@ template <typename T> std::enable_if_t<std::is_enum_v<T>, mcs::ItemComponentData
 {
     return ToItemComponentData(static_cast<uint64_t>(Value));
 }
+
+mcs::CompactItemComponentData ToCompactItemComponentData(mcs::ComponentDataArena& Arena, ComponentBase* Value);
+mcs::CompactItemComponentData ToCompactItemComponentData(mcs::ComponentDataArena& Arena, const csp::common::ReplicatedValue& Value);
+mcs::CompactItemComponentData ToCompactItemComponentData(mcs::ComponentDataArena& Arena, bool Value);
+mcs::CompactItemComponentData ToCompactItemComponentData(mcs::ComponentDataArena& Arena, uint64_t Value);
+mcs::CompactItemComponentData ToCompactItemComponentData(mcs::ComponentDataArena& Arena, int64_t Value);
+mcs::CompactItemComponentData ToCompactItemComponentData(mcs::ComponentDataArena& Arena, float Value);
+mcs::CompactItemComponentData ToCompactItemComponentData(mcs::ComponentDataArena& Arena, const csp::common::String& Value);
+mcs::CompactItemComponentData ToCompactItemComponentData(mcs::ComponentDataArena& Arena, const csp::common::Vector3& Value);
+mcs::CompactItemComponentData ToCompactItemComponentData(mcs::ComponentDataArena& Arena, const csp::common::Vector4& Value);
+mcs::CompactItemComponentData ToCompactItemComponentData(mcs::ComponentDataArena& Arena, const csp::common::Vector2& Value);
+mcs::CompactItemComponentData ToCompactItemComponentData(
+    mcs::ComponentDataArena& Arena, const csp::common::Map<csp::common::String, csp::common::ReplicatedValue>& Value);
+
+template <typename T>
+std::enable_if_t<std::is_enum_v<T>, mcs::CompactItemComponentData> ToCompactItemComponentData(mcs::ComponentDataArena& Arena, T Value)
+{
+    return ToCompactItemComponentData(Arena, static_cast<uint64_t>(Value));
+}
+
+template <class T> inline void MCSCompactComponentPacker::WriteValue(uint16_t Key, const T& Value)
+{
+    Components.Set(Key, ToCompactItemComponentData(Arena, Value));
+}
 }
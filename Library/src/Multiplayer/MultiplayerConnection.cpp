@@ -25,6 +25,7 @@
 #include "CSP/Multiplayer/OnlineRealtimeEngine.h"
 #include "CSP/Multiplayer/SpaceEntity.h"
 #include "CallHelpers.h"
+#include "Common/Systems/Log/LogFormat.h"
 #include "Events/EventSystem.h"
 #include "Multiplayer/MultiplayerConstants.h"
 #include "Multiplayer/NetworkEventSerialisation.h"
@@ -298,7 +299,7 @@ auto MultiplayerConnection::RequestClientId()
                 return;
             }
 
-            LogSystem.LogMsg(csp::common::LogLevel::Verbose, fmt::format("ClientId={}", Result.as_uinteger()).c_str());
+            CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Verbose, "ClientId={}", Result.as_uinteger());
 
             ClientIdRequestedEvent->set(Result.as_uinteger());
         };
@@ -548,6 +549,8 @@ CSP_ASYNC_RESULT void MultiplayerConnection::SetAllowSelfMessagingFlag(const boo
 
 bool MultiplayerConnection::GetAllowSelfMessagingFlag() const { return AllowSelfMessaging; }
 
+bool MultiplayerConnection::IsSendBackPressured() const { return WebSocketClient != nullptr && WebSocketClient->IsSendBackPressured(); }
+
 void MultiplayerConnection::BindOnObjectMessage()
 {
     const std::string OnObjectMessage = GetMultiplayerHubMethods().Get(MultiplayerHubMethod::ON_OBJECT_MESSAGE);
@@ -19,6 +19,8 @@
 #include "CSP/Common/Systems/Log/LogSystem.h"
 #include "CSP/Common/fmt_Formatters.h"
 #include "CSP/Systems/SystemBase.h"
+#include "Common/Systems/Log/LogFormat.h"
+#include "Debug/Profiler.h"
 #include "Multiplayer/NetworkEventSerialisation.h"
 #include "Multiplayer/SignalR/SignalRConnection.h"
 #include "NetworkEventManagerImpl.h"
@@ -47,16 +49,16 @@ void RegisterEventCallback(csp::common::LogSystem& LogSystem, const csp::common:
 
     if (EventReceiverId.IsEmpty())
     {
-        LogSystem.LogMsg(csp::common::LogLevel::Error,
-            fmt::format("NetworkEventBus: Expected non-empty EventReceiverId for event {}. Registration denied.", EventName).c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error, "NetworkEventBus: Expected non-empty EventReceiverId for event {}. Registration denied.",
+            EventName);
 
         return;
     }
 
     if (!Callback)
     {
-        LogSystem.LogMsg(csp::common::LogLevel::Error,
-            fmt::format("NetworkEventBus: Expected non-null callback for event {} with EventReceiverId: {}. Registration denied.", EventName, EventReceiverId).c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error,
+            "NetworkEventBus: Expected non-null callback for event {} with EventReceiverId: {}. Registration denied.", EventName, EventReceiverId);
 
         return;
     }
@@ -66,17 +68,14 @@ void RegisterEventCallback(csp::common::LogSystem& LogSystem, const csp::common:
     if (RegisteredEvents.find(Registration) != RegisteredEvents.end())
     {
         // An event with matching ReceiverId and EventName has already been registered, double registration is not allowed.
-        LogSystem.LogMsg(csp::common::LogLevel::Warning,
-            fmt::format("NetworkEventBus: Attempting to register a duplicate {} network event "
-                        "with EventReceiverId: {}. Registration denied.",
-                EventName, EventReceiverId)
-                .c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Warning,
+            "NetworkEventBus: Attempting to register a duplicate {} network event with EventReceiverId: {}. Registration denied.", EventName,
+            EventReceiverId);
 
         return;
     }
 
-    LogSystem.LogMsg(
-        csp::common::LogLevel::Verbose, fmt::format("Registering {} network event. EventReceiverId: {}.", EventName, EventReceiverId).c_str());
+    CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Verbose, "Registering {} network event. EventReceiverId: {}.", EventName, EventReceiverId);
 
     RegisteredEvents[Registration] = Callback;
 }
@@ -92,20 +91,20 @@ bool TryDeserializeEventData(
     }
     catch (const signalr::signalr_exception& e)
     {
-        LogSystem.LogMsg(csp::common::LogLevel::Error,
-            fmt::format("NetworkEventBus: SignalR type mismatch encountered in Event {}: {}", EventTypeStr.c_str(), e.what()).c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error, "NetworkEventBus: SignalR type mismatch encountered in Event {}: {}",
+            EventTypeStr.c_str(), e.what());
     }
     catch (const csp::common::ReplicatedValueException& e)
     {
-        LogSystem.LogMsg(csp::common::LogLevel::Error, fmt::format("NetworkEventBus: ReplicatedValue type mismatch: {}", e.what()).c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error, "NetworkEventBus: ReplicatedValue type mismatch: {}", e.what());
     }
     catch (...)
     {
         LogSystem.LogMsg(csp::common::LogLevel::Error, "NetworkEventBus: Unknown error encountered during event deserialisation.");
     }
 
-    LogSystem.LogMsg(csp::common::LogLevel::Error,
-        fmt::format("NetworkEventBus: Failed to deserialize event '{}'. Registered events will not be fired.", EventTypeStr).c_str());
+    CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error, "NetworkEventBus: Failed to deserialize event '{}'. Registered events will not be fired.",
+        EventTypeStr);
 
     return false;
 }
@@ -178,11 +177,9 @@ void NetworkEventBus::StopListenCustomNetworkEvent(csp::common::String EventRece
 
     if (RemovedCount == 0)
     {
-        LogSystem.LogMsg(csp::common::LogLevel::Verbose,
-            fmt::format("NetworkEventBus::StopListenCustomNetworkEvent: Could not find custom network event registration with Event ReceiverId: {}, "
-                        "Event: {}. Deregistration denied.",
-                EventReceiverId, EventName)
-                .c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Verbose,
+            "NetworkEventBus::StopListenCustomNetworkEvent: Could not find custom network event registration with Event ReceiverId: {}, Event: {}. "
+            "Deregistration denied.", EventReceiverId, EventName);
     }
 }
 
@@ -194,12 +191,9 @@ void NetworkEventBus::StopListenAccessControlChangedEvent(csp::common::String Ev
 
     if (RemovedCount == 0)
     {
-        LogSystem.LogMsg(csp::common::LogLevel::Verbose,
-            fmt::format("NetworkEventBus::StopListenAccessControlChangedEvent: Could not find access control changed network event registration with "
-                        "Event ReceiverId: {}. "
-                        "Deregistration denied.",
-                EventReceiverId)
-                .c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Verbose,
+            "NetworkEventBus::StopListenAccessControlChangedEvent: Could not find access control changed network event registration with Event "
+            "ReceiverId: {}. Deregistration denied.", EventReceiverId);
     }
 }
 
@@ -211,13 +205,9 @@ void NetworkEventBus::StopListenAssetDetailBlobChangedEvent(csp::common::String
 
     if (RemovedCount == 0)
     {
-        LogSystem.LogMsg(csp::common::LogLevel::Verbose,
-            fmt::format("NetworkEventBus::StopListenAssetDetailBlobChangedEvent: Could not find asset detail blob changed network event registration "
-                        "with Event "
-                        "ReceiverId: {}. "
-                        "Deregistration denied.",
-                EventReceiverId)
-                .c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Verbose,
+            "NetworkEventBus::StopListenAssetDetailBlobChangedEvent: Could not find asset detail blob changed network event registration with Event "
+            "ReceiverId: {}. Deregistration denied.", EventReceiverId);
     }
 }
 
@@ -229,11 +219,9 @@ void NetworkEventBus::StopListenAsyncCallCompletedEvent(csp::common::String Even
 
     if (RemovedCount == 0)
     {
-        LogSystem.LogMsg(csp::common::LogLevel::Verbose,
-            fmt::format("NetworkEventBus::StopListenAsyncCallCompletedEvent: Could not find async call completed network event for registration with "
-                        "Event ReceiverId: {} for Operation: {}. Deregistration denied.",
-                EventReceiverId, OperationName)
-                .c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Verbose,
+            "NetworkEventBus::StopListenAsyncCallCompletedEvent: Could not find async call completed network event for registration with Event "
+            "ReceiverId: {} for Operation: {}. Deregistration denied.", EventReceiverId, OperationName);
     }
 }
 
@@ -245,12 +233,9 @@ void NetworkEventBus::StopListenConversationEvent(csp::common::String EventRecei
 
     if (RemovedCount == 0)
     {
-        LogSystem.LogMsg(csp::common::LogLevel::Verbose,
-            fmt::format(
-                "NetworkEventBus::StopListenConversationEvent: Could not find conversation network event registration with Event ReceiverId: {}. "
-                "Deregistration denied.",
-                EventReceiverId)
-                .c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Verbose,
+            "NetworkEventBus::StopListenConversationEvent: Could not find conversation network event registration with Event ReceiverId: {}. "
+            "Deregistration denied.", EventReceiverId);
     }
 }
 
@@ -262,12 +247,9 @@ void NetworkEventBus::StopListenSequenceChangedEvent(csp::common::String EventRe
 
     if (RemovedCount == 0)
     {
-        LogSystem.LogMsg(csp::common::LogLevel::Verbose,
-            fmt::format("NetworkEventBus::StopListenSequenceChangedEvent: Could not find sequence changed network event registration with Event "
-                        "ReceiverId: {}. "
-                        "Deregistration denied.",
-                EventReceiverId)
-                .c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Verbose,
+            "NetworkEventBus::StopListenSequenceChangedEvent: Could not find sequence changed network event registration with Event ReceiverId: {}. "
+            "Deregistration denied.", EventReceiverId);
     }
 }
 
@@ -310,18 +292,15 @@ void NetworkEventBus::StopListenAllNetworkEvents(const csp::common::String& Even
 
     if (RegistrationsToRemoveCount == 0)
     {
-        LogSystem.LogMsg(csp::common::LogLevel::Log,
-            fmt::format("NetworkEventBus::StopListenAllNetworkEvents: Could not find any network events registered with EventReceiverId: {}. No "
-                        "events were deregistered.",
-                EventReceiverId)
-                .c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Log,
+            "NetworkEventBus::StopListenAllNetworkEvents: Could not find any network events registered with EventReceiverId: {}. No events were "
+            "deregistered.", EventReceiverId);
     }
     else
     {
-        LogSystem.LogMsg(csp::common::LogLevel::Verbose,
-            fmt::format("NetworkEventBus::StopListenAllNetworkEvents: Removed {} network event registration/s with EventReceiverId: {}.",
-                RegistrationsToRemoveCount, EventReceiverId)
-                .c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Verbose,
+            "NetworkEventBus::StopListenAllNetworkEvents: Removed {} network event registration/s with EventReceiverId: {}.",
+            RegistrationsToRemoveCount, EventReceiverId);
     }
 }
 
@@ -365,6 +344,8 @@ bool NetworkEventBus::StartEventMessageListening()
 
     std::function<void(signalr::value)> EventDispatchCallback = [this](signalr::value Result)
     {
+        CSP_PROFILE_SCOPED_NAME("NetworkEventBus::OnEventMessage");
+
         if (Result.is_null())
         {
             LogSystem.LogMsg(csp::common::LogLevel::Log, "NetworkEventBus: Event message received with null data.");
@@ -567,8 +548,7 @@ bool NetworkEventBus::StartEventMessageListening()
 
         if (!HasMatchingRegistrations)
         {
-            LogSystem.LogMsg(
-                csp::common::LogLevel::Verbose, fmt::format("Received event {} has no registrations, discarding...", EventTypeStr).c_str());
+            CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Verbose, "Received event {} has no registrations, discarding...", EventTypeStr);
         }
     };
 
@@ -16,6 +16,7 @@
 
 #include "Multiplayer/NetworkEventSerialisation.h"
 #include "CSP/Common/Systems/Log/LogSystem.h"
+#include "Common/Systems/Log/LogFormat.h"
 #include "MCS/MCSTypes.h"
 
 #include "Common/Encode.h"
@@ -398,8 +399,8 @@ csp::common::SequenceChangedNetworkEventData DeserializeSequenceChangedEvent(
 
     if (ParsedEvent.EventValues.Size() != 3)
     {
-        LogSystem.LogMsg(csp::common::LogLevel::Error,
-            fmt::format("SequenceChangedEvent - Invalid arguments. Expected 3 arguments but got {}.", ParsedEvent.EventValues.Size()).c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error, "SequenceChangedEvent - Invalid arguments. Expected 3 arguments but got {}.",
+            ParsedEvent.EventValues.Size());
         throw std::invalid_argument(
             fmt::format("SequenceChangedEvent - Invalid arguments. Expected 3 arguments but got {}.", ParsedEvent.EventValues.Size()).c_str());
     }
@@ -21,13 +21,20 @@
 #include "CSP/Multiplayer/CSPSceneDescription.h"
 #include "CSP/Multiplayer/ComponentSchema.h"
 #include "CSP/Multiplayer/Components/AvatarSpaceComponent.h"
+#include "CSP/Multiplayer/Script/EntityScriptMessages.h"
 #include "CSP/Multiplayer/SpaceEntity.h"
+#include "Common/Systems/Log/LogFormat.h"
+#include "Common/TaskExecutor.h"
 #include "Common/UUIDGenerator.h"
+#include "Debug/Profiler.h"
 #include "Events/EventListener.h"
 #include "Events/EventSystem.h"
 #include "Multiplayer/ComponentSchemaRegistry.h"
 #include "Multiplayer/RealtimeEngineUtils.h"
 #include "Multiplayer/Script/EntityScriptBinding.h"
+#include "Multiplayer/SpaceEntityHierarchy.h"
+#include "Multiplayer/SpaceEntityIndex.h"
+#include "Multiplayer/SpaceEntityTickList.h"
 
 #include "CSP/Common/fmt_Formatters.h"
 
@@ -61,7 +68,9 @@ void OfflineSpaceEntityEventHandler::OnEvent(const csp::events::Event& InEvent)
     if (InEvent.GetId() == csp::events::FOUNDATION_TICK_EVENT_ID)
     {
         LastTickTime = RealtimeEngineUtils::TickEntityScripts(
-            EntitySystem->GetEntitiesLock(), *EntitySystem->GetAllEntities(), LastTickTime);
+            EntitySystem->GetEntitiesLock(), *EntitySystem->TickList, *EntitySystem->ScriptRunner, LastTickTime);
+
+        RealtimeEngineUtils::UpdateWorldTransforms(EntitySystem->GetEntitiesLock(), *EntitySystem->RootHierarchy);
     }
 }
 
@@ -82,7 +91,6 @@ namespace
         assert(counter < csp::common::Precision53Bits && "Id's need to be able to be represented at double precision, because of JS bindings.");
         return counter++;
     }
-
 }
 
 OfflineRealtimeEngine::OfflineRealtimeEngine(
@@ -97,7 +105,7 @@ OfflineRealtimeEngine::OfflineRealtimeEngine(const CSPSceneDescription& SceneDes
 {
     std::scoped_lock EntitiesLocker(EntitiesLock);
 
-    auto DeserializedEntities = SceneDescription.CreateEntities(*this, LogSystem, RemoteScriptRunner);
+    auto DeserializedEntities = SceneDescription.CreateEntities(*this, LogSystem, RemoteScriptRunner, csp::GetDecodeExecutor());
 
     for (size_t i = 0; i < DeserializedEntities.Size(); ++i)
     {
@@ -128,6 +136,9 @@ OfflineRealtimeEngine::OfflineRealtimeEngine(csp::common::LogSystem& LogSystem,
     const csp::common::Array<ComponentSchema>& AdditionalComponents)
     : LogSystem { &LogSystem }
     , ScriptRunner { &RemoteScriptRunner }
+    , EntityIndex { std::make_unique<SpaceEntityIndex>(Entities, Avatars, Objects) }
+    , RootHierarchy { std::make_unique<SpaceEntityHierarchy>() }
+    , TickList { std::make_unique<SpaceEntityTickList>() }
     , ComponentRegistry { std::make_unique<ComponentSchemaRegistryImpl>(*this->LogSystem, AdditionalComponents) }
 {
     ScriptBinding = std::unique_ptr<EntityScriptBinding>(EntityScriptBinding::BindEntitySystem(this, *this->LogSystem, *this->ScriptRunner));
@@ -158,8 +169,7 @@ void csp::multiplayer::OfflineRealtimeEngine::CreateAvatar(const csp::common::St
 
     std::scoped_lock EntitiesLocker(EntitiesLock);
 
-    Entities.Append(NewAvatar.get());
-    Avatars.Append(NewAvatar.get());
+    EntityIndex->Add(NewAvatar.get());
 
     Callback(NewAvatar.release());
 }
@@ -177,33 +187,30 @@ void OfflineRealtimeEngine::CreateEntity(const csp::common::String& Name, const
 
     ResolveEntityHierarchy(NewEntity);
 
-    Entities.Append(NewEntity);
-    Objects.Append(NewEntity);
+    EntityIndex->Add(NewEntity);
 
     Callback(NewEntity);
 }
 
 void OfflineRealtimeEngine::DestroyEntity(csp::multiplayer::SpaceEntity* Entity, csp::multiplayer::CallbackHandler Callback)
 {
-    if (!Entities.Contains(Entity))
+    if (Entity == nullptr)
     {
-        LogSystem->LogMsg(
-            csp::common::LogLevel::Warning, fmt::format("Attempting to delete unknown Entity `{}`. Aborting operation.", Entity->GetName()).c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Warning, "Attempting to delete a null Entity. Aborting operation.");
         Callback(false);
         return;
     }
 
-    csp::common::List<csp::multiplayer::SpaceEntity*>& AvatarOrObjectList = Entity->GetEntityType() == SpaceEntityType::Avatar ? Avatars : Objects;
-    if (!AvatarOrObjectList.Contains(Entity))
+    std::scoped_lock EntitiesLocker(EntitiesLock);
+
+    // Looked up under the lock, so that another thread can't destroy the entity between the check and the removal.
+    if (EntityIndex->FindById(Entity->GetId()) != Entity)
     {
-        LogSystem->LogMsg(csp::common::LogLevel::Fatal,
-            fmt::format("Entity `{}` is not in the expected Avatar/Object container. Aborting operation.", Entity->GetName()).c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Warning, "Attempting to delete unknown Entity `{}`. Aborting operation.", Entity->GetName());
         Callback(false);
         return;
     }
 
-    std::scoped_lock EntitiesLocker(EntitiesLock);
-
     // At time of writing, the only reason to do this is to call cleanup behaviour in ConversationSpaceComponent.
     // This feels like an unfortunate pattern break and an unnecesary concept (OnLocalDelete). An opportunity to
     // refactor. This also happens in OnlineRealtimeEngine.
@@ -220,17 +227,18 @@ void OfflineRealtimeEngine::DestroyEntity(csp::multiplayer::SpaceEntity* Entity,
 
     // We want to do heirarchy changes before destroy notification, there _seems_ to be some assertion that this is a platform requirement, although
     // I'm personally dubious. Nonetheless, we have tests that assert this ordering.
-    RootHierarchyEntities.RemoveItem(Entity);
-    RealtimeEngineUtils::LocalProcessChildUpdates(*this, RootHierarchyEntities, Entity);
+    RootHierarchy->RemoveRoot(Entity);
+    RealtimeEngineUtils::LocalProcessChildUpdates(*RootHierarchy, Entity);
 
     if (Entity->GetEntityDestroyCallback() != nullptr)
     {
         Entity->GetEntityDestroyCallback()(true);
     }
 
-    AvatarOrObjectList.RemoveItem(Entity);
-    RealtimeEngineUtils::RemoveParentChildRelationshipsFromEntity(*this, RootHierarchyEntities, Entity);
-    Entities.RemoveItem(Entity);
+    RealtimeEngineUtils::RemoveParentChildRelationshipsFromEntity(*RootHierarchy, Entity);
+    // Drops the entity from Entities and Avatars/Objects too.
+    EntityIndex->Remove(Entity);
+    TickList->Remove(Entity);
 
     delete (Entity);
 
@@ -271,22 +279,26 @@ bool OfflineRealtimeEngine::RemoveEntityFromSelectedEntities(csp::multiplayer::S
 
 csp::multiplayer::SpaceEntity* OfflineRealtimeEngine::FindSpaceEntity(const csp::common::String& Name)
 {
-    return RealtimeEngineUtils::FindSpaceEntity(*this, Name);
+    std::scoped_lock EntitiesLocker(EntitiesLock);
+    return RealtimeEngineUtils::FindSpaceEntity(*EntityIndex, Name);
 }
 
 csp::multiplayer::SpaceEntity* OfflineRealtimeEngine::FindSpaceEntityById(uint64_t EntityId)
 {
-    return RealtimeEngineUtils::FindSpaceEntityById(*this, EntityId);
+    std::scoped_lock EntitiesLocker(EntitiesLock);
+    return RealtimeEngineUtils::FindSpaceEntityById(*EntityIndex, EntityId);
 }
 
 csp::multiplayer::SpaceEntity* OfflineRealtimeEngine::FindSpaceAvatar(const csp::common::String& Name)
 {
-    return RealtimeEngineUtils::FindSpaceAvatar(*this, Name);
+    std::scoped_lock EntitiesLocker(EntitiesLock);
+    return RealtimeEngineUtils::FindSpaceAvatar(*EntityIndex, Name);
 }
 
 csp::multiplayer::SpaceEntity* OfflineRealtimeEngine::FindSpaceObject(const csp::common::String& Name)
 {
-    return RealtimeEngineUtils::FindSpaceObject(*this, Name);
+    std::scoped_lock EntitiesLocker(EntitiesLock);
+    return RealtimeEngineUtils::FindSpaceObject(*EntityIndex, Name);
 }
 
 csp::multiplayer::SpaceEntity* OfflineRealtimeEngine::GetEntityByIndex(size_t EntityIndex) { return Entities[EntityIndex]; }
@@ -303,15 +315,37 @@ size_t OfflineRealtimeEngine::GetNumAvatars() const { return Avatars.Size(); }
 
 size_t OfflineRealtimeEngine::GetNumObjects() const { return Objects.Size(); }
 
-const csp::common::List<csp::multiplayer::SpaceEntity*>* OfflineRealtimeEngine::GetRootHierarchyEntities() const { return &RootHierarchyEntities; }
+const csp::common::List<csp::multiplayer::SpaceEntity*>* OfflineRealtimeEngine::GetRootHierarchyEntities() const { return &RootHierarchy->GetRootEntities(); }
 
 void OfflineRealtimeEngine::ResolveEntityHierarchy(csp::multiplayer::SpaceEntity* Entity)
 {
-    RealtimeEngineUtils::ResolveEntityHierarchy(*this, RootHierarchyEntities, Entity);
+    RealtimeEngineUtils::ResolveEntityHierarchy(*RootHierarchy, Entity);
+}
+
+void OfflineRealtimeEngine::OnEntityNameChanged(csp::multiplayer::SpaceEntity* Entity, const csp::common::String& OldName)
+{
+    std::scoped_lock EntitiesLocker(EntitiesLock);
+    EntityIndex->Rename(Entity, OldName);
+}
+
+void OfflineRealtimeEngine::OnEntityTickHandlerChanged(csp::multiplayer::SpaceEntity* Entity, bool HasTickHandler)
+{
+    csp::common::String TickCallback;
+
+    if (HasTickHandler && Entity->GetScript().TryGetMessageCallback(SCRIPT_MSG_ENTITY_TICK, TickCallback))
+    {
+        TickList->Add(Entity, TickCallback);
+    }
+    else
+    {
+        TickList->Remove(Entity);
+    }
 }
 
 void OfflineRealtimeEngine::FetchAllEntitiesAndPopulateBuffers(const csp::common::String&, csp::common::EntityFetchStartedCallback Callback)
 {
+    CSP_PROFILE_SCOPED();
+
     // Entities are populated in the constructor, so can immediately call back.
     Callback();
 
@@ -357,22 +391,7 @@ void OfflineRealtimeEngine::AddEntity(SpaceEntity* EntityToAdd)
 
     std::scoped_lock EntitiesLocker(EntitiesLock);
 
-    if (FindSpaceEntityById(EntityToAdd->GetId()) == nullptr)
-    {
-        Entities.Append(EntityToAdd);
-
-        switch (EntityToAdd->GetEntityType())
-        {
-        case SpaceEntityType::Avatar:
-            Avatars.Append(EntityToAdd);
-            break;
-
-        case SpaceEntityType::Object:
-            Objects.Append(EntityToAdd);
-            break;
-        }
-    }
-    else
+    if (EntityIndex->Add(EntityToAdd) == false)
     {
         LogSystem->LogMsg(common::LogLevel::Error, "Attempted to add an entity already known to the RealtimeEngine. Aborting operation.");
     }
@@ -28,16 +28,25 @@
 #include "CSP/Multiplayer/Script/EntityScript.h"
 #include "CSP/Multiplayer/Script/EntityScriptMessages.h"
 #include "CSP/Multiplayer/SpaceEntity.h"
+#include "Common/Systems/Log/LogFormat.h"
+#include "Common/TaskExecutor.h"
+#include "Debug/Profiler.h"
 #include "Events/EventListener.h"
 #include "Events/EventSystem.h"
+#include "MCS/MCSCompactTypes.h"
 #include "MCS/MCSTypes.h"
 #include "Multiplayer/ComponentSchemaRegistry.h"
 #include "Multiplayer/Election/ScopeLeadershipManager.h"
+#include "Multiplayer/IncomingPatchBatch.h"
 #include "Multiplayer/MultiplayerConstants.h"
+#include "Multiplayer/OutgoingPatchScheduler.h"
 #include "Multiplayer/RealtimeEngineUtils.h"
 #include "Multiplayer/Script/EntityScriptBinding.h"
 #include "Multiplayer/SignalR/ISignalRConnection.h"
 #include "Multiplayer/SignalR/SignalRClient.h"
+#include "Multiplayer/SpaceEntityHierarchy.h"
+#include "Multiplayer/SpaceEntityIndex.h"
+#include "Multiplayer/SpaceEntityTickList.h"
 #include "Multiplayer/SpaceEntityStatePatcher.h"
 #include "RealtimeEngineUtils.h"
 #include "SignalRSerializer.h"
@@ -54,6 +63,7 @@
 #include <map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 using namespace std::chrono_literals;
 
@@ -76,7 +86,7 @@ uint64_t ParseGenerateObjectIDsResult(const signalr::value& Result, csp::common:
         {
             if (IdValue.is_uinteger())
             {
-                LogSystem.LogMsg(csp::common::LogLevel::Verbose, fmt::format("Entity Id={}", IdValue.as_uinteger()).c_str());
+                CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Verbose, "Entity Id={}", IdValue.as_uinteger());
                 EntityId = IdValue.as_uinteger();
                 break;
             }
@@ -163,7 +173,10 @@ class DirtyComponent;
 using namespace std::chrono;
 
 OnlineRealtimeEngine::OnlineRealtimeEngine()
-    : EntitiesLock(new std::recursive_mutex)
+    : EntityIndex(std::make_unique<SpaceEntityIndex>(Entities, Avatars, Objects))
+    , RootHierarchy(std::make_unique<SpaceEntityHierarchy>())
+    , TickList(std::make_unique<SpaceEntityTickList>())
+    , EntitiesLock(new std::recursive_mutex)
     , MultiplayerConnectionInst(nullptr)
     , LogSystem(nullptr)
     , ScriptBinding(nullptr)
@@ -171,11 +184,10 @@ OnlineRealtimeEngine::OnlineRealtimeEngine()
     , TickEntitiesLock(new std::recursive_mutex)
     , PendingAdds(nullptr)
     , PendingRemoves(nullptr)
-    , PendingOutgoingUpdateUniqueSet(nullptr)
+    , PendingOutgoingUpdates(nullptr)
     , PendingIncomingUpdates(nullptr)
     , EnableEntityTick(false)
     , LastTickTime(std::chrono::system_clock::now())
-    , EntityPatchRate(90)
     , ScriptRunner(nullptr)
     , NetworkEventBus(nullptr)
 {
@@ -197,18 +209,20 @@ OnlineRealtimeEngine::OnlineRealtimeEngine(MultiplayerConnection& InMultiplayerC
 OnlineRealtimeEngine::OnlineRealtimeEngine(MultiplayerConnection& InMultiplayerConnection, csp::common::LogSystem& LogSystem,
     csp::multiplayer::NetworkEventBus& NetworkEventBus, csp::common::IJSScriptRunner& ScriptRunner,
     const csp::common::Array<ComponentSchema>& AdditionalComponents)
-    : EntitiesLock(new std::recursive_mutex)
+    : EntityIndex(std::make_unique<SpaceEntityIndex>(Entities, Avatars, Objects))
+    , RootHierarchy(std::make_unique<SpaceEntityHierarchy>())
+    , TickList(std::make_unique<SpaceEntityTickList>())
+    , EntitiesLock(new std::recursive_mutex)
     , MultiplayerConnectionInst(&InMultiplayerConnection)
     , LogSystem(&LogSystem)
     , EventHandler(new SpaceEntityEventHandler(this))
     , TickEntitiesLock(new std::recursive_mutex)
     , PendingAdds(new(std::deque<csp::multiplayer::SpaceEntity*>))
     , PendingRemoves(new(std::deque<csp::multiplayer::SpaceEntity*>))
-    , PendingOutgoingUpdateUniqueSet(new(std::set<csp::multiplayer::SpaceEntity*>))
-    , PendingIncomingUpdates(new(PatchMessageQueue))
+    , PendingOutgoingUpdates(new(OutgoingPatchScheduler))
+    , PendingIncomingUpdates(new(IncomingPatchBatch))
     , EnableEntityTick(false)
     , LastTickTime(std::chrono::system_clock::now())
-    , EntityPatchRate(90)
     , ScriptRunner(&ScriptRunner)
     , NetworkEventBus(&NetworkEventBus)
     , ComponentRegistry { std::make_unique<ComponentSchemaRegistryImpl>(*this->LogSystem, AdditionalComponents) }
@@ -234,7 +248,7 @@ OnlineRealtimeEngine::~OnlineRealtimeEngine()
 
     delete (PendingAdds);
     delete (PendingRemoves);
-    delete (PendingOutgoingUpdateUniqueSet);
+    delete (PendingOutgoingUpdates);
     delete (PendingIncomingUpdates);
 }
 
@@ -318,8 +332,7 @@ std::function<void(uint64_t)> OnlineRealtimeEngine::CreateNewLocalAvatar(const c
         // Release to vague ownership. True ownership is blurry here. It could be shared between both Entities and Objects, or just owned by
         // Entities.
         SpaceEntity* ReleasedAvatar = NewAvatar.release();
-        Entities.Append(ReleasedAvatar);
-        Avatars.Append(ReleasedAvatar);
+        EntityIndex->Add(ReleasedAvatar);
         ReleasedAvatar->ApplyLocalPatch(false, GetMultiplayerConnectionInstance()->GetAllowSelfMessagingFlag());
 
         Callback(ReleasedAvatar);
@@ -338,7 +351,7 @@ void OnlineRealtimeEngine::CreateAvatar(const csp::common::String& Name, const c
         .then(csp::common::continuations::InvokeIfExceptionInChain(*LogSystem,
             [Callback, LogSystem = this->LogSystem]([[maybe_unused]] const csp::common::continuations::ExpectedExceptionBase& exception)
             {
-                LogSystem->LogMsg(csp::common::LogLevel::Error, fmt::format("Failed to create Avatar. Exception: {}", exception.what()).c_str());
+                CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error, "Failed to create Avatar. Exception: {}", exception.what());
                 Callback(nullptr);
             }));
 }
@@ -358,7 +371,7 @@ void OnlineRealtimeEngine::CreateEntity(const csp::common::String& Name, const c
         }
         catch (const std::exception& e)
         {
-            LogSystem->LogMsg(csp::common::LogLevel::Error, fmt::format("Failed to generate object ID. Exception: {}", e.what()).c_str());
+            CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error, "Failed to generate object ID. Exception: {}", e.what());
             Callback(nullptr);
             return;
         }
@@ -384,7 +397,7 @@ void OnlineRealtimeEngine::CreateEntity(const csp::common::String& Name, const c
             }
             catch (const std::exception& e)
             {
-                LogSystem->LogMsg(csp::common::LogLevel::Error, fmt::format("Failed to create object. Exception: {}", e.what()).c_str());
+                CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error, "Failed to create object. Exception: {}", e.what());
                 Callback(nullptr);
                 return;
             }
@@ -393,8 +406,7 @@ void OnlineRealtimeEngine::CreateEntity(const csp::common::String& Name, const c
 
             ResolveEntityHierarchy(NewObject);
 
-            Entities.Append(NewObject);
-            Objects.Append(NewObject);
+            EntityIndex->Add(NewObject);
             Callback(NewObject);
         };
 
@@ -428,7 +440,7 @@ void OnlineRealtimeEngine::DestroyEntity(SpaceEntity* Entity, CallbackHandler Ca
         }
         catch (const std::exception& e)
         {
-            LogSystem->LogMsg(csp::common::LogLevel::Error, fmt::format("Failed to destroy entity. Exception: {}", e.what()).c_str());
+            CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error, "Failed to destroy entity. Exception: {}", e.what());
             Callback(false);
             return;
         }
@@ -471,9 +483,9 @@ void OnlineRealtimeEngine::DestroyEntity(SpaceEntity* Entity, CallbackHandler Ca
 
     delete (Keys);
 
-    RootHierarchyEntities.RemoveItem(Entity);
+    RootHierarchy->RemoveRoot(Entity);
 
-    RealtimeEngineUtils::LocalProcessChildUpdates(*this, RootHierarchyEntities, Entity);
+    RealtimeEngineUtils::LocalProcessChildUpdates(*RootHierarchy, Entity);
 
     // We break the usual pattern of not considering local state to be true until we get the ack back from CHS here
     // and instead immediately delete the local view of the entity before issuing the delete for the remote view.
@@ -502,25 +514,25 @@ void OnlineRealtimeEngine::LocalDestroyEntity(SpaceEntity* Entity)
 SpaceEntity* OnlineRealtimeEngine::FindSpaceEntity(const csp::common::String& InName)
 {
     std::scoped_lock EntitiesLocker(*EntitiesLock);
-    return RealtimeEngineUtils::FindSpaceEntity(*this, InName);
+    return RealtimeEngineUtils::FindSpaceEntity(*EntityIndex, InName);
 }
 
 SpaceEntity* OnlineRealtimeEngine::FindSpaceEntityById(uint64_t EntityId)
 {
     std::scoped_lock EntitiesLocker(*EntitiesLock);
-    return RealtimeEngineUtils::FindSpaceEntityById(*this, EntityId);
+    return RealtimeEngineUtils::FindSpaceEntityById(*EntityIndex, EntityId);
 }
 
 SpaceEntity* OnlineRealtimeEngine::FindSpaceAvatar(const csp::common::String& InName)
 {
     std::scoped_lock EntitiesLocker(*EntitiesLock);
-    return RealtimeEngineUtils::FindSpaceAvatar(*this, InName);
+    return RealtimeEngineUtils::FindSpaceAvatar(*EntityIndex, InName);
 }
 
 SpaceEntity* OnlineRealtimeEngine::FindSpaceObject(const csp::common::String& InName)
 {
     std::scoped_lock EntitiesLocker(*EntitiesLock);
-    return RealtimeEngineUtils::FindSpaceObject(*this, InName);
+    return RealtimeEngineUtils::FindSpaceObject(*EntityIndex, InName);
 }
 
 void OnlineRealtimeEngine::SetRemoteEntityCreatedCallback(EntityCreatedCallback Callback)
@@ -569,6 +581,48 @@ void OnlineRealtimeEngine::SetOnVacatedAsScopeLeaderCallback(ScopeLeaderCallback
 
 namespace
 {
+    mcs::ObjectMessage DecodeEntityMessage(const signalr::value& EntityMessage)
+    {
+        mcs::ObjectMessage Message;
+        SignalRDeserializer Deserializer { EntityMessage };
+        Deserializer.ReadValue(Message);
+
+        return Message;
+    }
+
+    // Decodes a page of entity messages, in order. With an executor, each message is decoded as a task on its workers.
+    std::vector<mcs::ObjectMessage> DecodeEntityMessages(const std::vector<signalr::value>& EntityMessages, csp::TaskExecutor* Executor)
+    {
+        std::vector<mcs::ObjectMessage> Messages;
+        Messages.reserve(EntityMessages.size());
+
+        if (Executor == nullptr || EntityMessages.size() < 2)
+        {
+            for (const signalr::value& EntityMessage : EntityMessages)
+            {
+                Messages.push_back(DecodeEntityMessage(EntityMessage));
+            }
+
+            return Messages;
+        }
+
+        std::vector<async::task<mcs::ObjectMessage>> Decodes;
+        Decodes.reserve(EntityMessages.size());
+
+        for (const signalr::value& EntityMessage : EntityMessages)
+        {
+            Decodes.push_back(async::spawn(Executor->GetAsyncScheduler(), [&EntityMessage]() { return DecodeEntityMessage(EntityMessage); }));
+        }
+
+        // Wait for every decode before taking any results, so none are still reading the messages if one of them throws.
+        for (async::task<mcs::ObjectMessage>& Decode : async::when_all(Decodes).get())
+        {
+            Messages.push_back(Decode.get());
+        }
+
+        return Messages;
+    }
+
     void FireRemoteSpaceEntityCreatedCallback(
         SpaceEntity* SpaceEntity, csp::multiplayer::EntityCreatedCallback RemoteSpaceEntityCreatedCallback, csp::common::LogSystem& LogSystem)
     {
@@ -587,10 +641,11 @@ namespace
 SpaceEntity* OnlineRealtimeEngine::CreateRemotelyRetrievedEntity(const signalr::value& EntityMessage)
 {
     //  Create object message from signalr value
-    mcs::ObjectMessage Message;
-    SignalRDeserializer Deserializer { EntityMessage };
-    Deserializer.ReadValue(Message);
+    return CreateRemotelyRetrievedEntity(DecodeEntityMessage(EntityMessage));
+}
 
+SpaceEntity* OnlineRealtimeEngine::CreateRemotelyRetrievedEntity(const mcs::ObjectMessage& Message)
+{
     auto NewEntity = SpaceEntityStatePatcher::NewFromObjectMessage(Message, *this, *ScriptRunner, *LogSystem);
 
     std::scoped_lock EntitiesLocker(*EntitiesLock);
@@ -599,6 +654,8 @@ SpaceEntity* OnlineRealtimeEngine::CreateRemotelyRetrievedEntity(const signalr::
 
 void OnlineRealtimeEngine::OnObjectMessage(const signalr::value& Params)
 {
+    CSP_PROFILE_SCOPED();
+
     // Params is an array of all params sent, so grab the first
     auto& EntityMessage = Params.as_array()[0];
 
@@ -612,12 +669,19 @@ void OnlineRealtimeEngine::OnObjectMessage(const signalr::value& Params)
 
 void OnlineRealtimeEngine::OnObjectPatch(const signalr::value& Params)
 {
-    std::scoped_lock EntitiesLocker(*EntitiesLock);
+    CSP_PROFILE_SCOPED();
 
     // Params is an array of all params sent, so grab the first
     auto& EntityMessage = Params.as_array()[0];
 
-    PendingIncomingUpdates->emplace_back(new signalr::value(EntityMessage));
+    // Deserialize before taking the lock, straight from the received message rather than a copy of it.
+    mcs::ObjectPatch Patch;
+    SignalRDeserializer Deserializer { EntityMessage };
+    Deserializer.ReadValue(Patch);
+
+    std::scoped_lock EntitiesLocker(*EntitiesLock);
+
+    PendingIncomingUpdates->Add(std::move(Patch));
 }
 
 void OnlineRealtimeEngine::OnRequestToSendObject(const signalr::value& Params)
@@ -720,9 +784,10 @@ std::function<void(const signalr::value&, std::exception_ptr)> OnlineRealtimeEng
         const auto& Items = Results[0].as_array();
         auto ItemTotalCount = Results[1].as_uinteger();
 
-        for (const auto& EntityMessage : Items)
+        // Decoding is independent per entity, so it is spread across the workers. Entities are still created in the order they were sent.
+        for (const mcs::ObjectMessage& Message : DecodeEntityMessages(Items, csp::GetDecodeExecutor()))
         {
-            SpaceEntity* NewEntity = CreateRemotelyRetrievedEntity(EntityMessage);
+            SpaceEntity* NewEntity = CreateRemotelyRetrievedEntity(Message);
             FireRemoteSpaceEntityCreatedCallback(NewEntity, RemoteSpaceEntityCreatedCallback, *LogSystem);
         }
 
@@ -780,6 +845,8 @@ std::function<void(const signalr::value&, std::exception_ptr)> OnlineRealtimeEng
 void OnlineRealtimeEngine::FetchAllEntitiesAndPopulateBuffers(
     const csp::common::String&, csp::common::EntityFetchStartedCallback FetchStartedCallback)
 {
+    CSP_PROFILE_SCOPED();
+
     this->RetrieveAllEntities(EntityFetchCompleteCallback);
     FetchStartedCallback();
 }
@@ -803,7 +870,7 @@ ModifiableStatus OnlineRealtimeEngine::IsEntityModifiable(const csp::multiplayer
     // In order to unlock an entity, we need to modify it. 
     // So we need to check if we are about to unlock the entity, and treat it as modifiabe if so, otherwise we cannot unlock a locked entity.
     // Note : This will stop working if we ever add another lock type
-    const bool AboutToUnlock = SpaceEntity->GetStatePatcher()->GetDirtyProperties().count(SpaceEntityComponentKey::LockType) > 0;
+    const bool AboutToUnlock = SpaceEntity->GetStatePatcher()->IsPropertyDirty(SpaceEntityComponentKey::LockType);
     if (SpaceEntity->GetLockType() == LockType::UserAgnostic && !AboutToUnlock)
     {
         return ModifiableStatus::EntityLocked;
@@ -856,15 +923,15 @@ void OnlineRealtimeEngine::LocalDestroyAllEntities()
         delete (Entity);
     }
 
-    Entities.Clear();
-    Objects.Clear();
-    Avatars.Clear();
-    RootHierarchyEntities.Clear();
+    RootHierarchy->Clear();
+    EntityIndex->Clear();
+    TickList->Clear();
 
     // Clear adds/removes, we don't want to mutate if we're cleaning everything else.
     PendingAdds->clear();
     PendingRemoves->clear();
-    PendingIncomingUpdates->clear();
+    PendingIncomingUpdates->Clear();
+    PendingOutgoingUpdates->Reset();
 
     UnlockEntityUpdate();
 }
@@ -883,20 +950,14 @@ void OnlineRealtimeEngine::QueueEntityUpdate(SpaceEntity* EntityToUpdate)
     ModifiableStatus Modifiable = EntityToUpdate->IsModifiable();
     if (Modifiable != ModifiableStatus::Modifiable)
     {
-        if (LogSystem != nullptr)
-        {
-            LogSystem->LogMsg(csp::common::LogLevel::Warning,
-                fmt::format("Failed to queue entity update: {0}. Entity name: {1}", RealtimeEngineUtils::ModifiableStatusToString(Modifiable),
-                    EntityToUpdate->GetName())
-                    .c_str());
-        }
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Warning, "Failed to queue entity update: {0}. Entity name: {1}",
+            RealtimeEngineUtils::ModifiableStatusToString(Modifiable), EntityToUpdate->GetName());
 
         return;
     }
 
-    // Note that calling Queue many times will be ignored by this emplace call, but may have performance impact in some situations.
-    // TODO: consider enabling clients to queue at sensible rates by exposing update rates/next update callbacks/timings.
-    PendingOutgoingUpdateUniqueSet->emplace(EntityToUpdate);
+    // Queueing an entity that is already queued only brings its send time forward, if what is now dirty on it has a faster rate.
+    PendingOutgoingUpdates->Schedule(EntityToUpdate, EntityToUpdate->GetId(), *EntityToUpdate->GetStatePatcher());
 }
 
 void OnlineRealtimeEngine::RemoveEntity(SpaceEntity* EntityToRemove)
@@ -904,12 +965,14 @@ void OnlineRealtimeEngine::RemoveEntity(SpaceEntity* EntityToRemove)
     std::scoped_lock EntitiesLocker(*EntitiesLock);
     PendingRemoves->emplace_back(EntityToRemove);
 
-    // Remove from the unique set to indicate it could be queued again if needed.
-    PendingOutgoingUpdateUniqueSet->erase(EntityToRemove);
+    // Unschedule to indicate it could be queued again if needed.
+    PendingOutgoingUpdates->Remove(EntityToRemove);
 }
 
 void OnlineRealtimeEngine::TickEntities()
 {
+    CSP_PROFILE_SCOPED();
+
     ProcessPendingEntityOperations();
 
     if (EnableEntityTick)
@@ -920,7 +983,7 @@ void OnlineRealtimeEngine::TickEntities()
 
         if (CanRunScripts)
         {
-            LastTickTime = RealtimeEngineUtils::TickEntityScripts(*TickEntitiesLock, Entities, LastTickTime);
+            LastTickTime = RealtimeEngineUtils::TickEntityScripts(*TickEntitiesLock, *TickList, *ScriptRunner, LastTickTime);
         }
         else
         {
@@ -949,6 +1012,9 @@ void OnlineRealtimeEngine::TickEntities()
 
         TickUpdateEntities.clear();
     }
+
+    // Scripts and incoming patches have had their say for this tick, so refresh global transforms in one pass.
+    RealtimeEngineUtils::UpdateWorldTransforms(*EntitiesLock, *RootHierarchy);
 }
 
 void OnlineRealtimeEngine::RegisterDefaultScope(const std::string& ScopeId, const std::optional<uint64_t>& LeaderId)
@@ -976,10 +1042,9 @@ void OnlineRealtimeEngine::__AssumeScopeLeadership(const std::string& ScopeId, s
             }
             catch (const std::exception& Exception)
             {
-                LogSystem->LogMsg(csp::common::LogLevel::Error,
-                    fmt::format("OnlineRealtimeEngine::__AssumeScopeLeadership Failed to send AssumeScopeLeadership with error: {}", Exception.what(),
-                        Exception.what())
-                        .c_str());
+                CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error,
+                    "OnlineRealtimeEngine::__AssumeScopeLeadership Failed to send AssumeScopeLeadership with error: {}", Exception.what(),
+                    Exception.what());
             }
             catch (...)
             {
@@ -1002,18 +1067,7 @@ void OnlineRealtimeEngine::__AssumeScopeLeadership(const std::string& ScopeId, s
         MultiplayerConnectionInst->GetMultiplayerHubMethods().Get(MultiplayerHubMethod::ASSUME_SCOPE_LEADERSHIP), signalr::value { Params }, CB);
 }
 
-bool OnlineRealtimeEngine::EntityIsInRootHierarchy(SpaceEntity* Entity)
-{
-    for (size_t i = 0; i < RootHierarchyEntities.Size(); ++i)
-    {
-        if (RootHierarchyEntities[i]->GetId() == Entity->GetId())
-        {
-            return true;
-        }
-    }
-
-    return false;
-}
+bool OnlineRealtimeEngine::EntityIsInRootHierarchy(SpaceEntity* Entity) { return RealtimeEngineUtils::EntityIsInRootHierarchy(*RootHierarchy, Entity); }
 
 void OnlineRealtimeEngine::OnRemoteRunScriptEvent(const csp::common::Array<csp::common::ReplicatedValue>& Data)
 {
@@ -1021,8 +1075,8 @@ void OnlineRealtimeEngine::OnRemoteRunScriptEvent(const csp::common::Array<csp::
     const int64_t ContextId = static_cast<int64_t>(Data[0].GetInt());
     const csp::common::String& ScriptText = Data[1].GetString();
 
-    LogSystem->LogMsg(csp::common::LogLevel::VeryVerbose,
-        fmt::format("OnRemoteRunScriptEvent called. ContextId={0}, Script={1}", ContextId, ScriptText.c_str()).c_str());
+    CSP_LOG_FMT(LogSystem, csp::common::LogLevel::VeryVerbose, "OnRemoteRunScriptEvent called. ContextId={0}, Script={1}", ContextId,
+        ScriptText.c_str());
 
     if (LeaderElectionManager->IsLocalClientLeader(DefaultScopeId.c_str()))
     {
@@ -1030,8 +1084,8 @@ void OnlineRealtimeEngine::OnRemoteRunScriptEvent(const csp::common::Array<csp::
     }
     else
     {
-        LogSystem->LogMsg(csp::common::LogLevel::Error,
-            fmt::format("Client {} has received remote script event but is not the Leader", MultiplayerConnectionInst->GetClientId()).c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error, "Client {} has received remote script event but is not the Leader",
+            MultiplayerConnectionInst->GetClientId());
     }
 }
 
@@ -1045,8 +1099,8 @@ void OnlineRealtimeEngine::SendRemoteRunScriptEvent(int64_t TargetClientId, int6
         }
     };
 
-    LogSystem->LogMsg(csp::common::LogLevel::VeryVerbose,
-        fmt::format("SendRemoteRunScriptEvent Target={0} ContextId={1} Script='{2}'", TargetClientId, ContextId, ScriptText).c_str());
+    CSP_LOG_FMT(LogSystem, csp::common::LogLevel::VeryVerbose, "SendRemoteRunScriptEvent Target={0} ContextId={1} Script='{2}'", TargetClientId,
+        ContextId, ScriptText);
 
     NetworkEventBus->SendNetworkEventToClient(RemoteRunScriptMessage,
         { csp::common::ReplicatedValue(ContextId), csp::common::ReplicatedValue(ScriptText) }, TargetClientId, SignalRCallback);
@@ -1111,11 +1165,73 @@ bool OnlineRealtimeEngine::GetEntityPatchRateLimitEnabled() const { return Entit
 
 void OnlineRealtimeEngine::SetEntityPatchRateLimitEnabled(bool Enabled) { EntityPatchRateLimitEnabled = Enabled; }
 
-const csp::common::List<SpaceEntity*>* OnlineRealtimeEngine::GetRootHierarchyEntities() const { return &RootHierarchyEntities; }
+void OnlineRealtimeEngine::SetDefaultEntityPatchRate(uint32_t RateMs)
+{
+    std::scoped_lock EntitiesLocker(*EntitiesLock);
+    PendingOutgoingUpdates->SetDefaultPatchRate(milliseconds(RateMs));
+}
+
+uint32_t OnlineRealtimeEngine::GetDefaultEntityPatchRate() const
+{
+    std::scoped_lock EntitiesLocker(*EntitiesLock);
+    return static_cast<uint32_t>(PendingOutgoingUpdates->GetDefaultPatchRate().count());
+}
+
+void OnlineRealtimeEngine::SetEntityPatchRate(uint64_t EntityId, uint32_t RateMs)
+{
+    std::scoped_lock EntitiesLocker(*EntitiesLock);
+    PendingOutgoingUpdates->SetEntityPatchRate(EntityId, milliseconds(RateMs));
+}
+
+void OnlineRealtimeEngine::ClearEntityPatchRate(uint64_t EntityId)
+{
+    std::scoped_lock EntitiesLocker(*EntitiesLock);
+    PendingOutgoingUpdates->ClearEntityPatchRate(EntityId);
+}
+
+void OnlineRealtimeEngine::SetComponentTypePatchRate(ComponentType Type, uint32_t RateMs)
+{
+    std::scoped_lock EntitiesLocker(*EntitiesLock);
+    PendingOutgoingUpdates->SetComponentTypePatchRate(Type, milliseconds(RateMs));
+}
+
+void OnlineRealtimeEngine::ClearComponentTypePatchRate(ComponentType Type)
+{
+    std::scoped_lock EntitiesLocker(*EntitiesLock);
+    PendingOutgoingUpdates->ClearComponentTypePatchRate(Type);
+}
+
+void OnlineRealtimeEngine::SetMaxEntityPatchesPerBatch(uint32_t MaxPatches)
+{
+    std::scoped_lock EntitiesLocker(*EntitiesLock);
+    PendingOutgoingUpdates->SetMaxPatchesPerBatch(MaxPatches);
+}
+
+const csp::common::List<SpaceEntity*>* OnlineRealtimeEngine::GetRootHierarchyEntities() const { return &RootHierarchy->GetRootEntities(); }
 
 void OnlineRealtimeEngine::ResolveEntityHierarchy(csp::multiplayer::SpaceEntity* Entity)
 {
-    RealtimeEngineUtils::ResolveEntityHierarchy(*this, RootHierarchyEntities, Entity);
+    RealtimeEngineUtils::ResolveEntityHierarchy(*RootHierarchy, Entity);
+}
+
+void OnlineRealtimeEngine::OnEntityNameChanged(csp::multiplayer::SpaceEntity* Entity, const csp::common::String& OldName)
+{
+    std::scoped_lock EntitiesLocker(*EntitiesLock);
+    EntityIndex->Rename(Entity, OldName);
+}
+
+void OnlineRealtimeEngine::OnEntityTickHandlerChanged(csp::multiplayer::SpaceEntity* Entity, bool HasTickHandler)
+{
+    csp::common::String TickCallback;
+
+    if (HasTickHandler && Entity->GetScript().TryGetMessageCallback(SCRIPT_MSG_ENTITY_TICK, TickCallback))
+    {
+        TickList->Add(Entity, TickCallback);
+    }
+    else
+    {
+        TickList->Remove(Entity);
+    }
 }
 
 async::task<void> OnlineRealtimeEngine::RefreshMultiplayerConnectionToEnactScopeChange(csp::common::String SpaceId)
@@ -1146,7 +1262,7 @@ bool OnlineRealtimeEngine::CheckIfWeShouldRunScriptsLocally() const
 void OnlineRealtimeEngine::RunScriptRemotely(int64_t ContextId, const csp::common::String& ScriptText)
 {
     // Run script on a remote leader...
-    LogSystem->LogMsg(csp::common::LogLevel::VeryVerbose, fmt::format("OnlineRealtimeEngine::RunScriptRemotely Script='{}'", ScriptText).c_str());
+    CSP_LOG_FMT(LogSystem, csp::common::LogLevel::VeryVerbose, "OnlineRealtimeEngine::RunScriptRemotely Script='{}'", ScriptText);
 
     std::optional<uint64_t> LeaderId = LeaderElectionManager->GetLeaderClientId(DefaultScopeId.c_str());
 
@@ -1200,8 +1316,10 @@ SpaceEntity* OnlineRealtimeEngine::GetObjectByIndex(const size_t ObjectIndex)
 
 const csp::common::List<SpaceEntity*>* OnlineRealtimeEngine::GetAllEntities() const { return &Entities; }
 
-void OnlineRealtimeEngine::SendPatches(const csp::common::List<SpaceEntity*> PendingEntities)
+void OnlineRealtimeEngine::SendPatches(const std::vector<SpaceEntity*>& PendingEntities)
 {
+    CSP_PROFILE_SCOPED();
+
     const std::function LocalCallback = [&LogSystem = this->LogSystem](const signalr::value& /*Result*/, const std::exception_ptr& Except)
     {
         try
@@ -1213,34 +1331,52 @@ void OnlineRealtimeEngine::SendPatches(const csp::common::List<SpaceEntity*> Pen
         }
         catch (const std::exception& e)
         {
-            LogSystem->LogMsg(csp::common::LogLevel::Error,
-                fmt::format("Failed to send list of entity update due to a signalr exception! Exception: {}", e.what()).c_str());
+            CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error, "Failed to send list of entity update due to a signalr exception! Exception: {}",
+                e.what());
         }
     };
 
-    std::vector<mcs::ObjectPatch> Patches;
-    SignalRSerializer Serializer;
+    // Backs the component data of every patch in a batch, and is reused for the next batch once this one has been serialized.
+    // Declared before Patches, so the patches are destroyed while the storage they point into is still alive.
+    mcs::ComponentDataArena PatchArena;
 
-    for (size_t i = 0; i < PendingEntities.Size(); ++i)
-    {
-        Patches.push_back(PendingEntities[i]->GetStatePatcher()->CreateObjectPatch());
-    }
+    const size_t MaxPatchesPerBatch = PendingOutgoingUpdates->GetMaxPatchesPerBatch();
+    std::vector<mcs::CompactObjectPatch> Patches;
+    Patches.reserve(std::min(PendingEntities.size(), MaxPatchesPerBatch));
 
-    // We are writing multiple patches, so we need an additional nested array.
-    Serializer.StartWriteArray();
+    for (size_t BatchStart = 0; BatchStart < PendingEntities.size(); BatchStart += MaxPatchesPerBatch)
     {
-        Serializer.WriteValue(Patches);
-    }
-    Serializer.EndWriteArray();
+        const size_t BatchEnd = std::min(BatchStart + MaxPatchesPerBatch, PendingEntities.size());
 
-    MultiplayerConnectionInst->GetSignalRConnection()->Invoke(
-        MultiplayerConnectionInst->GetMultiplayerHubMethods().Get(MultiplayerHubMethod::SEND_OBJECT_PATCHES), Serializer.Get(), LocalCallback);
+        Patches.clear();
+        PatchArena.Reset();
+
+        for (size_t i = BatchStart; i < BatchEnd; ++i)
+        {
+            Patches.push_back(PendingEntities[i]->GetStatePatcher()->CreateObjectPatch(PatchArena));
+        }
+
+        SignalRSerializer Serializer;
+
+        // We are writing multiple patches, so we need an additional nested array.
+        Serializer.StartWriteArray();
+        {
+            Serializer.WriteValue(Patches);
+        }
+        Serializer.EndWriteArray();
+
+        MultiplayerConnectionInst->GetSignalRConnection()->Invoke(
+            MultiplayerConnectionInst->GetMultiplayerHubMethods().Get(MultiplayerHubMethod::SEND_OBJECT_PATCHES), Serializer.Get(), LocalCallback);
+    }
 }
 
 void OnlineRealtimeEngine::ProcessPendingEntityOperations()
 {
+    CSP_PROFILE_SCOPED();
+
     std::scoped_lock EntitiesLocker(*EntitiesLock);
-    csp::common::List<SpaceEntity*> PendingEntities;
+    const milliseconds CurrentTime = duration_cast<milliseconds>(system_clock::now().time_since_epoch());
+
     // we run pending entity operations in a specific order
     // 1 - flush pending adds - we do this first to ensure any attempts to apply updates after are successful
     // 2 - flush pending updates - first the local representation, then the remote representation (with rate limiting)
@@ -1248,6 +1384,9 @@ void OnlineRealtimeEngine::ProcessPendingEntityOperations()
 
     // adds
     std::unordered_set<SpaceEntity*> AddedEntities;
+    std::vector<SpaceEntity*> EntitiesToResolve;
+    EntitiesToResolve.reserve(PendingAdds->size());
+
     while (PendingAdds->empty() == false)
     {
         SpaceEntity* PendingAddEntity = PendingAdds->front();
@@ -1257,83 +1396,94 @@ void OnlineRealtimeEngine::ProcessPendingEntityOperations()
         {
             AddPendingEntity(PendingAddEntity);
             AddedEntities.emplace(PendingAddEntity);
-
-            ResolveEntityHierarchy(PendingAddEntity);
+            EntitiesToResolve.push_back(PendingAddEntity);
         }
         PendingAdds->pop_front();
     }
 
+    // Resolve the hierarchy once the whole batch is indexed, so parents that arrived in the same batch are found by id
+    // rather than each child searching the pending adds for them.
+    for (SpaceEntity* AddedEntity : EntitiesToResolve)
+    {
+        ResolveEntityHierarchy(AddedEntity);
+    }
+
     // local updates
-    while (PendingIncomingUpdates->empty() == false)
+    // Patches are merged per entity as they arrive, so each entity has at most one patch to apply here (unless it was destroyed,
+    // or had a component replaced, in between).
+    for (const mcs::ObjectPatch& Patch : PendingIncomingUpdates->Flush())
     {
-        ApplyIncomingPatch(PendingIncomingUpdates->front());
-        PendingIncomingUpdates->pop_front();
+        ApplyIncomingPatch(Patch);
     }
 
     // remote updates
+    // While the connection is back pressured, due patches are left scheduled. Their changes keep merging in each entity's patcher,
+    // so they go out as one patch once the connection has caught up, rather than queueing behind each other.
+    // The connection is only consulted when there is something to send, as an engine may be ticked before it has one.
+    const bool HasDuePatches = EntityPatchRateLimitEnabled ? PendingOutgoingUpdates->HasDue(CurrentTime) : PendingOutgoingUpdates->IsEmpty() == false;
+
+    if (HasDuePatches && MultiplayerConnectionInst != nullptr && MultiplayerConnectionInst->IsSendBackPressured() == false)
     {
-        for (auto it = PendingOutgoingUpdateUniqueSet->begin(); it != PendingOutgoingUpdateUniqueSet->end();)
+        // Only entities whose rate window has expired are visited, earliest first.
+        std::vector<SpaceEntity*> DueEntities;
+
+        if (EntityPatchRateLimitEnabled)
         {
-            SpaceEntity* PendingEntity = *it;
+            PendingOutgoingUpdates->PopDue(CurrentTime, DueEntities);
+        }
+        else
+        {
+            PendingOutgoingUpdates->PopAll(DueEntities);
+        }
 
-            const milliseconds CurrentTime = duration_cast<milliseconds>(system_clock::now().time_since_epoch());
+        std::vector<SpaceEntity*> PendingEntities;
+        PendingEntities.reserve(DueEntities.size());
 
-            if (CurrentTime - PendingEntity->GetTimeOfLastPatch() >= EntityPatchRate || !EntityPatchRateLimitEnabled)
+        for (SpaceEntity* PendingEntity : DueEntities)
+        {
+            // Ensure we can modify the entity. The criteria for this can be found on the specific RealtimeEngine::IsEntityModifiable overloads.
+            ModifiableStatus Modifiable = PendingEntity->IsModifiable();
+            if (Modifiable != ModifiableStatus::Modifiable)
             {
-                // Ensure we can modify the entity. The criteria for this can be found on the specific RealtimeEngine::IsEntityModifiable overloads.
-                ModifiableStatus Modifiable = PendingEntity->IsModifiable();
-                if (Modifiable != ModifiableStatus::Modifiable)
-                {
-                    if (LogSystem != nullptr)
-                    {
-                        LogSystem->LogMsg(csp::common::LogLevel::Warning,
-                            fmt::format("Failed to send patch for entity: {0}. Entity name: {1}",
-                                RealtimeEngineUtils::ModifiableStatusToString(Modifiable), PendingEntity->GetName())
-                                .c_str());
-                    }
-
-                    it = PendingOutgoingUpdateUniqueSet->erase(it);
-                    continue;
-                }
+                CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Warning, "Failed to send patch for entity: {0}. Entity name: {1}",
+                    RealtimeEngineUtils::ModifiableStatusToString(Modifiable), PendingEntity->GetName());
 
-                // since we are aiming to mutate the data for this entity remotely, we need to claim ownership over it
-                PendingEntity->SetOwnerId(MultiplayerConnectionInst->GetClientId());
-                RealtimeEngineUtils::ClaimScriptOwnership(PendingEntity, GetMultiplayerConnectionInstance()->GetClientId());
+                continue;
+            }
 
-                PendingEntities.Append(PendingEntity);
+            // since we are aiming to mutate the data for this entity remotely, we need to claim ownership over it
+            PendingEntity->SetOwnerId(MultiplayerConnectionInst->GetClientId());
+            RealtimeEngineUtils::ClaimScriptOwnership(PendingEntity, GetMultiplayerConnectionInstance()->GetClientId());
 
-                if (PendingEntity->GetStatePatcher()->GetEntityPatchSentCallback() != nullptr)
-                {
-                    PendingEntity->GetStatePatcher()->CallEntityPatchSentCallback(true);
-                }
+            PendingEntities.push_back(PendingEntity);
 
-                PendingEntity->GetStatePatcher()->SetTimeOfLastPatch(CurrentTime);
-                it = PendingOutgoingUpdateUniqueSet->erase(it);
-            }
-            else
+            if (PendingEntity->GetStatePatcher()->GetEntityPatchSentCallback() != nullptr)
             {
-                LogSystem->LogMsg(common::LogLevel::VeryVerbose,
-                    "Skipping patch send in ProcessPendingEntityOperations as not enough time has passed since the last patch");
-                ++it;
+                PendingEntity->GetStatePatcher()->CallEntityPatchSentCallback(true);
             }
+
+            PendingEntity->GetStatePatcher()->SetTimeOfLastPatch(CurrentTime);
         }
 
         // Only send if there are patches in list
-        if (PendingEntities.Size() != 0)
+        if (PendingEntities.empty() == false)
         {
             // Send list of PendingEntities to chs
             SendPatches(PendingEntities);
 
             // Loop through and apply local patches from generated list
-            for (size_t i = 0; i < PendingEntities.Size(); ++i)
+            for (SpaceEntity* PendingEntity : PendingEntities)
             {
-                PendingEntities[i]->ApplyLocalPatch(true, GetMultiplayerConnectionInstance()->GetAllowSelfMessagingFlag());
+                PendingEntity->ApplyLocalPatch(true, GetMultiplayerConnectionInstance()->GetAllowSelfMessagingFlag());
             }
         }
     }
 
     // removes
     std::unordered_set<SpaceEntity*> RemovedEntities;
+    std::vector<SpaceEntity*> EntitiesToDelete;
+    EntitiesToDelete.reserve(PendingRemoves->size());
+
     while (PendingRemoves->empty() == false)
     {
         SpaceEntity* PendingRemoveEntity = PendingRemoves->front();
@@ -1342,31 +1492,30 @@ void OnlineRealtimeEngine::ProcessPendingEntityOperations()
         if (RemovedEntities.find(PendingRemoveEntity) == RemovedEntities.end())
         {
             RemovedEntities.emplace(PendingRemoveEntity);
+            EntitiesToDelete.push_back(PendingRemoveEntity);
 
-            RemovePendingEntity(PendingRemoves->front());
+            RemovePendingEntity(PendingRemoveEntity);
         }
         PendingRemoves->pop_front();
     }
-}
 
-void OnlineRealtimeEngine::AddPendingEntity(SpaceEntity* EntityToAdd)
-{
-    if (FindSpaceEntityById(EntityToAdd->GetId()) == nullptr)
+    if (RemovedEntities.empty() == false)
     {
-        Entities.Append(EntityToAdd);
+        // Drop the whole batch from the roots and entity lists at once, so removing many entities walks each list once rather than once per entity.
+        // This also picks up any removed children that were made roots when their removed parent was detached above.
+        RootHierarchy->RemoveRoots(RemovedEntities);
+        EntityIndex->RemoveAll(RemovedEntities);
 
-        switch (EntityToAdd->GetEntityType())
+        for (SpaceEntity* RemovedEntity : EntitiesToDelete)
         {
-        case SpaceEntityType::Avatar:
-            Avatars.Append(EntityToAdd);
-            break;
-
-        case SpaceEntityType::Object:
-            Objects.Append(EntityToAdd);
-            break;
+            delete (RemovedEntity);
         }
     }
-    else
+}
+
+void OnlineRealtimeEngine::AddPendingEntity(SpaceEntity* EntityToAdd)
+{
+    if (EntityIndex->Add(EntityToAdd) == false)
     {
         LogSystem->LogMsg(common::LogLevel::Error, "Attempted to add a pending entity that we already have!");
     }
@@ -1374,84 +1523,54 @@ void OnlineRealtimeEngine::AddPendingEntity(SpaceEntity* EntityToAdd)
 
 void OnlineRealtimeEngine::RemovePendingEntity(SpaceEntity* EntityToRemove)
 {
-    assert(Entities.Contains(EntityToRemove));
-
-    switch (EntityToRemove->GetEntityType())
-    {
-    case SpaceEntityType::Avatar:
-        assert(Avatars.Contains(EntityToRemove));
-        Avatars.RemoveItem(EntityToRemove);
-        break;
-
-    case SpaceEntityType::Object:
-        assert(Objects.Contains(EntityToRemove));
-        Objects.RemoveItem(EntityToRemove);
-        break;
-
-    default:
-        assert(false && "Unhandled entity type encountered during its destruction!");
-        break;
-    }
-
-    RootHierarchyEntities.RemoveItem(EntityToRemove);
-    RealtimeEngineUtils::RemoveParentChildRelationshipsFromEntity(*this, RootHierarchyEntities, EntityToRemove);
+    assert(EntityIndex->FindById(EntityToRemove->GetId()) == EntityToRemove);
 
-    Entities.RemoveItem(EntityToRemove);
+    // The entity is dropped from the roots and entity lists, and deleted, by ProcessPendingEntityOperations once the whole batch is detached.
+    RealtimeEngineUtils::RemoveParentChildRelationshipsFromEntity(*RootHierarchy, EntityToRemove);
 
-    delete (EntityToRemove);
+    TickList->Remove(EntityToRemove);
+    PendingOutgoingUpdates->Remove(EntityToRemove);
+    PendingOutgoingUpdates->ClearEntityPatchRate(EntityToRemove->GetId());
 }
 
-void OnlineRealtimeEngine::ApplyIncomingPatch(const signalr::value* EntityMessage)
+void OnlineRealtimeEngine::ApplyIncomingPatch(const mcs::ObjectPatch& Patch)
 {
-    mcs::ObjectPatch Patch;
-    SignalRDeserializer Deserializer { *EntityMessage };
-    Deserializer.ReadValue(Patch);
+    CSP_PROFILE_SCOPED();
+
+    SpaceEntity* Entity = EntityIndex->FindById(Patch.GetId());
 
     if (Patch.GetDestroy())
     {
         // This is an entity deletion.
-        for (size_t i = 0; i < Entities.Size(); ++i)
+        if (Entity != nullptr)
         {
-            SpaceEntity* Entity = Entities[i];
-
-            if (Entity->GetId() == Patch.GetId())
+            if (Entity->GetEntityType() == SpaceEntityType::Avatar)
             {
-                if (Entity->GetEntityType() == SpaceEntityType::Avatar)
+                // Loop through all entities and check if the deleted avatar owned any of them. If they did, deselect them.
+                // This covers disconnected clients as their avatar gets cleaned up after timing out.
+                for (size_t j = 0; j < Entities.Size(); ++j)
                 {
-                    // Loop through all entities and check if the deleted avatar owned any of them. If they did, deselect them.
-                    // This covers disconnected clients as their avatar gets cleaned up after timing out.
-                    for (size_t j = 0; j < Entities.Size(); ++j)
+                    if (Entities[j]->GetSelectingClientID() == Patch.GetId())
                     {
-                        if (Entities[j]->GetSelectingClientID() == Patch.GetId())
-                        {
-                            Entities[j]->Deselect();
-                            SelectedEntities.RemoveItem(Entities[j]);
-                        }
+                        Entities[j]->Deselect();
+                        SelectedEntities.RemoveItem(Entities[j]);
                     }
                 }
-
-                LocalDestroyEntity(Entity);
             }
+
+            LocalDestroyEntity(Entity);
         }
     }
     else
     {
-        bool EntityFound = false;
-
         // Update
-        for (SpaceEntity* Entity : Entities)
+        if (Entity != nullptr)
         {
-            if (Entity->GetId() == Patch.GetId())
-            {
-                Entity->GetStatePatcher()->ApplyPatchFromObjectPatch(Patch);
-                EntityFound = true;
-            }
+            Entity->GetStatePatcher()->ApplyPatchFromObjectPatch(Patch);
         }
-
-        if (!EntityFound)
+        else
         {
-            LogSystem->LogMsg(csp::common::LogLevel::Error,
-                fmt::format("Failed to find an entity with ID {} when received a patch message.", Patch.GetId()).c_str());
+            CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error, "Failed to find an entity with ID {} when received a patch message.", Patch.GetId());
         }
     }
 }
@@ -1467,7 +1586,7 @@ void OnlineRealtimeEngine::HandleException(const std::exception_ptr& Except, con
     }
     catch (const std::exception& e)
     {
-        LogSystem->LogMsg(csp::common::LogLevel::Error, fmt::format("{0} Exception: {1}", ExceptionDescription.c_str(), e.what()).c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error, "{0} Exception: {1}", ExceptionDescription.c_str(), e.what());
     }
 }
 } // namespace csp::multiplayer
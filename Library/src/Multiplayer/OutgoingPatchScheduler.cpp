@@ -0,0 +1,200 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "Multiplayer/OutgoingPatchScheduler.h"
+
+#include "Multiplayer/SpaceEntityStatePatcher.h"
+
+#include <algorithm>
+
+using namespace std::chrono;
+
+namespace csp::multiplayer
+{
+
+OutgoingPatchScheduler::OutgoingPatchScheduler()
+    : NextSequence(0)
+    , DefaultPatchRate(DEFAULT_PATCH_RATE)
+    , MaxPatchesPerBatch(DEFAULT_MAX_PATCHES_PER_BATCH)
+{
+}
+
+void OutgoingPatchScheduler::Schedule(SpaceEntity* Entity, uint64_t EntityId, const SpaceEntityStatePatcher& Patcher)
+{
+    ScheduleAt(Entity, Patcher.GetTimeOfLastPatch() + GetPatchRate(EntityId, Patcher));
+}
+
+void OutgoingPatchScheduler::ScheduleAt(SpaceEntity* Entity, milliseconds Deadline)
+{
+    auto ScheduledIt = Scheduled.find(Entity);
+
+    if (ScheduledIt != Scheduled.end() && ScheduledIt->second.Deadline <= Deadline)
+    {
+        return;
+    }
+
+    const HeapEntry Entry { Deadline, NextSequence++, Entity };
+
+    // Any existing entry for the entity is left in the heap, and skipped once it reaches the top as its sequence no longer matches.
+    Scheduled[Entity] = Entry;
+    Heap.push_back(Entry);
+    std::push_heap(Heap.begin(), Heap.end(), LaterDeadline {});
+
+    CompactIfStale();
+}
+
+void OutgoingPatchScheduler::Remove(SpaceEntity* Entity)
+{
+    if (Scheduled.erase(Entity) > 0)
+    {
+        CompactIfStale();
+    }
+}
+
+void OutgoingPatchScheduler::PopDue(milliseconds Now, std::vector<SpaceEntity*>& OutEntities)
+{
+    while (Heap.empty() == false && Heap.front().Deadline <= Now)
+    {
+        const HeapEntry Top = PopTop();
+
+        if (IsLive(Top))
+        {
+            Scheduled.erase(Top.Entity);
+            OutEntities.push_back(Top.Entity);
+        }
+    }
+}
+
+void OutgoingPatchScheduler::PopAll(std::vector<SpaceEntity*>& OutEntities)
+{
+    OutEntities.reserve(OutEntities.size() + Scheduled.size());
+
+    while (Heap.empty() == false)
+    {
+        const HeapEntry Top = PopTop();
+
+        if (IsLive(Top))
+        {
+            Scheduled.erase(Top.Entity);
+            OutEntities.push_back(Top.Entity);
+        }
+    }
+}
+
+void OutgoingPatchScheduler::Clear()
+{
+    Heap.clear();
+    Scheduled.clear();
+}
+
+void OutgoingPatchScheduler::Reset()
+{
+    Clear();
+    EntityPatchRates.clear();
+}
+
+bool OutgoingPatchScheduler::IsScheduled(SpaceEntity* Entity) const { return Scheduled.find(Entity) != Scheduled.end(); }
+
+bool OutgoingPatchScheduler::IsEmpty() const { return Scheduled.empty(); }
+
+bool OutgoingPatchScheduler::HasDue(milliseconds Now) const { return Heap.empty() == false && Heap.front().Deadline <= Now; }
+
+size_t OutgoingPatchScheduler::Size() const { return Scheduled.size(); }
+
+milliseconds OutgoingPatchScheduler::GetPatchRate(uint64_t EntityId, const SpaceEntityStatePatcher& Patcher) const
+{
+    const auto EntityRateIt = EntityPatchRates.find(EntityId);
+
+    if (EntityRateIt != EntityPatchRates.end())
+    {
+        return EntityRateIt->second;
+    }
+
+    if (ComponentTypePatchRates.empty())
+    {
+        return DefaultPatchRate;
+    }
+
+    // Anything dirty that isn't a component with its own rate is held to the default rate.
+    bool UsesDefaultRate = Patcher.GetDirtyPropertyCount() > 0 || Patcher.GetPendingComponentDeletionCount() > 0
+        || Patcher.GetNewParentId().HasValue() || Patcher.GetDirtyComponentCount() == 0;
+    milliseconds Rate = milliseconds::max();
+
+    Patcher.VisitDirtyComponents(
+        [this, &UsesDefaultRate, &Rate](uint16_t /*ComponentKey*/, const SpaceEntityStatePatcher::DirtyComponent& Dirty)
+        {
+            const auto TypeRateIt = Dirty.Component != nullptr ? ComponentTypePatchRates.find(Dirty.Component->GetComponentType())
+                                                               : ComponentTypePatchRates.end();
+
+            if (TypeRateIt != ComponentTypePatchRates.end())
+            {
+                Rate = std::min(Rate, TypeRateIt->second);
+            }
+            else
+            {
+                UsesDefaultRate = true;
+            }
+        });
+
+    return UsesDefaultRate ? std::min(Rate, DefaultPatchRate) : Rate;
+}
+
+void OutgoingPatchScheduler::SetDefaultPatchRate(milliseconds Rate) { DefaultPatchRate = Rate; }
+
+milliseconds OutgoingPatchScheduler::GetDefaultPatchRate() const { return DefaultPatchRate; }
+
+void OutgoingPatchScheduler::SetEntityPatchRate(uint64_t EntityId, milliseconds Rate) { EntityPatchRates[EntityId] = Rate; }
+
+void OutgoingPatchScheduler::ClearEntityPatchRate(uint64_t EntityId) { EntityPatchRates.erase(EntityId); }
+
+void OutgoingPatchScheduler::SetComponentTypePatchRate(ComponentType Type, milliseconds Rate) { ComponentTypePatchRates[Type] = Rate; }
+
+void OutgoingPatchScheduler::ClearComponentTypePatchRate(ComponentType Type) { ComponentTypePatchRates.erase(Type); }
+
+void OutgoingPatchScheduler::SetMaxPatchesPerBatch(size_t MaxPatches) { MaxPatchesPerBatch = std::max<size_t>(MaxPatches, 1); }
+
+size_t OutgoingPatchScheduler::GetMaxPatchesPerBatch() const { return MaxPatchesPerBatch; }
+
+bool OutgoingPatchScheduler::IsLive(const HeapEntry& Entry) const
+{
+    const auto ScheduledIt = Scheduled.find(Entry.Entity);
+    return ScheduledIt != Scheduled.end() && ScheduledIt->second.Sequence == Entry.Sequence;
+}
+
+OutgoingPatchScheduler::HeapEntry OutgoingPatchScheduler::PopTop()
+{
+    std::pop_heap(Heap.begin(), Heap.end(), LaterDeadline {});
+    const HeapEntry Top = Heap.back();
+    Heap.pop_back();
+
+    return Top;
+}
+
+void OutgoingPatchScheduler::CompactIfStale()
+{
+    // Stale entries are normally skipped as they surface, but an entity that keeps being rescheduled earlier, or removed, while
+    // others sit in the heap would let it grow without bound. Rebuild once the heap is mostly stale.
+    if (Heap.size() <= 2 * Scheduled.size() + 32)
+    {
+        return;
+    }
+
+    Heap.erase(std::remove_if(Heap.begin(), Heap.end(), [this](const HeapEntry& Entry) { return IsLive(Entry) == false; }), Heap.end());
+    std::make_heap(Heap.begin(), Heap.end(), LaterDeadline {});
+}
+
+} // namespace csp::multiplayer
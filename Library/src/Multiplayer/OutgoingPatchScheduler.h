@@ -0,0 +1,139 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include "CSP/Multiplayer/ComponentBase.h"
+
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace csp::multiplayer
+{
+
+class SpaceEntity;
+class SpaceEntityStatePatcher;
+
+/*
+    Holds the entities with local changes waiting to be sent to MCS, ordered by the time each one is next allowed to send a patch.
+    Entities sit in a min-heap keyed on their deadline, so a tick only visits entities whose rate window has expired,
+    rather than walking every queued entity to find out that most of them are not ready yet.
+
+    The rate an entity is limited to is resolved when it is scheduled, from (in order of precedence):
+    - A per-entity override, set via SetEntityPatchRate.
+    - The rates of the component types that are dirty on the entity, set via SetComponentTypePatchRate.
+      Entity properties (transform, name etc.), parent changes, and components without a configured rate all use the default rate.
+      The fastest applicable rate wins, so a slow metadata component never holds back a transform change made alongside it.
+    - The default rate.
+    Per-entity overrides are keyed on entity id, and are expected to be cleared when the entity is removed so that a reused id doesn't
+    inherit a stale rate.
+
+    Scheduling an entity that is already scheduled can only bring its deadline forward, never push it back.
+    Removed entities are dropped lazily from the heap when they reach the top of it.
+
+    This does no locking of its own, callers are expected to hold the engine's entities lock.
+*/
+class OutgoingPatchScheduler
+{
+public:
+    static constexpr std::chrono::milliseconds DEFAULT_PATCH_RATE { 90 };
+    static constexpr size_t DEFAULT_MAX_PATCHES_PER_BATCH = 64;
+
+    OutgoingPatchScheduler();
+
+    // Schedules the entity to be sent once its rate window, starting at TimeOfLastPatch, has expired.
+    void Schedule(SpaceEntity* Entity, uint64_t EntityId, const SpaceEntityStatePatcher& Patcher);
+
+    // Schedules the entity to be sent once Deadline has been reached.
+    void ScheduleAt(SpaceEntity* Entity, std::chrono::milliseconds Deadline);
+
+    void Remove(SpaceEntity* Entity);
+
+    // Appends every entity whose deadline is at or before Now to OutEntities, earliest deadline first, and unschedules them.
+    void PopDue(std::chrono::milliseconds Now, std::vector<SpaceEntity*>& OutEntities);
+
+    // Appends every scheduled entity to OutEntities, earliest deadline first, regardless of deadline, and unschedules them.
+    void PopAll(std::vector<SpaceEntity*>& OutEntities);
+
+    void Clear();
+
+    // Clears the schedule and drops every per-entity rate override, for when the entities they were set for are all gone.
+    // The default and component type rates are engine settings, so are kept.
+    void Reset();
+
+    [[nodiscard]] bool IsScheduled(SpaceEntity* Entity) const;
+    [[nodiscard]] bool IsEmpty() const;
+
+    // Whether PopDue may have anything to return at Now. Can be true for an entry that has since been superseded, but never false when
+    // something is due.
+    [[nodiscard]] bool HasDue(std::chrono::milliseconds Now) const;
+    [[nodiscard]] size_t Size() const;
+
+    // The rate the entity would currently be limited to, given what is dirty on its patcher.
+    [[nodiscard]] std::chrono::milliseconds GetPatchRate(uint64_t EntityId, const SpaceEntityStatePatcher& Patcher) const;
+
+    void SetDefaultPatchRate(std::chrono::milliseconds Rate);
+    [[nodiscard]] std::chrono::milliseconds GetDefaultPatchRate() const;
+
+    void SetEntityPatchRate(uint64_t EntityId, std::chrono::milliseconds Rate);
+    void ClearEntityPatchRate(uint64_t EntityId);
+
+    void SetComponentTypePatchRate(ComponentType Type, std::chrono::milliseconds Rate);
+    void ClearComponentTypePatchRate(ComponentType Type);
+
+    // The maximum number of patches sent in a single SEND_OBJECT_PATCHES invocation. Larger sets are split across several invocations.
+    void SetMaxPatchesPerBatch(size_t MaxPatches);
+    [[nodiscard]] size_t GetMaxPatchesPerBatch() const;
+
+private:
+    struct HeapEntry
+    {
+        std::chrono::milliseconds Deadline;
+        // Breaks deadline ties in scheduling order, and identifies stale entries.
+        uint64_t Sequence;
+        SpaceEntity* Entity;
+    };
+
+    struct LaterDeadline
+    {
+        bool operator()(const HeapEntry& Lhs, const HeapEntry& Rhs) const
+        {
+            return Lhs.Deadline != Rhs.Deadline ? Lhs.Deadline > Rhs.Deadline : Lhs.Sequence > Rhs.Sequence;
+        }
+    };
+
+    // Whether the entry is the entity's current schedule, rather than a superseded or removed one.
+    bool IsLive(const HeapEntry& Entry) const;
+    HeapEntry PopTop();
+    void CompactIfStale();
+
+    std::vector<HeapEntry> Heap;
+
+    // Entity -> the heap entry that is current for it.
+    std::unordered_map<SpaceEntity*, HeapEntry> Scheduled;
+
+    uint64_t NextSequence;
+
+    std::chrono::milliseconds DefaultPatchRate;
+    std::unordered_map<uint64_t, std::chrono::milliseconds> EntityPatchRates;
+    std::unordered_map<ComponentType, std::chrono::milliseconds> ComponentTypePatchRates;
+    size_t MaxPatchesPerBatch;
+};
+
+} // namespace csp::multiplayer
@@ -2,6 +2,7 @@
 
 #include "CSP/Common/Systems/Log/LogSystem.h"
 #include "CSP/Multiplayer/SpaceEntity.h"
+#include "Common/Systems/Log/LogFormat.h"
 #include "Multiplayer/RealtimeEngineUtils.h"
 #include "SpaceEntityStatePatcher.h"
 
@@ -17,13 +18,8 @@ static bool SetProperty(
     ModifiableStatus Modifiable = Entity.IsModifiable();
     if (Modifiable != ModifiableStatus::Modifiable)
     {
-        if (LogSystem != nullptr)
-        {
-            LogSystem->LogMsg(csp::common::LogLevel::Warning,
-                fmt::format("Failed to set propery on entity: {0}, skipping update. Entity name: {1}",
-                    RealtimeEngineUtils::ModifiableStatusToString(Modifiable), Entity.GetName())
-                    .c_str());
-        }
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Warning, "Failed to set propery on entity: {0}, skipping update. Entity name: {1}",
+            RealtimeEngineUtils::ModifiableStatusToString(Modifiable), Entity.GetName());
 
         return false;
     }
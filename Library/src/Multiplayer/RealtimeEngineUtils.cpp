@@ -19,7 +19,11 @@
 #include "CSP/Multiplayer/Components/AvatarSpaceComponent.h"
 #include "CSP/Multiplayer/Script/EntityScriptMessages.h"
 #include "CSP/Multiplayer/SpaceEntity.h"
+#include "Debug/Profiler.h"
 #include "Multiplayer/Election/ScopeLeadershipManager.h"
+#include "Multiplayer/SpaceEntityHierarchy.h"
+#include "Multiplayer/SpaceEntityIndex.h"
+#include "Multiplayer/SpaceEntityTickList.h"
 #include <fmt/format.h>
 
 namespace
@@ -38,56 +42,24 @@ csp::common::String ModifiableStatusToString(ModifiableStatus Failure)
     return "No log specified for modifiable status";
 }
 
-csp::multiplayer::SpaceEntity* FindSpaceEntity(csp::common::IRealtimeEngine& RealtimeEngine, const csp::common::String& Name)
+csp::multiplayer::SpaceEntity* FindSpaceEntity(const SpaceEntityIndex& EntityIndex, const csp::common::String& Name)
 {
-    for (size_t i = 0; i < RealtimeEngine.GetNumEntities(); ++i)
-    {
-        if (RealtimeEngine.GetEntityByIndex(i)->GetName() == Name)
-        {
-            return RealtimeEngine.GetEntityByIndex(i);
-        }
-    }
-
-    return nullptr;
+    return EntityIndex.FindByName(Name);
 }
 
-csp::multiplayer::SpaceEntity* FindSpaceEntityById(csp::common::IRealtimeEngine& RealtimeEngine, uint64_t EntityId)
+csp::multiplayer::SpaceEntity* FindSpaceEntityById(const SpaceEntityIndex& EntityIndex, uint64_t EntityId)
 {
-    for (size_t i = 0; i < RealtimeEngine.GetNumEntities(); ++i)
-    {
-        if (RealtimeEngine.GetEntityByIndex(i)->GetId() == EntityId)
-        {
-            return RealtimeEngine.GetEntityByIndex(i);
-        }
-    }
-
-    return nullptr;
+    return EntityIndex.FindById(EntityId);
 }
 
-csp::multiplayer::SpaceEntity* FindSpaceAvatar(csp::common::IRealtimeEngine& RealtimeEngine, const csp::common::String& Name)
+csp::multiplayer::SpaceEntity* FindSpaceAvatar(const SpaceEntityIndex& EntityIndex, const csp::common::String& Name)
 {
-    for (size_t i = 0; i < RealtimeEngine.GetNumAvatars(); ++i)
-    {
-        if (RealtimeEngine.GetAvatarByIndex(i)->GetName() == Name)
-        {
-            return RealtimeEngine.GetAvatarByIndex(i);
-        }
-    }
-
-    return nullptr;
+    return EntityIndex.FindByName(Name, SpaceEntityType::Avatar);
 }
 
-csp::multiplayer::SpaceEntity* FindSpaceObject(csp::common::IRealtimeEngine& RealtimeEngine, const csp::common::String& Name)
+csp::multiplayer::SpaceEntity* FindSpaceObject(const SpaceEntityIndex& EntityIndex, const csp::common::String& Name)
 {
-    for (size_t i = 0; i < RealtimeEngine.GetNumObjects(); ++i)
-    {
-        if (RealtimeEngine.GetObjectByIndex(i)->GetName() == Name)
-        {
-            return RealtimeEngine.GetObjectByIndex(i);
-        }
-    }
-
-    return nullptr;
+    return EntityIndex.FindByName(Name, SpaceEntityType::Object);
 }
 
 std::unique_ptr<csp::multiplayer::SpaceEntity> BuildNewAvatar(const csp::common::String& UserId, csp::common::IRealtimeEngine& RealtimeEngine,
@@ -110,47 +82,25 @@ std::unique_ptr<csp::multiplayer::SpaceEntity> BuildNewAvatar(const csp::common:
     return NewAvatar;
 }
 
-bool EntityIsInRootHierarchy(csp::common::IRealtimeEngine& RealtimeEngine, SpaceEntity* Entity)
-{
-    for (size_t i = 0; i < RealtimeEngine.GetRootHierarchyEntities()->Size(); ++i)
-    {
-        if ((*RealtimeEngine.GetRootHierarchyEntities())[i]->GetId() == Entity->GetId())
-        {
-            return true;
-        }
-    }
-
-    return false;
-}
+bool EntityIsInRootHierarchy(const SpaceEntityHierarchy& RootHierarchy, SpaceEntity* Entity) { return RootHierarchy.IsRoot(Entity); }
 
-void ResolveEntityHierarchy(csp::common::IRealtimeEngine& RealtimeEngine, csp::common::List<SpaceEntity*>& RootHierarchyEntities, SpaceEntity* Entity)
+void ResolveEntityHierarchy(SpaceEntityHierarchy& RootHierarchy, SpaceEntity* Entity)
 {
     // Feels weird this not having a mutex lock, relies on the caller setting the entities lock
 
     if (Entity->GetParentId().HasValue())
     {
-        for (size_t i = 0; i < RootHierarchyEntities.Size(); ++i)
-        {
-            if (RootHierarchyEntities[i]->GetId() == Entity->GetId())
-            {
-                RootHierarchyEntities.Remove(i);
-                break;
-            }
-        }
+        RootHierarchy.RemoveRoot(Entity);
     }
     else
     {
-        if (EntityIsInRootHierarchy(RealtimeEngine, Entity) == false)
-        {
-            RootHierarchyEntities.Append(Entity);
-        }
+        RootHierarchy.AddRoot(Entity);
     }
 
     Entity->ResolveParentChildRelationship();
 }
 
-void RemoveParentChildRelationshipsFromEntity(
-    csp::common::IRealtimeEngine& RealtimeEngine, csp::common::List<SpaceEntity*>& RootHierarchyEntities, SpaceEntity* Entity)
+void RemoveParentChildRelationshipsFromEntity(SpaceEntityHierarchy& RootHierarchy, SpaceEntity* Entity)
 {
     if (Entity->GetParentEntity())
     {
@@ -162,12 +112,11 @@ void RemoveParentChildRelationshipsFromEntity(
     {
         Entity->RemoveParentFromChildEntity(i);
 
-        ResolveEntityHierarchy(RealtimeEngine, RootHierarchyEntities, ChildEntities[i]);
+        ResolveEntityHierarchy(RootHierarchy, ChildEntities[i]);
     }
 }
 
-void LocalProcessChildUpdates(
-    csp::common::IRealtimeEngine& RealtimeEngine, csp::common::List<SpaceEntity*>& RootHierarchyEntities, csp::multiplayer::SpaceEntity* Entity)
+void LocalProcessChildUpdates(SpaceEntityHierarchy& RootHierarchy, csp::multiplayer::SpaceEntity* Entity)
 {
     // Messy, taken from existing cleanup code. Needs a conceptual facelift
 
@@ -178,7 +127,7 @@ void LocalProcessChildUpdates(
     for (size_t i = 0; i < ChildrenToUpdate.Size(); ++i)
     {
         ChildrenToUpdate[i]->RemoveParentId();
-        ResolveEntityHierarchy(RealtimeEngine, RootHierarchyEntities, ChildrenToUpdate[i]);
+        ResolveEntityHierarchy(RootHierarchy, ChildrenToUpdate[i]);
 
         if (ChildrenToUpdate[i]->GetEntityUpdateCallback())
         {
@@ -240,21 +189,35 @@ void ClaimScriptOwnership(SpaceEntity* Entity, uint64_t ClientId)
     Script.SetOwnerId(ClientId);
 }
 
-std::chrono::system_clock::time_point TickEntityScripts(
-    std::recursive_mutex& EntitiesLock, const csp::common::List<SpaceEntity*>& Entities, std::chrono::system_clock::time_point LastTickTime)
+std::chrono::system_clock::time_point TickEntityScripts(std::recursive_mutex& EntitiesLock, SpaceEntityTickList& TickList,
+    csp::common::IJSScriptRunner& ScriptRunner, std::chrono::system_clock::time_point LastTickTime)
 {
+    CSP_PROFILE_SCOPED();
+
     std::scoped_lock EntitiesLocker(EntitiesLock);
 
     const auto CurrentTime = std::chrono::system_clock::now();
     const auto DeltaTimeMS = std::chrono::duration_cast<std::chrono::milliseconds>(CurrentTime - LastTickTime).count();
 
-    const csp::common::String DeltaTimeJSON = JSONStringFromDeltaTime(static_cast<double>(DeltaTimeMS));
-
-    for (size_t i = 0; i < Entities.Size(); ++i)
+    if (TickList.Size() == 0)
     {
-        Entities[i]->GetScript().PostMessageToScript(SCRIPT_MSG_ENTITY_TICK, DeltaTimeJSON);
+        return CurrentTime;
     }
 
+    // The JSON params are kept for existing scripts, newer ones can take the delta as a number from the third argument.
+    const csp::common::String DeltaTimeJSON = JSONStringFromDeltaTime(static_cast<double>(DeltaTimeMS));
+
+    TickList.PostToAll(ScriptRunner, SCRIPT_MSG_ENTITY_TICK, DeltaTimeJSON, static_cast<double>(DeltaTimeMS));
+
     return CurrentTime;
 }
+
+void UpdateWorldTransforms(std::recursive_mutex& EntitiesLock, const SpaceEntityHierarchy& RootHierarchy)
+{
+    CSP_PROFILE_SCOPED();
+
+    std::scoped_lock EntitiesLocker(EntitiesLock);
+
+    SpaceEntity::UpdateWorldTransforms(RootHierarchy.GetRootEntities());
+}
 }
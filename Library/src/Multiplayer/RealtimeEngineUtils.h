@@ -41,6 +41,9 @@ class LogSystem;
 namespace csp::multiplayer
 {
 class SpaceEntity;
+class SpaceEntityHierarchy;
+class SpaceEntityIndex;
+class SpaceEntityTickList;
 class SpaceTransform;
 class AvatarSpaceComponent;
 enum class AvatarState;
@@ -58,16 +61,17 @@ static const std::unordered_map<ModifiableStatus, csp::common::String> Modifiabl
 
 csp::common::String ModifiableStatusToString(ModifiableStatus Failure);
 
-// Finds a space entity in the Entities container. Returns nullptr if the entity is not found.
-csp::multiplayer::SpaceEntity* FindSpaceEntity(csp::common::IRealtimeEngine& RealtimeEngine, const csp::common::String& Name);
+// Finds a space entity by name using the engine's entity index. Returns nullptr if the entity is not found.
+csp::multiplayer::SpaceEntity* FindSpaceEntity(const SpaceEntityIndex& EntityIndex, const csp::common::String& Name);
 
-csp::multiplayer::SpaceEntity* FindSpaceEntityById(csp::common::IRealtimeEngine& RealtimeEngine, uint64_t EntityId);
+// Finds a space entity by id using the engine's entity index. Returns nullptr if the entity is not found.
+csp::multiplayer::SpaceEntity* FindSpaceEntityById(const SpaceEntityIndex& EntityIndex, uint64_t EntityId);
 
-// Finds an avatar entity in the Avatar container. Returns nullptr if the avatar is not found.
-csp::multiplayer::SpaceEntity* FindSpaceAvatar(csp::common::IRealtimeEngine& RealtimeEngine, const csp::common::String& Name);
+// Finds an avatar entity by name using the engine's entity index. Returns nullptr if the avatar is not found.
+csp::multiplayer::SpaceEntity* FindSpaceAvatar(const SpaceEntityIndex& EntityIndex, const csp::common::String& Name);
 
-// Finds an object in the Objects container. Returns nullptr if the object is not found.
-csp::multiplayer::SpaceEntity* FindSpaceObject(csp::common::IRealtimeEngine& RealtimeEngine, const csp::common::String& Name);
+// Finds an object entity by name using the engine's entity index. Returns nullptr if the object is not found.
+csp::multiplayer::SpaceEntity* FindSpaceObject(const SpaceEntityIndex& EntityIndex, const csp::common::String& Name);
 
 // Creates a space entity with an avatar component.
 std::unique_ptr<csp::multiplayer::SpaceEntity> BuildNewAvatar(const csp::common::String& UserId, csp::common::IRealtimeEngine& RealtimeEngine,
@@ -76,24 +80,21 @@ std::unique_ptr<csp::multiplayer::SpaceEntity> BuildNewAvatar(const csp::common:
     const csp::common::String& AvatarId, csp::multiplayer::AvatarState AvatarState, csp::multiplayer::AvatarPlayMode AvatarPlayMode,
     csp::multiplayer::LocomotionModel LocomotionModel);
 
-// Checks if an entity exists within the root hierarchy array
-bool EntityIsInRootHierarchy(csp::common::IRealtimeEngine& RealtimeEngine, SpaceEntity* Entity);
+// Checks if an entity is one of the engine's root hierarchy entities
+bool EntityIsInRootHierarchy(const SpaceEntityHierarchy& RootHierarchy, SpaceEntity* Entity);
 
 // "Resolves" the entity heirarchy, which is really a bit of an unhelpful catch all term to mean
 // "Walk the entity tree, and make sure all our internal buffers are set up to have the right pointers in them".
 // Sets the entities in the root entity heirarchy list, as well as calling SpaceEntity::ResolveParentChildRelationship,
 // which also "resolves" itself, by setting the `Parent` pointer to the correct entity, and making sure it's list of children is correctly populated.
-void ResolveEntityHierarchy(
-    csp::common::IRealtimeEngine& RealtimeEngine, csp::common::List<SpaceEntity*>& RootHierarchyEntities, SpaceEntity* Entity);
+void ResolveEntityHierarchy(SpaceEntityHierarchy& RootHierarchy, SpaceEntity* Entity);
 
 // Unparents any child entities from the entity and remove the parent relationship. Need to call this before deleting an entity
-void RemoveParentChildRelationshipsFromEntity(
-    csp::common::IRealtimeEngine& RealtimeEngine, csp::common::List<SpaceEntity*>& RootHierarchyEntities, SpaceEntity* Entity);
+void RemoveParentChildRelationshipsFromEntity(SpaceEntityHierarchy& RootHierarchy, SpaceEntity* Entity);
 
 // Ensures components attached to the entity are notified of deletion by calling OnLocalDelete.
 // It also fires the entity patch callback, notifying clients that the child entities have been reparented.
-void LocalProcessChildUpdates(
-    csp::common::IRealtimeEngine& RealtimeEngine, csp::common::List<SpaceEntity*>& RootHierarchyEntities, csp::multiplayer::SpaceEntity* Entity);
+void LocalProcessChildUpdates(SpaceEntityHierarchy& RootHierarchy, csp::multiplayer::SpaceEntity* Entity);
 
 // You should lock the entities mutex before calling this, and probably have processed entity operations
 void InitialiseEntityScripts(csp::common::List<SpaceEntity*>& Entities);
@@ -105,7 +106,12 @@ void DetermineScriptOwners(const csp::common::List<SpaceEntity*>& Entities, uint
 void ClaimScriptOwnership(SpaceEntity* Entity, uint64_t ClientId);
 
 // Returns the current time, meant to be set as LastTickTime. If an offline engine, will not bother checking whether the local client is the leader.
-std::chrono::system_clock::time_point TickEntityScripts(
-    std::recursive_mutex& EntitiesLock, const csp::common::List<SpaceEntity*>& Entities, std::chrono::system_clock::time_point LastTickTime);
+// Only entities in TickList are ticked, see SpaceEntityTickList.
+std::chrono::system_clock::time_point TickEntityScripts(std::recursive_mutex& EntitiesLock, SpaceEntityTickList& TickList,
+    csp::common::IJSScriptRunner& ScriptRunner, std::chrono::system_clock::time_point LastTickTime);
+
+// Walks the entity hierarchy from the roots once, refreshing any global transforms that were invalidated by local transform or parent changes
+// since the last tick. Takes EntitiesLock itself.
+void UpdateWorldTransforms(std::recursive_mutex& EntitiesLock, const SpaceEntityHierarchy& RootHierarchy);
 
 }
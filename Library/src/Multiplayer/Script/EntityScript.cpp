@@ -21,6 +21,8 @@
 #include "CSP/Multiplayer/Components/ScriptSpaceComponent.h"
 #include "CSP/Multiplayer/Script/EntityScriptMessages.h"
 #include "CSP/Multiplayer/SpaceEntity.h"
+#include "Common/Systems/Log/LogFormat.h"
+#include "Debug/Profiler.h"
 
 #include <fmt/format.h>
 
@@ -46,10 +48,9 @@ EntityScript::~EntityScript() { Shutdown(); }
 
 bool EntityScript::Invoke()
 {
-    if (LogSystem != nullptr)
-    {
-        LogSystem->LogMsg(csp::common::LogLevel::VeryVerbose, fmt::format("EntityScript::Invoke called for {}", Entity->GetName()).c_str());
-    }
+    CSP_PROFILE_SCOPED();
+
+    CSP_LOG_FMT(LogSystem, csp::common::LogLevel::VeryVerbose, "EntityScript::Invoke called for {}", Entity->GetName());
 
     CheckBinding();
 
@@ -78,10 +79,7 @@ bool EntityScript::Invoke()
 
     if (HasLastError)
     {
-        if (LogSystem != nullptr)
-        {
-            LogSystem->LogMsg(csp::common::LogLevel::Error, fmt::format("Script Error: {}", LastError).c_str());
-        }
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error, "Script Error: {}", LastError);
     }
 
     return !HasLastError;
@@ -89,38 +87,44 @@ bool EntityScript::Invoke()
 
 void EntityScript::RunScript(const csp::common::String& ScriptSource)
 {
+    CSP_PROFILE_SCOPED();
+
     if (RealtimeEnginePtr == nullptr)
     {
         LogSystem->LogMsg(csp::common::LogLevel::Fatal, "Null RealtimeEngine when trying to run script. Aborting Operation.");
         return;
     }
 
-    // If offline, just run the script
-    if (RealtimeEnginePtr->GetRealtimeEngineType() != csp::common::RealtimeEngineType::Online)
-    {
-        ScriptRunner->RunScript(Entity->GetId(), ScriptSource);
-        return;
-    }
-
-    // Otherwise we're online
-    auto* OnlineRealtimeEngine = static_cast<csp::multiplayer::OnlineRealtimeEngine*>(RealtimeEnginePtr);
-    if (OnlineRealtimeEngine->CheckIfWeShouldRunScriptsLocally())
+    if (ShouldRunScriptsLocally())
     {
         ScriptRunner->RunScript(Entity->GetId(), ScriptSource);
     }
     else
     {
-
+        auto* OnlineRealtimeEngine = static_cast<csp::multiplayer::OnlineRealtimeEngine*>(RealtimeEnginePtr);
         OnlineRealtimeEngine->RunScriptRemotely(Entity->GetId(), ScriptSource);
     }
 }
 
+bool EntityScript::ShouldRunScriptsLocally() const
+{
+    // If offline, scripts always run locally
+    if (RealtimeEnginePtr->GetRealtimeEngineType() != csp::common::RealtimeEngineType::Online)
+    {
+        return true;
+    }
+
+    // Otherwise we're online, and only the script leader runs them
+    auto* OnlineRealtimeEngine = static_cast<csp::multiplayer::OnlineRealtimeEngine*>(RealtimeEnginePtr);
+    return OnlineRealtimeEngine->CheckIfWeShouldRunScriptsLocally();
+}
+
 void EntityScript::SetScriptSource(const csp::common::String& InScriptSource)
 {
     if (LogSystem != nullptr)
     {
-        LogSystem->LogMsg(csp::common::LogLevel::VeryVerbose,
-            fmt::format("EntityScript::SetScriptSource called for {0}\nSource: {1}", Entity->GetName(), InScriptSource).c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::VeryVerbose, "EntityScript::SetScriptSource called for {0}\nSource: {1}", Entity->GetName(),
+            InScriptSource);
         LogSystem->LogMsg(csp::common::LogLevel::VeryVerbose, "--EndScriptSource--");
     }
 
@@ -194,16 +198,20 @@ void EntityScript::Shutdown()
 
 void EntityScript::OnSourceChanged(const csp::common::String& InScriptSource)
 {
-    if (LogSystem != nullptr)
-    {
-        LogSystem->LogMsg(csp::common::LogLevel::VeryVerbose, fmt::format("OnSourceChanged: {}\n", InScriptSource).c_str());
-    }
+    CSP_LOG_FMT(LogSystem, csp::common::LogLevel::VeryVerbose, "OnSourceChanged: {}\n", InScriptSource);
 
     if (EntityScriptComponent != nullptr)
     {
+        const bool HadTickHandler = MessageMap.count(SCRIPT_MSG_ENTITY_TICK) > 0;
+
         MessageMap.clear();
         PropertyMap.clear();
 
+        if (HadTickHandler && RealtimeEnginePtr != nullptr)
+        {
+            RealtimeEnginePtr->OnEntityTickHandlerChanged(Entity, false);
+        }
+
         ScriptRunner->ResetContext(Entity->GetId());
         HasBinding = false; // we've reset the context which means this script is no longer bound
 
@@ -238,11 +246,8 @@ void EntityScript::SubscribeToPropertyChange(int32_t ComponentId, int32_t Proper
 
     if (It == PropertyMap.end())
     {
-        if (LogSystem != nullptr)
-        {
-            LogSystem->LogMsg(csp::common::LogLevel::VeryVerbose,
-                fmt::format("SubscribeToPropertyChange: ({0}, {1}) {2}\n", ComponentId, PropertyKey, Message).c_str());
-        }
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::VeryVerbose, "SubscribeToPropertyChange: ({0}, {1}) {2}\n", ComponentId, PropertyKey,
+            Message);
 
         PropertyMap.insert(PropertyChangeMap::value_type(Key, Message));
     }
@@ -270,35 +275,78 @@ void EntityScript::SubscribeToMessage(const csp::common::String Message, const c
 
     if (It == MessageMap.end())
     {
-        if (LogSystem != nullptr)
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::VeryVerbose, "SubscribeToMessage: {} -> {}\n", Message, OnMessageCallback);
+
+        MessageMap.insert(SubscribedMessageMap::value_type(Message, OnMessageCallback));
+
+        // The engine only ticks entities that asked for it.
+        if (Message == SCRIPT_MSG_ENTITY_TICK && RealtimeEnginePtr != nullptr)
         {
-            LogSystem->LogMsg(csp::common::LogLevel::VeryVerbose, fmt::format("SubscribeToMessage: {} -> {}\n", Message, OnMessageCallback).c_str());
+            RealtimeEnginePtr->OnEntityTickHandlerChanged(Entity, true);
         }
+    }
+    else if (It->second != OnMessageCallback)
+    {
+        It->second = OnMessageCallback;
 
-        MessageMap.insert(SubscribedMessageMap::value_type(Message, OnMessageCallback));
+        // The engine's tick list holds the callback name, so it needs to hear about the new one.
+        if (Message == SCRIPT_MSG_ENTITY_TICK && RealtimeEnginePtr != nullptr)
+        {
+            RealtimeEnginePtr->OnEntityTickHandlerChanged(Entity, true);
+        }
+    }
+
+    // Split the callback's name (which may be a dotted path) into atoms up front, so posting a message only has to read the path rather than
+    // compile a script to make the call. The callback may not be defined yet, which is fine, as the path is read each time the message is posted.
+    ScriptRunner->ResolveCallback(Entity->GetId(), OnMessageCallback);
+}
+
+bool EntityScript::TryGetMessageCallback(const csp::common::String& Message, csp::common::String& OutCallback) const
+{
+    SubscribedMessageMap::const_iterator It = MessageMap.find(Message);
+
+    if (It == MessageMap.end())
+    {
+        return false;
     }
+
+    OutCallback = It->second;
+
+    return true;
 }
 
 void EntityScript::PostMessageToScript(const csp::common::String Message, const csp::common::String MessageParamsJson)
 {
+    CSP_PROFILE_SCOPED();
+
     SubscribedMessageMap::iterator It = MessageMap.find(Message);
 
     if (It != MessageMap.end())
     {
         const csp::common::String& OnMessageCallback = It->second;
 
-        // Generate a call to the callback with the correct parameters
-        csp::common::String ScriptText
-            = csp::common::StringFormat("%s('%s','%s')", OnMessageCallback.c_str(), Message.c_str(), MessageParamsJson.c_str());
-
         if (Message != SCRIPT_MSG_ENTITY_TICK)
         {
-            if (LogSystem != nullptr)
-            {
-                LogSystem->LogMsg(csp::common::LogLevel::VeryVerbose, fmt::format("PostMessageToScript: {}\n", ScriptText).c_str());
-            }
+            CSP_LOG_FMT(LogSystem, csp::common::LogLevel::VeryVerbose, "PostMessageToScript: {}('{}','{}')\n", OnMessageCallback, Message,
+                MessageParamsJson);
+        }
+
+        if (RealtimeEnginePtr == nullptr)
+        {
+            LogSystem->LogMsg(csp::common::LogLevel::Fatal, "Null RealtimeEngine when trying to run script. Aborting Operation.");
+            return;
+        }
+
+        // Call the callback directly when running locally
+        if (ShouldRunScriptsLocally() && ScriptRunner->InvokeCallback(Entity->GetId(), OnMessageCallback, Message, MessageParamsJson))
+        {
+            return;
         }
 
+        // Otherwise generate a call to the callback with the correct parameters
+        csp::common::String ScriptText
+            = csp::common::StringFormat("%s('%s','%s')", OnMessageCallback.c_str(), Message.c_str(), MessageParamsJson.c_str());
+
         RunScript(ScriptText.c_str());
     }
 }
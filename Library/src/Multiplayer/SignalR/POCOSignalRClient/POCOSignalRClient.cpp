@@ -17,6 +17,7 @@
 
 #include "POCOSignalRClient.h"
 #include "CSP/Common/Systems/Log/LogSystem.h"
+#include "Common/Systems/Log/LogFormat.h"
 #include <Poco/Net/HTTPRequest.h>
 #include <Poco/Net/HTTPResponse.h>
 #include <Poco/Net/HTTPSClientSession.h>
@@ -32,8 +33,16 @@
 
 using namespace std::chrono_literals;
 
-constexpr const size_t INITIAL_BUFFER_SIZE = 8192;
+constexpr const size_t INITIAL_BUFFER_SIZE = 65536;
 constexpr const size_t RECEIVE_BLOCK_SIZE = 4096;
+// How long the receive thread blocks waiting on the socket before checking whether it has been stopped.
+const Poco::Timespan SOCKET_POLL_TIMEOUT(10 * Poco::Timespan::MILLISECONDS);
+// Largest frame queued messages are coalesced into. A single message larger than this still goes out on its own.
+constexpr const size_t MAX_COALESCED_FRAME_SIZE = 65536;
+// Largest frame we will receive. Poco grows the receive buffer to fit whatever length a frame header claims, so without a cap
+// a bad or hostile header could make us allocate gigabytes. Larger frames are rejected and treated as a receive error.
+// Messages are capped to the same size, as one message can be spread over many frames that would otherwise be buffered without bound.
+constexpr const int MAX_RECEIVE_FRAME_SIZE = 64 * 1024 * 1024;
 
 namespace csp::multiplayer
 {
@@ -41,7 +50,13 @@ namespace csp::multiplayer
 CSPWebSocketClientPOCO::CSPWebSocketClientPOCO(
     const std::string& MultiplayerUri, const std::string& AccessToken, const std::string& DeviceId, csp::common::LogSystem& LogSystem) noexcept
     : PocoWebSocket(nullptr)
+    , ReceiveReady(false)
     , StopFlag(false)
+    , ReceiveBuffer(INITIAL_BUFFER_SIZE)
+    , QueuedSendBytes(0)
+    , SendStopFlag(false)
+    , SendCoalescingWindow(DEFAULT_SEND_COALESCING_WINDOW)
+    , SendQueueByteBudget(DEFAULT_SEND_QUEUE_BYTE_BUDGET)
     , MultiplayerUri { MultiplayerUri }
     , AccessToken { AccessToken }
     , DeviceId { DeviceId }
@@ -53,6 +68,9 @@ CSPWebSocketClientPOCO::~CSPWebSocketClientPOCO()
 {
     // Block exit until receive and callback threads exits
     Stop(nullptr);
+
+    // Stop leaves the send thread running if it was called from a send callback, so it is joined here instead.
+    JoinSendThread();
 }
 
 CSPWebSocketClientPOCO::ParsedURIInfo CSPWebSocketClientPOCO::ParseMultiplayerServiceUriEndPoint(const std::string& MultiplayerServiceUriEndpoint)
@@ -108,10 +126,22 @@ void CSPWebSocketClientPOCO::Start(const std::string& /*Url*/, CallbackHandler C
         request.set("Authorization", Str);
 
         StopFlag = false;
+        ReceiveReady = false;
 
         PocoWebSocket = new Poco::Net::WebSocket(*cs, request, response);
-        // Receive worker thread
+        PocoWebSocket->setMaxPayloadSize(MAX_RECEIVE_FRAME_SIZE);
+
+        // A send thread stopped from one of its own callbacks has exited, or is about to, but has not been joined yet.
+        JoinSendThread();
+
+        {
+            std::scoped_lock<std::mutex> SendLocker(SendMutex);
+            SendStopFlag = false;
+        }
+
+        // Receive and send worker threads
         ReceiveThread = std::thread([this]() { ReceiveThreadFunc(); });
+        SendThread = std::thread([this]() { SendThreadFunc(); });
 
         Callback(true);
     }
@@ -138,6 +168,16 @@ void CSPWebSocketClientPOCO::Stop(CallbackHandler Callback)
         // If the ReceiveThread is locked then the other thread will never finish because itd will be waiting for the ReceiveThread to join
         Mutex.unlock();
 
+        // Wake the receive thread if it is waiting on a call to Receive
+        {
+            std::scoped_lock<std::mutex> ReceiveLocker(ReceiveMutex);
+        }
+
+        ReceiveCondition.notify_all();
+
+        // Let anything already queued go out before the socket is closed
+        StopSendThread();
+
         // POCO doesn't like close being called in the middle of
         // receiveFrame, so wait for receive thread to close
         if (std::this_thread::get_id() != ReceiveThread.get_id())
@@ -180,33 +220,49 @@ void CSPWebSocketClientPOCO::Send(const std::string& Message, CallbackHandler Ca
 
     assert(PocoWebSocket && "Web socket not created! Please call Start() before calling Send().");
 
-    int Flags = Poco::Net::WebSocket::SendFlags::FRAME_BINARY; // Assume binary as we don't support JSON anymore
-    auto Remaining = Message.size();
-    auto Succeeded = true;
+    bool Queued = false;
+    bool WakeSendThread = false;
 
-    try
     {
-        while (Remaining > 0)
+        std::scoped_lock<std::mutex> SendLocker(SendMutex);
+
+        if (SendStopFlag == false)
         {
-            auto SentCount = PocoWebSocket->sendFrame(Message.data(), static_cast<int>(Message.size()), Flags);
+            // The send thread only needs waking if it is idle, or waiting out the coalescing window with a full frame's worth queued
+            WakeSendThread = SendQueue.empty() || QueuedSendBytes.load() + Message.size() >= MAX_COALESCED_FRAME_SIZE;
 
-            Remaining -= SentCount;
+            SendQueue.push_back({ Message, std::move(Callback) });
+            QueuedSendBytes += Message.size();
+            Queued = true;
+        }
+    }
 
-            if (SentCount <= 0)
-            {
-                Succeeded = false;
-                break;
-            }
+    if (Queued == false)
+    {
+        if (Callback)
+        {
+            Callback(false);
         }
+
+        return;
     }
-    catch (const std::exception&)
+
+    if (WakeSendThread)
     {
-        LogSystem.LogMsg(csp::common::LogLevel::Error, "Error: Failed to send data to socket.");
+        SendCondition.notify_one();
     }
+}
 
-    Callback(Succeeded);
+bool CSPWebSocketClientPOCO::IsSendBackPressured() const { return QueuedSendBytes.load() > SendQueueByteBudget.load(); }
+
+void CSPWebSocketClientPOCO::SetSendCoalescingWindow(std::chrono::microseconds Window)
+{
+    std::scoped_lock<std::mutex> SendLocker(SendMutex);
+    SendCoalescingWindow = Window;
 }
 
+void CSPWebSocketClientPOCO::SetSendQueueByteBudget(size_t Budget) { SendQueueByteBudget = Budget; }
+
 void CSPWebSocketClientPOCO::Receive(ReceiveHandler Callback)
 {
     CSP_PROFILE_SCOPED();
@@ -215,8 +271,14 @@ void CSPWebSocketClientPOCO::Receive(ReceiveHandler Callback)
     {
         assert(PocoWebSocket && "Web socket not created! Please call Start() before calling Receive().");
 
-        ReceiveCallback = Callback;
-        ReceiveReady = true;
+        {
+            std::scoped_lock<std::mutex> ReceiveLocker(ReceiveMutex);
+
+            ReceiveCallback = Callback;
+            ReceiveReady = true;
+        }
+
+        ReceiveCondition.notify_one();
     }
     else if (Callback)
     {
@@ -229,204 +291,273 @@ void CSPWebSocketClientPOCO::__CauseFailure() { HandleReceiveError("__CauseFailu
 void CSPWebSocketClientPOCO::ReceiveThreadFunc()
 {
     bool HandshakeReceived = false;
-    auto* Buffer = (char*)std::malloc(INITIAL_BUFFER_SIZE);
-    auto CurrentBufferSize = INITIAL_BUFFER_SIZE;
-    auto CurrentBufferIndex = 0;
-    auto SkipWait = false;
-    auto SocketPollTimeout = Poco::Timespan(1000);
-    auto ShouldRead = true;
+
+    // Anything left over from a previous connection is of no use to this one
+    ReceiveBuffer.Consume(ReceiveBuffer.GetReadableSize());
 
     for (;;)
     {
         CSP_PROFILE_SCOPED();
 
+        // SignalR asks for one delivery at a time, usually from within the previous delivery's callback
+        {
+            std::unique_lock<std::mutex> ReceiveLocker(ReceiveMutex);
+            ReceiveCondition.wait(ReceiveLocker, [this]() { return ReceiveReady || StopFlag; });
+        }
+
         if (StopFlag)
         {
             return;
         }
 
-        if (!SkipWait)
+        size_t DeliverySize = 0;
+
+        try
         {
-            while (!ReceiveReady)
+            // Keep reading until there is something complete to hand over. A frame may hold many messages, or only part of one.
+            for (;;)
             {
-                std::this_thread::sleep_for(500ns);
+                if (HandshakeReceived)
+                {
+                    size_t MessageCount = 0;
+                    DeliverySize = ReceiveBuffer.FindCompleteMessages(MAX_RECEIVE_FRAME_SIZE, MessageCount);
+                }
+                else
+                {
+                    // Handshake needs to be handled differently as it is in JSON format
+                    DeliverySize = ReceiveBuffer.FindHandshake();
+                }
 
-                if (StopFlag)
+                if (DeliverySize > 0)
+                {
+                    break;
+                }
+
+                if (ReceiveFrame() == false)
                 {
                     return;
                 }
             }
         }
+        catch (const std::exception& e)
+        {
+            HandleReceiveError(e.what());
 
-        SkipWait = false;
+            return;
+        }
 
-        if (ShouldRead)
+        if (StopFlag)
         {
-            // Resize buffer if needed
-            if (CurrentBufferIndex + RECEIVE_BLOCK_SIZE > CurrentBufferSize)
-            {
-                auto* NewBuffer = std::realloc(Buffer, CurrentBufferSize * 2);
-                Buffer = static_cast<char*>(NewBuffer);
-                CurrentBufferSize = CurrentBufferSize * 2;
-                LogSystem.LogMsg(csp::common::LogLevel::Log, fmt::format("Resizing receive buffer to {}", CurrentBufferSize).c_str());
-            }
+            return;
+        }
 
-            try
-            {
-                while (!PocoWebSocket->poll(SocketPollTimeout, Poco::Net::WebSocket::SELECT_READ))
-                {
-                    std::this_thread::sleep_for(500ns);
+        // Every complete message goes over in the one delivery, SignalR's hub protocol parses them all out of it in turn.
+        // DeliveryBuffer keeps its capacity between deliveries, so this is a copy, but not an allocation.
+        DeliveryBuffer.assign(ReceiveBuffer.GetReadPointer(), DeliverySize);
+        ReceiveBuffer.Consume(DeliverySize);
+        HandshakeReceived = true;
 
-                    if (StopFlag)
-                    {
-                        return;
-                    }
-                }
-            }
-            catch (const std::exception& e)
-            {
-                std::free(Buffer);
-                HandleReceiveError(e.what());
+        ReceiveHandler Callback;
 
-                return;
-            }
+        {
+            std::scoped_lock<std::mutex> ReceiveLocker(ReceiveMutex);
 
-            int Flags;
-            int Received = 0;
+            ReceiveReady = false;
+            Callback = ReceiveCallback;
+        }
+
+        Callback(DeliveryBuffer, true);
+    }
+}
 
-            try
+bool CSPWebSocketClientPOCO::ReceiveFrame()
+{
+    try
+    {
+        while (!PocoWebSocket->poll(SOCKET_POLL_TIMEOUT, Poco::Net::WebSocket::SELECT_READ))
+        {
+            if (StopFlag)
             {
-                Received = PocoWebSocket->receiveFrame(Buffer + CurrentBufferIndex, RECEIVE_BLOCK_SIZE, Flags);
+                return false;
             }
-            catch (const std::exception& e)
-            {
-                std::free(Buffer);
-                HandleReceiveError(e.what());
+        }
+    }
+    catch (const std::exception& e)
+    {
+        HandleReceiveError(e.what());
 
-                return;
-            }
+        return false;
+    }
 
-            if (Received == 0)
-            {
-                std::free(Buffer);
-                HandleReceiveError("Error: Socket closed by remote host.");
+    const size_t PreviousCapacity = ReceiveBuffer.GetCapacity();
 
-                return;
-            }
+    // Frames are appended straight into the receive buffer. Making room for a typical frame up front keeps the buffer growing
+    // geometrically, rather than by exactly one frame at a time if frames are larger than the free space.
+    ReceiveBuffer.Reserve(RECEIVE_BLOCK_SIZE);
 
-            assert(!(Flags & Poco::Net::WebSocket::FrameOpcodes::FRAME_OP_TEXT) && "The JSON hub protocol is currently not supported!");
+    int Flags = 0;
+    int Received = 0;
 
-            if (Flags & Poco::Net::WebSocket::FrameOpcodes::FRAME_OP_CLOSE)
-            {
-                std::free(Buffer);
-                HandleReceiveError("Error: Socket closed.");
+    try
+    {
+        Received = PocoWebSocket->receiveFrame(ReceiveBuffer.GetStorage(), Flags);
+    }
+    catch (const std::exception& e)
+    {
+        HandleReceiveError(e.what());
 
-                return;
-            }
+        return false;
+    }
 
-            CurrentBufferIndex += Received;
-        }
+    if (ReceiveBuffer.GetCapacity() != PreviousCapacity)
+    {
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Log, "Resizing receive buffer to {}", ReceiveBuffer.GetCapacity());
+    }
 
-        if (StopFlag)
-        {
-            return;
-        }
+    // Poco reports a closed connection as an empty frame with no flags
+    if (Received == 0 && Flags == 0)
+    {
+        HandleReceiveError("Error: Socket closed by remote host.");
+
+        return false;
+    }
+
+    const int Opcode = Flags & Poco::Net::WebSocket::FrameOpcodes::FRAME_OP_BITMASK;
+
+    assert(Opcode != Poco::Net::WebSocket::FrameOpcodes::FRAME_OP_TEXT && "The JSON hub protocol is currently not supported!");
 
-        // Handshake needs to be handled differently as it is in JSON format
-        if (!HandshakeReceived)
+    if (Opcode == Poco::Net::WebSocket::FrameOpcodes::FRAME_OP_CLOSE)
+    {
+        HandleReceiveError("Error: Socket closed.");
+
+        return false;
+    }
+
+    if (Opcode == Poco::Net::WebSocket::FrameOpcodes::FRAME_OP_PING || Opcode == Poco::Net::WebSocket::FrameOpcodes::FRAME_OP_PONG)
+    {
+        // Control frame payloads aren't part of the message stream
+        ReceiveBuffer.Truncate(static_cast<size_t>(Received));
+    }
+
+    return true;
+}
+
+void CSPWebSocketClientPOCO::SendThreadFunc()
+{
+    for (;;)
+    {
         {
-            int i;
+            std::unique_lock<std::mutex> SendLocker(SendMutex);
+            SendCondition.wait(SendLocker, [this]() { return SendQueue.empty() == false || SendStopFlag; });
 
-            for (i = 0; i < CurrentBufferIndex; ++i)
+            if (SendQueue.empty())
             {
-                // JSON messages are terminated with the 0x1E character
-                if (Buffer[i] == 0x1E)
-                {
-                    break;
-                }
+                return;
             }
 
-            // Read more data if we haven't found the message terminator yet
-            if (i == CurrentBufferIndex)
+            // Give anything else sent within the window the chance to go out in the same frame
+            if (SendCoalescingWindow.count() > 0 && SendStopFlag == false)
             {
-                SkipWait = true;
-                ShouldRead = true;
-                continue;
+                SendCondition.wait_for(
+                    SendLocker, SendCoalescingWindow, [this]() { return SendStopFlag || QueuedSendBytes.load() >= MAX_COALESCED_FRAME_SIZE; });
             }
 
-            std::string CallbackMessage(Buffer, i + 1);
+            size_t BatchBytes = 0;
 
-            if (i < (CurrentBufferIndex - (i + 1)))
-            {
-                auto Remaining = CurrentBufferIndex - (i + 1);
-                memmove(Buffer, Buffer + i + 1, Remaining);
-                CurrentBufferIndex = Remaining;
-                ShouldRead = false;
-            }
-            else
+            while (SendQueue.empty() == false
+                && (SendBatch.empty() || BatchBytes + SendQueue.front().Message.size() <= MAX_COALESCED_FRAME_SIZE))
             {
-                CurrentBufferIndex = 0;
-                ShouldRead = true;
+                BatchBytes += SendQueue.front().Message.size();
+                SendBatch.push_back(std::move(SendQueue.front()));
+                SendQueue.pop_front();
             }
 
-            HandshakeReceived = true;
-            ReceiveReady = false;
-            ReceiveCallback(CallbackMessage, true);
-
-            continue;
+            QueuedSendBytes -= BatchBytes;
         }
 
-        /*
-         * TODO: Make sure we have enough bytes for length
-         * Max number of bytes for message length is 5. Let's ensure we have at least 5 before we try to read length.
-         */
+        CSP_PROFILE_SCOPED();
 
-        auto Length = 0;
-        int i;
+        // SignalR's binary protocol length prefixes every message, so a run of them can share one frame
+        const std::string* Frame = &SendBatch.front().Message;
 
-        for (i = 0; i < 5; ++i)
+        if (SendBatch.size() > 1)
         {
-            Length |= (Buffer[i] & 0x7F) << (i * 7);
+            SendBuffer.clear();
 
-            if ((Buffer[i] & 0x80) == 0)
+            for (const PendingSend& Pending : SendBatch)
             {
-                ++i;
-                break;
+                SendBuffer.append(Pending.Message);
             }
+
+            Frame = &SendBuffer;
         }
 
-        // Continue reading if we don't have the entire message yet
-        if (Length > CurrentBufferIndex - i)
+        bool Succeeded = true;
+
+        try
         {
-            SkipWait = true;
-            ShouldRead = true;
-            continue;
+            // Assume binary as we don't support JSON anymore
+            PocoWebSocket->sendFrame(Frame->data(), static_cast<int>(Frame->size()), Poco::Net::WebSocket::SendFlags::FRAME_BINARY);
+        }
+        catch (const std::exception&)
+        {
+            LogSystem.LogMsg(csp::common::LogLevel::Error, "Error: Failed to send data to socket.");
+            Succeeded = false;
         }
 
-        /*
-         * TODO: Look into modifying SignalR to process byte arrays instead of strings, and re-use a buffer for holding the
-         *  message to be processed
-         */
-        std::string CallbackMessage(Buffer, Length + i);
-        ReceiveReady = false;
+        for (PendingSend& Pending : SendBatch)
+        {
+            if (Pending.Callback)
+            {
+                Pending.Callback(Succeeded);
+            }
+        }
+
+        SendBatch.clear();
+    }
+}
+
+void CSPWebSocketClientPOCO::StopSendThread()
+{
+    const bool OnSendThread = std::this_thread::get_id() == SendThread.get_id();
+    std::deque<PendingSend> Unsent;
+
+    {
+        std::scoped_lock<std::mutex> SendLocker(SendMutex);
+        SendStopFlag = true;
 
-        // Move remaining data to beginning of buffer
-        if (Length < CurrentBufferIndex - i)
+        // Called from a send callback, so the socket is about to be closed without waiting for the send thread. Anything still
+        // queued can't be sent.
+        if (OnSendThread)
         {
-            auto Remaining = (CurrentBufferIndex - i) - Length;
-            memmove(Buffer, Buffer + Length + i, Remaining);
-            CurrentBufferIndex = Remaining;
-            // If we have remaining data, we should try to process it the next time Receive is called without reading from the socket
-            ShouldRead = false;
+            Unsent.swap(SendQueue);
+            QueuedSendBytes = 0;
         }
-        else
+    }
+
+    SendCondition.notify_all();
+
+    for (PendingSend& Pending : Unsent)
+    {
+        if (Pending.Callback)
         {
-            CurrentBufferIndex = 0;
-            ShouldRead = true;
+            Pending.Callback(false);
         }
+    }
 
-        auto Callback = ReceiveCallback;
-        Callback(CallbackMessage, true);
+    // Called from a send callback, the thread exits as soon as the callback returns, as nothing is left queued. It can't join itself,
+    // so is joined from the owner's thread, by Start or the destructor.
+    if (OnSendThread == false)
+    {
+        JoinSendThread();
+    }
+}
+
+void CSPWebSocketClientPOCO::JoinSendThread()
+{
+    if (SendThread.joinable() && std::this_thread::get_id() != SendThread.get_id())
+    {
+        SendThread.join();
     }
 }
 
@@ -434,11 +565,20 @@ void CSPWebSocketClientPOCO::HandleReceiveError(const std::string& Message)
 {
     LogSystem.LogMsg(csp::common::LogLevel::Error, Message.c_str());
 
-    if (ReceiveCallback)
+    // Receive may be setting the callback from another thread, so take it under the lock, and call it outside of it.
+    ReceiveHandler Callback;
+
     {
-        ReceiveCallback("", false);
+        std::scoped_lock<std::mutex> ReceiveLocker(ReceiveMutex);
+
+        Callback = std::move(ReceiveCallback);
         ReceiveCallback = nullptr;
     }
+
+    if (Callback)
+    {
+        Callback("", false);
+    }
 }
 
 } // namespace csp::multiplayer
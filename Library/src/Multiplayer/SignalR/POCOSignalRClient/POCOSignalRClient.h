@@ -17,14 +17,20 @@
 
 #ifndef CSP_WASM
 
+#include "Multiplayer/SignalR/POCOSignalRClient/ReceiveRingBuffer.h"
 #include "Multiplayer/WebSocketClient.h"
 
 #include <Poco/Net/WebSocket.h>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <mutex>
 #include <signalrclient/hub_exception.h>
 #include <signalrclient/signalr_client_config.h>
+#include <string>
 #include <thread>
+#include <vector>
 
 namespace csp::common
 {
@@ -45,6 +51,15 @@ public:
     void Stop(CallbackHandler Callback) override;
     void Send(const std::string& Message, CallbackHandler Callback) override;
     void Receive(ReceiveHandler Callback) override;
+    bool IsSendBackPressured() const override;
+
+    /// Messages sent within this long of each other are written to the socket as a single frame. Zero sends each as soon as it is queued.
+    static constexpr std::chrono::microseconds DEFAULT_SEND_COALESCING_WINDOW = std::chrono::microseconds(2000);
+    /// Queued bytes past which the client reports back pressure.
+    static constexpr size_t DEFAULT_SEND_QUEUE_BYTE_BUDGET = 256 * 1024;
+
+    void SetSendCoalescingWindow(std::chrono::microseconds Window);
+    void SetSendQueueByteBudget(size_t Budget);
 
     void __CauseFailure() override;
 
@@ -61,16 +76,51 @@ public:
 
 private:
     void ReceiveThreadFunc();
+    // Blocks until the next frame has been appended to ReceiveBuffer. Returns false if the socket failed or was closed, or we were stopped.
+    bool ReceiveFrame();
     void HandleReceiveError(const std::string& Message);
+    void SendThreadFunc();
+    // Stops the send thread, after it has written anything already queued. When called from the send thread itself, only asks it to stop.
+    void StopSendThread();
+    // Waits for a stopped send thread to exit. Does nothing if there is no thread, or if called from the send thread.
+    void JoinSendThread();
 
     Poco::Net::WebSocket* PocoWebSocket;
 
     std::thread ReceiveThread;
     std::mutex Mutex;
-    std::atomic_bool ReceiveReady;
+
+    // Guards ReceiveReady and ReceiveCallback, which Receive sets to ask the receive thread for the next batch of messages.
+    std::mutex ReceiveMutex;
+    std::condition_variable ReceiveCondition;
+    bool ReceiveReady;
     ReceiveHandler ReceiveCallback;
     std::atomic_bool StopFlag;
 
+    // Only touched by the receive thread.
+    ReceiveRingBuffer ReceiveBuffer;
+    std::string DeliveryBuffer;
+
+    struct PendingSend
+    {
+        std::string Message;
+        CallbackHandler Callback;
+    };
+
+    // Sends are queued here and written out by the send thread, so callers never block on the socket.
+    std::thread SendThread;
+    std::mutex SendMutex;
+    std::condition_variable SendCondition;
+    std::deque<PendingSend> SendQueue;
+    std::atomic<size_t> QueuedSendBytes;
+    bool SendStopFlag;
+    std::chrono::microseconds SendCoalescingWindow;
+    std::atomic<size_t> SendQueueByteBudget;
+
+    // Only touched by the send thread.
+    std::vector<PendingSend> SendBatch;
+    std::string SendBuffer;
+
     std::string MultiplayerUri;
     std::string AccessToken;
     std::string DeviceId;
@@ -0,0 +1,154 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CSP_WASM
+
+#include "Multiplayer/SignalR/POCOSignalRClient/ReceiveRingBuffer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace csp::multiplayer
+{
+
+ReceiveRingBuffer::ReceiveRingBuffer(size_t InitialCapacity)
+    : Storage(std::max<size_t>(InitialCapacity, 1))
+    , ReadOffset(0)
+{
+    Storage.resize(0);
+}
+
+void ReceiveRingBuffer::Reserve(size_t MinFree)
+{
+    if (Storage.capacity() - Storage.size() >= MinFree)
+    {
+        return;
+    }
+
+    if (ReadOffset > 0)
+    {
+        const size_t Unread = GetReadableSize();
+        std::memmove(Storage.begin(), Storage.begin() + ReadOffset, Unread);
+        Storage.resize(Unread);
+        ReadOffset = 0;
+    }
+
+    if (Storage.capacity() - Storage.size() < MinFree)
+    {
+        Storage.setCapacity(std::max(Storage.capacity() * 2, Storage.size() + MinFree));
+    }
+}
+
+Poco::Buffer<char>& ReceiveRingBuffer::GetStorage() { return Storage; }
+
+void ReceiveRingBuffer::Append(const char* Data, size_t Size)
+{
+    Reserve(Size);
+    Storage.append(Data, Size);
+}
+
+const char* ReceiveRingBuffer::GetReadPointer() const { return Storage.begin() + ReadOffset; }
+
+size_t ReceiveRingBuffer::GetReadableSize() const { return Storage.size() - ReadOffset; }
+
+size_t ReceiveRingBuffer::GetCapacity() const { return Storage.capacity(); }
+
+void ReceiveRingBuffer::Consume(size_t Size)
+{
+    ReadOffset += std::min(Size, GetReadableSize());
+
+    // Nothing left to read, so the next write can start from the front again without moving anything.
+    if (ReadOffset == Storage.size())
+    {
+        Storage.resize(0);
+        ReadOffset = 0;
+    }
+}
+
+void ReceiveRingBuffer::Truncate(size_t Size) { Storage.resize(Storage.size() - std::min(Size, GetReadableSize())); }
+
+size_t ReceiveRingBuffer::FindHandshake() const
+{
+    const char* Data = GetReadPointer();
+    const void* Terminator = std::memchr(Data, 0x1E, GetReadableSize());
+
+    if (Terminator == nullptr)
+    {
+        return 0;
+    }
+
+    return static_cast<const char*>(Terminator) - Data + 1;
+}
+
+size_t ReceiveRingBuffer::FindCompleteMessages(size_t MaxMessageSize, size_t& OutMessageCount) const
+{
+    const unsigned char* Data = reinterpret_cast<const unsigned char*>(GetReadPointer());
+    const size_t Size = GetReadableSize();
+
+    size_t Offset = 0;
+    OutMessageCount = 0;
+
+    while (Offset < Size)
+    {
+        size_t Length = 0;
+        size_t PrefixSize = 0;
+        bool PrefixComplete = false;
+
+        while (PrefixSize < MAX_LENGTH_PREFIX_SIZE && Offset + PrefixSize < Size)
+        {
+            const unsigned char Byte = Data[Offset + PrefixSize];
+            Length |= static_cast<size_t>(Byte & 0x7F) << (PrefixSize * 7);
+            ++PrefixSize;
+
+            if ((Byte & 0x80) == 0)
+            {
+                PrefixComplete = true;
+                break;
+            }
+        }
+
+        if (PrefixComplete == false)
+        {
+            if (PrefixSize == MAX_LENGTH_PREFIX_SIZE)
+            {
+                throw std::runtime_error("Error: Malformed SignalR message length prefix.");
+            }
+
+            // The rest of the prefix hasn't arrived yet.
+            break;
+        }
+
+        if (Length > MaxMessageSize)
+        {
+            throw std::runtime_error("Error: SignalR message length exceeds the maximum receive size.");
+        }
+
+        if (Size - Offset - PrefixSize < Length)
+        {
+            break;
+        }
+
+        Offset += PrefixSize + Length;
+        ++OutMessageCount;
+    }
+
+    return Offset;
+}
+
+} // namespace csp::multiplayer
+
+#endif
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#ifndef CSP_WASM
+
+#include <Poco/Buffer.h>
+
+#include <cstddef>
+
+namespace csp::multiplayer
+{
+
+/// @brief Reusable receive buffer for the SignalR websocket, which frames can be received straight into, and messages read straight out of.
+///
+/// Received bytes are appended at the write end and consumed from the read end. When the write end runs out of room, the unread bytes
+/// (at most one partial message, as complete messages are consumed as soon as they are found) wrap back round to the front, so the
+/// storage only grows when a single message doesn't fit. Everything readable is always contiguous, so a run of messages can be handed
+/// on as a single block.
+///
+/// The storage is a Poco::Buffer, so that Poco's WebSocket::receiveFrame can append a frame of any size to it directly.
+class ReceiveRingBuffer
+{
+public:
+    /// Most bytes a SignalR binary message length prefix can take up.
+    static constexpr size_t MAX_LENGTH_PREFIX_SIZE = 5;
+
+    explicit ReceiveRingBuffer(size_t InitialCapacity);
+
+    /// @brief Make sure at least MinFree bytes can be appended without reallocating, wrapping any unread bytes to the front first.
+    void Reserve(size_t MinFree);
+
+    /// @brief The storage to append received bytes to. Anything appended becomes readable.
+    Poco::Buffer<char>& GetStorage();
+
+    void Append(const char* Data, size_t Size);
+
+    [[nodiscard]] const char* GetReadPointer() const;
+    [[nodiscard]] size_t GetReadableSize() const;
+    [[nodiscard]] size_t GetCapacity() const;
+
+    /// @brief Mark Size bytes at the read end as handled.
+    void Consume(size_t Size);
+
+    /// @brief Drop Size bytes from the write end, e.g. the payload of a control frame that was appended.
+    void Truncate(size_t Size);
+
+    /// @brief Finds the JSON handshake response, which is terminated with 0x1E.
+    /// @return The size of the handshake including its terminator, or 0 if it hasn't all been received yet.
+    [[nodiscard]] size_t FindHandshake() const;
+
+    /// @brief Finds the run of complete varint length prefixed messages at the read end, in a single pass.
+    /// @param MaxMessageSize The largest message length a prefix may declare. Anything larger is rejected as soon as its prefix arrives,
+    /// rather than buffering frames until a message that big completes.
+    /// @param OutMessageCount The number of complete messages found.
+    /// @return The size of the run of complete messages, prefixes included, or 0 if there isn't a complete message yet.
+    /// @throws std::runtime_error if a length prefix is malformed or declares more than MaxMessageSize, as the stream can't be recovered
+    /// from that.
+    [[nodiscard]] size_t FindCompleteMessages(size_t MaxMessageSize, size_t& OutMessageCount) const;
+
+private:
+    Poco::Buffer<char> Storage;
+    size_t ReadOffset;
+};
+
+} // namespace csp::multiplayer
+
+#endif
@@ -18,6 +18,7 @@
 #include "CSP/CSPFoundation.h"
 #include "CSP/Common/Systems/Log/LogSystem.h"
 #include "CSP/Common/Interfaces/IAuthContext.h"
+#include "Common/Systems/Log/LogFormat.h"
 #include "SignalRClient.h"
 #include <fmt/format.h>
 #include <memory>
@@ -130,8 +131,8 @@ bool SignalRConnection::On(const std::string& EventName, const SignalRConnection
     {
         // If you register an event twice, you'll throw. Very hard to debug if this happens off thread, which it does with re-logging in.
         // Not really an error though, expected behaviour for our flow, just log to help in debugability
-        LogSystem.LogMsg(csp::common::LogLevel::Verbose,
-            fmt::format("Caught SignalR error, ignoring 'On' registration for {}. : {}", EventName, exception.what()).c_str());
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Verbose, "Caught SignalR error, ignoring 'On' registration for {}. : {}", EventName,
+            exception.what());
         return false;
     }
 }
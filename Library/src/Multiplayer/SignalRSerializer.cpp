@@ -13,7 +13,7 @@ void SignalRSerializer::EndWriteArray()
 
     auto ArrayObject = std::move(Stack.top());
     Stack.pop();
-    FinalizeContainerSerialization(signalr::value { std::get<std::vector<signalr::value>>(ArrayObject) });
+    FinalizeContainerSerialization(signalr::value { std::move(std::get<std::vector<signalr::value>>(ArrayObject)) });
 }
 
 void SignalRSerializer::StartWriteStringMap() { Stack.push(std::map<std::string, signalr::value> {}); }
@@ -27,7 +27,7 @@ void SignalRSerializer::EndWriteStringMap()
 
     auto StringMapObject = std::move(Stack.top());
     Stack.pop();
-    FinalizeContainerSerialization(signalr::value { std::get<std::map<std::string, signalr::value>>(StringMapObject) });
+    FinalizeContainerSerialization(signalr::value { std::move(std::get<std::map<std::string, signalr::value>>(StringMapObject)) });
 }
 
 void SignalRSerializer::StartWriteUintMap() { Stack.push(std::map<uint64_t, signalr::value> {}); }
@@ -41,7 +41,7 @@ void SignalRSerializer::EndWriteUintMap()
 
     auto UintMapObject = std::move(Stack.top());
     Stack.pop();
-    FinalizeContainerSerialization(signalr::value { std::get<std::map<uint64_t, signalr::value>>(UintMapObject) });
+    FinalizeContainerSerialization(signalr::value { std::move(std::get<std::map<uint64_t, signalr::value>>(UintMapObject)) });
 }
 
 signalr::value SignalRSerializer::Get() const
@@ -84,7 +84,7 @@ void SignalRSerializer::FinalizeContainerSerialization(signalr::value&& Serializ
     if (Stack.size() == 0)
     {
         // If the last element has been popped, push back a root value.
-        Stack.push(SerializedContainer);
+        Stack.push(std::move(SerializedContainer));
         return;
     }
 
@@ -95,17 +95,18 @@ void SignalRSerializer::FinalizeContainerSerialization(signalr::value&& Serializ
 
 void SignalRSerializer::FinalizeContainerSerializationInternal(std::vector<signalr::value>& Container, signalr::value&& SerializedContainer)
 {
-    Container.push_back(SerializedContainer);
+    Container.push_back(std::move(SerializedContainer));
 }
 
 SignalRDeserializer::SignalRDeserializer(const signalr::value& Object)
-    : Root { Object }
+    : Root { &Object }
 {
     ObjectStack.push(nullptr);
 }
 
 SignalRDeserializer::SignalRDeserializer(signalr::value&& Object)
-    : Root { std::move(Object) }
+    : OwnedRoot { std::move(Object) }
+    , Root { &OwnedRoot }
 {
     ObjectStack.push(nullptr);
 }
@@ -197,7 +198,7 @@ const signalr::value& SignalRDeserializer::ReadNextValue() const
     }
     else if (std::holds_alternative<std::nullptr_t>(ObjectStack.top()))
     {
-        return Root;
+        return *Root;
     }
     else
     {
@@ -235,7 +236,7 @@ void SignalRDeserializer::EndReadStringMapInternal()
     ObjectStack.pop();
 }
 
-const std::pair<std::uint64_t, signalr::value> SignalRDeserializer::ReadNextUintKeyValue() const
+const std::pair<const std::uint64_t, signalr::value>& SignalRDeserializer::ReadNextUintKeyValue() const
 {
     if (std::holds_alternative<std::map<uint64_t, signalr::value>::const_iterator>(ObjectStack.top()) == false)
     {
@@ -245,7 +246,7 @@ const std::pair<std::uint64_t, signalr::value> SignalRDeserializer::ReadNextUint
     return *std::get<std::map<uint64_t, signalr::value>::const_iterator>(ObjectStack.top());
 }
 
-const std::pair<std::string, signalr::value> SignalRDeserializer::ReadNextStringKeyValue() const
+const std::pair<const std::string, signalr::value>& SignalRDeserializer::ReadNextStringKeyValue() const
 {
     if (std::holds_alternative<std::map<std::string, signalr::value>::const_iterator>(ObjectStack.top()) == false)
     {
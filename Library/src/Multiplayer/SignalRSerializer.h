@@ -39,6 +39,7 @@ class ISignalRSerializable;
 ///     - Doubles
 ///     - Floats
 ///     - String
+///     - String views (write only)
 ///     - Null pointers (represents null)
 ///     - Optionals
 ///     - Vectors
@@ -140,8 +141,8 @@ private:
 class SignalRDeserializer
 {
 public:
-    /// @brief Constructor used to copy object to deserialize.
-    /// @param Object const signalr::value& : The value to deserialize
+    /// @brief Constructor used to deserialize an object in place, without copying it.
+    /// @param Object const signalr::value& : The value to deserialize. Must outlive the deserializer.
     /// This should match the structure generated by the SignalRSerializer.
     SignalRDeserializer(const signalr::value& Object);
 
@@ -150,6 +151,10 @@ public:
     /// This should match the structure generated by the SignalRSerializer.
     SignalRDeserializer(signalr::value&& Object);
 
+    // Root may point at OwnedRoot, so copying would leave the copy reading from the original.
+    SignalRDeserializer(const SignalRDeserializer&) = delete;
+    SignalRDeserializer& operator=(const SignalRDeserializer&) = delete;
+
     /// @brief Reads a value from the internal signalr array.
     /// @pre This function should be used if this serializer represents a single value,
     /// or if StartReadArray is called first to write to the array.
@@ -223,8 +228,8 @@ private:
     void EndReadUintMapInternal();
     void EndReadStringMapInternal();
 
-    const std::pair<std::uint64_t, signalr::value> ReadNextUintKeyValue() const;
-    const std::pair<std::string, signalr::value> ReadNextStringKeyValue() const;
+    const std::pair<const std::uint64_t, signalr::value>& ReadNextUintKeyValue() const;
+    const std::pair<const std::string, signalr::value>& ReadNextStringKeyValue() const;
 
     // Reads the specified type from the given signalr object.
     // This internally calls the ReadValueFromObjectInternal for the given type.
@@ -252,7 +257,9 @@ private:
     using Iterator = std::variant<std::nullptr_t, std::vector<signalr::value>::const_iterator, std::map<uint64_t, signalr::value>::const_iterator,
         std::map<std::string, signalr::value>::const_iterator>;
 
-    signalr::value Root;
+    // Only used when constructed from an rvalue, otherwise Root points at the caller's value.
+    signalr::value OwnedRoot;
+    const signalr::value* Root;
     std::stack<Iterator> ObjectStack;
 };
 
@@ -310,12 +317,12 @@ std::enable_if_t<IsUnsignedIntegerV<K> && IsSupportedSignalRType<T>::value> Sign
     WriteValue(Value);
 
     // Get our pair from the top of the stack and pop
-    std::pair<uint64_t, signalr::value> Pair = std::get<std::pair<uint64_t, signalr::value>>(Stack.top());
+    std::pair<uint64_t, signalr::value> Pair = std::move(std::get<std::pair<uint64_t, signalr::value>>(Stack.top()));
     Stack.pop();
 
     // Get our map from the top of the stack and append the pair
     std::map<uint64_t, signalr::value>& Map = std::get<std::map<uint64_t, signalr::value>>(Stack.top());
-    Map[Pair.first] = Pair.second;
+    Map[Pair.first] = std::move(Pair.second);
 }
 
 template <typename T> std::enable_if_t<IsSupportedSignalRType<T>::value> SignalRSerializer::WriteKeyValue(std::string Key, const T& Value)
@@ -331,12 +338,12 @@ template <typename T> std::enable_if_t<IsSupportedSignalRType<T>::value> SignalR
     WriteValue(Value);
 
     // Get our pair from the top of the stack and pop.
-    std::pair<std::string, signalr::value> Pair = std::get<std::pair<std::string, signalr::value>>(Stack.top());
+    std::pair<std::string, signalr::value> Pair = std::move(std::get<std::pair<std::string, signalr::value>>(Stack.top()));
     Stack.pop();
 
     // Get our map from the top of the stack and append the pair.
     std::map<std::string, signalr::value>& Map = std::get<std::map<std::string, signalr::value>>(Stack.top());
-    Map[Pair.first] = Pair.second;
+    Map[Pair.first] = std::move(Pair.second);
 }
 
 template <typename T> inline void SignalRSerializer::FinalizeContainerSerializationInternal(T&, signalr::value&&)
@@ -347,7 +354,7 @@ template <typename T> inline void SignalRSerializer::FinalizeContainerSerializat
 template <typename K>
 inline void SignalRSerializer::FinalizeContainerSerializationInternal(std::pair<K, signalr::value>& Pair, signalr::value&& SerializedContainer)
 {
-    Pair.second = SerializedContainer;
+    Pair.second = std::move(SerializedContainer);
 }
 
 template <typename T> inline void SignalRSerializer::WriteValueInternal(const T& Value)
@@ -443,6 +450,10 @@ template <typename T> inline signalr::value SignalRSerializer::CreateSignalRObje
     {
         return signalr::value { static_cast<uint64_t>(Value) };
     }
+    else if constexpr (std::is_same_v<T, std::string_view>)
+    {
+        return signalr::value { Value.data(), Value.size() };
+    }
     else
     {
         return signalr::value { Value };
@@ -460,7 +471,7 @@ template <typename T> std::enable_if_t<IsSupportedSignalRType<T>::value> SignalR
 template <typename K, typename T>
 std::enable_if_t<IsUnsignedIntegerV<K> && IsSupportedSignalRType<T>::value> SignalRDeserializer::ReadKeyValue(std::pair<K, T>& OutVal)
 {
-    const std::pair<uint64_t, signalr::value>& Next = ReadNextUintKeyValue();
+    const std::pair<const uint64_t, signalr::value>& Next = ReadNextUintKeyValue();
 
     OutVal.first = static_cast<K>(Next.first);
     ReadValueFromObject(Next.second, OutVal.second);
@@ -470,7 +481,7 @@ std::enable_if_t<IsUnsignedIntegerV<K> && IsSupportedSignalRType<T>::value> Sign
 
 template <typename T> std::enable_if_t<IsSupportedSignalRType<T>::value> SignalRDeserializer::ReadKeyValue(std::pair<std::string, T>& OutVal)
 {
-    const std::pair<std::string, signalr::value>& Next = ReadNextStringKeyValue();
+    const std::pair<const std::string, signalr::value>& Next = ReadNextStringKeyValue();
 
     OutVal.first = Next.first;
     ReadValueFromObject(Next.second, OutVal.second);
@@ -563,7 +574,7 @@ template <typename K, typename T> inline void SignalRDeserializer::ReadValueFrom
     {
         std::pair<K, T> Pair;
         ReadKeyValue(Pair);
-        OutVal[Pair.first] = Pair.second;
+        OutVal[Pair.first] = std::move(Pair.second);
     }
 
     EndReadUintMapInternal();
@@ -578,7 +589,7 @@ template <typename T> inline void SignalRDeserializer::ReadValueFromObjectIntern
     {
         std::pair<std::string, T> Pair;
         ReadKeyValue(Pair);
-        OutVal[Pair.first] = Pair.second;
+        OutVal[std::move(Pair.first)] = std::move(Pair.second);
     }
 
     EndReadStringMapInternal();
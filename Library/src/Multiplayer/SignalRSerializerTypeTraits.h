@@ -19,6 +19,7 @@
 #include <signalrclient/signalr_value.h>
 
 #include <optional>
+#include <string_view>
 #include <type_traits>
 #include <variant>
 #include <vector>
@@ -71,6 +72,7 @@ template <typename T> constexpr bool IsCustomDeserializableV = std::is_base_of_v
 // Supported types ------------------------------------------------------------------------------------------------
 
 // All supported basic types our serializer supports.
+// String views can be written, but not read, as the view would point into the value being deserialized.
 // clang-format off
 template <typename T>
 constexpr bool IsSupportedSignalRBasicType = 
@@ -79,6 +81,7 @@ constexpr bool IsSupportedSignalRBasicType =
     std::is_same_v<T, float> ||
     std::is_same_v<T, bool> || 
     std::is_same_v<T, std::string> || 
+    std::is_same_v<T, std::string_view> ||
     std::is_same_v<T, std::nullptr_t> ||
     std::is_base_of_v<ISignalRSerializable, T> ||
     std::is_base_of_v<ISignalRDeserializable, T>;
@@ -47,6 +47,9 @@
 #include "CSP/Multiplayer/OfflineRealtimeEngine.h"
 #include "CSP/Multiplayer/OnlineRealtimeEngine.h"
 #include "CSP/Multiplayer/Script/EntityScript.h"
+#include "Common/Systems/Log/LogFormat.h"
+#include "Debug/Profiler.h"
+#include "Multiplayer/ComponentPropertyIndex.h"
 #include "Multiplayer/ComponentSchemaRegistry.h"
 #include "Multiplayer/MCS/MCSTypes.h"
 #include "Multiplayer/MCSComponentPacker.h"
@@ -56,12 +59,16 @@
 #include "Multiplayer/Script/EntityScriptInterface.h"
 #include "Multiplayer/SpaceEntityKeys.h"
 #include "Multiplayer/SpaceEntityStatePatcher.h"
+#include "Multiplayer/TransformBatch.h"
 #include "RealtimeEngineUtils.h"
 #include "signalrclient/signalr_value.h"
 
+#include <algorithm>
 #include <chrono>
-#include <glm/gtc/quaternion.hpp>
+#include <mutex>
 #include <thread>
+#include <utility>
+#include <vector>
 
 using namespace std::chrono;
 
@@ -71,20 +78,6 @@ using namespace std::chrono;
 namespace csp::multiplayer
 {
 
-glm::mat4 computeParentMat4(const SpaceTransform& ParentSpaceTransform)
-{
-    glm::mat4 ParentTranslate = glm::translate(
-        glm::mat4(1.0f), glm::vec3(ParentSpaceTransform.Position.X, ParentSpaceTransform.Position.Y, ParentSpaceTransform.Position.Z));
-    glm::quat ParentOrientation { ParentSpaceTransform.Rotation.W, ParentSpaceTransform.Rotation.X, ParentSpaceTransform.Rotation.Y,
-        ParentSpaceTransform.Rotation.Z };
-
-    glm::mat4 ParentRotation(ParentOrientation);
-    glm::mat4 ParentScale
-        = glm::scale(glm::mat4(1.0f), glm::vec3(ParentSpaceTransform.Scale.X, ParentSpaceTransform.Scale.Y, ParentSpaceTransform.Scale.Z));
-    glm::mat4 ParentTransform = ParentTranslate * ParentRotation * ParentScale;
-    return ParentTransform;
-}
-
 inline uint32_t CheckedUInt64ToUint32(uint64_t Value)
 {
     assert(Value <= UINT32_MAX);
@@ -92,6 +85,28 @@ inline uint32_t CheckedUInt64ToUint32(uint64_t Value)
     return ValueAsUInt32;
 }
 
+namespace
+{
+
+// Guards the cached global transforms of the entities of each realtime engine. Marking a transform dirty reaches down into descendants, and
+// refreshing one reads up through ancestors, so one lock covers a whole hierarchy rather than taking a lock per entity along each branch.
+// Entities are only parented within their own engine, so engines are hashed onto a fixed table of locks, and separate engines rarely contend.
+constexpr size_t GLOBAL_TRANSFORM_LOCK_COUNT = 64;
+std::mutex GlobalTransformMutexes[GLOBAL_TRANSFORM_LOCK_COUNT];
+
+std::mutex& GetGlobalTransformMutexForEngine(const csp::common::IRealtimeEngine* Engine)
+{
+    // Mix the pointer bits, as allocation alignment leaves the low bits of every engine address the same.
+    uint64_t Hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(Engine));
+    Hash ^= Hash >> 33;
+    Hash *= 0xff51afd7ed558ccdULL;
+    Hash ^= Hash >> 33;
+
+    return GlobalTransformMutexes[Hash % GLOBAL_TRANSFORM_LOCK_COUNT];
+}
+
+} // namespace
+
 SpaceEntity::SpaceEntity()
     : EntitySystem(nullptr)
     , Type(SpaceEntityType::Avatar)
@@ -177,39 +192,25 @@ const csp::common::String& SpaceEntity::GetName() const { return Name; }
 
 bool SpaceEntity::SetName(const csp::common::String& Value)
 {
-    return SetProperty(*this, Name, Value, SpaceEntityComponentKey::Name, UPDATE_FLAGS_NAME, LogSystem);
-}
+    const csp::common::String OldName = Name;
+    const bool Updated = SetProperty(*this, Name, Value, SpaceEntityComponentKey::Name, UPDATE_FLAGS_NAME, LogSystem);
 
-const SpaceTransform& SpaceEntity::GetTransform() const { return Transform; }
-
-SpaceTransform SpaceEntity::GetGlobalTransform() const
-{
-    if (Parent != nullptr)
+    // Without a state patcher the name is applied immediately, otherwise this happens when the patch is applied.
+    if (Updated && StatePatcher == nullptr)
     {
-        SpaceTransform GlobalTransform;
-        GlobalTransform.Position = GetGlobalPosition();
-        GlobalTransform.Rotation = GetGlobalRotation();
-        GlobalTransform.Scale = GetGlobalScale();
-        return GlobalTransform;
+        NotifyNameChanged(OldName);
     }
-    return Transform;
+
+    return Updated;
 }
 
-const csp::common::Vector3& SpaceEntity::GetPosition() const { return Transform.Position; }
+const SpaceTransform& SpaceEntity::GetTransform() const { return Transform; }
 
-csp::common::Vector3 SpaceEntity::GetGlobalPosition() const
-{
-    if (Parent != nullptr)
-    {
-        glm::mat4 ParentTransform = computeParentMat4(Parent->GetGlobalTransform());
+SpaceTransform SpaceEntity::GetGlobalTransform() const { return GetCachedGlobalTransform(); }
 
-        glm::vec3 GlobalEntityPosition = ParentTransform * glm::vec4(Transform.Position.X, Transform.Position.Y, Transform.Position.Z, 1.0f);
+const csp::common::Vector3& SpaceEntity::GetPosition() const { return Transform.Position; }
 
-        return { GlobalEntityPosition.x, GlobalEntityPosition.y, GlobalEntityPosition.z };
-    }
-    else
-        return Transform.Position;
-}
+csp::common::Vector3 SpaceEntity::GetGlobalPosition() const { return GetCachedGlobalTransform().Position; }
 
 bool SpaceEntity::SetPosition(const csp::common::Vector3& Value)
 {
@@ -218,20 +219,7 @@ bool SpaceEntity::SetPosition(const csp::common::Vector3& Value)
 
 const csp::common::Vector4& SpaceEntity::GetRotation() const { return Transform.Rotation; }
 
-csp::common::Vector4 SpaceEntity::GetGlobalRotation() const
-{
-    if (Parent != nullptr)
-    {
-        csp::common::Vector4 GlobalRotation = Parent->GetGlobalRotation();
-        glm::quat Orientation { Transform.Rotation.W, Transform.Rotation.X, Transform.Rotation.Y, Transform.Rotation.Z };
-        glm::quat GlobalOrientation(GlobalRotation.W, GlobalRotation.X, GlobalRotation.Y, GlobalRotation.Z);
-
-        glm::quat FinalOrientation = GlobalOrientation * Orientation;
-        return csp::common::Vector4 { FinalOrientation.x, FinalOrientation.y, FinalOrientation.z, FinalOrientation.w };
-    }
-    else
-        return Transform.Rotation;
-}
+csp::common::Vector4 SpaceEntity::GetGlobalRotation() const { return GetCachedGlobalTransform().Rotation; }
 
 bool SpaceEntity::SetRotation(const csp::common::Vector4& Value)
 {
@@ -240,18 +228,112 @@ bool SpaceEntity::SetRotation(const csp::common::Vector4& Value)
 
 const csp::common::Vector3& SpaceEntity::GetScale() const { return Transform.Scale; }
 
-csp::common::Vector3 SpaceEntity::GetGlobalScale() const
-{
-    if (Parent != nullptr)
-        return Parent->GetGlobalScale() * Transform.Scale;
-    return Transform.Scale;
-}
+csp::common::Vector3 SpaceEntity::GetGlobalScale() const { return GetCachedGlobalTransform().Scale; }
 
 bool SpaceEntity::SetScale(const csp::common::Vector3& Value)
 {
     return SetProperty(*this, Transform.Scale, Value, SpaceEntityComponentKey::Scale, UPDATE_FLAGS_SCALE, LogSystem);
 }
 
+csp::common::Array<SpaceTransform> SpaceEntity::GetGlobalTransforms(const csp::common::Array<SpaceEntity*>& Entities)
+{
+    CSP_PROFILE_SCOPED();
+
+    // Refresh from the top of each queried entity's hierarchy, so stale transforms are computed as one batch rather than lazily one by one.
+    // Entities are grouped by the lock guarding their engine's hierarchies, and each group is refreshed under its own lock in turn.
+    std::vector<SpaceEntity*> Queried;
+    Queried.reserve(Entities.Size());
+
+    for (size_t i = 0; i < Entities.Size(); ++i)
+    {
+        if (Entities[i] != nullptr)
+        {
+            Queried.push_back(Entities[i]);
+        }
+    }
+
+    std::sort(Queried.begin(), Queried.end(),
+        [](const SpaceEntity* A, const SpaceEntity* B) { return &A->GetGlobalTransformMutex() < &B->GetGlobalTransformMutex(); });
+
+    std::vector<SpaceEntity*> Roots;
+    Roots.reserve(Queried.size());
+
+    // Null entries are left as the identity transform.
+    csp::common::Array<SpaceTransform> GlobalTransforms(Entities.Size());
+
+    for (size_t GroupBegin = 0; GroupBegin < Queried.size();)
+    {
+        std::mutex& GroupMutex = Queried[GroupBegin]->GetGlobalTransformMutex();
+        size_t GroupEnd = GroupBegin + 1;
+
+        while (GroupEnd < Queried.size() && &Queried[GroupEnd]->GetGlobalTransformMutex() == &GroupMutex)
+        {
+            ++GroupEnd;
+        }
+
+        // Parents are only assigned under the lock, so it's held while walking up to the roots.
+        std::scoped_lock GlobalTransformLocker(GroupMutex);
+
+        Roots.clear();
+
+        for (size_t i = GroupBegin; i < GroupEnd; ++i)
+        {
+            SpaceEntity* Root = Queried[i];
+
+            while (Root->Parent != nullptr)
+            {
+                Root = Root->Parent;
+            }
+
+            Roots.push_back(Root);
+        }
+
+        std::sort(Roots.begin(), Roots.end());
+        Roots.erase(std::unique(Roots.begin(), Roots.end()), Roots.end());
+
+        RefreshGlobalTransforms(Roots.data(), Roots.size());
+
+        // Copy out while the lock is still held, as another thread may dirty these once it's released.
+        for (size_t i = 0; i < Entities.Size(); ++i)
+        {
+            if (Entities[i] != nullptr && &Entities[i]->GetGlobalTransformMutex() == &GroupMutex)
+            {
+                GlobalTransforms[i] = Entities[i]->GlobalTransform;
+            }
+        }
+
+        GroupBegin = GroupEnd;
+    }
+
+    return GlobalTransforms;
+}
+
+csp::common::Array<SpaceTransform> SpaceEntity::GetInverseGlobalTransforms(const csp::common::Array<SpaceEntity*>& Entities)
+{
+    CSP_PROFILE_SCOPED();
+
+    const csp::common::Array<SpaceTransform> GlobalTransforms = GetGlobalTransforms(Entities);
+
+    TransformBuffer Buffer;
+    Buffer.Resize(GlobalTransforms.Size());
+
+    for (size_t i = 0; i < GlobalTransforms.Size(); ++i)
+    {
+        Buffer.Set(i, GlobalTransforms[i]);
+    }
+
+    InvertTransforms(std::as_const(Buffer).GetStreams(), Buffer.GetStreams(), Buffer.Size());
+
+    csp::common::Array<SpaceTransform> InverseTransforms(Buffer.Size());
+
+    for (size_t i = 0; i < Buffer.Size(); ++i)
+    {
+        InverseTransforms[i] = Buffer.Get(i);
+    }
+
+    return InverseTransforms;
+}
+
 bool SpaceEntity::GetIsTransient() const { return !IsPersistent; }
 
 const csp::common::String& SpaceEntity::GetThirdPartyRef() const { return ThirdPartyRef; }
@@ -345,13 +427,8 @@ ComponentBase* SpaceEntity::AddComponentByTypeId(uint64_t TypeId)
     ModifiableStatus Modifiable = IsModifiable();
     if (Modifiable != ModifiableStatus::Modifiable)
     {
-        if (LogSystem != nullptr)
-        {
-            LogSystem->LogMsg(csp::common::LogLevel::Warning,
-                fmt::format("Failed to add component: {0}, skipping update. Entity name: {1}",
-                    RealtimeEngineUtils::ModifiableStatusToString(Modifiable), GetName())
-                    .c_str());
-        }
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Warning, "Failed to add component: {0}, skipping update. Entity name: {1}",
+            RealtimeEngineUtils::ModifiableStatusToString(Modifiable), GetName());
 
         return nullptr;
     }
@@ -410,13 +487,8 @@ bool SpaceEntity::RemoveComponent(uint16_t Key)
     ModifiableStatus Modifiable = IsModifiable();
     if (Modifiable != ModifiableStatus::Modifiable)
     {
-        if (LogSystem != nullptr)
-        {
-            LogSystem->LogMsg(csp::common::LogLevel::Warning,
-                fmt::format("Failed to remove component: {0}, skipping update. Entity name: {1}",
-                    RealtimeEngineUtils::ModifiableStatusToString(Modifiable), GetName())
-                    .c_str());
-        }
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Warning, "Failed to remove component: {0}, skipping update. Entity name: {1}",
+            RealtimeEngineUtils::ModifiableStatusToString(Modifiable), GetName());
 
         return false;
     }
@@ -430,7 +502,7 @@ void SpaceEntity::RemoveAsChildFromParent()
     if (Parent != nullptr)
     {
         Parent->ChildEntities.RemoveItem(this);
-        Parent = nullptr;
+        SetParent(nullptr);
     }
 }
 
@@ -439,7 +511,7 @@ void SpaceEntity::RemoveParentFromChildEntity(size_t Index)
     if (Index < ChildEntities.Size())
     {
         ChildEntities[Index]->RemoveParentEntity();
-        ChildEntities[Index]->Parent = nullptr;
+        ChildEntities[Index]->SetParent(nullptr);
     }
 }
 
@@ -476,20 +548,23 @@ SpaceEntity::DestroyCallback SpaceEntity::GetEntityDestroyCallback() { return En
 
 SpaceEntity* SpaceEntity::GetParent() { return Parent; }
 
-void SpaceEntity::SetParent(SpaceEntity* InParent) { Parent = InParent; }
+void SpaceEntity::SetParent(SpaceEntity* InParent)
+{
+    std::scoped_lock GlobalTransformLocker(GetGlobalTransformMutex());
+
+    Parent = InParent;
+    MarkGlobalTransformDirtyLocked();
+}
 
 uint16_t SpaceEntity::GenerateComponentId()
 {
     auto NextId = NextComponentId;
 
     // We want to also account for dirty components. If we're in a context that has them (online, patching), account for them, otherwise we can just
-    // use an empty container (ie, ignore it)
-    const auto& DirtyComponents
-        = StatePatcher != nullptr ? StatePatcher->GetDirtyComponents() : std::unordered_map<uint16_t, SpaceEntityStatePatcher::DirtyComponent> {};
-
+    // ignore them.
     for (;;)
     {
-        if (!Components.HasKey(NextId) && !(DirtyComponents.count(NextId) > 0))
+        if (!Components.HasKey(NextId) && !(StatePatcher != nullptr && StatePatcher->IsComponentDirty(NextId)))
         {
             NextComponentId = NextId + 1;
 
@@ -527,10 +602,7 @@ ComponentBase* SpaceEntity::InstantiateComponent(uint16_t InstantiateId, uint64_
     {
         if (Schema == nullptr)
         {
-            if (LogSystem != nullptr)
-            {
-                LogSystem->LogMsg(csp::common::LogLevel::Warning, fmt::format("Unknown Component TypeId: {}", TypeId).c_str());
-            }
+            CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Warning, "Unknown Component TypeId: {}", TypeId);
             return nullptr;
         }
 
@@ -621,11 +693,7 @@ ComponentBase* SpaceEntity::InstantiateComponent(uint16_t InstantiateId, uint64_
         break;
     default:
     {
-        if (LogSystem != nullptr)
-        {
-            LogSystem->LogMsg(
-                csp::common::LogLevel::Warning, fmt::format("Unknown Component type of value: {}", static_cast<uint32_t>(InstantiateType)).c_str());
-        }
+        CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Warning, "Unknown Component type of value: {}", static_cast<uint32_t>(InstantiateType));
         return nullptr;
     }
     }
@@ -889,12 +957,12 @@ void SpaceEntity::ResolveParentChildRelationship()
             Parent->ChildEntities.RemoveItem(this);
         }
 
-        // Set our new parent
-        Parent = EntitySystem->FindSpaceEntityById(*ParentId);
+        // Find our new parent
+        SpaceEntity* NewParent = EntitySystem->FindSpaceEntityById(*ParentId);
 
         if (EntitySystem->GetRealtimeEngineType() == csp::common::RealtimeEngineType::Online)
         {
-            if (Parent == nullptr)
+            if (NewParent == nullptr)
             {
                 // For the OnlineRealtimeSystem, it's possible for parents to exist within the PendingAdds array,
                 // so we also need to check here.
@@ -906,24 +974,23 @@ void SpaceEntity::ResolveParentChildRelationship()
                 {
                     if (PendingParent->Id == *ParentId)
                     {
-                        Parent = PendingParent;
+                        NewParent = PendingParent;
                         break;
                     }
                 }
             }
         }
 
+        SetParent(NewParent);
+
         if (Parent != nullptr)
         {
             Parent->ChildEntities.Append(this);
         }
         else
         {
-            if (LogSystem != nullptr)
-            {
-                LogSystem->LogMsg(csp::common::LogLevel::Error,
-                    fmt::format("SpaceEntity unable to find parent for entity: {}. Please report if this issue is encountered.", GetId()).c_str());
-            }
+            CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Error,
+                "SpaceEntity unable to find parent for entity: {}. Please report if this issue is encountered.", GetId());
             return;
         }
     }
@@ -932,19 +999,169 @@ void SpaceEntity::ResolveParentChildRelationship()
         if (Parent != nullptr)
         {
             Parent->ChildEntities.RemoveItem(this);
-            Parent = nullptr;
+            SetParent(nullptr);
+        }
+    }
+}
+
+void SpaceEntity::UpdateWorldTransforms()
+{
+    std::scoped_lock GlobalTransformLocker(GetGlobalTransformMutex());
+
+    // Make sure our parent is up to date, as the batch starts from its global transform.
+    if (Parent != nullptr)
+    {
+        Parent->RefreshGlobalTransform();
+    }
+
+    SpaceEntity* Root = this;
+    RefreshGlobalTransforms(&Root, 1);
+}
+
+void SpaceEntity::UpdateWorldTransforms(const csp::common::List<SpaceEntity*>& RootEntities)
+{
+    CSP_PROFILE_SCOPED();
+
+    std::vector<SpaceEntity*> Roots(RootEntities.Size());
+
+    for (size_t i = 0; i < RootEntities.Size(); ++i)
+    {
+        Roots[i] = RootEntities[i];
+    }
+
+    // The roots normally all belong to one engine, but group them by lock in case they don't, refreshing each group under its own lock.
+    std::sort(Roots.begin(), Roots.end(),
+        [](const SpaceEntity* A, const SpaceEntity* B) { return &A->GetGlobalTransformMutex() < &B->GetGlobalTransformMutex(); });
+
+    for (size_t GroupBegin = 0; GroupBegin < Roots.size();)
+    {
+        std::mutex& GroupMutex = Roots[GroupBegin]->GetGlobalTransformMutex();
+        size_t GroupEnd = GroupBegin + 1;
+
+        while (GroupEnd < Roots.size() && &Roots[GroupEnd]->GetGlobalTransformMutex() == &GroupMutex)
+        {
+            ++GroupEnd;
         }
+
+        std::scoped_lock GlobalTransformLocker(GroupMutex);
+
+        RefreshGlobalTransforms(Roots.data() + GroupBegin, GroupEnd - GroupBegin);
+
+        GroupBegin = GroupEnd;
     }
 }
 
+void SpaceEntity::RefreshGlobalTransforms(SpaceEntity* const* Roots, size_t RootCount)
+{
+    // Scratch buffers are kept between calls, as this runs every tick.
+    thread_local std::vector<SpaceEntity*> Level;
+    thread_local std::vector<SpaceEntity*> NextLevel;
+    thread_local TransformBuffer Parents;
+    thread_local TransformBuffer Globals;
+
+    Level.clear();
+    NextLevel.assign(Roots, Roots + RootCount);
+
+    // Find the topmost dirty entities. Everything below a dirty entity is also dirty, so clean entities are only walked through to find them.
+    while (NextLevel.empty() == false)
+    {
+        SpaceEntity* Entity = NextLevel.back();
+        NextLevel.pop_back();
+
+        if (Entity->IsGlobalTransformDirty)
+        {
+            Level.push_back(Entity);
+            continue;
+        }
+
+        for (size_t i = 0; i < Entity->ChildEntities.Size(); ++i)
+        {
+            NextLevel.push_back(Entity->ChildEntities[i]);
+        }
+    }
+
+    // Each level only depends on the one above it, so a whole level is composed in one batch.
+    const SpaceTransform Identity;
+
+    while (Level.empty() == false)
+    {
+        const size_t Count = Level.size();
+        Parents.Resize(Count);
+        Globals.Resize(Count);
+
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const SpaceEntity* Entity = Level[i];
+            Parents.Set(i, Entity->Parent != nullptr ? Entity->Parent->GlobalTransform : Identity);
+            Globals.Set(i, Entity->Transform);
+        }
+
+        ComposeTransforms(std::as_const(Parents).GetStreams(), std::as_const(Globals).GetStreams(), Globals.GetStreams(), Count);
+
+        NextLevel.clear();
+
+        for (size_t i = 0; i < Count; ++i)
+        {
+            SpaceEntity* Entity = Level[i];
+            Entity->GlobalTransform = Globals.Get(i);
+            Entity->IsGlobalTransformDirty = false;
+
+            for (size_t j = 0; j < Entity->ChildEntities.Size(); ++j)
+            {
+                NextLevel.push_back(Entity->ChildEntities[j]);
+            }
+        }
+
+        std::swap(Level, NextLevel);
+    }
+}
+
+std::unique_lock<std::mutex> SpaceEntity::LockGlobalTransforms() const { return std::unique_lock<std::mutex>(GetGlobalTransformMutex()); }
+
+std::mutex& SpaceEntity::GetGlobalTransformMutex() const { return GetGlobalTransformMutexForEngine(EntitySystem); }
+
+void SpaceEntity::MarkGlobalTransformDirtyLocked()
+{
+    // Descendants of a dirty entity are always dirty too, so there is nothing further to do.
+    if (IsGlobalTransformDirty)
+    {
+        return;
+    }
+
+    IsGlobalTransformDirty = true;
+
+    for (size_t i = 0; i < ChildEntities.Size(); ++i)
+    {
+        ChildEntities[i]->MarkGlobalTransformDirtyLocked();
+    }
+}
+
+SpaceTransform SpaceEntity::GetCachedGlobalTransform() const
+{
+    std::scoped_lock GlobalTransformLocker(GetGlobalTransformMutex());
+
+    return RefreshGlobalTransform();
+}
+
+const SpaceTransform& SpaceEntity::RefreshGlobalTransform() const
+{
+    if (IsGlobalTransformDirty)
+    {
+        GlobalTransform = Parent != nullptr ? ComposeTransform(Parent->RefreshGlobalTransform(), Transform) : Transform;
+        IsGlobalTransformDirty = false;
+    }
+
+    return GlobalTransform;
+}
+
 const std::unique_ptr<SpaceEntityStatePatcher>& SpaceEntity::GetStatePatcher() const { return StatePatcher; }
 
 std::unique_ptr<SpaceEntityStatePatcher>& SpaceEntity::GetStatePatcher() { return StatePatcher; }
 
 void SpaceEntity::AddComponentFromItemComponentData(uint16_t ComponentId, const mcs::ItemComponentData& ComponentData)
 {
-    auto ComponentDataMap = std::get<std::map<uint16_t, mcs::ItemComponentData>>(ComponentData.GetValue());
-    const auto TypeId = std::get<uint64_t>(ComponentDataMap[COMPONENT_KEY_COMPONENTTYPE].GetValue());
+    const auto& ComponentDataMap = std::get<std::map<uint16_t, mcs::ItemComponentData>>(ComponentData.GetValue());
+    const auto TypeId = std::get<uint64_t>(ComponentDataMap.at(COMPONENT_KEY_COMPONENTTYPE).GetValue());
 
     if (TypeId != static_cast<uint64_t>(ComponentType::Invalid))
     {
@@ -963,7 +1180,7 @@ void SpaceEntity::AddComponentFromItemComponentData(uint16_t ComponentId, const
 
                 csp::common::ReplicatedValue Property = ToReplicatedValue(PatchComponentPair.second);
 
-                Component->Properties[PatchComponentPair.first] = Property;
+                Component->PropertyIndex->Set(PatchComponentPair.first, Property);
                 Component->OnCreated();
             }
             std::scoped_lock ComponentsLocker(ComponentsLock);
@@ -974,8 +1191,8 @@ void SpaceEntity::AddComponentFromItemComponentData(uint16_t ComponentId, const
 
 ComponentUpdateInfo SpaceEntity::AddComponentFromItemComponentDataPatch(uint16_t ComponentId, const mcs::ItemComponentData& ComponentData)
 {
-    auto ComponentDataMap = std::get<std::map<uint16_t, mcs::ItemComponentData>>(ComponentData.GetValue());
-    const auto PatchComponentType = std::get<uint64_t>(ComponentDataMap[COMPONENT_KEY_COMPONENTTYPE].GetValue());
+    const auto& ComponentDataMap = std::get<std::map<uint16_t, mcs::ItemComponentData>>(ComponentData.GetValue());
+    const auto PatchComponentType = std::get<uint64_t>(ComponentDataMap.at(COMPONENT_KEY_COMPONENTTYPE).GetValue());
 
     auto UpdateType = ComponentUpdateType::Update;
 
@@ -1058,7 +1275,12 @@ csp::common::Array<EntityProperty> SpaceEntity::CreateReplicatedProperties()
         { 
             SpaceEntityComponentKey::Name, UPDATE_FLAGS_NAME, 
             [&Name = Name]() { return csp::common::ReplicatedValue { Name }; },
-            [this](const csp::common::ReplicatedValue& Value) { SetPropertyDirect(Name, Value.GetString(), UPDATE_FLAGS_NAME); } 
+            [this](const csp::common::ReplicatedValue& Value)
+            {
+                const csp::common::String OldName = Name;
+                SetPropertyDirect(Name, Value.GetString(), UPDATE_FLAGS_NAME);
+                NotifyNameChanged(OldName);
+            }
         },
         {
             SpaceEntityComponentKey::Position, UPDATE_FLAGS_POSITION,
@@ -1106,6 +1328,14 @@ void SpaceEntity::ClaimScriptOwnership()
     }
 }
 
+void SpaceEntity::NotifyNameChanged(const csp::common::String& OldName)
+{
+    if (EntitySystem != nullptr && OldName != Name)
+    {
+        EntitySystem->OnEntityNameChanged(this, OldName);
+    }
+}
+
 void SpaceEntity::OnPropertyChanged(ComponentBase* DirtyComponent, int32_t PropertyKey)
 {
     Script.OnPropertyChanged(DirtyComponent->GetId(), PropertyKey);
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Multiplayer/SpaceEntityHierarchy.h"
+
+namespace csp::multiplayer
+{
+
+void SpaceEntityHierarchy::AddRoot(SpaceEntity* Entity)
+{
+    if (Entity == nullptr)
+    {
+        return;
+    }
+
+    if (RootPositions.count(Entity) == 0)
+    {
+        AppendEntityToList(RootEntities, RootPositions, Entity);
+    }
+}
+
+void SpaceEntityHierarchy::RemoveRoot(SpaceEntity* Entity)
+{
+    SwapRemoveEntityFromList(RootEntities, RootPositions, Entity);
+}
+
+void SpaceEntityHierarchy::RemoveRoots(const std::unordered_set<SpaceEntity*>& Entities)
+{
+    std::unordered_set<SpaceEntity*> Roots;
+
+    for (SpaceEntity* Entity : Entities)
+    {
+        if (RootPositions.count(Entity) > 0)
+        {
+            Roots.insert(Entity);
+        }
+    }
+
+    if (Roots.empty() == false)
+    {
+        RemoveEntitiesFromList(RootEntities, RootPositions, Roots);
+    }
+}
+
+bool SpaceEntityHierarchy::IsRoot(const SpaceEntity* Entity) const
+{
+    return RootPositions.count(Entity) > 0;
+}
+
+void SpaceEntityHierarchy::Clear()
+{
+    RootEntities.Clear();
+    RootPositions.clear();
+}
+
+const csp::common::List<SpaceEntity*>& SpaceEntityHierarchy::GetRootEntities() const { return RootEntities; }
+
+} // namespace csp::multiplayer
@@ -0,0 +1,59 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CSP/Common/List.h"
+#include "Multiplayer/SpaceEntityIndex.h"
+
+#include <unordered_set>
+
+namespace csp::multiplayer
+{
+class SpaceEntity;
+
+/*
+    The set of root (unparented) entities owned by a realtime engine.
+    The roots are kept in a List so they can be handed out through IRealtimeEngine::GetRootHierarchyEntities, alongside
+    each root's position in it, so membership checks, adds and removes don't need to walk the list.
+    Removing a single root swaps the last root into its place. RemoveRoots removes many roots with a single walk, keeping
+    the remaining roots in order.
+    Like SpaceEntityIndex, this does no locking of its own and relies on callers holding the engine's entities lock.
+*/
+class SpaceEntityHierarchy
+{
+public:
+    // Adds the entity as a root. Does nothing if it is already a root.
+    void AddRoot(SpaceEntity* Entity);
+
+    // Removes the entity from the roots. Does nothing if it isn't a root.
+    void RemoveRoot(SpaceEntity* Entity);
+
+    // Removes any of the given entities that are roots.
+    void RemoveRoots(const std::unordered_set<SpaceEntity*>& Entities);
+
+    [[nodiscard]] bool IsRoot(const SpaceEntity* Entity) const;
+
+    void Clear();
+
+    [[nodiscard]] const csp::common::List<SpaceEntity*>& GetRootEntities() const;
+
+private:
+    csp::common::List<SpaceEntity*> RootEntities;
+    EntityPositionMap RootPositions;
+};
+
+} // namespace csp::multiplayer
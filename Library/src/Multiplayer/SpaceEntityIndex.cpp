@@ -0,0 +1,304 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Multiplayer/SpaceEntityIndex.h"
+
+#include "CSP/Multiplayer/SpaceEntity.h"
+
+#include <algorithm>
+
+namespace csp::multiplayer
+{
+
+void AppendEntityToList(csp::common::List<SpaceEntity*>& List, EntityPositionMap& Positions, SpaceEntity* Entity)
+{
+    Positions[Entity] = List.Size();
+    List.Append(Entity);
+}
+
+void SwapRemoveEntityFromList(csp::common::List<SpaceEntity*>& List, EntityPositionMap& Positions, const SpaceEntity* Entity)
+{
+    auto It = Positions.find(Entity);
+
+    if (It == Positions.end())
+    {
+        return;
+    }
+
+    const size_t Position = It->second;
+    const size_t LastPosition = List.Size() - 1;
+    Positions.erase(It);
+
+    if (Position != LastPosition)
+    {
+        SpaceEntity* Last = List[LastPosition];
+        List[Position] = Last;
+        Positions[Last] = Position;
+    }
+
+    // Removing from the back doesn't shift anything.
+    List.Remove(LastPosition);
+}
+
+void RemoveEntitiesFromList(
+    csp::common::List<SpaceEntity*>& List, EntityPositionMap& Positions, const std::unordered_set<SpaceEntity*>& EntitiesToRemove)
+{
+    // remove_if keeps the surviving entities in order, so the list only needs to be walked once.
+    SpaceEntity** NewEnd
+        = std::remove_if(List.begin(), List.end(), [&EntitiesToRemove](SpaceEntity* Entity) { return EntitiesToRemove.count(Entity) > 0; });
+    const size_t NewSize = static_cast<size_t>(NewEnd - List.begin());
+
+    // Removing from the back doesn't shift anything.
+    while (List.Size() > NewSize)
+    {
+        List.Remove(List.Size() - 1);
+    }
+
+    for (SpaceEntity* Entity : EntitiesToRemove)
+    {
+        Positions.erase(Entity);
+    }
+
+    for (size_t i = 0; i < List.Size(); ++i)
+    {
+        Positions[List[i]] = i;
+    }
+}
+
+SpaceEntityIndex::SpaceEntityIndex(
+    csp::common::List<SpaceEntity*>& Entities, csp::common::List<SpaceEntity*>& Avatars, csp::common::List<SpaceEntity*>& Objects)
+    : Entities(Entities)
+    , Avatars(Avatars)
+    , Objects(Objects)
+{
+}
+
+bool SpaceEntityIndex::Add(SpaceEntity* Entity)
+{
+    if (Entity == nullptr)
+    {
+        return false;
+    }
+
+    const IndexedEntity Indexed { Entity, NextSequence };
+
+    if (EntitiesById.emplace(Entity->GetId(), Indexed).second == false)
+    {
+        return false;
+    }
+
+    ++NextSequence;
+
+    AppendEntityToList(Entities, EntityPositions, Entity);
+
+    if (csp::common::List<SpaceEntity*>* TypedList = GetTypedList(Entity))
+    {
+        AppendEntityToList(*TypedList, *GetTypedPositions(Entity), Entity);
+    }
+
+    // Appending keeps the bucket in order, as this is the newest entity.
+    EntitiesByName[Entity->GetName()].push_back(Indexed);
+
+    return true;
+}
+
+void SpaceEntityIndex::Remove(SpaceEntity* Entity)
+{
+    if (Unindex(Entity) == false)
+    {
+        return;
+    }
+
+    SwapRemoveEntityFromList(Entities, EntityPositions, Entity);
+
+    if (csp::common::List<SpaceEntity*>* TypedList = GetTypedList(Entity))
+    {
+        SwapRemoveEntityFromList(*TypedList, *GetTypedPositions(Entity), Entity);
+    }
+}
+
+void SpaceEntityIndex::RemoveAll(const std::unordered_set<SpaceEntity*>& EntitiesToRemove)
+{
+    std::unordered_set<SpaceEntity*> Removed;
+    Removed.reserve(EntitiesToRemove.size());
+
+    for (SpaceEntity* Entity : EntitiesToRemove)
+    {
+        if (Unindex(Entity))
+        {
+            Removed.insert(Entity);
+        }
+    }
+
+    if (Removed.empty())
+    {
+        return;
+    }
+
+    RemoveEntitiesFromList(Entities, EntityPositions, Removed);
+    RemoveEntitiesFromList(Avatars, AvatarPositions, Removed);
+    RemoveEntitiesFromList(Objects, ObjectPositions, Removed);
+}
+
+void SpaceEntityIndex::Rename(SpaceEntity* Entity, const csp::common::String& OldName)
+{
+    if (Entity == nullptr || OldName == Entity->GetName())
+    {
+        return;
+    }
+
+    auto It = EntitiesById.find(Entity->GetId());
+
+    if (It == EntitiesById.end() || It->second.Entity != Entity)
+    {
+        return;
+    }
+
+    RemoveFromNameBucket(Entity, OldName);
+    AddToNameBucket(It->second, Entity->GetName());
+}
+
+void SpaceEntityIndex::Clear()
+{
+    Entities.Clear();
+    Avatars.Clear();
+    Objects.Clear();
+    EntitiesById.clear();
+    EntityPositions.clear();
+    AvatarPositions.clear();
+    ObjectPositions.clear();
+    EntitiesByName.clear();
+    NextSequence = 0;
+}
+
+SpaceEntity* SpaceEntityIndex::FindById(uint64_t EntityId) const
+{
+    if (auto It = EntitiesById.find(EntityId); It != EntitiesById.end())
+    {
+        return It->second.Entity;
+    }
+
+    return nullptr;
+}
+
+SpaceEntity* SpaceEntityIndex::FindByName(const csp::common::String& Name) const
+{
+    if (auto It = EntitiesByName.find(Name); It != EntitiesByName.end() && It->second.empty() == false)
+    {
+        return It->second.front().Entity;
+    }
+
+    return nullptr;
+}
+
+SpaceEntity* SpaceEntityIndex::FindByName(const csp::common::String& Name, SpaceEntityType Type) const
+{
+    if (auto It = EntitiesByName.find(Name); It != EntitiesByName.end())
+    {
+        for (const IndexedEntity& Indexed : It->second)
+        {
+            if (Indexed.Entity->GetEntityType() == Type)
+            {
+                return Indexed.Entity;
+            }
+        }
+    }
+
+    return nullptr;
+}
+
+bool SpaceEntityIndex::Contains(uint64_t EntityId) const { return EntitiesById.count(EntityId) > 0; }
+
+size_t SpaceEntityIndex::Size() const { return EntitiesById.size(); }
+
+bool SpaceEntityIndex::Unindex(SpaceEntity* Entity)
+{
+    if (Entity == nullptr)
+    {
+        return false;
+    }
+
+    auto It = EntitiesById.find(Entity->GetId());
+
+    // Only drop the id entry if it's actually this entity, we don't want to evict a different entity that happens to share an id.
+    if (It == EntitiesById.end() || It->second.Entity != Entity)
+    {
+        return false;
+    }
+
+    EntitiesById.erase(It);
+    RemoveFromNameBucket(Entity, Entity->GetName());
+
+    return true;
+}
+
+csp::common::List<SpaceEntity*>* SpaceEntityIndex::GetTypedList(const SpaceEntity* Entity)
+{
+    switch (Entity->GetEntityType())
+    {
+    case SpaceEntityType::Avatar:
+        return &Avatars;
+
+    case SpaceEntityType::Object:
+        return &Objects;
+    }
+
+    return nullptr;
+}
+
+EntityPositionMap* SpaceEntityIndex::GetTypedPositions(const SpaceEntity* Entity)
+{
+    switch (Entity->GetEntityType())
+    {
+    case SpaceEntityType::Avatar:
+        return &AvatarPositions;
+
+    case SpaceEntityType::Object:
+        return &ObjectPositions;
+    }
+
+    return nullptr;
+}
+
+void SpaceEntityIndex::AddToNameBucket(const IndexedEntity& Entity, const csp::common::String& Name)
+{
+    auto& Bucket = EntitiesByName[Name];
+    const auto Position = std::upper_bound(Bucket.begin(), Bucket.end(), Entity.Sequence,
+        [](uint64_t Sequence, const IndexedEntity& Other) { return Sequence < Other.Sequence; });
+
+    Bucket.insert(Position, Entity);
+}
+
+void SpaceEntityIndex::RemoveFromNameBucket(SpaceEntity* Entity, const csp::common::String& Name)
+{
+    auto It = EntitiesByName.find(Name);
+
+    if (It == EntitiesByName.end())
+    {
+        return;
+    }
+
+    auto& Bucket = It->second;
+    Bucket.erase(std::remove_if(Bucket.begin(), Bucket.end(), [Entity](const IndexedEntity& Indexed) { return Indexed.Entity == Entity; }),
+        Bucket.end());
+
+    if (Bucket.empty())
+    {
+        EntitiesByName.erase(It);
+    }
+}
+
+} // namespace csp::multiplayer
@@ -0,0 +1,129 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CSP/Common/Hash.h"
+#include "CSP/Common/List.h"
+#include "CSP/Common/String.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace csp::multiplayer
+{
+class SpaceEntity;
+enum class SpaceEntityType;
+
+// Entity -> its position in a list, so it can be removed without walking the list to find it.
+using EntityPositionMap = std::unordered_map<const SpaceEntity*, size_t>;
+
+// Appends the entity to the list, recording its position.
+void AppendEntityToList(csp::common::List<SpaceEntity*>& List, EntityPositionMap& Positions, SpaceEntity* Entity);
+
+// Removes the entity by moving the last entity in the list into its place and updating that entity's position, so nothing is shifted.
+// Does nothing if the entity has no recorded position.
+void SwapRemoveEntityFromList(csp::common::List<SpaceEntity*>& List, EntityPositionMap& Positions, const SpaceEntity* Entity);
+
+// Removes the given entities from the list in a single pass, keeping the remaining entities in order, and re-records their positions.
+void RemoveEntitiesFromList(
+    csp::common::List<SpaceEntity*>& List, EntityPositionMap& Positions, const std::unordered_set<SpaceEntity*>& EntitiesToRemove);
+
+/*
+    Lookup index over the entities owned by a realtime engine.
+    The engines keep their `Entities`/`Avatars`/`Objects` lists for index based access, this maintains those lists on their behalf
+    and indexes the entities alongside them so that lookups by id or name do not need to walk the lists.
+    Each entity's position in the lists is recorded, so removing a single entity swaps the last entity in the list into its place
+    rather than walking and shifting the list. RemoveAll instead compacts each list in one pass, keeping the remaining entities in order.
+    This does no locking of its own, callers are expected to hold the engine's entities lock.
+*/
+class SpaceEntityIndex
+{
+public:
+    // The lists are owned by the engine and must outlive the index.
+    SpaceEntityIndex(csp::common::List<SpaceEntity*>& Entities, csp::common::List<SpaceEntity*>& Avatars,
+        csp::common::List<SpaceEntity*>& Objects);
+
+    // Indexes the entity under its current id and name, and appends it to `Entities` and to `Avatars` or `Objects` depending on its type.
+    // Returns false, leaving the lists untouched, if an entity with the same id is already indexed.
+    bool Add(SpaceEntity* Entity);
+
+    // Removes the entity from the index and the lists, moving the last entity in each list into its place.
+    // Safe to call with entities that were never added.
+    void Remove(SpaceEntity* Entity);
+
+    // Removes all of the given entities from the index and the lists, walking each list once rather than once per entity.
+    // Entities that were never added are ignored.
+    void RemoveAll(const std::unordered_set<SpaceEntity*>& EntitiesToRemove);
+
+    // Re-keys the entity after its name has changed. OldName must be the name the entity was indexed under.
+    // Entities that are not indexed (for example, ones still pending add) are ignored.
+    void Rename(SpaceEntity* Entity, const csp::common::String& OldName);
+
+    // Clears the index and the lists.
+    void Clear();
+
+    [[nodiscard]] SpaceEntity* FindById(uint64_t EntityId) const;
+
+    // Returns the earliest indexed entity with a matching name, or nullptr if there is none.
+    [[nodiscard]] SpaceEntity* FindByName(const csp::common::String& Name) const;
+
+    // As above, but only considers entities of the given type.
+    [[nodiscard]] SpaceEntity* FindByName(const csp::common::String& Name, SpaceEntityType Type) const;
+
+    [[nodiscard]] bool Contains(uint64_t EntityId) const;
+
+    [[nodiscard]] size_t Size() const;
+
+private:
+    struct IndexedEntity
+    {
+        SpaceEntity* Entity;
+
+        // When the entity was added. Entities are in this order in the lists, so name lookups can keep to it too.
+        uint64_t Sequence;
+    };
+
+    csp::common::List<SpaceEntity*>* GetTypedList(const SpaceEntity* Entity);
+    EntityPositionMap* GetTypedPositions(const SpaceEntity* Entity);
+
+    // Drops the entity from the id and name maps, leaving the lists alone. Returns false if this entity isn't indexed.
+    bool Unindex(SpaceEntity* Entity);
+
+    // Inserts into the name bucket in Sequence order, so renamed entities are found where a walk of the lists would find them.
+    void AddToNameBucket(const IndexedEntity& Entity, const csp::common::String& Name);
+    void RemoveFromNameBucket(SpaceEntity* Entity, const csp::common::String& Name);
+
+    csp::common::List<SpaceEntity*>& Entities;
+    csp::common::List<SpaceEntity*>& Avatars;
+    csp::common::List<SpaceEntity*>& Objects;
+
+    std::unordered_map<uint64_t, IndexedEntity> EntitiesById;
+
+    // Positions in `Entities`, and in whichever of `Avatars` or `Objects` the entity is in.
+    EntityPositionMap EntityPositions;
+    EntityPositionMap AvatarPositions;
+    EntityPositionMap ObjectPositions;
+
+    // Name -> entities, in the order they were added. Names are not unique, and Find* has always returned the first match in the lists.
+    std::unordered_map<csp::common::String, std::vector<IndexedEntity>> EntitiesByName;
+
+    uint64_t NextSequence = 0;
+};
+
+} // namespace csp::multiplayer
@@ -18,6 +18,8 @@
 #include "CSP/Common/Systems/Log/LogSystem.h"
 #include "CSP/Multiplayer/SpaceEntity.h"
 #include "Common/Convert.h"
+#include "Common/Systems/Log/LogFormat.h"
+#include "Multiplayer/ComponentPropertyIndex.h"
 
 #include <algorithm>
 #include <fmt/format.h>
@@ -36,19 +38,17 @@ bool SpaceEntityStatePatcher::SetDirtyComponent(uint16_t ComponentKey, DirtyComp
 {
     std::scoped_lock ComponentsLocker(DirtyComponentsLock);
 
-    if (DirtyComponents.count(ComponentKey) > 0)
+    if (FindDirtyComponentSlot(ComponentKey) != DirtyComponents.size())
     {
         if (LogSystem)
         {
-            LogSystem->LogMsg(csp::common::LogLevel::VeryVerbose,
-                fmt::format(
-                    "SpaceEntityStatePatcher::SetDirtyComponent. Dirty components map already contains key : {}. Performing no action", ComponentKey)
-                    .c_str());
+            CSP_LOG_FMT(LogSystem, csp::common::LogLevel::VeryVerbose,
+                "SpaceEntityStatePatcher::SetDirtyComponent. Dirty components map already contains key : {}. Performing no action", ComponentKey);
         }
         return false;
     }
 
-    DirtyComponents[ComponentKey] = DirtyComponent;
+    DirtyComponents.push_back({ ComponentKey, DirtyComponent });
     return true;
 }
 
@@ -58,8 +58,13 @@ bool SpaceEntityStatePatcher::RemoveDirtyComponent(uint16_t ComponentKey, const
 
     if (!TransientDeletionComponentIds.Contains(ComponentKey) || CurrentComponents.HasKey(ComponentKey))
     {
+        const size_t SlotIndex = FindDirtyComponentSlot(ComponentKey);
+
+        if (SlotIndex != DirtyComponents.size())
+        {
+            DirtyComponents.erase(DirtyComponents.begin() + SlotIndex);
+        }
 
-        DirtyComponents.erase(ComponentKey);
         TransientDeletionComponentIds.Append(ComponentKey);
         return true;
     }
@@ -80,10 +85,10 @@ std::pair<SpaceEntityUpdateFlags, csp::common::Array<ComponentUpdateInfo>> Space
 
     auto UpdateFlags = static_cast<SpaceEntityUpdateFlags>(0);
 
-    for (const auto& DirtyProperty : DirtyProperties)
+    for (const DirtyProperty& Dirty : DirtyProperties)
     {
         // Find our entity property using the dirty property id.
-        const SpaceEntityComponentKey PropertyKey = DirtyProperty.first;
+        const SpaceEntityComponentKey PropertyKey = Dirty.PropertyKey;
         auto PropertyIt = RegisteredProperties.find(PropertyKey);
 
         if (PropertyIt != RegisteredProperties.end())
@@ -91,7 +96,7 @@ std::pair<SpaceEntityUpdateFlags, csp::common::Array<ComponentUpdateInfo>> Space
             // Set our entity property using the dirty property value.
             EntityProperty& Property = PropertyIt->second;
             UpdateFlags = static_cast<SpaceEntityUpdateFlags>(UpdateFlags | Property.GetUpdateFlag());
-            Property.Set(DirtyProperty.second);
+            Property.Set(Dirty.Value);
         }
         else
         {
@@ -103,6 +108,7 @@ std::pair<SpaceEntityUpdateFlags, csp::common::Array<ComponentUpdateInfo>> Space
     }
 
     DirtyProperties.clear();
+    DirtyPropertyBits.reset();
 
     // Allocate a ComponentUpdates array (to pass update info to the client), with
     // sufficient size for all dirty components and scheduled deletions.
@@ -113,16 +119,17 @@ std::pair<SpaceEntityUpdateFlags, csp::common::Array<ComponentUpdateInfo>> Space
         UpdateFlags = static_cast<SpaceEntityUpdateFlags>(UpdateFlags | UPDATE_FLAGS_COMPONENTS);
 
         size_t Index = 0;
-        for (const auto& DirtyComponent : DirtyComponents)
+        for (const DirtyComponentSlot& Slot : DirtyComponents)
         {
-            uint16_t ComponentKey = DirtyComponent.first;
+            const uint16_t ComponentKey = Slot.ComponentKey;
 
-            switch (DirtyComponents[ComponentKey].UpdateType)
+            switch (Slot.Component.UpdateType)
             {
             case ComponentUpdateType::Add:
-                SpaceEntity.AddComponentDirect(ComponentKey, DirtyComponents[ComponentKey].Component, false);
+                SpaceEntity.AddComponentDirect(ComponentKey, Slot.Component.Component, false);
+                Slot.Component.Component->PropertyIndex->ClearDirty();
                 // Components[ComponentKey] = DirtyComponents[ComponentKey].Component;
-                ComponentUpdates[Index].ComponentId = DirtyComponents[ComponentKey].Component->GetId();
+                ComponentUpdates[Index].ComponentId = Slot.Component.Component->GetId();
                 ComponentUpdates[Index].UpdateType = ComponentUpdateType::Add;
                 break;
             case ComponentUpdateType::Delete:
@@ -135,9 +142,12 @@ std::pair<SpaceEntityUpdateFlags, csp::common::Array<ComponentUpdateInfo>> Space
                 // You may expect a `SpaceEntity.UpdateComponentDirect`, but component property updates
                 // are still out-of-pattern and set immediately rather than looping back. Should change.
 
-                ComponentUpdates[Index].ComponentId = DirtyComponents[ComponentKey].Component->GetId();
+                ComponentUpdates[Index].ComponentId = Slot.Component.Component->GetId();
                 ComponentUpdates[Index].UpdateType = ComponentUpdateType::Update;
 
+                // The whole component is sent, so everything it had changed locally is now accounted for.
+                Slot.Component.Component->PropertyIndex->ClearDirty();
+
                 // TODO: For the moment, we update all properties on a dirty component, in future we need to change this to per property
                 // replication. Components[DirtyComponents[i].Component->GetId()]->Properties = DirtyComponents[i].Component->DirtyProperties;
 
@@ -203,12 +213,80 @@ std::pair<SpaceEntityUpdateFlags, csp::common::Array<ComponentUpdateInfo>> Space
     return std::pair<SpaceEntityUpdateFlags, csp::common::Array<ComponentUpdateInfo>>(UpdateFlags, ComponentUpdates);
 }
 
-std::unordered_map<SpaceEntityComponentKey, csp::common::ReplicatedValue> SpaceEntityStatePatcher::GetDirtyProperties() const
+bool SpaceEntityStatePatcher::IsPropertyDirty(SpaceEntityComponentKey PropertyKey) const
 {
-    return DirtyProperties;
+    std::scoped_lock<std::mutex> PropertiesLocker(DirtyPropertiesLock);
+
+    return DirtyPropertyBits.test(GetDirtyPropertyBit(PropertyKey));
 }
 
-std::unordered_map<uint16_t, SpaceEntityStatePatcher::DirtyComponent> SpaceEntityStatePatcher::GetDirtyComponents() const { return DirtyComponents; }
+bool SpaceEntityStatePatcher::IsComponentDirty(uint16_t ComponentKey) const
+{
+    std::scoped_lock<std::mutex> ComponentsLocker(DirtyComponentsLock);
+
+    return FindDirtyComponentSlot(ComponentKey) != DirtyComponents.size();
+}
+
+size_t SpaceEntityStatePatcher::GetDirtyPropertyCount() const
+{
+    std::scoped_lock<std::mutex> PropertiesLocker(DirtyPropertiesLock);
+
+    return DirtyProperties.size();
+}
+
+size_t SpaceEntityStatePatcher::GetDirtyComponentCount() const
+{
+    std::scoped_lock<std::mutex> ComponentsLocker(DirtyComponentsLock);
+
+    return DirtyComponents.size();
+}
+
+size_t SpaceEntityStatePatcher::GetPendingComponentDeletionCount() const
+{
+    std::scoped_lock<std::mutex> ComponentsLocker(DirtyComponentsLock);
+
+    return TransientDeletionComponentIds.Size();
+}
+
+void SpaceEntityStatePatcher::EraseDirtyProperty(SpaceEntityComponentKey PropertyKey)
+{
+    const size_t Bit = GetDirtyPropertyBit(PropertyKey);
+
+    if (DirtyPropertyBits.test(Bit) == false)
+    {
+        return;
+    }
+
+    DirtyPropertyBits.reset(Bit);
+
+    // Ordering of dirty properties has no meaning on the wire, so swap-remove to keep the array dense.
+    auto PropertyIt = std::find_if(
+        DirtyProperties.begin(), DirtyProperties.end(), [PropertyKey](const DirtyProperty& Dirty) { return Dirty.PropertyKey == PropertyKey; });
+
+    if (PropertyIt != DirtyProperties.end())
+    {
+        if (PropertyIt != DirtyProperties.end() - 1)
+        {
+            *PropertyIt = std::move(DirtyProperties.back());
+        }
+
+        DirtyProperties.pop_back();
+    }
+}
+
+size_t SpaceEntityStatePatcher::FindDirtyComponentSlot(uint16_t ComponentKey) const
+{
+    // Entities rarely have more than a handful of components dirty at once, so a linear scan over the dense array beats a hashed lookup.
+    for (size_t i = 0; i < DirtyComponents.size(); ++i)
+    {
+        if (DirtyComponents[i].ComponentKey == ComponentKey)
+        {
+            return i;
+        }
+    }
+
+    return DirtyComponents.size();
+}
 
 std::chrono::milliseconds SpaceEntityStatePatcher::GetTimeOfLastPatch() const { return TimeOfLastPatch; }
 
@@ -229,15 +307,15 @@ csp::multiplayer::ComponentBase* SpaceEntityStatePatcher::GetFirstPendingCompone
 {
     std::scoped_lock ComponentsLocker(DirtyComponentsLock);
 
-    for (const std::pair<const uint16_t, DirtyComponent>& DirtyComp : DirtyComponents)
+    for (const DirtyComponentSlot& Slot : DirtyComponents)
     {
         // If any of our dirty components are :
         //  - Of the type requested AND
         //  - Of update types of interest
-        const auto UpdateType = DirtyComp.second.UpdateType;
-        if ((DirtyComp.second.Component->GetComponentType() == Type) && (InterestingUpdateTypes.find(UpdateType) != InterestingUpdateTypes.end()))
+        const auto UpdateType = Slot.Component.UpdateType;
+        if ((Slot.Component.Component->GetComponentType() == Type) && (InterestingUpdateTypes.find(UpdateType) != InterestingUpdateTypes.end()))
         {
-            return DirtyComp.second.Component;
+            return Slot.Component.Component;
         }
     }
     return nullptr;
@@ -256,14 +334,14 @@ mcs::ObjectMessage SpaceEntityStatePatcher::CreateObjectMessage() const
 
     std::scoped_lock<std::mutex> ComponentsLocker(DirtyComponentsLock);
 
-    for (const std::pair<const uint16_t, SpaceEntityStatePatcher::DirtyComponent>& Component : DirtyComponents)
+    for (const DirtyComponentSlot& Slot : DirtyComponents)
     {
-        assert(Component.second.Component != nullptr && "DirtyComponent given a null component!");
+        assert(Slot.Component.Component != nullptr && "DirtyComponent given a null component!");
 
-        if (Component.second.Component != nullptr)
+        if (Slot.Component.Component != nullptr)
         {
-            auto* RealComponent = Component.second.Component;
-            ComponentPacker.WriteValue(Component.first, RealComponent);
+            auto* RealComponent = Slot.Component.Component;
+            ComponentPacker.WriteValue(Slot.ComponentKey, RealComponent);
         }
     }
 
@@ -272,16 +350,18 @@ mcs::ObjectMessage SpaceEntityStatePatcher::CreateObjectMessage() const
         SpaceEntity.GetIsPersistent(), SpaceEntity.GetOwnerId(), Convert(SpaceEntity.GetParentId()), ComponentPacker.GetComponents() };
 }
 
-mcs::ObjectPatch SpaceEntityStatePatcher::CreateObjectPatch() const
+mcs::CompactObjectPatch SpaceEntityStatePatcher::CreateObjectPatch(mcs::ComponentDataArena& Arena) const
 {
-    MCSComponentPacker ComponentPacker;
+    MCSCompactComponentPacker ComponentPacker { Arena };
 
     // 1. Convert our modified view components to mcs compatible types.
     {
         // Loop through modfied view components and convert to ItemComponentData.
-        for (const std::pair<const SpaceEntityComponentKey, csp::common::ReplicatedValue>& DirtyProp : DirtyProperties)
+        std::scoped_lock<std::mutex> PropertiesLocker(DirtyPropertiesLock);
+
+        for (const DirtyProperty& Dirty : DirtyProperties)
         {
-            ComponentPacker.WriteValue(DirtyProp.first, DirtyProp.second);
+            ComponentPacker.WriteValue(Dirty.PropertyKey, Dirty.Value);
         }
     }
 
@@ -290,14 +370,14 @@ mcs::ObjectPatch SpaceEntityStatePatcher::CreateObjectPatch() const
         std::scoped_lock ComponentsLocker(DirtyComponentsLock);
 
         // Loop through all components and convert to ItemComponentData.
-        for (const std::pair<const uint16_t, SpaceEntityStatePatcher::DirtyComponent>& Component : DirtyComponents)
+        for (const DirtyComponentSlot& Slot : DirtyComponents)
         {
-            assert(Component.second.Component != nullptr && "DirtyComponent given a null component!");
+            assert(Slot.Component.Component != nullptr && "DirtyComponent given a null component!");
 
-            if (Component.second.Component != nullptr)
+            if (Slot.Component.Component != nullptr)
             {
-                auto* RealComponent = Component.second.Component;
-                ComponentPacker.WriteValue(Component.first, RealComponent);
+                auto* RealComponent = Slot.Component.Component;
+                ComponentPacker.WriteValue(Slot.ComponentKey, RealComponent);
             }
         }
     }
@@ -316,8 +396,8 @@ mcs::ObjectPatch SpaceEntityStatePatcher::CreateObjectPatch() const
     // Seems like a bit of a mixed bag here, Components + Parent updates are disconnected state, but pulling Id's from SpaceEntity feels like it
     // leaves us vulnerable to sequencing bugs. Fine if ID + OwnerID never change, but dubious about that for OwnerId.
     const bool HasBeenParentUpdate = NewParentId.HasValue();
-    return mcs::ObjectPatch { SpaceEntity.GetId(), SpaceEntity.GetOwnerId(), false, HasBeenParentUpdate,
-        HasBeenParentUpdate ? Convert(*NewParentId) : Convert(SpaceEntity.GetParentId()), ComponentPacker.GetComponents() };
+    return mcs::CompactObjectPatch { SpaceEntity.GetId(), SpaceEntity.GetOwnerId(), false, HasBeenParentUpdate,
+        HasBeenParentUpdate ? Convert(*NewParentId) : Convert(SpaceEntity.GetParentId()), ComponentPacker.TakeComponents() };
 }
 
 std::unique_ptr<csp::multiplayer::SpaceEntity> SpaceEntityStatePatcher::NewFromObjectMessage(const mcs::ObjectMessage& Message,
@@ -385,11 +465,11 @@ void SpaceEntityStatePatcher::ApplyPatchFromObjectPatch(const mcs::ObjectPatch&
     SpaceEntityUpdateFlags UpdateFlags = SpaceEntityUpdateFlags(0);
     csp::common::Array<ComponentUpdateInfo> ComponentUpdates(0);
 
-    auto PatchComponents = Patch.GetComponents();
+    const auto& PatchComponents = Patch.GetComponents();
 
     if (PatchComponents.has_value())
     {
-        MCSComponentUnpacker ComponentUnpacker { *Patch.GetComponents() };
+        MCSComponentUnpacker ComponentUnpacker { *PatchComponents };
         uint64_t ComponentCount = ComponentUnpacker.GetRuntimeComponentsCount();
 
         if (ComponentCount > 0)
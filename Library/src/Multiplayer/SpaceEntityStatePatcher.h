@@ -25,11 +25,13 @@
 #include "Multiplayer/MCSComponentPacker.h"
 #include "Multiplayer/SpaceEntityKeys.h"
 
+#include <bitset>
 #include <cstdint>
 #include <mutex>
 #include <set>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace csp::common
 {
@@ -139,11 +141,12 @@ public:
         // A value was changed, but before a patch is sent,
         // the value is set back to its original value.
         // This will prevent a redundant patch from being sent.
-        DirtyProperties.erase(PropertyKey);
+        EraseDirtyProperty(PropertyKey);
 
         if (NewValue != static_cast<U>(PriorValue))
         {
-            DirtyProperties[PropertyKey] = csp::common::ReplicatedValue(NewValue);
+            DirtyPropertyBits.set(GetDirtyPropertyBit(PropertyKey));
+            DirtyProperties.push_back({ PropertyKey, csp::common::ReplicatedValue(NewValue) });
             return true;
         }
         else
@@ -160,8 +163,27 @@ public:
     //        Second: Record of all component updates made in the patch application
     [[nodiscard]] std::pair<SpaceEntityUpdateFlags, csp::common::Array<ComponentUpdateInfo>> ApplyLocalPatch();
 
-    std::unordered_map<SpaceEntityComponentKey, csp::common::ReplicatedValue> GetDirtyProperties() const;
-    std::unordered_map<uint16_t, DirtyComponent> GetDirtyComponents() const;
+    // Whether the given entity property has a pending value waiting to be sent in the next patch.
+    bool IsPropertyDirty(SpaceEntityComponentKey PropertyKey) const;
+
+    // Whether a component with the given key has a pending add/update/delete waiting to be sent in the next patch.
+    bool IsComponentDirty(uint16_t ComponentKey) const;
+
+    size_t GetDirtyPropertyCount() const;
+    size_t GetDirtyComponentCount() const;
+    size_t GetPendingComponentDeletionCount() const;
+
+    // Invokes Visitor(uint16_t ComponentKey, const DirtyComponent& Component) for each dirty component, in the order they were made dirty.
+    // The dirty components lock is held for the duration of the visit, so the visitor must not call back into this patcher.
+    template <typename VisitorType> void VisitDirtyComponents(VisitorType&& Visitor) const
+    {
+        std::scoped_lock<std::mutex> ComponentsLocker(DirtyComponentsLock);
+
+        for (const DirtyComponentSlot& Slot : DirtyComponents)
+        {
+            Visitor(Slot.ComponentKey, Slot.Component);
+        }
+    }
 
     std::chrono::milliseconds GetTimeOfLastPatch() const;
     void SetTimeOfLastPatch(std::chrono::milliseconds NewTimeOfLastPatch);
@@ -176,7 +198,8 @@ public:
         = { ComponentUpdateType::Add, ComponentUpdateType::Update, ComponentUpdateType::Delete }) const;
 
     [[nodiscard]] mcs::ObjectMessage CreateObjectMessage() const;
-    [[nodiscard]] mcs::ObjectPatch CreateObjectPatch() const;
+    // Strings and component maps in the patch are allocated from Arena, so it must outlive the patch.
+    [[nodiscard]] mcs::CompactObjectPatch CreateObjectPatch(mcs::ComponentDataArena& Arena) const;
 
     [[nodiscard]] static std::unique_ptr<csp::multiplayer::SpaceEntity> NewFromObjectMessage(const mcs::ObjectMessage& Message,
         csp::common::IRealtimeEngine& RealtimeEngine, csp::common::IJSScriptRunner& ScriptRunner, csp::common::LogSystem& LogSystem);
@@ -195,13 +218,42 @@ public:
     void RegisterProperties(const csp::common::Array<EntityProperty>& Properties);
 
 private:
+    struct DirtyProperty
+    {
+        SpaceEntityComponentKey PropertyKey;
+        csp::common::ReplicatedValue Value;
+    };
+
+    struct DirtyComponentSlot
+    {
+        uint16_t ComponentKey;
+        DirtyComponent Component;
+    };
+
+    // Entity property keys all live in the reserved view range at the top of the key space, so they map directly onto a fixed size bitset.
+    static constexpr size_t DIRTY_PROPERTY_BIT_COUNT = static_cast<size_t>(COMPONENT_KEYS_END_VIEWS - COMPONENT_KEYS_START_VIEWS) + 1;
+
+    static size_t GetDirtyPropertyBit(SpaceEntityComponentKey PropertyKey)
+    {
+        return static_cast<size_t>(static_cast<uint16_t>(PropertyKey) - COMPONENT_KEYS_START_VIEWS);
+    }
+
+    // Expects DirtyPropertiesLock to be held.
+    void EraseDirtyProperty(SpaceEntityComponentKey PropertyKey);
+
+    // Expects DirtyComponentsLock to be held. Returns DirtyComponents.size() if the key is not dirty.
+    size_t FindDirtyComponentSlot(uint16_t ComponentKey) const;
+
     CSP_START_IGNORE
     mutable std::mutex DirtyPropertiesLock;
     mutable std::mutex DirtyComponentsLock;
     CSP_END_IGNORE
 
-    std::unordered_map<SpaceEntityComponentKey, csp::common::ReplicatedValue> DirtyProperties;
-    std::unordered_map<uint16_t, DirtyComponent> DirtyComponents;
+    // Dirty state is kept in dense arrays that are cleared, rather than freed, once a patch has been applied, so the storage is reused from
+    // patch to patch. The bitset mirrors the keys in DirtyProperties so that membership checks never have to scan or copy.
+    std::bitset<DIRTY_PROPERTY_BIT_COUNT> DirtyPropertyBits;
+    std::vector<DirtyProperty> DirtyProperties;
+    std::vector<DirtyComponentSlot> DirtyComponents;
     csp::common::List<uint16_t> TransientDeletionComponentIds;
     std::chrono::milliseconds TimeOfLastPatch;
 
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Multiplayer/SpaceEntityTickList.h"
+
+#include "CSP/Common/Interfaces/IJSScriptRunner.h"
+#include "CSP/Multiplayer/SpaceEntity.h"
+
+namespace csp::multiplayer
+{
+
+void SpaceEntityTickList::Add(const SpaceEntity* Entity, const csp::common::String& CallbackName)
+{
+    if (Entity == nullptr)
+    {
+        return;
+    }
+
+    std::scoped_lock TickListLocker(Lock);
+
+    auto [It, Inserted] = PositionsById.emplace(Entity->GetId(), ContextIds.size());
+
+    if (Inserted)
+    {
+        ContextIds.push_back(static_cast<int64_t>(Entity->GetId()));
+        CallbackNames.push_back(CallbackName);
+    }
+    else
+    {
+        CallbackNames[It->second] = CallbackName;
+    }
+}
+
+void SpaceEntityTickList::Remove(const SpaceEntity* Entity)
+{
+    if (Entity == nullptr)
+    {
+        return;
+    }
+
+    std::scoped_lock TickListLocker(Lock);
+
+    auto It = PositionsById.find(Entity->GetId());
+
+    if (It == PositionsById.end())
+    {
+        return;
+    }
+
+    const size_t Position = It->second;
+    const size_t LastPosition = ContextIds.size() - 1;
+
+    PositionsById.erase(It);
+
+    // Move the last entry into the gap so the vectors never have to shift.
+    if (Position != LastPosition)
+    {
+        ContextIds[Position] = ContextIds[LastPosition];
+        CallbackNames[Position] = std::move(CallbackNames[LastPosition]);
+        PositionsById[static_cast<uint64_t>(ContextIds[Position])] = Position;
+    }
+
+    ContextIds.pop_back();
+    CallbackNames.pop_back();
+}
+
+bool SpaceEntityTickList::Contains(const SpaceEntity* Entity) const
+{
+    if (Entity == nullptr)
+    {
+        return false;
+    }
+
+    std::scoped_lock TickListLocker(Lock);
+
+    return PositionsById.count(Entity->GetId()) > 0;
+}
+
+void SpaceEntityTickList::Clear()
+{
+    std::scoped_lock TickListLocker(Lock);
+
+    ContextIds.clear();
+    CallbackNames.clear();
+    PositionsById.clear();
+}
+
+size_t SpaceEntityTickList::Size() const
+{
+    std::scoped_lock TickListLocker(Lock);
+
+    return ContextIds.size();
+}
+
+void SpaceEntityTickList::PostToAll(
+    csp::common::IJSScriptRunner& ScriptRunner, const csp::common::String& Message, const csp::common::String& MessageParamsJson, double Value)
+{
+    {
+        std::scoped_lock TickListLocker(Lock);
+
+        // Assigning into the existing vectors reuses their storage.
+        PostContextIds = ContextIds;
+        PostCallbackNames = CallbackNames;
+    }
+
+    if (PostContextIds.empty())
+    {
+        return;
+    }
+
+    ScriptRunner.PostMessageToContexts(PostContextIds.data(), PostCallbackNames.data(), PostContextIds.size(), Message, MessageParamsJson, Value);
+}
+
+} // namespace csp::multiplayer
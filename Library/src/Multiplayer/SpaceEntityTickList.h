@@ -0,0 +1,76 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CSP/Common/String.h"
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace csp::common
+{
+class IJSScriptRunner;
+}
+
+namespace csp::multiplayer
+{
+class SpaceEntity;
+
+/*
+    The entities whose scripts handle the entity tick message, along with the callback each one subscribed with.
+    Engines tick through this rather than every entity they own, so entities without a tick handler cost nothing per tick,
+    and the whole set is handed to the script runner in one call.
+
+    Scripts subscribe while they run, which can happen from within a tick, so unlike SpaceEntityHierarchy this guards
+    itself with its own lock rather than relying on an engine lock. Removal swaps the last entry into the freed slot.
+*/
+class SpaceEntityTickList
+{
+public:
+    // Adds the entity, or updates its callback if it is already in the list.
+    void Add(const SpaceEntity* Entity, const csp::common::String& CallbackName);
+
+    // Removes the entity. Does nothing if it isn't in the list.
+    void Remove(const SpaceEntity* Entity);
+
+    [[nodiscard]] bool Contains(const SpaceEntity* Entity) const;
+
+    void Clear();
+
+    [[nodiscard]] size_t Size() const;
+
+    // Posts the message to every callback in the list, in a single call to the script runner.
+    // The list is copied before posting so callbacks are free to add or remove entities. Expected to be called from the engine tick only.
+    void PostToAll(csp::common::IJSScriptRunner& ScriptRunner, const csp::common::String& Message, const csp::common::String& MessageParamsJson,
+        double Value);
+
+private:
+    mutable std::mutex Lock;
+
+    // Script context ids (which are entity ids) and their callbacks, kept parallel.
+    std::vector<int64_t> ContextIds;
+    std::vector<csp::common::String> CallbackNames;
+    std::unordered_map<uint64_t, size_t> PositionsById;
+
+    // Reused between ticks so posting doesn't allocate once the list has settled.
+    std::vector<int64_t> PostContextIds;
+    std::vector<csp::common::String> PostCallbackNames;
+};
+
+} // namespace csp::multiplayer
@@ -0,0 +1,322 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Multiplayer/TransformBatch.h"
+
+#include "Debug/Profiler.h"
+
+#if defined(__AVX2__)
+#define CSP_TRANSFORM_KERNEL_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CSP_TRANSFORM_KERNEL_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define CSP_TRANSFORM_KERNEL_NEON
+#include <arm_neon.h>
+#endif
+
+namespace csp::multiplayer
+{
+
+namespace
+{
+
+/*
+    The kernels are written once against a "lane" type, which is either a plain float or one of the SIMD wrappers below.
+    Each wrapper only needs loading, storing, broadcasting and the four arithmetic operators.
+*/
+
+#if defined(CSP_TRANSFORM_KERNEL_AVX2)
+
+struct SimdLane
+{
+    static constexpr size_t Width = 8;
+    __m256 Value;
+};
+
+inline SimdLane operator+(SimdLane A, SimdLane B) { return { _mm256_add_ps(A.Value, B.Value) }; }
+inline SimdLane operator-(SimdLane A, SimdLane B) { return { _mm256_sub_ps(A.Value, B.Value) }; }
+inline SimdLane operator*(SimdLane A, SimdLane B) { return { _mm256_mul_ps(A.Value, B.Value) }; }
+inline SimdLane operator/(SimdLane A, SimdLane B) { return { _mm256_div_ps(A.Value, B.Value) }; }
+
+inline SimdLane LoadLane(const float* Source, SimdLane) { return { _mm256_loadu_ps(Source) }; }
+inline void StoreLane(float* Destination, SimdLane Lane) { _mm256_storeu_ps(Destination, Lane.Value); }
+inline SimdLane BroadcastLane(float Value, SimdLane) { return { _mm256_set1_ps(Value) }; }
+
+constexpr const char* KERNEL_NAME = "AVX2";
+
+#elif defined(CSP_TRANSFORM_KERNEL_SSE2)
+
+struct SimdLane
+{
+    static constexpr size_t Width = 4;
+    __m128 Value;
+};
+
+inline SimdLane operator+(SimdLane A, SimdLane B) { return { _mm_add_ps(A.Value, B.Value) }; }
+inline SimdLane operator-(SimdLane A, SimdLane B) { return { _mm_sub_ps(A.Value, B.Value) }; }
+inline SimdLane operator*(SimdLane A, SimdLane B) { return { _mm_mul_ps(A.Value, B.Value) }; }
+inline SimdLane operator/(SimdLane A, SimdLane B) { return { _mm_div_ps(A.Value, B.Value) }; }
+
+inline SimdLane LoadLane(const float* Source, SimdLane) { return { _mm_loadu_ps(Source) }; }
+inline void StoreLane(float* Destination, SimdLane Lane) { _mm_storeu_ps(Destination, Lane.Value); }
+inline SimdLane BroadcastLane(float Value, SimdLane) { return { _mm_set1_ps(Value) }; }
+
+constexpr const char* KERNEL_NAME = "SSE2";
+
+#elif defined(CSP_TRANSFORM_KERNEL_NEON)
+
+struct SimdLane
+{
+    static constexpr size_t Width = 4;
+    float32x4_t Value;
+};
+
+inline SimdLane operator+(SimdLane A, SimdLane B) { return { vaddq_f32(A.Value, B.Value) }; }
+inline SimdLane operator-(SimdLane A, SimdLane B) { return { vsubq_f32(A.Value, B.Value) }; }
+inline SimdLane operator*(SimdLane A, SimdLane B) { return { vmulq_f32(A.Value, B.Value) }; }
+inline SimdLane operator/(SimdLane A, SimdLane B) { return { vdivq_f32(A.Value, B.Value) }; }
+
+inline SimdLane LoadLane(const float* Source, SimdLane) { return { vld1q_f32(Source) }; }
+inline void StoreLane(float* Destination, SimdLane Lane) { vst1q_f32(Destination, Lane.Value); }
+inline SimdLane BroadcastLane(float Value, SimdLane) { return { vdupq_n_f32(Value) }; }
+
+constexpr const char* KERNEL_NAME = "NEON";
+
+#else
+
+constexpr const char* KERNEL_NAME = "Scalar";
+
+#endif
+
+// The lane argument only selects the overload.
+inline float LoadLane(const float* Source, float) { return *Source; }
+inline void StoreLane(float* Destination, float Lane) { *Destination = Lane; }
+inline float BroadcastLane(float Value, float) { return Value; }
+
+template <typename Lane>
+void ComposeLane(const ConstTransformStreams& Parents, const ConstTransformStreams& Locals, const TransformStreams& Out, size_t Index)
+{
+    // Everything is loaded before anything is stored, so Out may alias either input.
+    const Lane ParentPX = LoadLane(Parents.PositionX + Index, Lane {});
+    const Lane ParentPY = LoadLane(Parents.PositionY + Index, Lane {});
+    const Lane ParentPZ = LoadLane(Parents.PositionZ + Index, Lane {});
+    const Lane ParentRX = LoadLane(Parents.RotationX + Index, Lane {});
+    const Lane ParentRY = LoadLane(Parents.RotationY + Index, Lane {});
+    const Lane ParentRZ = LoadLane(Parents.RotationZ + Index, Lane {});
+    const Lane ParentRW = LoadLane(Parents.RotationW + Index, Lane {});
+    const Lane ParentSX = LoadLane(Parents.ScaleX + Index, Lane {});
+    const Lane ParentSY = LoadLane(Parents.ScaleY + Index, Lane {});
+    const Lane ParentSZ = LoadLane(Parents.ScaleZ + Index, Lane {});
+
+    const Lane LocalPX = LoadLane(Locals.PositionX + Index, Lane {});
+    const Lane LocalPY = LoadLane(Locals.PositionY + Index, Lane {});
+    const Lane LocalPZ = LoadLane(Locals.PositionZ + Index, Lane {});
+    const Lane LocalRX = LoadLane(Locals.RotationX + Index, Lane {});
+    const Lane LocalRY = LoadLane(Locals.RotationY + Index, Lane {});
+    const Lane LocalRZ = LoadLane(Locals.RotationZ + Index, Lane {});
+    const Lane LocalRW = LoadLane(Locals.RotationW + Index, Lane {});
+    const Lane LocalSX = LoadLane(Locals.ScaleX + Index, Lane {});
+    const Lane LocalSY = LoadLane(Locals.ScaleY + Index, Lane {});
+    const Lane LocalSZ = LoadLane(Locals.ScaleZ + Index, Lane {});
+
+    const Lane Two = BroadcastLane(2.0f, Lane {});
+
+    // Scale the local position by the parent, then rotate it: V' = V + W * T + U x T, where T = 2 * (U x V).
+    const Lane VX = ParentSX * LocalPX;
+    const Lane VY = ParentSY * LocalPY;
+    const Lane VZ = ParentSZ * LocalPZ;
+
+    const Lane TX = Two * (ParentRY * VZ - ParentRZ * VY);
+    const Lane TY = Two * (ParentRZ * VX - ParentRX * VZ);
+    const Lane TZ = Two * (ParentRX * VY - ParentRY * VX);
+
+    StoreLane(Out.PositionX + Index, ParentPX + VX + ParentRW * TX + (ParentRY * TZ - ParentRZ * TY));
+    StoreLane(Out.PositionY + Index, ParentPY + VY + ParentRW * TY + (ParentRZ * TX - ParentRX * TZ));
+    StoreLane(Out.PositionZ + Index, ParentPZ + VZ + ParentRW * TZ + (ParentRX * TY - ParentRY * TX));
+
+    StoreLane(Out.RotationX + Index, ParentRW * LocalRX + ParentRX * LocalRW + ParentRY * LocalRZ - ParentRZ * LocalRY);
+    StoreLane(Out.RotationY + Index, ParentRW * LocalRY - ParentRX * LocalRZ + ParentRY * LocalRW + ParentRZ * LocalRX);
+    StoreLane(Out.RotationZ + Index, ParentRW * LocalRZ + ParentRX * LocalRY - ParentRY * LocalRX + ParentRZ * LocalRW);
+    StoreLane(Out.RotationW + Index, ParentRW * LocalRW - ParentRX * LocalRX - ParentRY * LocalRY - ParentRZ * LocalRZ);
+
+    StoreLane(Out.ScaleX + Index, ParentSX * LocalSX);
+    StoreLane(Out.ScaleY + Index, ParentSY * LocalSY);
+    StoreLane(Out.ScaleZ + Index, ParentSZ * LocalSZ);
+}
+
+template <typename Lane> void InvertLane(const ConstTransformStreams& Transforms, const TransformStreams& Out, size_t Index)
+{
+    const Lane PX = LoadLane(Transforms.PositionX + Index, Lane {});
+    const Lane PY = LoadLane(Transforms.PositionY + Index, Lane {});
+    const Lane PZ = LoadLane(Transforms.PositionZ + Index, Lane {});
+    const Lane RW = LoadLane(Transforms.RotationW + Index, Lane {});
+    const Lane SX = LoadLane(Transforms.ScaleX + Index, Lane {});
+    const Lane SY = LoadLane(Transforms.ScaleY + Index, Lane {});
+    const Lane SZ = LoadLane(Transforms.ScaleZ + Index, Lane {});
+
+    const Lane Zero = BroadcastLane(0.0f, Lane {});
+    const Lane One = BroadcastLane(1.0f, Lane {});
+    const Lane Two = BroadcastLane(2.0f, Lane {});
+
+    // The inverse rotation is the conjugate
+    const Lane RX = Zero - LoadLane(Transforms.RotationX + Index, Lane {});
+    const Lane RY = Zero - LoadLane(Transforms.RotationY + Index, Lane {});
+    const Lane RZ = Zero - LoadLane(Transforms.RotationZ + Index, Lane {});
+
+    const Lane InverseSX = One / SX;
+    const Lane InverseSY = One / SY;
+    const Lane InverseSZ = One / SZ;
+
+    // The inverse position undoes the translation, so it's the original position put through the inverse scale and rotation, negated.
+    const Lane VX = InverseSX * PX;
+    const Lane VY = InverseSY * PY;
+    const Lane VZ = InverseSZ * PZ;
+
+    const Lane TX = Two * (RY * VZ - RZ * VY);
+    const Lane TY = Two * (RZ * VX - RX * VZ);
+    const Lane TZ = Two * (RX * VY - RY * VX);
+
+    StoreLane(Out.PositionX + Index, Zero - (VX + RW * TX + (RY * TZ - RZ * TY)));
+    StoreLane(Out.PositionY + Index, Zero - (VY + RW * TY + (RZ * TX - RX * TZ)));
+    StoreLane(Out.PositionZ + Index, Zero - (VZ + RW * TZ + (RX * TY - RY * TX)));
+
+    StoreLane(Out.RotationX + Index, RX);
+    StoreLane(Out.RotationY + Index, RY);
+    StoreLane(Out.RotationZ + Index, RZ);
+    StoreLane(Out.RotationW + Index, RW);
+
+    StoreLane(Out.ScaleX + Index, InverseSX);
+    StoreLane(Out.ScaleY + Index, InverseSY);
+    StoreLane(Out.ScaleZ + Index, InverseSZ);
+}
+
+// Points a set of streams at a single SpaceTransform, so the single transform functions can share the scalar kernel.
+ConstTransformStreams StreamsOf(const SpaceTransform& Transform)
+{
+    return { &Transform.Position.X, &Transform.Position.Y, &Transform.Position.Z, &Transform.Rotation.X, &Transform.Rotation.Y,
+        &Transform.Rotation.Z, &Transform.Rotation.W, &Transform.Scale.X, &Transform.Scale.Y, &Transform.Scale.Z };
+}
+
+TransformStreams StreamsOf(SpaceTransform& Transform)
+{
+    return { &Transform.Position.X, &Transform.Position.Y, &Transform.Position.Z, &Transform.Rotation.X, &Transform.Rotation.Y,
+        &Transform.Rotation.Z, &Transform.Rotation.W, &Transform.Scale.X, &Transform.Scale.Y, &Transform.Scale.Z };
+}
+
+} // namespace
+
+size_t TransformBuffer::Size() const { return PositionX.size(); }
+
+void TransformBuffer::Resize(size_t Count)
+{
+    for (std::vector<float>* Channel :
+        { &PositionX, &PositionY, &PositionZ, &RotationX, &RotationY, &RotationZ, &RotationW, &ScaleX, &ScaleY, &ScaleZ })
+    {
+        Channel->resize(Count);
+    }
+}
+
+void TransformBuffer::Set(size_t Index, const SpaceTransform& Transform)
+{
+    PositionX[Index] = Transform.Position.X;
+    PositionY[Index] = Transform.Position.Y;
+    PositionZ[Index] = Transform.Position.Z;
+    RotationX[Index] = Transform.Rotation.X;
+    RotationY[Index] = Transform.Rotation.Y;
+    RotationZ[Index] = Transform.Rotation.Z;
+    RotationW[Index] = Transform.Rotation.W;
+    ScaleX[Index] = Transform.Scale.X;
+    ScaleY[Index] = Transform.Scale.Y;
+    ScaleZ[Index] = Transform.Scale.Z;
+}
+
+SpaceTransform TransformBuffer::Get(size_t Index) const
+{
+    return SpaceTransform { { PositionX[Index], PositionY[Index], PositionZ[Index] },
+        { RotationX[Index], RotationY[Index], RotationZ[Index], RotationW[Index] }, { ScaleX[Index], ScaleY[Index], ScaleZ[Index] } };
+}
+
+TransformStreams TransformBuffer::GetStreams()
+{
+    return { PositionX.data(), PositionY.data(), PositionZ.data(), RotationX.data(), RotationY.data(), RotationZ.data(), RotationW.data(),
+        ScaleX.data(), ScaleY.data(), ScaleZ.data() };
+}
+
+ConstTransformStreams TransformBuffer::GetStreams() const
+{
+    return { PositionX.data(), PositionY.data(), PositionZ.data(), RotationX.data(), RotationY.data(), RotationZ.data(), RotationW.data(),
+        ScaleX.data(), ScaleY.data(), ScaleZ.data() };
+}
+
+void ComposeTransforms(const ConstTransformStreams& Parents, const ConstTransformStreams& Locals, const TransformStreams& Out, size_t Count)
+{
+    CSP_PROFILE_SCOPED();
+
+    size_t Index = 0;
+
+#if defined(CSP_TRANSFORM_KERNEL_AVX2) || defined(CSP_TRANSFORM_KERNEL_SSE2) || defined(CSP_TRANSFORM_KERNEL_NEON)
+    for (; Index + SimdLane::Width <= Count; Index += SimdLane::Width)
+    {
+        ComposeLane<SimdLane>(Parents, Locals, Out, Index);
+    }
+#endif
+
+    for (; Index < Count; ++Index)
+    {
+        ComposeLane<float>(Parents, Locals, Out, Index);
+    }
+}
+
+void InvertTransforms(const ConstTransformStreams& Transforms, const TransformStreams& Out, size_t Count)
+{
+    CSP_PROFILE_SCOPED();
+
+    size_t Index = 0;
+
+#if defined(CSP_TRANSFORM_KERNEL_AVX2) || defined(CSP_TRANSFORM_KERNEL_SSE2) || defined(CSP_TRANSFORM_KERNEL_NEON)
+    for (; Index + SimdLane::Width <= Count; Index += SimdLane::Width)
+    {
+        InvertLane<SimdLane>(Transforms, Out, Index);
+    }
+#endif
+
+    for (; Index < Count; ++Index)
+    {
+        InvertLane<float>(Transforms, Out, Index);
+    }
+}
+
+SpaceTransform ComposeTransform(const SpaceTransform& Parent, const SpaceTransform& Local)
+{
+    SpaceTransform Result;
+    ComposeLane<float>(StreamsOf(Parent), StreamsOf(Local), StreamsOf(Result), 0);
+
+    return Result;
+}
+
+SpaceTransform InvertTransform(const SpaceTransform& Transform)
+{
+    SpaceTransform Result;
+    InvertLane<float>(StreamsOf(Transform), StreamsOf(Result), 0);
+
+    return Result;
+}
+
+const char* GetTransformKernelName() { return KERNEL_NAME; }
+
+} // namespace csp::multiplayer
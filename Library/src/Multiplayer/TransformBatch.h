@@ -0,0 +1,104 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CSP/Multiplayer/SpaceTransform.h"
+
+#include <cstddef>
+#include <vector>
+
+/*
+    Batched composition and inversion of SpaceTransforms.
+
+    Transforms are held as structure-of-arrays, one float channel per component, so the kernels can process several
+    transforms per instruction. The instruction set is chosen at compile time:
+      - AVX2 (8 wide) when the build targets it.
+      - SSE2 (4 wide) on any other x86-64 target.
+      - NEON (4 wide) on AArch64.
+      - Scalar everywhere else, such as WASM.
+    Entries that don't fill a whole SIMD batch are handled by the scalar path, which is also what the single transform
+    functions use, so batched and single results agree to within float rounding.
+
+    Composition follows the convention SpaceEntity uses for global transforms: the local position is scaled, rotated and then
+    translated by the parent, rotations are multiplied, and scales are multiplied component-wise.
+*/
+
+namespace csp::multiplayer
+{
+
+/// @brief Pointers to the channels of a structure-of-arrays transform buffer.
+template <typename FloatType> struct BasicTransformStreams
+{
+    FloatType* PositionX;
+    FloatType* PositionY;
+    FloatType* PositionZ;
+    FloatType* RotationX;
+    FloatType* RotationY;
+    FloatType* RotationZ;
+    FloatType* RotationW;
+    FloatType* ScaleX;
+    FloatType* ScaleY;
+    FloatType* ScaleZ;
+};
+
+using TransformStreams = BasicTransformStreams<float>;
+using ConstTransformStreams = BasicTransformStreams<const float>;
+
+/// @brief A resizable structure-of-arrays buffer of transforms, to feed the batch kernels.
+class TransformBuffer
+{
+public:
+    size_t Size() const;
+
+    // Newly added entries are uninitialised.
+    void Resize(size_t Count);
+
+    void Set(size_t Index, const SpaceTransform& Transform);
+    SpaceTransform Get(size_t Index) const;
+
+    TransformStreams GetStreams();
+    ConstTransformStreams GetStreams() const;
+
+private:
+    std::vector<float> PositionX;
+    std::vector<float> PositionY;
+    std::vector<float> PositionZ;
+    std::vector<float> RotationX;
+    std::vector<float> RotationY;
+    std::vector<float> RotationZ;
+    std::vector<float> RotationW;
+    std::vector<float> ScaleX;
+    std::vector<float> ScaleY;
+    std::vector<float> ScaleZ;
+};
+
+// Composes each parent transform with the local transform at the same index, writing the results to Out.
+// Out may be the same buffer as Parents or Locals.
+void ComposeTransforms(const ConstTransformStreams& Parents, const ConstTransformStreams& Locals, const TransformStreams& Out, size_t Count);
+
+// Inverts each transform, such that composing the inverse with the original gives the identity transform.
+// Rotations are expected to be normalized. As composition treats scale as if it commutes with rotation, the inverse only takes
+// global positions exactly into local space when the scale is uniform. Out may be the same buffer as Transforms.
+void InvertTransforms(const ConstTransformStreams& Transforms, const TransformStreams& Out, size_t Count);
+
+SpaceTransform ComposeTransform(const SpaceTransform& Parent, const SpaceTransform& Local);
+SpaceTransform InvertTransform(const SpaceTransform& Transform);
+
+// The instruction set the batch kernels were compiled for, for diagnostics and benchmarks.
+const char* GetTransformKernelName();
+
+} // namespace csp::multiplayer
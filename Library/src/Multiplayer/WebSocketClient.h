@@ -36,6 +36,10 @@ public:
     virtual void Send(const std::string& Message, CallbackHandler Callback) = 0;
     virtual void Receive(ReceiveHandler Callback) = 0;
 
+    // Whether sends are being queued faster than they can be written to the socket. Callers that can hold back (or merge) what they
+    // send should do so until this clears.
+    virtual bool IsSendBackPressured() const { return false; }
+
     // This function is used for testing unexpected connection terminations by causing the internal signalr connection to close.
     virtual void __CauseFailure() = 0;
 };
@@ -18,6 +18,7 @@
 
 #include "CSP/CSPFoundation.h"
 #include "CallHelpers.h"
+#include "Common/Systems/Log/LogFormat.h"
 #include "Events/EventListener.h"
 #include "Events/EventSystem.h"
 #include "Services/UserService/Api.h"
@@ -175,10 +176,8 @@ void AnalyticsSystem::SendAnalyticsEvent(const String& ProductContextSection, co
 
         if (Result.GetResultCode() == csp::systems::EResultCode::Failed)
         {
-            LogSystem->LogMsg(common::LogLevel::Error,
-                fmt::format("Failed to send Analytics Event. ResCode: {}, HttpResCode: {}", static_cast<int>(Result.GetResultCode()),
-                    Result.GetHttpResultCode())
-                    .c_str());
+            CSP_LOG_FMT(LogSystem, common::LogLevel::Error, "Failed to send Analytics Event. ResCode: {}, HttpResCode: {}",
+                static_cast<int>(Result.GetResultCode()), Result.GetHttpResultCode());
         }
 
         INVOKE_IF_NOT_NULL(Callback, Result);
@@ -238,10 +237,8 @@ void AnalyticsSystem::FlushAnalyticsEventsQueue(NullResultCallback Callback)
         }
         else if (Result.GetResultCode() == csp::systems::EResultCode::Failed)
         {
-            LogSystem->LogMsg(common::LogLevel::Error,
-                fmt::format("Failed to send Analytics Event. ResCode: {}, HttpResCode: {}", static_cast<int>(Result.GetResultCode()),
-                    Result.GetHttpResultCode())
-                    .c_str());
+            CSP_LOG_FMT(LogSystem, common::LogLevel::Error, "Failed to send Analytics Event. ResCode: {}, HttpResCode: {}",
+                static_cast<int>(Result.GetResultCode()), Result.GetHttpResultCode());
         }
 
         if (Callback)
@@ -18,12 +18,126 @@
 #include "CSP/Common/StringFormat.h"
 #include "CSP/Systems/Assets/AssetCollection.h"
 #include "Common/Convert.h"
+#include "Common/Web/HttpPayload.h"
 #include "Services/ApiBase/ApiBase.h"
 #include "Services/PrototypeService/AssetFileDto.h"
 #include "Services/PrototypeService/Dto.h"
 
+#include <cstring>
+#include <fstream>
+
 namespace chs = csp::services::generated::prototypeservice;
 
+namespace
+{
+
+class FileResponseSink : public csp::web::HttpResponseSink
+{
+public:
+    FileResponseSink(const csp::common::String& InFilePath)
+        : FilePath(InFilePath.c_str())
+    {
+    }
+
+    bool Begin(const std::optional<size_t>& /*ContentLength*/) override
+    {
+        // Reopening truncates anything written by an earlier attempt.
+        File.close();
+        File.open(FilePath, std::ios::out | std::ios::binary | std::ios::trunc);
+
+        return File.is_open();
+    }
+
+    bool Write(const char* Data, size_t DataLength) override
+    {
+        File.write(Data, static_cast<std::streamsize>(DataLength));
+
+        return File.good();
+    }
+
+    bool End() override
+    {
+        File.close();
+
+        return File.good();
+    }
+
+private:
+    std::string FilePath;
+    std::ofstream File;
+};
+
+class BufferResponseSink : public csp::web::HttpResponseSink
+{
+public:
+    BufferResponseSink(void* InBuffer, size_t InBufferLength)
+        : Buffer(static_cast<char*>(InBuffer))
+        , BufferLength(InBufferLength)
+        , Offset(0)
+    {
+    }
+
+    bool Begin(const std::optional<size_t>& ContentLength) override
+    {
+        Offset = 0;
+
+        return Buffer != nullptr && ContentLength.value_or(0) <= BufferLength;
+    }
+
+    bool Write(const char* Data, size_t DataLength) override
+    {
+        if (DataLength > BufferLength - Offset)
+        {
+            return false;
+        }
+
+        memcpy(Buffer + Offset, Data, DataLength);
+        Offset += DataLength;
+
+        return true;
+    }
+
+    bool End() override { return true; }
+
+private:
+    char* Buffer;
+    size_t BufferLength;
+    size_t Offset;
+};
+
+class CallbackResponseSink : public csp::web::HttpResponseSink
+{
+public:
+    CallbackResponseSink(const csp::systems::AssetDataChunkCallback& InCallback)
+        : Callback(InCallback)
+        , Offset(0)
+    {
+    }
+
+    bool Begin(const std::optional<size_t>& /*ContentLength*/) override
+    {
+        Offset = 0;
+
+        return Callback != nullptr;
+    }
+
+    bool Write(const char* Data, size_t DataLength) override
+    {
+        Callback(Data, DataLength, Offset);
+        Offset += DataLength;
+
+        return true;
+    }
+
+    bool End() override { return true; }
+
+private:
+    csp::systems::AssetDataChunkCallback Callback;
+    uint64_t Offset;
+};
+
+} // namespace
+
 namespace csp::systems
 {
 
@@ -239,6 +353,29 @@ void BufferAssetDataSource::SetUploadContent(
         InPayload, reinterpret_cast<const char*>(Buffer), BufferLength, InAsset.FileName, Version.c_str(), MimeType);
 }
 
+std::shared_ptr<csp::web::HttpResponseSink> FileAssetDataSink::CreateResponseSink() const
+{
+    assert(!FilePath.IsEmpty());
+
+    return std::make_shared<FileResponseSink>(FilePath);
+}
+
+BufferAssetDataSink::BufferAssetDataSink()
+    : Buffer(nullptr)
+    , BufferLength(0)
+{
+}
+
+std::shared_ptr<csp::web::HttpResponseSink> BufferAssetDataSink::CreateResponseSink() const
+{
+    return std::make_shared<BufferResponseSink>(Buffer, BufferLength);
+}
+
+std::shared_ptr<csp::web::HttpResponseSink> CallbackAssetDataSink::CreateResponseSink() const
+{
+    return std::make_shared<CallbackResponseSink>(Callback);
+}
+
 Asset& AssetResult::GetAsset() { return Asset; }
 
 const Asset& AssetResult::GetAsset() const { return Asset; }
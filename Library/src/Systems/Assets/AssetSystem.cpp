@@ -23,6 +23,7 @@
 #include "LODHelpers.h"
 #include "Multiplayer/NetworkEventSerialisation.h"
 #include "Services/PrototypeService/Api.h"
+#include "Systems/Assets/RangedAssetDownload.h"
 #include "Systems/ResultHelpers.h"
 #include "Web/RemoteFileManager.h"
 
@@ -35,6 +36,7 @@
 #include <fmt/format.h>
 
 #include <algorithm>
+#include <atomic>
 
 using namespace csp;
 using namespace csp::common;
@@ -227,6 +229,39 @@ csp::common::String CreateUniqueMaterialFileName(const csp::common::String& Name
     return MATERIAL_FILE_NAME_PREFIX + SpaceId + "_" + Name + ".json";
 }
 
+// Passes a download through to an asset data sink, keeping count of how much was written so it can be reported in the result.
+class CountingResponseSink : public web::HttpResponseSink
+{
+public:
+    CountingResponseSink(std::shared_ptr<web::HttpResponseSink> InSink)
+        : Sink(std::move(InSink))
+        , BytesWritten(0)
+    {
+    }
+
+    bool Begin(const std::optional<size_t>& ContentLength) override
+    {
+        BytesWritten = 0;
+
+        return Sink->Begin(ContentLength);
+    }
+
+    bool Write(const char* Data, size_t DataLength) override
+    {
+        BytesWritten += DataLength;
+
+        return Sink->Write(Data, DataLength);
+    }
+
+    bool End() override { return Sink->End(); }
+
+    uint64_t GetBytesWritten() const { return BytesWritten; }
+
+private:
+    std::shared_ptr<web::HttpResponseSink> Sink;
+    std::atomic<uint64_t> BytesWritten;
+};
+
 } // namespace
 
 namespace csp::systems
@@ -1308,6 +1343,48 @@ void AssetSystem::DownloadAssetDataEx(const Asset& Asset, CancellationToken& Can
     FileManager->GetFile(Asset.Uri, ResponseHandler, CancellationToken);
 }
 
+void AssetSystem::DownloadAssetDataToSink(
+    const Asset& Asset, const AssetDataSink& AssetDataSink, CancellationToken& CancellationToken, UInt64ResultCallback Callback)
+{
+    auto Sink = std::make_shared<CountingResponseSink>(AssetDataSink.CreateResponseSink());
+
+    NullResultCallback InternalCallback = [Callback, Sink](const NullResult& Result)
+    {
+        UInt64Result InternalResult(Result.GetResultCode(), Result.GetHttpResultCode());
+
+        if (Result.GetResultCode() == EResultCode::Success)
+        {
+            InternalResult.SetValue(Sink->GetBytesWritten());
+        }
+
+        INVOKE_IF_NOT_NULL(Callback, InternalResult);
+    };
+
+    services::ResponseHandlerPtr ResponseHandler
+        = AssetDetailAPI->CreateHandler<NullResultCallback, NullResult, void, services::NullDto>(InternalCallback, nullptr);
+
+    FileManager->GetFile(Asset.Uri, Sink, ResponseHandler, CancellationToken);
+}
+
+void AssetSystem::DownloadAssetDataToFile(const Asset& Asset, const csp::common::String& FilePath, uint32_t MaxConcurrentRanges,
+    CancellationToken& CancellationToken, UInt64ResultCallback Callback)
+{
+    RangedAssetDownload::CompletionCallback InternalCallback = [Callback](EResultCode ResultCode, uint16_t HttpResultCode, uint64_t FileSize)
+    {
+        UInt64Result InternalResult(ResultCode, HttpResultCode);
+
+        if (ResultCode == EResultCode::Success)
+        {
+            InternalResult.SetValue(FileSize);
+        }
+
+        INVOKE_IF_NOT_NULL(Callback, InternalResult);
+    };
+
+    RangedAssetDownload::Start(FileManager, AssetDetailAPI, Asset.Uri, FilePath, MaxConcurrentRanges, RangedAssetDownload::DEFAULT_SEGMENT_SIZE,
+        CancellationToken, InternalCallback);
+}
+
 void AssetSystem::GetAssetDataSize(const Asset& Asset, UInt64ResultCallback Callback)
 {
     HTTPHeadersResultCallback InternalCallback = [Callback](const HTTPHeadersResult& Result)
@@ -0,0 +1,661 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Systems/Assets/RangedAssetDownload.h"
+
+#include "CSP/Systems/Assets/Asset.h"
+#include "CSP/Systems/SystemsResult.h"
+#include "CallHelpers.h"
+#include "Common/Web/HttpPayload.h"
+#include "Debug/Logging.h"
+#include "Services/ApiBase/ApiBase.h"
+#include "Web/RemoteFileManager.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+
+namespace
+{
+
+constexpr uint32_t STATE_FILE_VERSION = 1;
+
+// Writes one segment of a ranged download into its place in the destination file.
+class SegmentFileSink : public csp::web::HttpResponseSink
+{
+public:
+    SegmentFileSink(const std::string& InFilePath, uint64_t InOffset, uint64_t InLength)
+        : FilePath(InFilePath)
+        , Offset(InOffset)
+        , Length(InLength)
+        , Written(0)
+    {
+    }
+
+    bool Begin(const std::optional<size_t>& ContentLength) override
+    {
+        // A retried request starts the segment again from its beginning.
+        File.close();
+        File.clear();
+        File.open(FilePath, std::ios::in | std::ios::out | std::ios::binary);
+        File.seekp(static_cast<std::streamoff>(Offset));
+        Written = 0;
+
+        // A server that ignores the range would send the whole file, which must not be written over the other segments.
+        return File.good() && ContentLength.value_or(Length) == Length;
+    }
+
+    bool Write(const char* Data, size_t DataLength) override
+    {
+        if (DataLength > Length - Written)
+        {
+            return false;
+        }
+
+        File.write(Data, static_cast<std::streamsize>(DataLength));
+        Written += DataLength;
+
+        return File.good();
+    }
+
+    bool End() override
+    {
+        File.close();
+
+        return File.good() && Written == Length;
+    }
+
+private:
+    std::string FilePath;
+    uint64_t Offset;
+    uint64_t Length;
+    uint64_t Written;
+    std::fstream File;
+};
+
+bool IsMD5Digest(const std::string& Value)
+{
+    return Value.size() == 32 && std::all_of(Value.begin(), Value.end(), [](unsigned char c) { return std::isxdigit(c); });
+}
+
+// Re-encodes a hex MD5 digest in base64, as Content-MD5 and x-goog-hash give it, lower-cased to match how the web client hands us headers.
+// Lower-casing loses information, but a mismatch still means the file is not the one the server described.
+std::string HexDigestToLowerBase64(const std::string& HexDigest)
+{
+    static constexpr char Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    std::vector<unsigned char> Bytes;
+
+    for (size_t i = 0; i + 1 < HexDigest.size(); i += 2)
+    {
+        Bytes.push_back(static_cast<unsigned char>(std::stoi(HexDigest.substr(i, 2), nullptr, 16)));
+    }
+
+    std::string Encoded;
+
+    for (size_t i = 0; i < Bytes.size(); i += 3)
+    {
+        const uint32_t Group = (Bytes[i] << 16) | ((i + 1 < Bytes.size() ? Bytes[i + 1] : 0) << 8) | (i + 2 < Bytes.size() ? Bytes[i + 2] : 0);
+
+        Encoded.push_back(Alphabet[(Group >> 18) & 0x3F]);
+        Encoded.push_back(Alphabet[(Group >> 12) & 0x3F]);
+        Encoded.push_back(i + 1 < Bytes.size() ? Alphabet[(Group >> 6) & 0x3F] : '=');
+        Encoded.push_back(i + 2 < Bytes.size() ? Alphabet[Group & 0x3F] : '=');
+    }
+
+    std::transform(Encoded.begin(), Encoded.end(), Encoded.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+    return Encoded;
+}
+
+// Finds the base64 MD5 in an x-goog-hash header, which lists a file's checksums as "crc32c=...,md5=...".
+std::string FindGoogleHashMD5(const std::string& Value)
+{
+    const size_t Start = Value.find("md5=");
+
+    if (Start == std::string::npos)
+    {
+        return {};
+    }
+
+    const size_t End = Value.find(',', Start);
+    std::string MD5 = Value.substr(Start + 4, End == std::string::npos ? std::string::npos : End - Start - 4);
+    MD5.erase(std::remove_if(MD5.begin(), MD5.end(), [](unsigned char c) { return std::isspace(c); }), MD5.end());
+
+    return MD5;
+}
+
+} // namespace
+
+namespace csp::systems
+{
+
+void RangedAssetDownload::Start(web::RemoteFileManager* FileManager, services::ApiBase* Api, const csp::common::String& FileUrl,
+    const csp::common::String& FilePath, uint32_t MaxConcurrentSegments, uint64_t SegmentSize, csp::common::CancellationToken& CancellationToken,
+    CompletionCallback Callback)
+{
+    auto Download = std::make_shared<RangedAssetDownload>(
+        FileManager, Api, FileUrl, FilePath, MaxConcurrentSegments, SegmentSize, CancellationToken, std::move(Callback));
+
+    // The size of the file, and whether the server can send parts of it, decide how it is downloaded.
+    HTTPHeadersResultCallback HeadersCallback = [Download](const HTTPHeadersResult& Result) { Download->OnHeadersReceived(Result); };
+
+    services::ResponseHandlerPtr ResponseHandler
+        = Api->CreateHandler<HTTPHeadersResultCallback, HTTPHeadersResult, void, services::NullDto>(HeadersCallback, nullptr);
+
+    FileManager->GetResponseHeaders(FileUrl, ResponseHandler);
+}
+
+RangedAssetDownload::RangedAssetDownload(web::RemoteFileManager* InFileManager, services::ApiBase* InApi, const csp::common::String& InFileUrl,
+    const csp::common::String& InFilePath, uint32_t InMaxConcurrentSegments, uint64_t InSegmentSize,
+    csp::common::CancellationToken& InCancellationToken, CompletionCallback InCallback)
+    : FileManager(InFileManager)
+    , Api(InApi)
+    , FileUrl(InFileUrl)
+    , FilePath(InFilePath.c_str())
+    , StateFilePath(GetStateFilePath(FilePath))
+    , MaxConcurrentSegments(InMaxConcurrentSegments)
+    , SegmentSize(std::max<uint64_t>(InSegmentSize, 1))
+    , CancellationToken(InCancellationToken)
+    , Callback(std::move(InCallback))
+    , FileSize(0)
+    , HasFileSize(false)
+    , SegmentsInFlight(0)
+    , HasFailed(false)
+    , FailureResultCode(EResultCode::Failed)
+    , FailureHttpResultCode(0)
+{
+#ifdef CSP_WASM
+    // Fetch holds every response in memory until it completes, so there is nothing to gain from splitting the download.
+    MaxConcurrentSegments = 1;
+#endif
+}
+
+std::string RangedAssetDownload::GetStateFilePath(const std::string& FilePath) { return FilePath + ".download"; }
+
+void RangedAssetDownload::OnHeadersReceived(const HTTPHeadersResult& Result)
+{
+    if (Result.GetResultCode() == EResultCode::InProgress)
+    {
+        return;
+    }
+
+    if (Result.GetResultCode() != EResultCode::Success)
+    {
+        Complete(Result.GetResultCode(), Result.GetHttpResultCode());
+        return;
+    }
+
+    // Header names and values have been lower-cased by the web client.
+    const auto& Headers = Result.GetValue();
+
+    if (Headers.HasKey("content-length"))
+    {
+        FileSize = std::strtoull(Headers["content-length"].c_str(), nullptr, 10);
+        HasFileSize = true;
+    }
+
+    const bool AcceptsRanges = Headers.HasKey("accept-ranges") && std::string(Headers["accept-ranges"].c_str()).find("bytes") != std::string::npos;
+
+    if (Headers.HasKey("etag"))
+    {
+        const std::string ETag = Headers["etag"].c_str();
+
+        // Weak ETags don't promise that the bytes are the same, so can't be used to stitch ranges together.
+        if (ETag.rfind("w/", 0) != 0)
+        {
+            Validator = ETag;
+            ValidatorHeader = "etag";
+
+            const std::string Digest = (ETag.size() >= 2 && ETag.front() == '"' && ETag.back() == '"') ? ETag.substr(1, ETag.size() - 2) : ETag;
+
+            if (IsMD5Digest(Digest))
+            {
+                ETagMD5 = Digest;
+            }
+        }
+    }
+
+    if (Headers.HasKey("content-md5"))
+    {
+        ExpectedMD5 = Headers["content-md5"].c_str();
+    }
+    else if (Headers.HasKey("x-goog-hash"))
+    {
+        ExpectedMD5 = FindGoogleHashMD5(Headers["x-goog-hash"].c_str());
+    }
+
+    if (Validator.empty() && Headers.HasKey("last-modified"))
+    {
+        Validator = Headers["last-modified"].c_str();
+        ValidatorHeader = "last-modified";
+    }
+
+    if (AcceptsRanges == false || HasFileSize == false || FileSize <= SegmentSize || MaxConcurrentSegments <= 1)
+    {
+        DownloadWhole();
+        return;
+    }
+
+    if (PrepareSegments() == false)
+    {
+        CSP_LOG_ERROR_FORMAT("Unable to create file for download: %s", FilePath.c_str());
+        Complete(EResultCode::Failed, 0);
+        return;
+    }
+
+    std::vector<size_t> SegmentsToStart;
+
+    {
+        std::scoped_lock Lock(Mutex);
+
+        while (SegmentsToStart.size() < MaxConcurrentSegments && PendingSegments.empty() == false)
+        {
+            SegmentsToStart.push_back(PendingSegments.back());
+            PendingSegments.pop_back();
+        }
+
+        SegmentsInFlight = SegmentsToStart.size();
+    }
+
+    // Everything arrived last time, but the download was interrupted before it could be checked.
+    if (SegmentsToStart.empty())
+    {
+        Verify(static_cast<uint16_t>(web::EResponseCodes::ResponsePartialContent));
+        return;
+    }
+
+    for (size_t Index : SegmentsToStart)
+    {
+        StartSegment(Index);
+    }
+}
+
+void RangedAssetDownload::DownloadWhole()
+{
+    // The file is rewritten from the start, so any progress from an earlier ranged download no longer applies.
+    std::error_code Error;
+    std::filesystem::remove(StateFilePath, Error);
+
+    FileAssetDataSink Sink;
+    Sink.FilePath = FilePath.c_str();
+
+    NullResultCallback DownloadCallback = [Download = shared_from_this()](const NullResult& Result)
+    {
+        if (Result.GetResultCode() == EResultCode::InProgress)
+        {
+            return;
+        }
+
+        Download->OnWholeDownloaded(Result.GetResultCode(), Result.GetHttpResultCode());
+    };
+
+    services::ResponseHandlerPtr ResponseHandler
+        = Api->CreateHandler<NullResultCallback, NullResult, void, services::NullDto>(DownloadCallback, nullptr);
+
+    FileManager->GetFile(FileUrl, static_cast<const AssetDataSink&>(Sink).CreateResponseSink(), ResponseHandler, CancellationToken);
+}
+
+void RangedAssetDownload::OnWholeDownloaded(EResultCode ResultCode, uint16_t HttpResultCode)
+{
+    if (ResultCode != EResultCode::Success)
+    {
+        Complete(ResultCode, HttpResultCode);
+        return;
+    }
+
+    Verify(HttpResultCode);
+}
+
+bool RangedAssetDownload::PrepareSegments()
+{
+    std::scoped_lock Lock(Mutex);
+
+    if (LoadState() == false)
+    {
+        CompletedSegments.assign(static_cast<size_t>((FileSize + SegmentSize - 1) / SegmentSize), false);
+
+        // The file is sized up front, so that each segment can be written to its place in it as soon as it arrives.
+        {
+            std::ofstream File(FilePath, std::ios::out | std::ios::binary | std::ios::trunc);
+
+            if (File.is_open() == false)
+            {
+                return false;
+            }
+        }
+
+        std::error_code Error;
+        std::filesystem::resize_file(FilePath, FileSize, Error);
+
+        if (Error)
+        {
+            return false;
+        }
+
+        if (SaveState() == false)
+        {
+            CSP_LOG_WARN_FORMAT("Unable to save download progress to %s. The download will not be resumable.", StateFilePath.c_str());
+        }
+    }
+    else
+    {
+        CSP_LOG_FORMAT(csp::common::LogLevel::Verbose, "Resuming download of %s", FilePath.c_str());
+    }
+
+    PendingSegments.clear();
+
+    // Pending segments are taken from the back, so they're stored in reverse to download the file roughly in order.
+    for (size_t Index = CompletedSegments.size(); Index-- > 0;)
+    {
+        if (CompletedSegments[Index] == false)
+        {
+            PendingSegments.push_back(Index);
+        }
+    }
+
+    return true;
+}
+
+void RangedAssetDownload::StartSegment(size_t Index)
+{
+    const uint64_t Offset = Index * SegmentSize;
+    const uint64_t Length = std::min(SegmentSize, FileSize - Offset);
+
+    auto Sink = std::make_shared<SegmentFileSink>(FilePath, Offset, Length);
+
+    HTTPHeadersResultCallback SegmentCallback
+        = [Download = shared_from_this(), Index](const HTTPHeadersResult& Result) { Download->OnSegmentDownloaded(Index, Result); };
+
+    services::ResponseHandlerPtr ResponseHandler = Api->CreateHandler<HTTPHeadersResultCallback, HTTPHeadersResult, void, services::NullDto>(
+        SegmentCallback, nullptr, web::EResponseCodes::ResponsePartialContent);
+
+    FileManager->GetFileRange(FileUrl, Offset, Length, Sink, ResponseHandler, CancellationToken);
+}
+
+void RangedAssetDownload::OnSegmentDownloaded(size_t Index, const HTTPHeadersResult& Result)
+{
+    if (Result.GetResultCode() == EResultCode::InProgress)
+    {
+        return;
+    }
+
+    // Checked first, as a cancelled request can end with any status, and shouldn't be reported as a bad range.
+    const bool Cancelled = CancellationToken.Cancelled();
+    const bool Succeeded = Cancelled == false && Result.GetResultCode() == EResultCode::Success && IsExpectedSegmentResponse(Index, Result);
+
+    bool HasNextSegment = false;
+    size_t NextSegment = 0;
+    bool Finished = false;
+
+    {
+        std::scoped_lock Lock(Mutex);
+
+        --SegmentsInFlight;
+
+        if (Succeeded)
+        {
+            CompletedSegments[Index] = true;
+
+            if (SaveState() == false)
+            {
+                CSP_LOG_WARN_FORMAT("Unable to save download progress to %s. The download will not be resumable.", StateFilePath.c_str());
+            }
+        }
+        else if (HasFailed == false)
+        {
+            // Requests are already retried by the web client, so a failed segment fails the download. The segments that did complete are
+            // kept, so calling again resumes from them.
+            HasFailed = true;
+            FailureResultCode = EResultCode::Failed;
+            FailureHttpResultCode
+                = Cancelled ? static_cast<uint16_t>(web::EResponseCodes::ResponseRequestTimeout) : Result.GetHttpResultCode();
+        }
+
+        // The token may have been cancelled since this segment completed, in which case the next one shouldn't be started.
+        if (HasFailed == false && CancellationToken.Cancelled())
+        {
+            HasFailed = true;
+            FailureResultCode = EResultCode::Failed;
+            FailureHttpResultCode = static_cast<uint16_t>(web::EResponseCodes::ResponseRequestTimeout);
+        }
+
+        if (HasFailed)
+        {
+            PendingSegments.clear();
+        }
+        else if (PendingSegments.empty() == false)
+        {
+            HasNextSegment = true;
+            NextSegment = PendingSegments.back();
+            PendingSegments.pop_back();
+            ++SegmentsInFlight;
+        }
+
+        Finished = SegmentsInFlight == 0;
+    }
+
+    if (HasNextSegment)
+    {
+        StartSegment(NextSegment);
+    }
+    else if (Finished)
+    {
+        if (HasFailed)
+        {
+            Complete(FailureResultCode, FailureHttpResultCode);
+        }
+        else
+        {
+            Verify(static_cast<uint16_t>(web::EResponseCodes::ResponsePartialContent));
+        }
+    }
+}
+
+bool RangedAssetDownload::IsExpectedSegmentResponse(size_t Index, const HTTPHeadersResult& Result) const
+{
+    if (Result.GetHttpResultCode() != static_cast<uint16_t>(web::EResponseCodes::ResponsePartialContent))
+    {
+        CSP_LOG_ERROR_FORMAT("Expected partial content for a ranged download, but got HTTP %d", Result.GetHttpResultCode());
+        return false;
+    }
+
+    const auto& Headers = Result.GetValue();
+
+    const uint64_t Offset = Index * SegmentSize;
+    const uint64_t Length = std::min(SegmentSize, FileSize - Offset);
+    const std::string ExpectedRange = fmt::format("bytes {}-{}/{}", Offset, Offset + Length - 1, FileSize);
+
+    if (Headers.HasKey("content-range") == false || ExpectedRange != Headers["content-range"].c_str())
+    {
+        CSP_LOG_ERROR_FORMAT("Ranged download returned a different range to the one requested: %s", ExpectedRange.c_str());
+        return false;
+    }
+
+    // Segments of a file that was replaced part way through the download can't be mixed with the ones before it.
+    if (ValidatorHeader.empty() == false
+        && (Headers.HasKey(ValidatorHeader.c_str()) == false || Validator != Headers[ValidatorHeader.c_str()].c_str()))
+    {
+        CSP_LOG_ERROR_FORMAT("The file being downloaded changed part way through the download: %s", FileUrl.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+bool RangedAssetDownload::LoadState()
+{
+    // Without a validator there's no telling whether the segments on disk came from the same file.
+    if (Validator.empty())
+    {
+        return false;
+    }
+
+    std::ifstream State(StateFilePath);
+
+    if (State.is_open() == false)
+    {
+        return false;
+    }
+
+    uint32_t StateVersion = 0;
+    uint64_t StateFileSize = 0;
+    uint64_t StateSegmentSize = 0;
+    std::string StateValidator;
+    std::string StateSegments;
+
+    State >> StateVersion >> StateFileSize >> StateSegmentSize;
+    State.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    std::getline(State, StateValidator);
+    std::getline(State, StateSegments);
+
+    const size_t SegmentCount = static_cast<size_t>((FileSize + SegmentSize - 1) / SegmentSize);
+
+    if (State.fail() || StateVersion != STATE_FILE_VERSION || StateFileSize != FileSize || StateSegmentSize != SegmentSize
+        || StateValidator != Validator || StateSegments.size() != SegmentCount)
+    {
+        return false;
+    }
+
+    std::error_code Error;
+
+    if (std::filesystem::file_size(FilePath, Error) != FileSize || Error)
+    {
+        return false;
+    }
+
+    CompletedSegments.assign(SegmentCount, false);
+
+    for (size_t Index = 0; Index < SegmentCount; ++Index)
+    {
+        if (StateSegments[Index] != '0' && StateSegments[Index] != '1')
+        {
+            return false;
+        }
+
+        CompletedSegments[Index] = StateSegments[Index] == '1';
+    }
+
+    return true;
+}
+
+bool RangedAssetDownload::SaveState() const
+{
+    // Written in full to a temporary file and then moved into place, so that an interrupted write can't leave a state file that claims
+    // segments the file doesn't have.
+    const std::string TempStateFilePath = StateFilePath + ".tmp";
+
+    {
+        std::ofstream State(TempStateFilePath, std::ios::out | std::ios::trunc);
+
+        State << STATE_FILE_VERSION << ' ' << FileSize << ' ' << SegmentSize << '\n' << Validator << '\n';
+
+        for (bool Completed : CompletedSegments)
+        {
+            State.put(Completed ? '1' : '0');
+        }
+
+        State << '\n';
+        State.close();
+
+        if (State.fail())
+        {
+            return false;
+        }
+    }
+
+    std::error_code Error;
+    std::filesystem::rename(TempStateFilePath, StateFilePath, Error);
+
+    return !Error;
+}
+
+void RangedAssetDownload::Verify(uint16_t HttpResultCode)
+{
+#ifndef CSP_WASM
+    Api->WebClient->EnqueueWork([Download = shared_from_this(), HttpResultCode]() { Download->VerifyFile(HttpResultCode); });
+#else
+    VerifyFile(HttpResultCode);
+#endif
+}
+
+void RangedAssetDownload::VerifyFile(uint16_t HttpResultCode)
+{
+    std::error_code Error;
+    const uint64_t DownloadedSize = std::filesystem::file_size(FilePath, Error);
+
+    if (Error)
+    {
+        CSP_LOG_ERROR_FORMAT("Unable to read downloaded file: %s", FilePath.c_str());
+        Complete(EResultCode::Failed, 0);
+        return;
+    }
+
+    bool IsValid = true;
+
+    if (HasFileSize && DownloadedSize != FileSize)
+    {
+        CSP_LOG_ERROR_FORMAT("Downloaded file %s is %llu bytes, but should be %llu bytes", FilePath.c_str(),
+            static_cast<unsigned long long>(DownloadedSize), static_cast<unsigned long long>(FileSize));
+        IsValid = false;
+    }
+#ifndef CSP_WASM
+    else if (ExpectedMD5.empty() == false || ETagMD5.empty() == false)
+    {
+        const std::string FileMD5 = Api->WebClient->MD5HashFile(FilePath.c_str());
+
+        if (ExpectedMD5.empty() == false)
+        {
+            if (HexDigestToLowerBase64(FileMD5) != ExpectedMD5)
+            {
+                CSP_LOG_ERROR_FORMAT("Downloaded file %s does not match the checksum given by the server", FilePath.c_str());
+                IsValid = false;
+            }
+        }
+        else if (FileMD5 != ETagMD5)
+        {
+            // Plenty of servers use ETags that look like an MD5 but aren't one, so this alone isn't enough to reject the file.
+            CSP_LOG_WARN_FORMAT("Downloaded file %s does not match the MD5 its ETag suggests. The ETag may not be a checksum.", FilePath.c_str());
+        }
+    }
+#endif
+
+    // The state is no longer needed once the download is complete. If the file turned out to be bad, it's dropped too, so that trying again
+    // downloads every segment rather than keeping the bad ones.
+    std::filesystem::remove(StateFilePath, Error);
+
+    if (IsValid == false)
+    {
+        Complete(EResultCode::Failed, 0);
+        return;
+    }
+
+    FileSize = DownloadedSize;
+    Complete(EResultCode::Success, HttpResultCode);
+}
+
+void RangedAssetDownload::Complete(EResultCode ResultCode, uint16_t HttpResultCode)
+{
+    INVOKE_IF_NOT_NULL(Callback, ResultCode, HttpResultCode, ResultCode == EResultCode::Success ? FileSize : 0);
+}
+
+} // namespace csp::systems
@@ -0,0 +1,128 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CSP/Common/CancellationToken.h"
+#include "CSP/Common/SharedEnums.h"
+#include "CSP/Common/String.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace csp::services
+{
+class ApiBase;
+} // namespace csp::services
+
+namespace csp::web
+{
+class RemoteFileManager;
+} // namespace csp::web
+
+namespace csp::systems
+{
+
+class HTTPHeadersResult;
+
+/// @brief Downloads a remote file to disk as a number of byte ranges, several of which are requested at once.
+///
+/// The file is split into fixed size segments, each of which is written straight to its place in the destination file as it arrives.
+/// Which segments have completed is recorded in a state file next to the destination, so a download that fails or is cancelled is
+/// resumed by starting another download to the same path. The state is only trusted if the remote file still has the same size and
+/// ETag (or Last-Modified date), otherwise the download starts again from scratch.
+///
+/// Once every segment is in, the size of the file is checked, along with its MD5 if the server gives one, and the state file is removed.
+/// Servers that don't advertise byte range support, and files no bigger than a single segment, are downloaded with a single request.
+class RangedAssetDownload : public std::enable_shared_from_this<RangedAssetDownload>
+{
+public:
+    typedef std::function<void(EResultCode ResultCode, uint16_t HttpResultCode, uint64_t FileSize)> CompletionCallback;
+
+    static constexpr uint64_t DEFAULT_SEGMENT_SIZE = 8 * 1024 * 1024;
+
+    /// @brief Starts downloading FileUrl to FilePath. The callback is called once, when the download has completed or failed.
+    static void Start(web::RemoteFileManager* FileManager, services::ApiBase* Api, const csp::common::String& FileUrl,
+        const csp::common::String& FilePath, uint32_t MaxConcurrentSegments, uint64_t SegmentSize, csp::common::CancellationToken& CancellationToken,
+        CompletionCallback Callback);
+
+    RangedAssetDownload(web::RemoteFileManager* InFileManager, services::ApiBase* InApi, const csp::common::String& InFileUrl,
+        const csp::common::String& InFilePath, uint32_t InMaxConcurrentSegments, uint64_t InSegmentSize,
+        csp::common::CancellationToken& InCancellationToken, CompletionCallback InCallback);
+
+    /// @brief The path of the file that tracks a ranged download to FilePath.
+    static std::string GetStateFilePath(const std::string& FilePath);
+
+private:
+    void OnHeadersReceived(const HTTPHeadersResult& Result);
+
+    void DownloadWhole();
+    void OnWholeDownloaded(EResultCode ResultCode, uint16_t HttpResultCode);
+
+    // Prepares the destination file, picking up the completed segments of an earlier attempt if it's still valid.
+    bool PrepareSegments();
+    void StartSegment(size_t Index);
+    void OnSegmentDownloaded(size_t Index, const HTTPHeadersResult& Result);
+    bool IsExpectedSegmentResponse(size_t Index, const HTTPHeadersResult& Result) const;
+
+    bool LoadState();
+    // Expects Mutex to be held.
+    bool SaveState() const;
+
+    // Checks the downloaded file against what the server told us about it, then reports the result.
+    // Hashing a large file takes a while, so Verify hands VerifyFile to the web client's executor rather than holding up the thread that
+    // delivered the last response.
+    void Verify(uint16_t HttpResultCode);
+    void VerifyFile(uint16_t HttpResultCode);
+    void Complete(EResultCode ResultCode, uint16_t HttpResultCode);
+
+    web::RemoteFileManager* FileManager;
+    services::ApiBase* Api;
+    csp::common::String FileUrl;
+    std::string FilePath;
+    std::string StateFilePath;
+    uint32_t MaxConcurrentSegments;
+    uint64_t SegmentSize;
+    csp::common::CancellationToken& CancellationToken;
+    CompletionCallback Callback;
+
+    // What the HEAD request told us about the remote file.
+    uint64_t FileSize;
+    bool HasFileSize;
+    // The ETag, or failing that the Last-Modified date, used to tell whether the remote file has changed, and the header it came from.
+    std::string Validator;
+    std::string ValidatorHeader;
+    // The MD5 the server declared for the file in Content-MD5 or x-goog-hash, base64 encoded and lower-cased. The file is rejected if it
+    // doesn't match.
+    std::string ExpectedMD5;
+    // Set when the ETag looks like a hex MD5, as it is for most object stores when a file isn't uploaded in parts. Nothing promises that it
+    // is one though, so a mismatch is only logged.
+    std::string ETagMD5;
+
+    std::mutex Mutex;
+    std::vector<bool> CompletedSegments;
+    std::vector<size_t> PendingSegments;
+    size_t SegmentsInFlight;
+    bool HasFailed;
+    EResultCode FailureResultCode;
+    uint16_t FailureHttpResultCode;
+};
+
+} // namespace csp::systems
@@ -18,6 +18,8 @@
 #include "CSP/Systems/Script/ScriptSystem.h"
 #include "Debug/Logging.h"
 
+#include <algorithm>
+
 namespace csp::systems
 {
 
@@ -65,6 +67,17 @@ void ScriptContext::Initialise()
 
 void ScriptContext::Shutdown()
 {
+    // Atoms belong to this context's runtime, so must be released before it is.
+    for (auto& Callback : Callbacks)
+    {
+        for (JSAtom Atom : Callback.second)
+        {
+            JS_FreeAtom(Context->ctx, Atom);
+        }
+    }
+
+    Callbacks.clear();
+
     for (auto Module : Modules)
     {
         delete (Module.second);
@@ -117,6 +130,124 @@ bool ScriptContext::ExistsInContext(const csp::common::String& ObjectName)
     return !isExcept;
 }
 
+bool ScriptContext::ResolveCallback(const csp::common::String& CallbackName)
+{
+    JSValue This;
+    JSValue Callback = GetCallback(CallbackName, This);
+    const bool IsFunction = JS_IsFunction(Context->ctx, Callback);
+    JS_FreeValue(Context->ctx, Callback);
+    JS_FreeValue(Context->ctx, This);
+
+    return IsFunction;
+}
+
+const std::vector<JSAtom>& ScriptContext::GetCallbackPath(const csp::common::String& CallbackName)
+{
+    const std::string_view Name(CallbackName.c_str(), CallbackName.Length());
+    CallbackMap::iterator It = Callbacks.find(Name);
+
+    if (It != Callbacks.end())
+    {
+        return It->second;
+    }
+
+    // Keep the path as atoms, so reading it on later calls doesn't need to split or intern the name again.
+    std::vector<JSAtom> Path;
+    size_t SegmentStart = 0;
+
+    for (;;)
+    {
+        const size_t SegmentEnd = std::min(Name.find('.', SegmentStart), Name.size());
+
+        if (SegmentEnd == SegmentStart)
+        {
+            // An empty segment ("", "a..b", "a.") can't name anything.
+            CSP_LOG_ERROR_FORMAT("Script callback '%s' is not a valid name or path\n", CallbackName.c_str());
+
+            for (JSAtom Atom : Path)
+            {
+                JS_FreeAtom(Context->ctx, Atom);
+            }
+
+            Path.clear();
+            break;
+        }
+
+        Path.push_back(JS_NewAtomLen(Context->ctx, Name.data() + SegmentStart, SegmentEnd - SegmentStart));
+
+        if (SegmentEnd == Name.size())
+        {
+            break;
+        }
+
+        SegmentStart = SegmentEnd + 1;
+    }
+
+    return Callbacks.emplace(std::string(Name), std::move(Path)).first->second;
+}
+
+JSValue ScriptContext::GetCallback(const csp::common::String& CallbackName, JSValue& OutThis)
+{
+    OutThis = JS_UNDEFINED;
+
+    const std::vector<JSAtom>& Path = GetCallbackPath(CallbackName);
+
+    if (Path.empty())
+    {
+        return JS_UNDEFINED;
+    }
+
+    // Always read the path, as scripts are free to reassign their callbacks without subscribing again.
+    JSValue Object = JS_GetGlobalObject(Context->ctx);
+    JSValue Callback = JS_UNDEFINED;
+
+    for (size_t i = 0; i < Path.size(); ++i)
+    {
+        Callback = JS_GetProperty(Context->ctx, Object, Path[i]);
+
+        if (JS_IsException(Callback))
+        {
+            // A throwing getter. Treat it like a missing callback, rather than leaving the exception pending.
+            JS_FreeValue(Context->ctx, JS_GetException(Context->ctx));
+            Callback = JS_UNDEFINED;
+        }
+
+        if (i + 1 == Path.size())
+        {
+            break;
+        }
+
+        JS_FreeValue(Context->ctx, Object);
+        Object = Callback;
+        Callback = JS_UNDEFINED;
+
+        if (JS_IsObject(Object) == false)
+        {
+            break;
+        }
+    }
+
+    if (JS_IsFunction(Context->ctx, Callback) == false)
+    {
+        JS_FreeValue(Context->ctx, Callback);
+        JS_FreeValue(Context->ctx, Object);
+
+        return JS_UNDEFINED;
+    }
+
+    // Plain globals are called without a this, as they always have been.
+    if (Path.size() > 1)
+    {
+        OutThis = Object;
+    }
+    else
+    {
+        JS_FreeValue(Context->ctx, Object);
+    }
+
+    return Callback;
+}
+
 void ScriptContext::AddImport(const csp::common::String& Url)
 {
     bool Exists = false;
@@ -21,6 +21,8 @@
 
 #include <map>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace csp::systems
 {
@@ -51,6 +53,16 @@ public:
 
     void Reset();
 
+    // Callback names are a global, or a dotted path to a property of one ("onTick", "Handlers.onTick").
+
+    // Returns whether the callback is currently a function, splitting its name into atoms for later calls to GetCallback.
+    bool ResolveCallback(const csp::common::String& CallbackName);
+
+    // Returns a new reference to the callback's function, which the caller must free, or JS_UNDEFINED if it is not a function.
+    // OutThis is set to a new reference to the object a dotted path was read from, so the function is called as a method, or JS_UNDEFINED.
+    // Only the atoms are cached, the path is read on every call, so a script reassigning the callback has the new function called.
+    JSValue GetCallback(const csp::common::String& CallbackName, JSValue& OutThis);
+
 private:
     void Initialise();
     void Shutdown();
@@ -60,6 +72,12 @@ private:
     using ModuleMap = std::map<std::string, ScriptModule*>;
     using ImportedModules = std::vector<std::string>;
 
+    // Callback name -> the atoms of its path, empty if the name isn't a valid path. Transparent, so that callbacks can be looked up without
+    // copying their names.
+    using CallbackMap = std::map<std::string, std::vector<JSAtom>, std::less<>>;
+
+    const std::vector<JSAtom>& GetCallbackPath(const csp::common::String& CallbackName);
+
     uint64_t ContextId;
     ScriptSystem* TheScriptSystem;
 
@@ -67,6 +85,7 @@ private:
     qjs::Runtime* Runtime;
     ModuleMap Modules;
     ImportedModules Imports;
+    CallbackMap Callbacks;
 };
 
 } // namespace csp::systems
@@ -124,6 +124,8 @@ void ScriptSystem::Shutdown()
 
 bool ScriptSystem::RunScript(int64_t ContextId, const csp::common::String& ScriptText)
 {
+    CSP_PROFILE_SCOPED();
+
     // CSP_LOG_FORMAT(LogLevel::Verbose, "RunScript: %s\n", ScriptText.c_str());
 
     ScriptContext* TheScriptContext = TheScriptRuntime->GetContext(ContextId);
@@ -139,6 +141,8 @@ bool ScriptSystem::RunScript(int64_t ContextId, const csp::common::String& Scrip
 
 bool ScriptSystem::RunScriptFile(int64_t ContextId, const csp::common::String& ScriptFilePath)
 {
+    CSP_PROFILE_SCOPED();
+
     CSP_LOG_FORMAT(common::LogLevel::Verbose, "RunScriptFile: %s\n", ScriptFilePath.c_str());
 
     ScriptContext* TheScriptContext = TheScriptRuntime->GetContext(ContextId);
@@ -152,6 +156,123 @@ bool ScriptSystem::RunScriptFile(int64_t ContextId, const csp::common::String& S
     return !HasErrors;
 }
 
+void ScriptSystem::PostMessageToContexts(const int64_t* ContextIds, const csp::common::String* CallbackNames, size_t Count,
+    const csp::common::String& Message, const csp::common::String& MessageParamsJson, double Value)
+{
+    CSP_PROFILE_SCOPED();
+
+    if (TheScriptRuntime == nullptr || Count == 0)
+    {
+        return;
+    }
+
+    // All contexts share the one runtime, so the arguments can be created once and passed to every callback.
+    JSRuntime* Runtime = TheScriptRuntime->Runtime->rt;
+    JSValue Args[3] = { JS_UNDEFINED, JS_UNDEFINED, JS_UNDEFINED };
+    bool HasArgs = false;
+
+    for (size_t i = 0; i < Count; ++i)
+    {
+        ScriptContext* TheScriptContext = TheScriptRuntime->GetContext(ContextIds[i]);
+
+        if (TheScriptContext == nullptr)
+        {
+            continue;
+        }
+
+        JSContext* Context = TheScriptContext->Context->ctx;
+
+        if (HasArgs == false)
+        {
+            Args[0] = JS_NewStringLen(Context, Message.c_str(), Message.Length());
+            Args[1] = JS_NewStringLen(Context, MessageParamsJson.c_str(), MessageParamsJson.Length());
+            Args[2] = JS_NewFloat64(Context, Value);
+            HasArgs = true;
+        }
+
+        // Callbacks that aren't defined (yet) are skipped. Their names were split into atoms when subscribing, so nothing is parsed here.
+        JSValue This;
+        JSValue Callback = TheScriptContext->GetCallback(CallbackNames[i], This);
+
+        if (JS_IsFunction(Context, Callback) == false)
+        {
+            continue;
+        }
+
+        JSValue Result = JS_Call(Context, Callback, This, 3, Args);
+
+        if (JS_IsException(Result))
+        {
+            csp_dump_error(Context);
+        }
+
+        JS_FreeValue(Context, Result);
+        JS_FreeValue(Context, Callback);
+        JS_FreeValue(Context, This);
+    }
+
+    if (HasArgs)
+    {
+        for (JSValue& Arg : Args)
+        {
+            JS_FreeValueRT(Runtime, Arg);
+        }
+    }
+}
+
+bool ScriptSystem::ResolveCallback(int64_t ContextId, const csp::common::String& CallbackName)
+{
+    ScriptContext* TheScriptContext = TheScriptRuntime->GetContext(ContextId);
+
+    if (TheScriptContext == nullptr)
+    {
+        return false;
+    }
+
+    return TheScriptContext->ResolveCallback(CallbackName);
+}
+
+bool ScriptSystem::InvokeCallback(int64_t ContextId, const csp::common::String& CallbackName, const csp::common::String& Message,
+    const csp::common::String& MessageParamsJson)
+{
+    CSP_PROFILE_SCOPED();
+
+    ScriptContext* TheScriptContext = TheScriptRuntime->GetContext(ContextId);
+
+    if (TheScriptContext == nullptr)
+    {
+        return false;
+    }
+
+    JSContext* Context = TheScriptContext->Context->ctx;
+    // Held for the duration of the call, as the callback is free to reassign its own name.
+    JSValue This;
+    JSValue Callback = TheScriptContext->GetCallback(CallbackName, This);
+
+    if (JS_IsFunction(Context, Callback) == false)
+    {
+        return false;
+    }
+
+    JSValue Args[2] = { JS_NewStringLen(Context, Message.c_str(), Message.Length()),
+        JS_NewStringLen(Context, MessageParamsJson.c_str(), MessageParamsJson.Length()) };
+
+    JSValue Result = JS_Call(Context, Callback, This, 2, Args);
+
+    if (JS_IsException(Result))
+    {
+        csp_dump_error(Context);
+    }
+
+    JS_FreeValue(Context, Result);
+    JS_FreeValue(Context, Args[0]);
+    JS_FreeValue(Context, Args[1]);
+    JS_FreeValue(Context, Callback);
+    JS_FreeValue(Context, This);
+
+    return true;
+}
+
 bool ScriptSystem::CreateContext(int64_t ContextId) { return TheScriptRuntime->AddContext(ContextId); }
 
 bool ScriptSystem::DestroyContext(int64_t ContextId) { return TheScriptRuntime->RemoveContext(ContextId); }
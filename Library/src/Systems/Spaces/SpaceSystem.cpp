@@ -32,6 +32,7 @@
 #include "CSP/Systems/Users/UserSystem.h"
 #include "CallHelpers.h"
 #include "Common/Convert.h"
+#include "Common/Systems/Log/LogFormat.h"
 #include "Debug/Logging.h"
 #include "Events/EventSystem.h"
 #include "Services/AggregationService/Api.h"
@@ -615,8 +616,8 @@ void SpaceSystem::ExitSpace(NullResultCallback Callback)
             .then(common::continuations::InvokeIfExceptionInChain(*LogSystem,
                 [Callback, MultiplayerConnection]([[maybe_unused]] const csp::common::continuations::ExpectedExceptionBase& exception)
                 {
-                    csp::systems::SystemsManager::Get().GetLogSystem()->LogMsg(
-                        csp::common::LogLevel::Fatal, fmt::format("Error on exiting spaces: {}", exception.what()).c_str());
+                    CSP_LOG_FMT(csp::systems::SystemsManager::Get().GetLogSystem(), csp::common::LogLevel::Fatal, "Error on exiting spaces: {}",
+                        exception.what());
 
                     // Null the realtime engine pointer in the multiplayer connection such that it stops dispatching signalR updates.
                     // (Error paths are messy, what does failing to leave a space mean memory wise? This is why owned types with RAII work so
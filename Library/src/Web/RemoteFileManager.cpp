@@ -56,9 +56,36 @@ RemoteFileManager::~RemoteFileManager() { }
 void RemoteFileManager::GetFile(
     const csp::common::String& FileUrl, csp::services::ResponseHandlerPtr ResponseHandler, csp::common::CancellationToken& CancellationToken)
 {
-    csp::web::Uri GetUri(FileUrl);
+    GetFile(FileUrl, nullptr, ResponseHandler, CancellationToken);
+}
+
+void RemoteFileManager::GetFile(const csp::common::String& FileUrl, const std::shared_ptr<HttpResponseSink>& Sink,
+    csp::services::ResponseHandlerPtr ResponseHandler, csp::common::CancellationToken& CancellationToken)
+{
+    csp::web::HttpPayload Payload;
+    Payload.SetResponseSink(Sink);
+
+    SendGetFileRequest(FileUrl, Payload, ResponseHandler, CancellationToken);
+}
 
+void RemoteFileManager::GetFileRange(const csp::common::String& FileUrl, uint64_t Offset, uint64_t Length,
+    const std::shared_ptr<HttpResponseSink>& Sink, csp::services::ResponseHandlerPtr ResponseHandler,
+    csp::common::CancellationToken& CancellationToken)
+{
     csp::web::HttpPayload Payload;
+    Payload.SetResponseSink(Sink);
+
+    // Byte ranges are inclusive of their last byte.
+    Payload.AddHeader(CSP_TEXT("Range"), csp::common::String(fmt::format("bytes={}-{}", Offset, Offset + Length - 1).c_str()));
+
+    SendGetFileRequest(FileUrl, Payload, ResponseHandler, CancellationToken);
+}
+
+void RemoteFileManager::SendGetFileRequest(const csp::common::String& FileUrl, HttpPayload& Payload,
+    csp::services::ResponseHandlerPtr ResponseHandler, csp::common::CancellationToken& CancellationToken)
+{
+    csp::web::Uri GetUri(FileUrl);
+
     Payload.AddHeader(CSP_TEXT("Content-Type"), CSP_TEXT("text/json"));
 
     auto BearerToken = ConstructAuthorizationHeader(AuthContext);
@@ -36,9 +36,18 @@ public:
 
     void GetFile(const csp::common::String& FileUrl, csp::services::ResponseHandlerPtr ResponseHandler,
         csp::common::CancellationToken& CancellationToken);
+    // Streams the file into the sink as it is downloaded, instead of into the response payload
+    void GetFile(const csp::common::String& FileUrl, const std::shared_ptr<HttpResponseSink>& Sink, csp::services::ResponseHandlerPtr ResponseHandler,
+        csp::common::CancellationToken& CancellationToken);
+    // Requests Length bytes of the file, starting at Offset, and streams them into the sink. Servers answer with 206 Partial Content.
+    void GetFileRange(const csp::common::String& FileUrl, uint64_t Offset, uint64_t Length, const std::shared_ptr<HttpResponseSink>& Sink,
+        csp::services::ResponseHandlerPtr ResponseHandler, csp::common::CancellationToken& CancellationToken);
     void GetResponseHeaders(const csp::common::String& Url, csp::services::ResponseHandlerPtr ResponseHandler);
 
 private:
+    void SendGetFileRequest(const csp::common::String& FileUrl, HttpPayload& Payload, csp::services::ResponseHandlerPtr ResponseHandler,
+        csp::common::CancellationToken& CancellationToken);
+
     csp::web::WebClient* WebClient;
     const csp::common::IAuthContext& AuthContext;
 };
@@ -32,6 +32,8 @@ set(CSP_TESTS_SOURCES
     ${CSP_TESTS_SOURCE_DIR}/InternalTests/SignalRSerializerTests.cpp
     ${CSP_TESTS_SOURCE_DIR}/InternalTests/SpaceEntityTests.cpp
     ${CSP_TESTS_SOURCE_DIR}/InternalTests/SpaceHelperTests.cpp
+    ${CSP_TESTS_SOURCE_DIR}/InternalTests/TaskExecutorTests.cpp
+    ${CSP_TESTS_SOURCE_DIR}/InternalTests/TransformBatchTests.cpp
     ${CSP_TESTS_SOURCE_DIR}/InternalTests/UniqueStringTest.cpp
     ${CSP_TESTS_SOURCE_DIR}/InternalTests/WebClientTests.cpp
     ${CSP_TESTS_SOURCE_DIR}/InternalTests/WebSocketClientTests.cpp
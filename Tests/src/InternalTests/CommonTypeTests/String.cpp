@@ -19,7 +19,11 @@
 
 #include "TestHelpers.h"
 
+#include <chrono>
+#include <cstring>
 #include <gtest/gtest.h>
+#include <iostream>
+#include <vector>
 
 using namespace csp::common;
 
@@ -523,3 +527,208 @@ CSP_INTERNAL_TEST(CSPEngine, CommonStringTests, StringSubStringInvalidLengthTest
 
     EXPECT_EQ(Instance.SubString(Offset, Length), "you can and you're halfway there.");
 }
+
+CSP_INTERNAL_TEST(CSPEngine, CommonStringTests, StringInlineCapacityBoundaryTest)
+{
+    // Either side of the inline storage limit, to cover both representations.
+    const String Short = "0123456789012345678901";
+    const String Long = "01234567890123456789012";
+
+    EXPECT_EQ(Short.Length(), 22);
+    EXPECT_EQ(Long.Length(), 23);
+
+    String ShortCopy = Short;
+    String LongCopy = Long;
+
+    EXPECT_EQ(ShortCopy, Short);
+    EXPECT_EQ(LongCopy, Long);
+    EXPECT_NE(ShortCopy.c_str(), Short.c_str());
+    EXPECT_NE(LongCopy.c_str(), Long.c_str());
+}
+
+CSP_INTERNAL_TEST(CSPEngine, CommonStringTests, StringMoveLeavesSourceEmptyTest)
+{
+    String ShortSource = "Short";
+    String LongSource = "A string that is too long to be stored inline";
+
+    const char* LongBuffer = LongSource.c_str();
+
+    String ShortTarget = std::move(ShortSource);
+    String LongTarget = std::move(LongSource);
+
+    EXPECT_EQ(ShortTarget, "Short");
+    EXPECT_EQ(LongTarget, "A string that is too long to be stored inline");
+
+    // Heap buffers should be handed over rather than copied.
+    EXPECT_EQ(LongTarget.c_str(), LongBuffer);
+
+    EXPECT_TRUE(ShortSource.IsEmpty());
+    EXPECT_TRUE(LongSource.IsEmpty());
+    EXPECT_NE(LongSource.c_str(), nullptr);
+}
+
+CSP_INTERNAL_TEST(CSPEngine, CommonStringTests, StringAppendGrowsPastInlineCapacityTest)
+{
+    String Instance;
+    std::string Expected;
+
+    for (int i = 0; i < 100; ++i)
+    {
+        Instance.Append("abc");
+        Expected.append("abc");
+    }
+
+    EXPECT_EQ(Instance.Length(), Expected.size());
+    EXPECT_EQ(Instance, Expected.c_str());
+}
+
+CSP_INTERNAL_TEST(CSPEngine, CommonStringTests, StringSelfAppendTest)
+{
+    String Instance = "A string that is too long to be stored inline";
+    Instance.Append(Instance);
+
+    EXPECT_EQ(Instance, "A string that is too long to be stored inlineA string that is too long to be stored inline");
+
+    String Other = "abcdefghijklmnopqrstuv";
+    Other.Append(Other.c_str() + 10);
+
+    EXPECT_EQ(Other, "abcdefghijklmnopqrstuvklmnopqrstuv");
+}
+
+namespace
+{
+
+// Copy of the previous String representation (a heap allocated impl owning a second heap allocated buffer), kept here so
+// the benchmark below has something to compare against.
+class LegacyString
+{
+public:
+    LegacyString(const char* InText)
+        : ImplPtr(new Impl(InText, strlen(InText)))
+    {
+    }
+
+    LegacyString(const LegacyString& Other)
+        : ImplPtr(new Impl(Other.ImplPtr->Text, Other.ImplPtr->Length))
+    {
+    }
+
+    LegacyString(LegacyString&& Other)
+        : ImplPtr(Other.ImplPtr)
+    {
+        Other.ImplPtr = nullptr;
+    }
+
+    ~LegacyString() { delete ImplPtr; }
+
+    LegacyString& operator=(const LegacyString&) = delete;
+
+    void Append(const char* Other)
+    {
+        const size_t OtherLength = strlen(Other);
+        const size_t NewLength = ImplPtr->Length + OtherLength;
+
+        char* NewText = new char[NewLength + 1];
+        memcpy(NewText, ImplPtr->Text, ImplPtr->Length);
+        memcpy(NewText + ImplPtr->Length, Other, OtherLength + 1);
+
+        delete[] ImplPtr->Text;
+        ImplPtr->Text = NewText;
+        ImplPtr->Length = NewLength;
+    }
+
+    size_t Length() const { return ImplPtr->Length; }
+
+private:
+    struct Impl
+    {
+        Impl(const char* InText, size_t InLength)
+            : Text(new char[InLength + 1])
+            , Length(InLength)
+        {
+            memcpy(Text, InText, InLength + 1);
+        }
+
+        ~Impl() { delete[] Text; }
+
+        char* Text;
+        size_t Length;
+    };
+
+    Impl* ImplPtr;
+};
+
+template <typename StringType> size_t RunCopyBenchmark(const char* Source, size_t Iterations)
+{
+    const StringType Original(Source);
+    size_t TotalLength = 0;
+
+    // Copies are kept alive so the compiler can't pair up and elide the allocations.
+    std::vector<StringType> Copies;
+    Copies.reserve(Iterations);
+
+    for (size_t i = 0; i < Iterations; ++i)
+    {
+        TotalLength += Copies.emplace_back(Original).Length();
+    }
+
+    return TotalLength;
+}
+
+template <typename StringType> size_t RunAppendBenchmark(size_t Iterations)
+{
+    size_t TotalLength = 0;
+
+    std::vector<StringType> Results;
+    Results.reserve(Iterations);
+
+    for (size_t i = 0; i < Iterations; ++i)
+    {
+        StringType& Json = Results.emplace_back("{\"deltaTimeMS\": ");
+        Json.Append("16.6667");
+        Json.Append("}");
+        TotalLength += Json.Length();
+    }
+
+    return TotalLength;
+}
+
+template <typename Func> double MeasureNanosecondsPerIteration(size_t Iterations, Func&& Function)
+{
+    const auto Start = std::chrono::steady_clock::now();
+    volatile size_t Sink = Function();
+    (void)Sink;
+    const auto End = std::chrono::steady_clock::now();
+
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(End - Start).count()) / Iterations;
+}
+
+} // namespace
+
+/*
+    Microbenchmark of common String operations against the previous representation.
+    Timings are reported rather than asserted on, as they're too machine dependent to make a reliable test. Disabled so it doesn't print
+    on every unit test run; run it with --gtest_also_run_disabled_tests.
+*/
+CSP_INTERNAL_TEST(DISABLED_CSPEngine, CommonStringTests, StringRepresentationBenchmark)
+{
+    constexpr size_t Iterations = 200000;
+
+    const char* ShortText = "ComponentKey";
+    const char* LongText = "A much longer entity name that will not fit into inline storage";
+
+    const double LegacyShortCopy = MeasureNanosecondsPerIteration(Iterations, [&]() { return RunCopyBenchmark<LegacyString>(ShortText, Iterations); });
+    const double ShortCopy = MeasureNanosecondsPerIteration(Iterations, [&]() { return RunCopyBenchmark<String>(ShortText, Iterations); });
+    const double LegacyLongCopy = MeasureNanosecondsPerIteration(Iterations, [&]() { return RunCopyBenchmark<LegacyString>(LongText, Iterations); });
+    const double LongCopy = MeasureNanosecondsPerIteration(Iterations, [&]() { return RunCopyBenchmark<String>(LongText, Iterations); });
+    const double LegacyAppend = MeasureNanosecondsPerIteration(Iterations, [&]() { return RunAppendBenchmark<LegacyString>(Iterations); });
+    const double Append = MeasureNanosecondsPerIteration(Iterations, [&]() { return RunAppendBenchmark<String>(Iterations); });
+
+    std::cout << "String benchmark (ns/op, legacy -> current)" << std::endl
+              << "    Short copy: " << LegacyShortCopy << " -> " << ShortCopy << std::endl
+              << "    Long copy:  " << LegacyLongCopy << " -> " << LongCopy << std::endl
+              << "    Append:     " << LegacyAppend << " -> " << Append << std::endl;
+
+    EXPECT_EQ(RunCopyBenchmark<String>(ShortText, 1), RunCopyBenchmark<LegacyString>(ShortText, 1));
+    EXPECT_EQ(RunAppendBenchmark<String>(1), RunAppendBenchmark<LegacyString>(1));
+}
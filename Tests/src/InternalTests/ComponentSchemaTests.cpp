@@ -21,17 +21,22 @@
 #include "CSP/Multiplayer/OfflineRealtimeEngine.h"
 #include "CSP/Multiplayer/SpaceEntity.h"
 #include "CSP/Systems/Script/ScriptSystem.h"
+#include "Multiplayer/ComponentPropertyIndex.h"
 #include "Multiplayer/MCS/MCSTypes.h"
 #include "Multiplayer/SpaceEntityKeys.h"
 
 #include <limits>
 #include <memory>
+#include <vector>
 
 namespace
 {
 
 using Schema = csp::multiplayer::ComponentSchema;
 
+// The key every component stores its name under. ComponentBaseKeys.h can't be included alongside SpaceEntityKeys.h, so it's mirrored here.
+constexpr uint32_t ComponentNameKey = std::numeric_limits<uint16_t>::max() - 1024;
+
 class TestFixture final
 {
 public:
@@ -1370,3 +1375,175 @@ CSP_INTERNAL_TEST(CSPEngine, ComponentSchemaTests, IsCompatibleReturnsFalseForPr
 
     EXPECT_FALSE(csp::multiplayer::IsCompatible(BuiltIn, Updated));
 }
+
+CSP_INTERNAL_TEST(CSPEngine, ComponentSchemaTests, PropertyIndexHoldsSchemaDefaults)
+{
+    const auto ExampleSchema = Schema {
+        Schema::TypeIdType { 909 },
+        "StoreExample",
+        {
+            { 0, "scale", 1.0f },
+            { 1, "position", csp::common::Vector3 { 1.0f, 2.0f, 3.0f } },
+            { 5000, "label", "Default" },
+        },
+    };
+
+    csp::common::Map<uint32_t, csp::common::ReplicatedValue> Values;
+    const auto Store = csp::multiplayer::ComponentPropertyIndex(csp::multiplayer::ComponentPropertyLayout::Get(ExampleSchema), Values);
+
+    // The schema properties, plus the component name, written into the map.
+    EXPECT_EQ(Store.Size(), 4);
+    EXPECT_EQ(Values.Size(), 4);
+
+    ASSERT_NE(Store.Find(0), nullptr);
+    EXPECT_EQ(Store.Find(0)->GetFloat(), 1.0f);
+    ASSERT_NE(Store.Find(1), nullptr);
+    EXPECT_EQ(Store.Find(1)->GetVector3(), (csp::common::Vector3 { 1.0f, 2.0f, 3.0f }));
+    ASSERT_NE(Store.Find(5000), nullptr);
+    EXPECT_EQ(Store.Find(5000)->GetString(), csp::common::String { "Default" });
+    ASSERT_NE(Store.Find(ComponentNameKey), nullptr);
+    EXPECT_EQ(Store.Find(ComponentNameKey)->GetString(), csp::common::String { "" });
+
+    EXPECT_EQ(Store.Find(2), nullptr);
+    EXPECT_FALSE(Store.HasDirtyProperties());
+}
+
+CSP_INTERNAL_TEST(CSPEngine, ComponentSchemaTests, PropertyIndexSetRemoveAndIterate)
+{
+    const auto ExampleSchema = Schema {
+        Schema::TypeIdType { 910 },
+        "StoreExample",
+        {
+            { 0, "scale", 1.0f },
+            { 1, "position", csp::common::Vector3 { 0.0f, 0.0f, 0.0f } },
+        },
+    };
+
+    csp::common::Map<uint32_t, csp::common::ReplicatedValue> Values;
+    auto Store = csp::multiplayer::ComponentPropertyIndex(csp::multiplayer::ComponentPropertyLayout::Get(ExampleSchema), Values);
+
+    EXPECT_TRUE(Store.Set(0, 2.0f));
+    EXPECT_FALSE(Store.Set(0, 2.0f));
+    EXPECT_EQ(Store.Find(0)->GetFloat(), 2.0f);
+
+    // Keys outside the schema are still stored.
+    EXPECT_TRUE(Store.Set(100, "Custom"));
+    EXPECT_TRUE(Store.Contains(100));
+    EXPECT_EQ(Store.Size(), 4);
+
+    EXPECT_TRUE(Store.Remove(1));
+    EXPECT_FALSE(Store.Remove(1));
+    EXPECT_FALSE(Store.Contains(1));
+    EXPECT_EQ(Store.Size(), 3);
+
+    std::vector<uint32_t> Keys;
+    Store.ForEach([&Keys](uint32_t Key, const csp::common::ReplicatedValue&) { Keys.push_back(Key); });
+
+    EXPECT_EQ(Keys, (std::vector<uint32_t> { 0, 100, ComponentNameKey }));
+
+    EXPECT_EQ(Values.Size(), 3);
+    EXPECT_EQ(Values[100].GetString(), csp::common::String { "Custom" });
+
+    Store.MarkDirty(0);
+    Store.MarkDirty(100);
+    EXPECT_TRUE(Store.IsDirty(0));
+    EXPECT_TRUE(Store.IsDirty(100));
+    EXPECT_FALSE(Store.IsDirty(1));
+
+    Store.ClearDirty();
+    EXPECT_FALSE(Store.HasDirtyProperties());
+}
+
+CSP_INTERNAL_TEST(CSPEngine, ComponentSchemaTests, PropertyIndexKeepsMapCurrent)
+{
+    const auto ExampleSchema = Schema {
+        Schema::TypeIdType { 912 },
+        "StoreExample",
+        {
+            { 0, "scale", 1.0f },
+            { 1, "position", csp::common::Vector3 { 0.0f, 0.0f, 0.0f } },
+        },
+    };
+
+    csp::common::Map<uint32_t, csp::common::ReplicatedValue> Values;
+    auto Store = csp::multiplayer::ComponentPropertyIndex(csp::multiplayer::ComponentPropertyLayout::Get(ExampleSchema), Values);
+
+    // The map is the storage, so a reference taken before a write sees it straight away.
+    const auto& View = Values;
+
+    Store.Set(0, 3.0f);
+    EXPECT_EQ(View[0].GetFloat(), 3.0f);
+
+    Store.Remove(1);
+    EXPECT_FALSE(View.HasKey(1));
+
+    Store.Set(1, csp::common::Vector3 { 1.0f, 1.0f, 1.0f });
+    EXPECT_EQ(View[1].GetVector3(), (csp::common::Vector3 { 1.0f, 1.0f, 1.0f }));
+
+    // Replacing the map's contents re-points the slots, so later writes still land in the map.
+    csp::common::Map<uint32_t, csp::common::ReplicatedValue> Replacement;
+    Replacement[0] = 5.0f;
+    Store.Assign(Replacement);
+
+    EXPECT_EQ(View.Size(), 1);
+    EXPECT_EQ(Store.Find(1), nullptr);
+
+    Store.Set(0, 6.0f);
+    EXPECT_EQ(View[0].GetFloat(), 6.0f);
+    EXPECT_EQ(Store.Find(0)->GetFloat(), 6.0f);
+
+    // Assigning the map to itself leaves it as it was.
+    Store.Assign(Values);
+    EXPECT_EQ(Store.Find(0)->GetFloat(), 6.0f);
+}
+
+CSP_INTERNAL_TEST(CSPEngine, ComponentSchemaTests, PropertyLayoutIsRebuiltForUpdatedSchema)
+{
+    const auto Original = Schema {
+        Schema::TypeIdType { 911 },
+        "LayoutExample",
+        {
+            { 0, "gain", 0.25f },
+        },
+    };
+
+    const auto Updated = Schema {
+        Schema::TypeIdType { 911 },
+        "LayoutExample",
+        {
+            { 0, "gain", 0.25f },
+            { 1, "level", 0.5f },
+        },
+    };
+
+    const auto OriginalLayout = csp::multiplayer::ComponentPropertyLayout::Get(Original);
+
+    EXPECT_EQ(csp::multiplayer::ComponentPropertyLayout::Get(Original), OriginalLayout);
+
+    const auto UpdatedLayout = csp::multiplayer::ComponentPropertyLayout::Get(Updated);
+
+    EXPECT_NE(UpdatedLayout, OriginalLayout);
+    EXPECT_NE(UpdatedLayout->FindSlot(1), csp::multiplayer::ComponentPropertyLayout::NO_SLOT);
+    EXPECT_EQ(OriginalLayout->FindSlot(1), csp::multiplayer::ComponentPropertyLayout::NO_SLOT);
+}
+
+CSP_INTERNAL_TEST(CSPEngine, ComponentSchemaTests, TypedSetterMarksPropertyDirty)
+{
+    auto Fixture = TestFixture({});
+
+    auto* Entity = Fixture.MakeEntity("Test Entity");
+    ASSERT_NE(Entity, nullptr);
+
+    auto* Component = Entity->AddComponentByTypeId(static_cast<uint64_t>(csp::multiplayer::ComponentType::Audio));
+    ASSERT_NE(Component, nullptr);
+
+    auto* AudioComponent = dynamic_cast<csp::multiplayer::AudioSpaceComponent*>(Component);
+    ASSERT_NE(AudioComponent, nullptr);
+
+    EXPECT_FALSE(Component->IsPropertyDirty(static_cast<uint32_t>(csp::multiplayer::AudioPropertyKeys::Position)));
+
+    AudioComponent->SetPosition(csp::common::Vector3 { 4.0f, 5.0f, 6.0f });
+
+    EXPECT_TRUE(Component->IsPropertyDirty(static_cast<uint32_t>(csp::multiplayer::AudioPropertyKeys::Position)));
+    EXPECT_FALSE(Component->IsPropertyDirty(static_cast<uint32_t>(csp::multiplayer::AudioPropertyKeys::Volume)));
+}
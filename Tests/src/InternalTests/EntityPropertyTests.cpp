@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "CSP/Multiplayer/SpaceEntity.h"
 #include "Multiplayer/SpaceEntityStatePatcher.h"
 #include "TestHelpers.h"
 
@@ -81,4 +82,48 @@ CSP_INTERNAL_TEST(CSPEngine, EntityPropertyTests, PropertySetGetTest)
 
     EXPECT_EQ(TestValue, 100);
     EXPECT_EQ(Property.Get().GetInt(), TestValue);
-}
\ No newline at end of file
+}
+
+// Ensures dirty properties and components can be queried and visited without copying, and that reverting a property clears it.
+CSP_INTERNAL_TEST(CSPEngine, EntityPropertyTests, StatePatcherDirtyTrackingTest)
+{
+    SpaceEntity Entity;
+    SpaceEntityStatePatcher Patcher { nullptr, Entity };
+
+    EXPECT_FALSE(Patcher.IsPropertyDirty(SpaceEntityComponentKey::LockType));
+    EXPECT_FALSE(Patcher.HasPendingPatch());
+
+    EXPECT_TRUE(Patcher.SetDirtyProperty(SpaceEntityComponentKey::LockType, static_cast<int64_t>(0), static_cast<int64_t>(1)));
+    EXPECT_TRUE(Patcher.SetDirtyProperty(SpaceEntityComponentKey::Name, csp::common::String("Old"), csp::common::String("New")));
+    EXPECT_TRUE(Patcher.IsPropertyDirty(SpaceEntityComponentKey::LockType));
+    EXPECT_TRUE(Patcher.IsPropertyDirty(SpaceEntityComponentKey::Name));
+    EXPECT_FALSE(Patcher.IsPropertyDirty(SpaceEntityComponentKey::Position));
+    EXPECT_EQ(Patcher.GetDirtyPropertyCount(), 2);
+
+    // Setting a property back to its prior value should no longer leave it dirty.
+    EXPECT_FALSE(Patcher.SetDirtyProperty(SpaceEntityComponentKey::LockType, static_cast<int64_t>(0), static_cast<int64_t>(0)));
+    EXPECT_FALSE(Patcher.IsPropertyDirty(SpaceEntityComponentKey::LockType));
+    EXPECT_TRUE(Patcher.IsPropertyDirty(SpaceEntityComponentKey::Name));
+    EXPECT_EQ(Patcher.GetDirtyPropertyCount(), 1);
+
+    EXPECT_TRUE(Patcher.SetDirtyComponent(3, SpaceEntityStatePatcher::DirtyComponent { nullptr, ComponentUpdateType::Add }));
+    EXPECT_TRUE(Patcher.SetDirtyComponent(7, SpaceEntityStatePatcher::DirtyComponent { nullptr, ComponentUpdateType::Update }));
+    EXPECT_FALSE(Patcher.SetDirtyComponent(3, SpaceEntityStatePatcher::DirtyComponent { nullptr, ComponentUpdateType::Update }));
+    EXPECT_TRUE(Patcher.IsComponentDirty(3));
+    EXPECT_TRUE(Patcher.IsComponentDirty(7));
+    EXPECT_FALSE(Patcher.IsComponentDirty(5));
+
+    std::vector<std::pair<uint16_t, ComponentUpdateType>> Visited;
+    Patcher.VisitDirtyComponents([&Visited](uint16_t ComponentKey, const SpaceEntityStatePatcher::DirtyComponent& Component)
+        { Visited.emplace_back(ComponentKey, Component.UpdateType); });
+
+    ASSERT_EQ(Visited.size(), 2);
+    EXPECT_EQ(Visited[0], std::make_pair(static_cast<uint16_t>(3), ComponentUpdateType::Add));
+    EXPECT_EQ(Visited[1], std::make_pair(static_cast<uint16_t>(7), ComponentUpdateType::Update));
+
+    EXPECT_TRUE(Patcher.RemoveDirtyComponent(3, csp::common::Map<uint16_t, ComponentBase*> {}));
+    EXPECT_FALSE(Patcher.IsComponentDirty(3));
+    EXPECT_TRUE(Patcher.IsComponentDirty(7));
+    EXPECT_EQ(Patcher.GetDirtyComponentCount(), 1);
+    EXPECT_TRUE(Patcher.HasPendingPatch());
+}
@@ -126,3 +126,59 @@ CSP_INTERNAL_TEST(CSPEngine, EventTests, EventSystemTest)
     OlyEvents.UnRegisterListener(kTestEventId, &TestHandler);
     OlyEvents.UnRegisterListener(kTestEventId, &AllHandler);
 }
+
+class CountingEventHandler : public EventListener
+{
+public:
+    virtual void OnEvent(const Event& InEvent) override
+    {
+        EXPECT_EQ(InEvent.GetInt("Index"), ReceivedCount);
+        ++ReceivedCount;
+    }
+
+    int ReceivedCount = 0;
+};
+
+CSP_INTERNAL_TEST(CSPEngine, EventTests, EventSystemOverflowKeepsOrderTest)
+{
+    EventSystem Events;
+
+    CountingEventHandler Handler;
+    Events.RegisterListener(kTestEventId, &Handler);
+
+    // Queue more events than the event queue can hold without being processed, so some spill into the overflow.
+    constexpr int EventCount = 5000;
+
+    for (int i = 0; i < EventCount; ++i)
+    {
+        Event* TestEvent = Events.AllocateEvent(kTestEventId);
+        TestEvent->AddInt("Index", i);
+        Events.EnqueueEvent(TestEvent);
+    }
+
+    Events.ProcessEvents();
+
+    EXPECT_EQ(Handler.ReceivedCount, EventCount);
+
+    Events.UnRegisterListener(kTestEventId, &Handler);
+}
+
+CSP_INTERNAL_TEST(CSPEngine, EventTests, EventSystemRecyclesEventsTest)
+{
+    EventSystem Events;
+
+    Event* FirstEvent = Events.AllocateEvent(kTestEventId);
+    FirstEvent->AddInt("TestInt", 384);
+    Events.EnqueueEvent(FirstEvent);
+    Events.ProcessEvents();
+
+    // The processed event should come back out of the pool, with its id updated and without the old payload.
+    Event* SecondEvent = Events.AllocateEvent(USERSERVICE_LOGIN_EVENT_ID);
+
+    EXPECT_EQ(SecondEvent, FirstEvent);
+    EXPECT_TRUE(SecondEvent->GetId() == USERSERVICE_LOGIN_EVENT_ID);
+    EXPECT_EQ(SecondEvent->GetInt("TestInt"), 0);
+
+    Events.EnqueueEvent(SecondEvent);
+    Events.ProcessEvents();
+}
@@ -17,8 +17,13 @@
 #include "CSP/Multiplayer/OfflineRealtimeEngine.h"
 #include "CSP/Multiplayer/SpaceEntity.h"
 #include "CSP/Systems/Script/ScriptSystem.h"
+#include "Multiplayer/IncomingPatchBatch.h"
+#include "Multiplayer/MCS/MCSCompactTypes.h"
 #include "Multiplayer/MCS/MCSTypes.h"
 #include "Multiplayer/MCSComponentPacker.h"
+#include "Multiplayer/OutgoingPatchScheduler.h"
+#include "Multiplayer/SpaceEntityKeys.h"
+#include "Multiplayer/SpaceEntityStatePatcher.h"
 #include "TestHelpers.h"
 
 #include <gtest/gtest.h>
@@ -75,6 +80,15 @@ CSP_INTERNAL_TEST(CSPEngine, MCSTests, ComponentPackerPreservesLargeComponentTyp
     };
 
     EXPECT_EQ(Packer.GetComponents(), Expected);
+
+    // The compact packer should produce the same component data.
+    mcs::ComponentDataArena Arena;
+    auto CompactPacker = MCSCompactComponentPacker { Arena };
+    CompactPacker.WriteValue(Component->GetId(), Component);
+
+    const mcs::CompactItemComponentData* CompactComponent = CompactPacker.GetComponents().Find(Component->GetId());
+    ASSERT_NE(CompactComponent, nullptr);
+    EXPECT_EQ(CompactComponent->ToItemComponentData(), Expected.at(Component->GetId()));
 }
 
 // Test constructor values of ObjectMessage are correct.
@@ -342,4 +356,427 @@ CSP_INTERNAL_TEST(CSPEngine, MCSTests, ItemComponentDataSerializeUIntMapTest)
     Deserializer.ReadValue(DeserializedValue);
 
     EXPECT_EQ(DeserializedValue, ComponentValue);
-}
\ No newline at end of file
+}
+namespace
+{
+
+// Builds a compact uint map holding every type CompactItemComponentData supports, including nested maps.
+mcs::CompactComponentMap MakeCompactComponents(mcs::ComponentDataArena& Arena)
+{
+    mcs::CompactStringComponentMap StringMap { Arena };
+    StringMap.Set(Arena.CopyString("Key2"), mcs::CompactItemComponentData { Arena.CopyString("Test") });
+    StringMap.Set(Arena.CopyString("Key1"), mcs::CompactItemComponentData { 1.1f });
+
+    mcs::CompactComponentMap NestedMap { Arena };
+    NestedMap.Set(1, mcs::CompactItemComponentData { mcs::InlineFloatArray { 1.0f, 2.0f } });
+    NestedMap.Set(0, mcs::CompactItemComponentData { std::move(StringMap) });
+
+    mcs::CompactComponentMap Components { Arena };
+    Components.Set(8, mcs::CompactItemComponentData { std::move(NestedMap) });
+    Components.Set(7, mcs::CompactItemComponentData { Arena.CopyString("Name") });
+    Components.Set(6, mcs::CompactItemComponentData { mcs::InlineFloatArray { 1.1f, 2.2f, 3.3f, 4.4f } });
+    Components.Set(5, mcs::CompactItemComponentData { 2.5 });
+    Components.Set(4, mcs::CompactItemComponentData { 1.5f });
+    Components.Set(3, mcs::CompactItemComponentData { uint64_t { 3 } });
+    Components.Set(2, mcs::CompactItemComponentData { int64_t { -2 } });
+    Components.Set(1, mcs::CompactItemComponentData { true });
+
+    return Components;
+}
+
+}
+
+// Compact maps should keep their entries sorted by key, and replace existing values rather than duplicating keys.
+CSP_INTERNAL_TEST(CSPEngine, MCSTests, CompactComponentMapSetAndFindTest)
+{
+    mcs::ComponentDataArena Arena;
+    mcs::CompactComponentMap Map { Arena };
+
+    Map.Set(5, mcs::CompactItemComponentData { int64_t { 5 } });
+    Map.Set(1, mcs::CompactItemComponentData { int64_t { 1 } });
+    Map.Set(3, mcs::CompactItemComponentData { int64_t { 3 } });
+    Map.Set(3, mcs::CompactItemComponentData { int64_t { 30 } });
+
+    ASSERT_EQ(Map.Size(), 3);
+
+    std::vector<mcs::PropertyKeyType> Keys;
+
+    for (const auto& Entry : Map)
+    {
+        Keys.push_back(Entry.first);
+    }
+
+    EXPECT_EQ(Keys, (std::vector<mcs::PropertyKeyType> { 1, 3, 5 }));
+
+    ASSERT_NE(Map.Find(3), nullptr);
+    EXPECT_EQ(*Map.Find(3), mcs::CompactItemComponentData { int64_t { 30 } });
+    EXPECT_EQ(Map.Find(4), nullptr);
+}
+
+// Compact component data should serialize to exactly what the equivalent ItemComponentData does.
+CSP_INTERNAL_TEST(CSPEngine, MCSTests, CompactItemComponentDataSerializesAsItemComponentDataTest)
+{
+    mcs::ComponentDataArena Arena;
+    mcs::CompactItemComponentData CompactValue { MakeCompactComponents(Arena) };
+
+    SignalRSerializer Serializer;
+    Serializer.WriteValue(CompactValue);
+
+    signalr::value SerializedValue = Serializer.Get();
+
+    SignalRDeserializer Deserializer { SerializedValue };
+
+    mcs::ItemComponentData DeserializedValue {};
+    Deserializer.ReadValue(DeserializedValue);
+
+    EXPECT_EQ(DeserializedValue, CompactValue.ToItemComponentData());
+
+    const auto& DeserializedMap = std::get<std::map<uint16_t, mcs::ItemComponentData>>(DeserializedValue.GetValue());
+    const std::vector<float> ExpectedFloats { 1.1f, 2.2f, 3.3f, 4.4f };
+    EXPECT_EQ(std::get<std::vector<float>>(DeserializedMap.at(6).GetValue()), ExpectedFloats);
+    EXPECT_EQ(std::get<std::string>(DeserializedMap.at(7).GetValue()), "Name");
+}
+
+// Compact component data should be readable from values written by ItemComponentData, allocating from the given arena.
+CSP_INTERNAL_TEST(CSPEngine, MCSTests, CompactItemComponentDataDeserializeTest)
+{
+    mcs::ComponentDataArena SourceArena;
+    const mcs::ItemComponentData ComponentValue = mcs::CompactItemComponentData { MakeCompactComponents(SourceArena) }.ToItemComponentData();
+
+    SignalRSerializer Serializer;
+    Serializer.WriteValue(ComponentValue);
+
+    signalr::value SerializedValue = Serializer.Get();
+
+    SignalRDeserializer Deserializer { SerializedValue };
+
+    mcs::ComponentDataArena Arena;
+    mcs::CompactItemComponentData DeserializedValue;
+    DeserializedValue.Deserialize(Deserializer, Arena);
+
+    EXPECT_EQ(DeserializedValue, mcs::CompactItemComponentData { MakeCompactComponents(SourceArena) });
+    EXPECT_EQ(DeserializedValue.ToItemComponentData(), ComponentValue);
+}
+
+// A compact patch should be readable as an ObjectPatch.
+CSP_INTERNAL_TEST(CSPEngine, MCSTests, CompactObjectPatchSerializeTest)
+{
+    mcs::ComponentDataArena Arena;
+    mcs::CompactObjectPatch Object { 1, 2, false, true, 4, MakeCompactComponents(Arena) };
+
+    SignalRSerializer Serializer;
+    Serializer.WriteValue(Object);
+
+    signalr::value SerializedValue = Serializer.Get();
+
+    SignalRDeserializer Deserializer { SerializedValue };
+
+    mcs::ObjectPatch DeserializedObject { 0, 0, false, false, 0, {} };
+    Deserializer.ReadValue(DeserializedObject);
+
+    std::map<mcs::PropertyKeyType, mcs::ItemComponentData> ExpectedComponents;
+
+    for (const auto& [Key, Value] : Object.GetComponents())
+    {
+        ExpectedComponents[Key] = Value.ToItemComponentData();
+    }
+
+    const mcs::ObjectPatch ExpectedObject { 1, 2, false, true, 4, ExpectedComponents };
+    EXPECT_EQ(DeserializedObject, ExpectedObject);
+}
+
+// Once reset, an arena should serve the same allocations again from the blocks it already has.
+CSP_INTERNAL_TEST(CSPEngine, MCSTests, ComponentDataArenaReusesBlocksAfterResetTest)
+{
+    mcs::ComponentDataArena Arena { 256 };
+
+    for (int i = 0; i < 3; ++i)
+    {
+        Arena.Reset();
+
+        for (int j = 0; j < 30; ++j)
+        {
+            void* Allocation = Arena.Allocate(24, alignof(double));
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(Allocation) % alignof(double), 0);
+        }
+    }
+
+    // Ten 24 byte allocations fit in each 256 byte block, so 30 need three blocks however many times the arena is reused.
+    EXPECT_EQ(Arena.GetBlockCount(), 3);
+
+    // Allocations larger than a block get a block of their own.
+    EXPECT_NE(Arena.Allocate(1024, alignof(double)), nullptr);
+    EXPECT_EQ(Arena.GetBlockCount(), 4);
+}
+
+namespace
+{
+
+mcs::ItemComponentData MakeComponentPatch(uint64_t ComponentType, const std::map<uint16_t, mcs::ItemComponentData>& Properties)
+{
+    std::map<uint16_t, mcs::ItemComponentData> ComponentData = Properties;
+    ComponentData[COMPONENT_KEY_COMPONENTTYPE] = mcs::ItemComponentData { ComponentType };
+
+    return mcs::ItemComponentData { ComponentData };
+}
+
+}
+
+// Patches for the same entity should be merged into one, keeping the newest value of each property.
+CSP_INTERNAL_TEST(CSPEngine, MCSTests, IncomingPatchBatchMergesPatchesTest)
+{
+    const uint16_t EntityPropertyKey = COMPONENT_KEY_END_COMPONENTS + 1;
+
+    IncomingPatchBatch Batch;
+
+    std::map<mcs::PropertyKeyType, mcs::ItemComponentData> FirstComponents;
+    FirstComponents[0] = MakeComponentPatch(1, { { 0, mcs::ItemComponentData { 1ll } }, { 1, mcs::ItemComponentData { std::string { "A" } } } });
+    FirstComponents[EntityPropertyKey] = mcs::ItemComponentData { std::string { "First" } };
+    Batch.Add(mcs::ObjectPatch { 1, 10, false, true, 5, FirstComponents });
+
+    std::map<mcs::PropertyKeyType, mcs::ItemComponentData> OtherComponents;
+    OtherComponents[EntityPropertyKey] = mcs::ItemComponentData { std::string { "Other" } };
+    Batch.Add(mcs::ObjectPatch { 2, 10, false, false, std::nullopt, OtherComponents });
+
+    std::map<mcs::PropertyKeyType, mcs::ItemComponentData> SecondComponents;
+    SecondComponents[0] = MakeComponentPatch(1, { { 0, mcs::ItemComponentData { 2ll } } });
+    SecondComponents[3] = MakeComponentPatch(7, { { 0, mcs::ItemComponentData { true } } });
+    SecondComponents[EntityPropertyKey] = mcs::ItemComponentData { std::string { "Second" } };
+    Batch.Add(mcs::ObjectPatch { 1, 11, false, false, 5, SecondComponents });
+
+    EXPECT_EQ(Batch.Size(), 2);
+
+    std::vector<mcs::ObjectPatch> Patches = Batch.Flush();
+
+    EXPECT_TRUE(Batch.IsEmpty());
+    ASSERT_EQ(Patches.size(), 2);
+
+    // Patches are applied in the order their entities were first seen.
+    const mcs::ObjectPatch& Merged = Patches[0];
+    EXPECT_EQ(Merged.GetId(), 1);
+    EXPECT_EQ(Merged.GetOwnerId(), 11);
+    EXPECT_TRUE(Merged.GetShouldUpdateParent());
+    EXPECT_EQ(Merged.GetParentId(), 5);
+
+    std::map<mcs::PropertyKeyType, mcs::ItemComponentData> ExpectedComponents;
+    ExpectedComponents[0] = MakeComponentPatch(1, { { 0, mcs::ItemComponentData { 2ll } }, { 1, mcs::ItemComponentData { std::string { "A" } } } });
+    ExpectedComponents[3] = MakeComponentPatch(7, { { 0, mcs::ItemComponentData { true } } });
+    ExpectedComponents[EntityPropertyKey] = mcs::ItemComponentData { std::string { "Second" } };
+    EXPECT_EQ(Merged.GetComponents(), ExpectedComponents);
+
+    EXPECT_EQ(Patches[1].GetId(), 2);
+    EXPECT_EQ(Patches[1].GetComponents(), OtherComponents);
+}
+
+// Destroys, and components changing type, must still be applied in order, so they shouldn't be merged.
+CSP_INTERNAL_TEST(CSPEngine, MCSTests, IncomingPatchBatchDoesNotMergeDestroyOrTypeChangeTest)
+{
+    IncomingPatchBatch Batch;
+
+    std::map<mcs::PropertyKeyType, mcs::ItemComponentData> AddComponents;
+    AddComponents[0] = MakeComponentPatch(1, { { 0, mcs::ItemComponentData { 1ll } } });
+    Batch.Add(mcs::ObjectPatch { 1, 10, false, false, std::nullopt, AddComponents });
+
+    std::map<mcs::PropertyKeyType, mcs::ItemComponentData> DeleteComponents;
+    DeleteComponents[0] = MakeComponentPatch(2, {});
+    Batch.Add(mcs::ObjectPatch { 1, 10, false, false, std::nullopt, DeleteComponents });
+
+    Batch.Add(mcs::ObjectPatch { 1, 10, true, false, std::nullopt, {} });
+    Batch.Add(mcs::ObjectPatch { 1, 10, false, false, std::nullopt, AddComponents });
+
+    std::vector<mcs::ObjectPatch> Patches = Batch.Flush();
+    ASSERT_EQ(Patches.size(), 4);
+
+    EXPECT_EQ(Patches[0].GetComponents(), AddComponents);
+    EXPECT_EQ(Patches[1].GetComponents(), DeleteComponents);
+    EXPECT_TRUE(Patches[2].GetDestroy());
+    EXPECT_FALSE(Patches[3].GetDestroy());
+
+    Batch.Add(mcs::ObjectPatch { 1, 10, false, false, std::nullopt, AddComponents });
+    Batch.Clear();
+
+    EXPECT_TRUE(Batch.IsEmpty());
+    EXPECT_TRUE(Batch.Flush().empty());
+}
+
+// Merging moves a patch ahead of patches for other entities, which mustn't reorder parenting or destroys across entities.
+CSP_INTERNAL_TEST(CSPEngine, MCSTests, IncomingPatchBatchKeepsCrossEntityOrderTest)
+{
+    const uint16_t EntityPropertyKey = COMPONENT_KEY_END_COMPONENTS + 1;
+
+    std::map<mcs::PropertyKeyType, mcs::ItemComponentData> FirstComponents;
+    FirstComponents[EntityPropertyKey] = mcs::ItemComponentData { std::string { "First" } };
+
+    std::map<mcs::PropertyKeyType, mcs::ItemComponentData> SecondComponents;
+    SecondComponents[EntityPropertyKey] = mcs::ItemComponentData { std::string { "Second" } };
+
+    IncomingPatchBatch Batch;
+
+    // Patches for other entities that don't touch the hierarchy don't stop a merge.
+    Batch.Add(mcs::ObjectPatch { 1, 10, false, false, std::nullopt, FirstComponents });
+    Batch.Add(mcs::ObjectPatch { 2, 10, false, false, std::nullopt, FirstComponents });
+    Batch.Add(mcs::ObjectPatch { 1, 10, false, false, std::nullopt, SecondComponents });
+    EXPECT_EQ(Batch.Size(), 2);
+
+    // Entity 2 is parented to entity 1, so entity 1's next patch has to be applied after that, not merged ahead of it.
+    Batch.Add(mcs::ObjectPatch { 2, 10, false, true, 1, {} });
+    Batch.Add(mcs::ObjectPatch { 1, 10, false, false, std::nullopt, FirstComponents });
+
+    std::vector<mcs::ObjectPatch> Patches = Batch.Flush();
+    ASSERT_EQ(Patches.size(), 3);
+
+    // The parent change was the newest patch for entity 2, so it could still merge into it.
+    EXPECT_EQ(Patches[0].GetId(), 1);
+    EXPECT_EQ(Patches[0].GetComponents(), SecondComponents);
+    EXPECT_EQ(Patches[1].GetId(), 2);
+    EXPECT_TRUE(Patches[1].GetShouldUpdateParent());
+    EXPECT_EQ(Patches[1].GetParentId(), 1);
+    EXPECT_EQ(Patches[2].GetId(), 1);
+    EXPECT_EQ(Patches[2].GetComponents(), FirstComponents);
+
+    // A parent change isn't moved ahead of patches for other entities either.
+    Batch.Add(mcs::ObjectPatch { 1, 10, false, false, std::nullopt, FirstComponents });
+    Batch.Add(mcs::ObjectPatch { 2, 10, false, false, std::nullopt, FirstComponents });
+    Batch.Add(mcs::ObjectPatch { 1, 10, false, true, 2, {} });
+
+    // Once merged into the newest patch, that parent change holds back later merges for entities queued before it.
+    Batch.Add(mcs::ObjectPatch { 3, 10, false, false, std::nullopt, FirstComponents });
+    Batch.Add(mcs::ObjectPatch { 3, 10, false, true, 1, {} });
+    Batch.Add(mcs::ObjectPatch { 2, 10, false, false, std::nullopt, SecondComponents });
+
+    Patches = Batch.Flush();
+    ASSERT_EQ(Patches.size(), 5);
+
+    EXPECT_EQ(Patches[0].GetId(), 1);
+    EXPECT_FALSE(Patches[0].GetShouldUpdateParent());
+    EXPECT_EQ(Patches[1].GetId(), 2);
+    EXPECT_EQ(Patches[2].GetId(), 1);
+    EXPECT_TRUE(Patches[2].GetShouldUpdateParent());
+    EXPECT_EQ(Patches[3].GetId(), 3);
+    EXPECT_TRUE(Patches[3].GetShouldUpdateParent());
+    EXPECT_EQ(Patches[3].GetComponents(), FirstComponents);
+    EXPECT_EQ(Patches[4].GetId(), 2);
+    EXPECT_EQ(Patches[4].GetComponents(), SecondComponents);
+
+    // Nor is anything merged across another entity's destroy.
+    Batch.Add(mcs::ObjectPatch { 1, 10, false, false, std::nullopt, FirstComponents });
+    Batch.Add(mcs::ObjectPatch { 2, 10, true, false, std::nullopt, {} });
+    Batch.Add(mcs::ObjectPatch { 1, 10, false, false, std::nullopt, SecondComponents });
+    EXPECT_EQ(Batch.Size(), 3);
+}
+
+// Only entities whose deadline has passed should be popped, earliest first, and rescheduling should only ever bring a deadline forward.
+CSP_INTERNAL_TEST(CSPEngine, MCSTests, OutgoingPatchSchedulerPopsDueEntitiesTest)
+{
+    using namespace std::chrono_literals;
+
+    SpaceEntity First, Second, Third;
+    OutgoingPatchScheduler Scheduler;
+    std::vector<SpaceEntity*> Due;
+
+    Scheduler.ScheduleAt(&First, 300ms);
+    Scheduler.ScheduleAt(&Second, 100ms);
+    Scheduler.ScheduleAt(&Third, 200ms);
+    EXPECT_EQ(Scheduler.Size(), 3);
+
+    // Scheduling later than the current deadline is ignored, scheduling earlier replaces it.
+    Scheduler.ScheduleAt(&Second, 500ms);
+    Scheduler.ScheduleAt(&First, 150ms);
+
+    EXPECT_FALSE(Scheduler.HasDue(50ms));
+    Scheduler.PopDue(50ms, Due);
+    EXPECT_TRUE(Due.empty());
+
+    EXPECT_TRUE(Scheduler.HasDue(200ms));
+    Scheduler.PopDue(200ms, Due);
+    ASSERT_EQ(Due.size(), 3);
+    EXPECT_EQ(Due[0], &Second);
+    EXPECT_EQ(Due[1], &First);
+    EXPECT_EQ(Due[2], &Third);
+    EXPECT_TRUE(Scheduler.IsEmpty());
+    EXPECT_FALSE(Scheduler.HasDue(1000ms));
+
+    // Removed entities are never popped, even once their deadline passes.
+    Due.clear();
+    Scheduler.ScheduleAt(&First, 100ms);
+    Scheduler.ScheduleAt(&Second, 100ms);
+    Scheduler.Remove(&First);
+    EXPECT_FALSE(Scheduler.IsScheduled(&First));
+
+    Scheduler.PopAll(Due);
+    ASSERT_EQ(Due.size(), 1);
+    EXPECT_EQ(Due[0], &Second);
+}
+
+// Per-entity rates should take precedence, then the fastest of the dirty component type rates, falling back to the default rate for anything else.
+CSP_INTERNAL_TEST(CSPEngine, MCSTests, OutgoingPatchSchedulerPatchRateTest)
+{
+    using namespace std::chrono_literals;
+
+    SpaceEntity Entity;
+    SpaceEntityStatePatcher Patcher { nullptr, Entity };
+    ComponentBase SlowComponent { ComponentType::Custom, nullptr, &Entity };
+    ComponentBase FastComponent { ComponentType::AnimatedModel, nullptr, &Entity };
+
+    OutgoingPatchScheduler Scheduler;
+    Scheduler.SetDefaultPatchRate(90ms);
+    Scheduler.SetComponentTypePatchRate(ComponentType::Custom, 500ms);
+
+    EXPECT_EQ(Scheduler.GetPatchRate(1, Patcher), 90ms);
+
+    Patcher.SetDirtyComponent(0, SpaceEntityStatePatcher::DirtyComponent { &SlowComponent, ComponentUpdateType::Update });
+    EXPECT_EQ(Scheduler.GetPatchRate(1, Patcher), 500ms);
+
+    // A change with no component type rate of its own holds the entity to the default rate.
+    Patcher.SetDirtyComponent(1, SpaceEntityStatePatcher::DirtyComponent { &FastComponent, ComponentUpdateType::Update });
+    EXPECT_EQ(Scheduler.GetPatchRate(1, Patcher), 90ms);
+
+    Scheduler.SetComponentTypePatchRate(ComponentType::AnimatedModel, 30ms);
+    EXPECT_EQ(Scheduler.GetPatchRate(1, Patcher), 30ms);
+
+    Scheduler.SetEntityPatchRate(1, 1000ms);
+    EXPECT_EQ(Scheduler.GetPatchRate(1, Patcher), 1000ms);
+    EXPECT_EQ(Scheduler.GetPatchRate(2, Patcher), 30ms);
+
+    Scheduler.ClearEntityPatchRate(1);
+    Scheduler.Schedule(&Entity, 1, Patcher);
+
+    std::vector<SpaceEntity*> Due;
+    Scheduler.PopDue(Patcher.GetTimeOfLastPatch() + 29ms, Due);
+    EXPECT_TRUE(Due.empty());
+    Scheduler.PopDue(Patcher.GetTimeOfLastPatch() + 30ms, Due);
+    EXPECT_EQ(Due.size(), 1);
+}
+
+// Resetting should drop the schedule and every per-entity override, so a reused entity id starts from the configured rates again.
+CSP_INTERNAL_TEST(CSPEngine, MCSTests, OutgoingPatchSchedulerResetTest)
+{
+    using namespace std::chrono_literals;
+
+    SpaceEntity Entity;
+    SpaceEntityStatePatcher Patcher { nullptr, Entity };
+
+    OutgoingPatchScheduler Scheduler;
+    Scheduler.SetDefaultPatchRate(90ms);
+    Scheduler.SetComponentTypePatchRate(ComponentType::Custom, 500ms);
+    Scheduler.SetEntityPatchRate(1, 1000ms);
+    Scheduler.SetEntityPatchRate(2, 1000ms);
+    Scheduler.Schedule(&Entity, 1, Patcher);
+
+    // Clearing the schedule alone keeps the overrides.
+    Scheduler.Clear();
+    EXPECT_TRUE(Scheduler.IsEmpty());
+    EXPECT_EQ(Scheduler.GetPatchRate(1, Patcher), 1000ms);
+
+    Scheduler.Schedule(&Entity, 1, Patcher);
+    Scheduler.Reset();
+
+    EXPECT_TRUE(Scheduler.IsEmpty());
+    EXPECT_EQ(Scheduler.GetPatchRate(1, Patcher), 90ms);
+    EXPECT_EQ(Scheduler.GetPatchRate(2, Patcher), 90ms);
+
+    // The engine-wide rates survive a reset.
+    ComponentBase SlowComponent { ComponentType::Custom, nullptr, &Entity };
+    Patcher.SetDirtyComponent(0, SpaceEntityStatePatcher::DirtyComponent { &SlowComponent, ComponentUpdateType::Update });
+    EXPECT_EQ(Scheduler.GetPatchRate(1, Patcher), 500ms);
+}
@@ -16,6 +16,7 @@
 
 #include "CSP/CSPFoundation.h"
 #include "Common/LoginStateData.h"
+#include "Common/Web/HttpPayload.h"
 #include "Mocks/AuthContextMock.h"
 #include "Mocks/WebClientMock.h"
 #include "PlatformTestUtils.h"
@@ -39,6 +40,18 @@ class GetResponseHeaders : public PublicTestBaseInternalWithParam<std::tuple<csp
 {
 };
 
+class GetFileRange : public PublicTestBaseInternalWithParam<std::tuple<csp::common::ELoginState, csp::common::String>>
+{
+};
+
+class NullResponseSink : public HttpResponseSink
+{
+public:
+    bool Begin(const std::optional<size_t>& /*ContentLength*/) override { return true; }
+    bool Write(const char* /*Data*/, size_t /*DataLength*/) override { return true; }
+    bool End() override { return true; }
+};
+
 TEST_P(GetFile, GetFileSendsCorrectRequest)
 {
     InitialiseFoundationWithUserAgentInfo(EndpointBaseURI());
@@ -165,6 +178,65 @@ TEST_P(GetResponseHeaders, GetResponseHeadersSendsCorrectRequest)
     csp::CSPFoundation::Shutdown();
 }
 
+TEST_P(GetFileRange, GetFileRangeSendsCorrectRequest)
+{
+    InitialiseFoundationWithUserAgentInfo(EndpointBaseURI());
+
+    auto MockClient = WebClientMock(80, ETransferProtocol::HTTP, nullptr, true);
+    auto MockContext = MockAuthContext();
+    MockApiResponseHandler MockHandler;
+
+    const csp::common::String FileUrl = "https://mock.service/assets/test-file.glb";
+
+    // Construct a LoginState object with the correct state.
+    csp::common::LoginState LoginState;
+    {
+        const auto Data = LoginState.GetSnapshotThreadSafe();
+        Data->State = std::get<0>(GetParam());
+        Data->AccessToken = std::get<1>(GetParam());
+        LoginState.SetLoginStateDataThreadSafe(*Data);
+    }
+
+    EXPECT_CALL(MockClient, SendRequest)
+        .WillOnce(
+            [&FileUrl, &LoginState](ERequestVerb Verb, const Uri& InUri, HttpPayload& Payload, IHttpResponseHandler* /*ResponseCallback*/,
+                csp::common::CancellationToken& /*CancellationToken*/, bool /*AsyncResponse*/)
+            {
+                EXPECT_EQ(Verb, ERequestVerb::GET);
+
+                EXPECT_STREQ(InUri.GetAsString(), FileUrl.c_str());
+
+                // Verify the Range header asks for the inclusive byte range
+                const auto& Headers = Payload.GetHeaders();
+                auto RangeIt = Headers.find("Range");
+                ASSERT_NE(RangeIt, Headers.end());
+                EXPECT_EQ(RangeIt->second, "bytes=1048576-2097151");
+
+                // Verify the body will be streamed into the sink
+                EXPECT_NE(Payload.GetResponseSink(), nullptr);
+
+                auto AuthIt = Headers.find("x-auth-token");
+
+                if (LoginState.GetLoginStateValue() == csp::common::ELoginState::LoggedIn)
+                {
+                    ASSERT_NE(AuthIt, Headers.end()) << "Authorization header should be present when the user is logged in";
+                }
+                else
+                {
+                    EXPECT_EQ(AuthIt, Headers.end()) << "Authorization header should not be present when the user is logged out";
+                }
+            });
+
+    EXPECT_CALL(MockContext, GetLoginState).WillRepeatedly(::testing::ReturnRef(LoginState));
+
+    RemoteFileManager FileManager(&MockClient, MockContext);
+
+    FileManager.GetFileRange(FileUrl, 1024 * 1024, 1024 * 1024, std::make_shared<NullResponseSink>(), &MockHandler,
+        csp::common::CancellationToken::Dummy());
+
+    csp::CSPFoundation::Shutdown();
+}
+
 INSTANTIATE_TEST_SUITE_P(RemoteFileManagerTests, GetFile,
     testing::Values(
         std::make_tuple(csp::common::ELoginState::LoggedOut, ""), std::make_tuple(csp::common::ELoginState::LoggedIn, "MockAccessToken")));
@@ -172,5 +244,9 @@ INSTANTIATE_TEST_SUITE_P(RemoteFileManagerTests, GetFile,
 INSTANTIATE_TEST_SUITE_P(RemoteFileManagerTests, GetResponseHeaders,
     testing::Values(
         std::make_tuple(csp::common::ELoginState::LoggedOut, ""), std::make_tuple(csp::common::ELoginState::LoggedIn, "MockAccessToken")));
+
+INSTANTIATE_TEST_SUITE_P(RemoteFileManagerTests, GetFileRange,
+    testing::Values(
+        std::make_tuple(csp::common::ELoginState::LoggedOut, ""), std::make_tuple(csp::common::ELoginState::LoggedIn, "MockAccessToken")));
         
 }
\ No newline at end of file
@@ -25,6 +25,7 @@
 #include "CSP/Systems/CSPSceneData.h"
 #include "CSP/Systems/SystemsManager.h"
 #include "CSP/Systems/Users/UserSystem.h"
+#include "Common/TaskExecutor.h"
 #include "Multiplayer/MCS/MCSSceneDescription.h"
 #include "Multiplayer/MCS/MCSTypes.h"
 #include "PublicAPITests/UserSystemTestHelpers.h"
@@ -487,6 +488,55 @@ CSP_INTERNAL_TEST(CSPEngine, SceneDescriptionTests, SceneDescriptionDeserializeB
     csp::CSPFoundation::Shutdown();
 }
 
+// Tests that streaming the objects out of a scene description gives the same objects as deserializing the whole document,
+// regardless of where the chunk boundaries fall, and when decoding across multiple threads.
+CSP_INTERNAL_TEST(CSPEngine, SceneDescriptionTests, SceneDescriptionStreamedObjectsMatchDocumentTest)
+{
+    auto FilePath = std::filesystem::absolute("assets/checkpoint-parents.json");
+
+    std::ifstream Stream { FilePath.u8string().c_str() };
+
+    if (!Stream)
+    {
+        FAIL();
+    }
+
+    std::stringstream SStream;
+    SStream << Stream.rdbuf();
+
+    std::string Json = SStream.str();
+
+    mcs::SceneDescription SceneDescription;
+    csp::json::JsonDeserializer::Deserialize(Json.c_str(), SceneDescription);
+
+    ASSERT_EQ(SceneDescription.Objects.size(), 3);
+
+    // Chunk sizes small enough for tokens to be split across chunks, with empty chunks in between.
+    csp::common::List<csp::common::String> JsonChunks;
+
+    for (size_t Offset = 0; Offset < Json.size(); Offset += 7)
+    {
+        JsonChunks.Append(csp::common::String(Json.data() + Offset, std::min<size_t>(7, Json.size() - Offset)));
+        JsonChunks.Append("");
+    }
+
+    csp::TaskExecutor Executor(3);
+
+    for (csp::TaskExecutor* DecodeExecutor : { static_cast<csp::TaskExecutor*>(nullptr), &Executor })
+    {
+        std::vector<mcs::ObjectMessage> Objects;
+        const bool Succeeded = mcs::ReadSceneDescriptionObjects(
+            JsonChunks, [&Objects](mcs::ObjectMessage&& Object) { Objects.push_back(std::move(Object)); }, DecodeExecutor);
+
+        EXPECT_TRUE(Succeeded);
+        EXPECT_EQ(Objects, SceneDescription.Objects);
+    }
+
+    // A truncated document reports failure
+    csp::common::List<csp::common::String> TruncatedChunks { csp::common::String(Json.data(), Json.size() / 2) };
+    EXPECT_FALSE(mcs::ReadSceneDescriptionObjects(TruncatedChunks, [](mcs::ObjectMessage&&) {}));
+}
+
 // Tests that a material parsed from scene data is valid
 CSP_INTERNAL_TEST(CSPEngine, SceneDescriptionTests, SceneDescriptionDeserializeMaterialTest)
 {
@@ -41,3 +41,75 @@ CSP_INTERNAL_TEST(CSPEngine, SchedulerTests, SchedulerTest)
 
     EXPECT_TRUE(ScheduleCallback);
 }
+
+CSP_INTERNAL_TEST(CSPEngine, SchedulerTests, CancelledTaskDoesNotRunTest)
+{
+    csp::Scheduler Scheduler;
+    Scheduler.Initialise();
+
+    std::atomic_bool CancelledCallback = false;
+    std::atomic_bool KeptCallback = false;
+
+    const auto FireTime = std::chrono::system_clock::now() + 100ms;
+
+    const csp::ScheduledTaskId CancelledId = Scheduler.ScheduleAt(FireTime, [&CancelledCallback]() { CancelledCallback = true; });
+    Scheduler.ScheduleAt(FireTime, [&KeptCallback]() { KeptCallback = true; });
+
+    Scheduler.CancelTask(CancelledId);
+
+    std::this_thread::sleep_for(500ms);
+
+    EXPECT_FALSE(CancelledCallback);
+    EXPECT_TRUE(KeptCallback);
+    EXPECT_EQ(Scheduler.GetPendingTaskCount(), 0);
+
+    Scheduler.Shutdown();
+}
+
+CSP_INTERNAL_TEST(CSPEngine, SchedulerTests, ManyTasksFireTogetherTest)
+{
+    csp::Scheduler Scheduler;
+    Scheduler.Initialise();
+
+    constexpr int TaskCount = 1000;
+    std::atomic_int CallbackCount = 0;
+
+    const auto FireTime = std::chrono::system_clock::now() + 50ms;
+
+    for (int i = 0; i < TaskCount; ++i)
+    {
+        Scheduler.ScheduleAt(FireTime, [&CallbackCount]() { ++CallbackCount; });
+    }
+
+    std::this_thread::sleep_for(500ms);
+
+    EXPECT_EQ(CallbackCount, TaskCount);
+
+    Scheduler.Shutdown();
+}
+
+CSP_INTERNAL_TEST(CSPEngine, SchedulerTests, ScheduleEveryRepeatsUntilCancelledTest)
+{
+    csp::Scheduler Scheduler;
+    Scheduler.Initialise();
+
+    std::atomic_int CallbackCount = 0;
+
+    const csp::ScheduledTaskId Id = Scheduler.ScheduleEvery(10ms, [&CallbackCount]() { ++CallbackCount; });
+
+    std::this_thread::sleep_for(200ms);
+
+    Scheduler.CancelTask(Id);
+
+    // Allow any run that was in flight when we cancelled to complete.
+    std::this_thread::sleep_for(50ms);
+
+    const int CountAfterCancel = CallbackCount;
+    EXPECT_GT(CountAfterCancel, 1);
+
+    std::this_thread::sleep_for(100ms);
+
+    EXPECT_EQ(CallbackCount, CountAfterCancel);
+
+    Scheduler.Shutdown();
+}
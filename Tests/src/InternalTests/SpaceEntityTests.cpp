@@ -28,6 +28,8 @@
 #include "Debug/Logging.h"
 #include "Multiplayer/NetworkEventManagerImpl.h"
 #include "Multiplayer/Script/EntityScriptBinding.h"
+#include "Multiplayer/SpaceEntityHierarchy.h"
+#include "Multiplayer/SpaceEntityIndex.h"
 #include "RAIIMockLogger.h"
 #include "TestHelpers.h"
 
@@ -38,6 +40,8 @@
 #include "gtest/gtest-param-test.h"
 #include "gtest/gtest.h"
 #include <atomic>
+#include <thread>
+#include <vector>
 
 using namespace csp::multiplayer;
 
@@ -978,4 +982,419 @@ CSP_PUBLIC_TEST(CSPEngine, UnlockPrerequisites, UnlockPrerequisitesTest)
     EXPECT_CALL(MockLogger.MockLogCallback, Call(csp::common::LogLevel::Error, UnlockErrorMsg)).Times(1);
 
     Entity.Unlock();
-}
\ No newline at end of file
+}
+
+// Check that posting a message calls the subscribed callback with its arguments passed through unmodified, including characters that would
+// need escaping if the call were made by compiling script text.
+CSP_INTERNAL_TEST(CSPEngine, SpaceEntityTests, PostMessageToScriptInvokesSubscribedCallbackTest)
+{
+    auto LogSystem = csp::common::LogSystem {};
+    auto ScriptSystem = csp::systems::ScriptSystem::MakeInitialised();
+    auto Engine = csp::multiplayer::OfflineRealtimeEngine { LogSystem, *ScriptSystem };
+
+    auto [Entity] = AWAIT(&Engine, CreateEntity, "Test Entity", csp::multiplayer::SpaceTransform {}, csp::common::Optional<uint64_t> {});
+    ASSERT_NE(Entity, nullptr);
+
+    const std::string ScriptText = R"xx(
+        globalThis.onCustomMessage = (message, params) => {
+            const { x, label } = JSON.parse(params);
+
+            if (message === "customMessage" && label === "it's 'quoted'") {
+                ThisEntity.position = [x, 0, 0];
+            }
+        }
+
+        ThisEntity.subscribeToMessage("customMessage", "onCustomMessage");
+    )xx";
+
+    auto* ScriptComponent = static_cast<ScriptSpaceComponent*>(Entity->AddComponent(ComponentType::ScriptData));
+    ScriptComponent->SetScriptSource(ScriptText.c_str());
+    Entity->GetScript().Invoke();
+
+    EXPECT_FALSE(Entity->GetScript().HasError());
+
+    Entity->GetScript().PostMessageToScript("customMessage", R"({"x": 2, "label": "it's 'quoted'"})");
+    EXPECT_EQ(Entity->GetPosition().X, 2.0f);
+
+    // Posting a message nothing is subscribed to should do nothing
+    Entity->GetScript().PostMessageToScript("otherMessage", R"({"x": 3, "label": "it's 'quoted'"})");
+    EXPECT_EQ(Entity->GetPosition().X, 2.0f);
+}
+
+// Check that moving an ancestor deep in a hierarchy is reflected in the cached global transforms of every descendant.
+CSP_INTERNAL_TEST(CSPEngine, SpaceEntityTests, GlobalTransformUpdatesWhenDeepAncestorMovesTest)
+{
+    auto LogSystem = csp::common::LogSystem {};
+    auto ScriptSystem = csp::systems::ScriptSystem::MakeInitialised();
+    auto Engine = csp::multiplayer::OfflineRealtimeEngine { LogSystem, *ScriptSystem };
+
+    constexpr int HierarchyDepth = 10;
+    const SpaceTransform LocalTransform { csp::common::Vector3(1, 0, 0), csp::common::Vector4::Identity(), csp::common::Vector3::One() };
+
+    auto [Root] = AWAIT(&Engine, CreateEntity, "Root", LocalTransform, csp::common::Optional<uint64_t> {});
+    ASSERT_NE(Root, nullptr);
+
+    std::vector<SpaceEntity*> Hierarchy { Root };
+
+    for (int i = 1; i < HierarchyDepth; ++i)
+    {
+        SpaceEntity* Parent = Hierarchy.back();
+        auto [Child] = AWAIT(Parent, CreateChildEntity, csp::common::String(std::to_string(i).c_str()), LocalTransform);
+        ASSERT_NE(Child, nullptr);
+        Hierarchy.push_back(Child);
+    }
+
+    SpaceEntity* Leaf = Hierarchy.back();
+    EXPECT_EQ(Leaf->GetGlobalPosition(), csp::common::Vector3(HierarchyDepth, 0, 0));
+
+    // Move an entity part way down the hierarchy, everything below it should follow
+    Hierarchy[4]->SetPosition(csp::common::Vector3(1, 2, 0));
+    Hierarchy[4]->SetScale(csp::common::Vector3(2, 2, 2));
+
+    EXPECT_EQ(Hierarchy[3]->GetGlobalPosition(), csp::common::Vector3(4, 0, 0));
+    EXPECT_EQ(Hierarchy[5]->GetGlobalPosition(), csp::common::Vector3(7, 2, 0));
+    EXPECT_EQ(Leaf->GetGlobalPosition(), csp::common::Vector3(15, 2, 0));
+    EXPECT_EQ(Leaf->GetGlobalScale(), csp::common::Vector3(2, 2, 2));
+
+    // The batch pass should produce the same results as querying lazily
+    Root->SetPosition(csp::common::Vector3(11, 0, 0));
+    Root->UpdateWorldTransforms();
+
+    EXPECT_EQ(Hierarchy[5]->GetGlobalPosition(), csp::common::Vector3(17, 2, 0));
+    EXPECT_EQ(Leaf->GetGlobalPosition(), csp::common::Vector3(25, 2, 0));
+
+    const SpaceTransform LeafGlobalTransform = Leaf->GetGlobalTransform();
+    EXPECT_EQ(LeafGlobalTransform.Position, Leaf->GetGlobalPosition());
+    EXPECT_EQ(LeafGlobalTransform.Rotation, csp::common::Vector4::Identity());
+    EXPECT_EQ(LeafGlobalTransform.Scale, csp::common::Vector3(2, 2, 2));
+}
+
+// Check that reparenting an entity, or removing its parent, refreshes the cached global transforms of it and its children.
+CSP_INTERNAL_TEST(CSPEngine, SpaceEntityTests, GlobalTransformUpdatesWhenReparentedTest)
+{
+    auto LogSystem = csp::common::LogSystem {};
+    auto ScriptSystem = csp::systems::ScriptSystem::MakeInitialised();
+    auto Engine = csp::multiplayer::OfflineRealtimeEngine { LogSystem, *ScriptSystem };
+
+    const SpaceTransform ParentATransform { csp::common::Vector3(10, 0, 0), csp::common::Vector4::Identity(), csp::common::Vector3::One() };
+    const SpaceTransform ParentBTransform { csp::common::Vector3(0, 20, 0), csp::common::Vector4::Identity(), csp::common::Vector3::One() };
+    const SpaceTransform LocalTransform { csp::common::Vector3(1, 1, 1), csp::common::Vector4::Identity(), csp::common::Vector3::One() };
+
+    auto [ParentA] = AWAIT(&Engine, CreateEntity, "ParentA", ParentATransform, csp::common::Optional<uint64_t> {});
+    auto [ParentB] = AWAIT(&Engine, CreateEntity, "ParentB", ParentBTransform, csp::common::Optional<uint64_t> {});
+    auto [Child] = AWAIT(ParentA, CreateChildEntity, "Child", LocalTransform);
+    auto [GrandChild] = AWAIT(Child, CreateChildEntity, "GrandChild", LocalTransform);
+
+    EXPECT_EQ(GrandChild->GetGlobalPosition(), csp::common::Vector3(12, 2, 2));
+
+    Child->SetParentId(ParentB->GetId());
+
+    EXPECT_EQ(Child->GetParentEntity(), ParentB);
+    EXPECT_EQ(Child->GetGlobalPosition(), csp::common::Vector3(1, 21, 1));
+    EXPECT_EQ(GrandChild->GetGlobalPosition(), csp::common::Vector3(2, 22, 2));
+
+    Child->RemoveParentEntity();
+
+    EXPECT_EQ(Child->GetParentEntity(), nullptr);
+    EXPECT_EQ(Child->GetGlobalPosition(), csp::common::Vector3(1, 1, 1));
+    EXPECT_EQ(GrandChild->GetGlobalPosition(), csp::common::Vector3(2, 2, 2));
+}
+
+// Check that global transforms can be read from several threads while an ancestor is being moved, without readers seeing a half written cache.
+CSP_INTERNAL_TEST(CSPEngine, SpaceEntityTests, GlobalTransformConcurrentReadsTest)
+{
+    auto LogSystem = csp::common::LogSystem {};
+    auto ScriptSystem = csp::systems::ScriptSystem::MakeInitialised();
+    auto Engine = csp::multiplayer::OfflineRealtimeEngine { LogSystem, *ScriptSystem };
+
+    const SpaceTransform LocalTransform { csp::common::Vector3(1, 0, 0), csp::common::Vector4::Identity(), csp::common::Vector3::One() };
+
+    auto [Root] = AWAIT(&Engine, CreateEntity, "Root", LocalTransform, csp::common::Optional<uint64_t> {});
+    ASSERT_NE(Root, nullptr);
+
+    auto [Child] = AWAIT(Root, CreateChildEntity, "Child", LocalTransform);
+    ASSERT_NE(Child, nullptr);
+
+    auto [Leaf] = AWAIT(Child, CreateChildEntity, "Leaf", LocalTransform);
+    ASSERT_NE(Leaf, nullptr);
+
+    constexpr int NumReaders = 4;
+    constexpr int NumMoves = 2000;
+
+    std::atomic<bool> Moving = true;
+    std::atomic<int> UnexpectedReads = 0;
+    std::vector<std::thread> Readers;
+
+    for (int i = 0; i < NumReaders; ++i)
+    {
+        Readers.emplace_back(
+            [&]()
+            {
+                while (Moving)
+                {
+                    // The root only ever moves between two positions, and nothing else changes.
+                    const csp::common::Vector3 Position = Leaf->GetGlobalPosition();
+
+                    if ((Position.X != 3.0f && Position.X != 103.0f) || Position.Y != 0.0f || Position.Z != 0.0f)
+                    {
+                        ++UnexpectedReads;
+                    }
+                }
+            });
+    }
+
+    for (int i = 0; i < NumMoves; ++i)
+    {
+        Root->SetPosition(csp::common::Vector3(i % 2 == 0 ? 101.0f : 1.0f, 0, 0));
+    }
+
+    Moving = false;
+
+    for (auto& Reader : Readers)
+    {
+        Reader.join();
+    }
+
+    EXPECT_EQ(UnexpectedReads, 0);
+    EXPECT_EQ(Leaf->GetGlobalPosition(), csp::common::Vector3(3, 0, 0));
+}
+
+// Check that the bulk global transform queries agree with querying each entity individually, including after a change deep in the hierarchy.
+CSP_INTERNAL_TEST(CSPEngine, SpaceEntityTests, GetGlobalTransformsMatchesPerEntityQueriesTest)
+{
+    auto LogSystem = csp::common::LogSystem {};
+    auto ScriptSystem = csp::systems::ScriptSystem::MakeInitialised();
+    auto Engine = csp::multiplayer::OfflineRealtimeEngine { LogSystem, *ScriptSystem };
+
+    const SpaceTransform RootTransform { csp::common::Vector3(10, 0, 0), csp::common::Vector4::Identity(), csp::common::Vector3(2, 2, 2) };
+    const SpaceTransform LocalTransform { csp::common::Vector3(1, 0, 0), csp::common::Vector4::Identity(), csp::common::Vector3::One() };
+
+    auto [Root] = AWAIT(&Engine, CreateEntity, "Root", RootTransform, csp::common::Optional<uint64_t> {});
+    auto [Child] = AWAIT(Root, CreateChildEntity, "Child", LocalTransform);
+    auto [GrandChild] = AWAIT(Child, CreateChildEntity, "GrandChild", LocalTransform);
+
+    Child->SetPosition(csp::common::Vector3(0, 3, 0));
+
+    const csp::common::Array<SpaceEntity*> Entities { GrandChild, Root, Child };
+    const csp::common::Array<SpaceTransform> GlobalTransforms = SpaceEntity::GetGlobalTransforms(Entities);
+
+    ASSERT_EQ(GlobalTransforms.Size(), Entities.Size());
+
+    for (size_t i = 0; i < Entities.Size(); ++i)
+    {
+        EXPECT_EQ(GlobalTransforms[i], Entities[i]->GetGlobalTransform());
+    }
+
+    EXPECT_EQ(GlobalTransforms[0].Position, csp::common::Vector3(12, 6, 0));
+
+    // The inverse takes global positions back into each entity's local space
+    const csp::common::Array<SpaceTransform> InverseTransforms = SpaceEntity::GetInverseGlobalTransforms(Entities);
+
+    ASSERT_EQ(InverseTransforms.Size(), Entities.Size());
+    EXPECT_EQ(InverseTransforms[1].Position, csp::common::Vector3(-5, 0, 0));
+    EXPECT_EQ(InverseTransforms[1].Scale, csp::common::Vector3(0.5f, 0.5f, 0.5f));
+    EXPECT_EQ(InverseTransforms[0].Position, csp::common::Vector3(-6, -3, 0));
+}
+
+// Check that null entries in the bulk global transform queries are skipped and given the identity transform.
+CSP_INTERNAL_TEST(CSPEngine, SpaceEntityTests, GetGlobalTransformsSkipsNullEntitiesTest)
+{
+    auto LogSystem = csp::common::LogSystem {};
+    auto ScriptSystem = csp::systems::ScriptSystem::MakeInitialised();
+    auto Engine = csp::multiplayer::OfflineRealtimeEngine { LogSystem, *ScriptSystem };
+
+    const SpaceTransform RootTransform { csp::common::Vector3(10, 0, 0), csp::common::Vector4::Identity(), csp::common::Vector3(2, 2, 2) };
+    const SpaceTransform LocalTransform { csp::common::Vector3(1, 0, 0), csp::common::Vector4::Identity(), csp::common::Vector3::One() };
+
+    auto [Root] = AWAIT(&Engine, CreateEntity, "Root", RootTransform, csp::common::Optional<uint64_t> {});
+    auto [Child] = AWAIT(Root, CreateChildEntity, "Child", LocalTransform);
+
+    const csp::common::Array<SpaceEntity*> Entities { nullptr, Child, nullptr };
+
+    const csp::common::Array<SpaceTransform> GlobalTransforms = SpaceEntity::GetGlobalTransforms(Entities);
+
+    ASSERT_EQ(GlobalTransforms.Size(), Entities.Size());
+    EXPECT_EQ(GlobalTransforms[0], SpaceTransform {});
+    EXPECT_EQ(GlobalTransforms[1], Child->GetGlobalTransform());
+    EXPECT_EQ(GlobalTransforms[2], SpaceTransform {});
+
+    const csp::common::Array<SpaceTransform> InverseTransforms = SpaceEntity::GetInverseGlobalTransforms(Entities);
+
+    ASSERT_EQ(InverseTransforms.Size(), Entities.Size());
+    EXPECT_EQ(InverseTransforms[0], SpaceTransform {});
+    EXPECT_EQ(InverseTransforms[1].Position, csp::common::Vector3(-6, 0, 0));
+    EXPECT_EQ(InverseTransforms[2], SpaceTransform {});
+}
+
+// Check that reassigning a subscribed callback after it has been called takes effect, rather than the first definition being called forever.
+CSP_INTERNAL_TEST(CSPEngine, SpaceEntityTests, PostMessageToScriptCallsResubscribedCallbackTest)
+{
+    auto LogSystem = csp::common::LogSystem {};
+    auto ScriptSystem = csp::systems::ScriptSystem::MakeInitialised();
+    auto Engine = csp::multiplayer::OfflineRealtimeEngine { LogSystem, *ScriptSystem };
+
+    auto [Entity] = AWAIT(&Engine, CreateEntity, "Test Entity", csp::multiplayer::SpaceTransform {}, csp::common::Optional<uint64_t> {});
+    ASSERT_NE(Entity, nullptr);
+
+    // The first definition replaces itself and resubscribes while it is running, which the call has to survive.
+    const std::string ScriptText = R"xx(
+        globalThis.onCustomMessage = (message, params) => {
+            ThisEntity.position = [1, 0, 0];
+
+            globalThis.onCustomMessage = (message, params) => {
+                ThisEntity.position = [2, 0, 0];
+
+                // Reassigning without subscribing again should still be picked up.
+                globalThis.onCustomMessage = (message, params) => {
+                    ThisEntity.position = [3, 0, 0];
+                }
+            }
+
+            ThisEntity.subscribeToMessage("customMessage", "onCustomMessage");
+        }
+
+        ThisEntity.subscribeToMessage("customMessage", "onCustomMessage");
+    )xx";
+
+    auto* ScriptComponent = static_cast<ScriptSpaceComponent*>(Entity->AddComponent(ComponentType::ScriptData));
+    ScriptComponent->SetScriptSource(ScriptText.c_str());
+    Entity->GetScript().Invoke();
+
+    EXPECT_FALSE(Entity->GetScript().HasError());
+
+    Entity->GetScript().PostMessageToScript("customMessage", "{}");
+    EXPECT_EQ(Entity->GetPosition().X, 1.0f);
+
+    Entity->GetScript().PostMessageToScript("customMessage", "{}");
+    EXPECT_EQ(Entity->GetPosition().X, 2.0f);
+
+    Entity->GetScript().PostMessageToScript("customMessage", "{}");
+    EXPECT_EQ(Entity->GetPosition().X, 3.0f);
+}
+
+// Check that removing a batch of entities from the index and root hierarchy keeps the remaining entities in the order they were added.
+CSP_INTERNAL_TEST(CSPEngine, SpaceEntityTests, SpaceEntityIndexRemoveAllKeepsOrderTest)
+{
+    auto LogSystem = csp::common::LogSystem {};
+    auto ScriptSystem = csp::systems::ScriptSystem::MakeInitialised();
+    auto Engine = csp::multiplayer::OfflineRealtimeEngine { LogSystem, *ScriptSystem };
+
+    constexpr int NumEntities = 6;
+    std::vector<SpaceEntity*> CreatedEntities;
+
+    for (int i = 0; i < NumEntities; ++i)
+    {
+        auto [Entity] = AWAIT(&Engine, CreateEntity, csp::common::String(std::to_string(i).c_str()), SpaceTransform {},
+            csp::common::Optional<uint64_t> {});
+        ASSERT_NE(Entity, nullptr);
+        CreatedEntities.push_back(Entity);
+    }
+
+    // The engine owns the entities, the index and hierarchy under test only track them.
+    csp::common::List<SpaceEntity*> Entities;
+    csp::common::List<SpaceEntity*> Avatars;
+    csp::common::List<SpaceEntity*> Objects;
+    SpaceEntityIndex Index { Entities, Avatars, Objects };
+    SpaceEntityHierarchy Hierarchy;
+
+    for (SpaceEntity* Entity : CreatedEntities)
+    {
+        EXPECT_TRUE(Index.Add(Entity));
+        Hierarchy.AddRoot(Entity);
+    }
+
+    const std::unordered_set<SpaceEntity*> ToRemove { CreatedEntities[0], CreatedEntities[2], CreatedEntities[3] };
+    Index.RemoveAll(ToRemove);
+    Hierarchy.RemoveRoots(ToRemove);
+
+    const std::vector<SpaceEntity*> Expected { CreatedEntities[1], CreatedEntities[4], CreatedEntities[5] };
+
+    ASSERT_EQ(Entities.Size(), Expected.size());
+    ASSERT_EQ(Objects.Size(), Expected.size());
+    ASSERT_EQ(Hierarchy.GetRootEntities().Size(), Expected.size());
+
+    for (size_t i = 0; i < Expected.size(); ++i)
+    {
+        EXPECT_EQ(Entities[i], Expected[i]);
+        EXPECT_EQ(Objects[i], Expected[i]);
+        EXPECT_EQ(Hierarchy.GetRootEntities()[i], Expected[i]);
+    }
+
+    EXPECT_EQ(Index.Size(), Expected.size());
+
+    for (SpaceEntity* Removed : ToRemove)
+    {
+        EXPECT_EQ(Index.FindById(Removed->GetId()), nullptr);
+        EXPECT_EQ(Index.FindByName(Removed->GetName()), nullptr);
+        EXPECT_FALSE(Hierarchy.IsRoot(Removed));
+    }
+}
+
+// Check that removing a single entity from the index and root hierarchy moves the last entity into its place, and that the recorded positions
+// stay correct for later removals, including after a batch removal has compacted the lists.
+CSP_INTERNAL_TEST(CSPEngine, SpaceEntityTests, SpaceEntityIndexRemoveSwapsLastEntityTest)
+{
+    auto LogSystem = csp::common::LogSystem {};
+    auto ScriptSystem = csp::systems::ScriptSystem::MakeInitialised();
+    auto Engine = csp::multiplayer::OfflineRealtimeEngine { LogSystem, *ScriptSystem };
+
+    constexpr int NumEntities = 5;
+    std::vector<SpaceEntity*> CreatedEntities;
+
+    for (int i = 0; i < NumEntities; ++i)
+    {
+        auto [Entity] = AWAIT(&Engine, CreateEntity, csp::common::String(std::to_string(i).c_str()), SpaceTransform {},
+            csp::common::Optional<uint64_t> {});
+        ASSERT_NE(Entity, nullptr);
+        CreatedEntities.push_back(Entity);
+    }
+
+    // The engine owns the entities, the index and hierarchy under test only track them.
+    csp::common::List<SpaceEntity*> Entities;
+    csp::common::List<SpaceEntity*> Avatars;
+    csp::common::List<SpaceEntity*> Objects;
+    SpaceEntityIndex Index { Entities, Avatars, Objects };
+    SpaceEntityHierarchy Hierarchy;
+
+    for (SpaceEntity* Entity : CreatedEntities)
+    {
+        EXPECT_TRUE(Index.Add(Entity));
+        Hierarchy.AddRoot(Entity);
+    }
+
+    const auto ExpectEntities = [&](const std::vector<SpaceEntity*>& Expected)
+    {
+        ASSERT_EQ(Entities.Size(), Expected.size());
+        ASSERT_EQ(Objects.Size(), Expected.size());
+        ASSERT_EQ(Hierarchy.GetRootEntities().Size(), Expected.size());
+
+        for (size_t i = 0; i < Expected.size(); ++i)
+        {
+            EXPECT_EQ(Entities[i], Expected[i]);
+            EXPECT_EQ(Objects[i], Expected[i]);
+            EXPECT_EQ(Hierarchy.GetRootEntities()[i], Expected[i]);
+        }
+    };
+
+    Index.Remove(CreatedEntities[1]);
+    Hierarchy.RemoveRoot(CreatedEntities[1]);
+    ExpectEntities({ CreatedEntities[0], CreatedEntities[4], CreatedEntities[2], CreatedEntities[3] });
+
+    Index.RemoveAll({ CreatedEntities[0] });
+    Hierarchy.RemoveRoots({ CreatedEntities[0] });
+    ExpectEntities({ CreatedEntities[4], CreatedEntities[2], CreatedEntities[3] });
+
+    Index.Remove(CreatedEntities[4]);
+    Hierarchy.RemoveRoot(CreatedEntities[4]);
+    ExpectEntities({ CreatedEntities[3], CreatedEntities[2] });
+
+    // Removing entities that are no longer tracked does nothing.
+    Index.Remove(CreatedEntities[1]);
+    Hierarchy.RemoveRoot(CreatedEntities[1]);
+    ExpectEntities({ CreatedEntities[3], CreatedEntities[2] });
+
+    EXPECT_EQ(Index.Size(), 2);
+    EXPECT_EQ(Index.FindById(CreatedEntities[4]->GetId()), nullptr);
+    EXPECT_FALSE(Hierarchy.IsRoot(CreatedEntities[4]));
+    EXPECT_TRUE(Hierarchy.IsRoot(CreatedEntities[2]));
+}
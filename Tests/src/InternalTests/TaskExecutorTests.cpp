@@ -0,0 +1,176 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Common/TaskExecutor.h"
+#include "TestHelpers.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+// Tasks queued from several threads at once, and from the workers themselves, should all run exactly once.
+CSP_INTERNAL_TEST(CSPEngine, TaskExecutorTests, RunsAllTasksTest)
+{
+    constexpr int ProducerCount = 4;
+    constexpr int TasksPerProducer = 5000;
+
+    std::atomic_int RunCount = 0;
+
+    {
+        csp::TaskExecutor Executor(4);
+
+        std::vector<std::thread> Producers;
+
+        for (int i = 0; i < ProducerCount; ++i)
+        {
+            Producers.emplace_back(
+                [&Executor, &RunCount]()
+                {
+                    for (int j = 0; j < TasksPerProducer; ++j)
+                    {
+                        // Every other task queues a follow up from the worker it runs on.
+                        Executor.Enqueue(
+                            [&Executor, &RunCount, j]()
+                            {
+                                ++RunCount;
+
+                                if (j % 2 == 0)
+                                {
+                                    Executor.Enqueue([&RunCount]() { ++RunCount; });
+                                }
+                            });
+                    }
+                });
+        }
+
+        for (auto& Producer : Producers)
+        {
+            Producer.join();
+        }
+
+        // Shutdown runs everything that was queued before returning.
+        Executor.Shutdown();
+
+        EXPECT_EQ(Executor.GetPendingTaskCount(), 0);
+    }
+
+    EXPECT_EQ(RunCount, ProducerCount * TasksPerProducer + ProducerCount * TasksPerProducer / 2);
+}
+
+// Once a worker is free, it should take the highest priority task available, and tasks of the same priority on one worker run in order.
+CSP_INTERNAL_TEST(CSPEngine, TaskExecutorTests, PriorityOrderTest)
+{
+    csp::TaskExecutor Executor(1);
+
+    std::promise<void> Release;
+    std::shared_future<void> Released = Release.get_future().share();
+
+    std::mutex OrderMutex;
+    std::vector<int> Order;
+
+    const auto Record = [&OrderMutex, &Order](int Value)
+    {
+        std::scoped_lock<std::mutex> Locker(OrderMutex);
+        Order.push_back(Value);
+    };
+
+    // Keep the only worker busy so everything below is queued before anything runs.
+    Executor.Enqueue([Released]() { Released.wait(); });
+
+    Executor.Enqueue([&Record]() { Record(5); }, csp::TaskPriority::Low);
+    Executor.Enqueue([&Record]() { Record(3); }, csp::TaskPriority::Normal);
+    Executor.Enqueue([&Record]() { Record(1); }, csp::TaskPriority::High);
+    Executor.Enqueue([&Record]() { Record(4); }, csp::TaskPriority::Normal);
+    Executor.Enqueue([&Record]() { Record(2); }, csp::TaskPriority::High);
+    Executor.Enqueue([&Record]() { Record(6); }, csp::TaskPriority::Low);
+
+    Release.set_value();
+    Executor.Shutdown();
+
+    EXPECT_EQ(Order, (std::vector<int> { 1, 2, 3, 4, 5, 6 }));
+}
+
+// Tasks with an affinity hint are queued on that worker, but an idle worker should still steal them rather than leave them waiting.
+CSP_INTERNAL_TEST(CSPEngine, TaskExecutorTests, IdleWorkersStealTest)
+{
+    csp::TaskExecutor Executor(2);
+
+    std::promise<void> Release;
+    std::shared_future<void> Released = Release.get_future().share();
+
+    std::atomic_bool StolenTaskRan = false;
+
+    // Block worker 0, then queue more work on it. The only way that work runs before the release is for worker 1 to steal it.
+    Executor.Enqueue([Released]() { Released.wait(); }, csp::TaskPriority::Normal, 0);
+    Executor.Enqueue([&StolenTaskRan]() { StolenTaskRan = true; }, csp::TaskPriority::Normal, 0);
+
+    const auto Deadline = std::chrono::steady_clock::now() + 5s;
+
+    while (StolenTaskRan == false && std::chrono::steady_clock::now() < Deadline)
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+
+    EXPECT_TRUE(StolenTaskRan);
+
+    Release.set_value();
+    Executor.Shutdown();
+}
+
+// A task that throws shouldn't take its worker down, and tasks queued after shutdown should still run rather than being dropped.
+CSP_INTERNAL_TEST(CSPEngine, TaskExecutorTests, ThrowingAndLateTasksTest)
+{
+    csp::TaskExecutor Executor(1);
+
+    std::promise<void> AfterThrow;
+    std::future<void> AfterThrowRan = AfterThrow.get_future();
+
+    Executor.Enqueue([]() { throw std::runtime_error("Task failed"); });
+    Executor.Enqueue([&AfterThrow]() { AfterThrow.set_value(); });
+
+    EXPECT_EQ(AfterThrowRan.wait_for(5s), std::future_status::ready);
+
+    Executor.Shutdown();
+
+    std::thread::id LateTaskThread;
+    Executor.Enqueue([&LateTaskThread]() { LateTaskThread = std::this_thread::get_id(); });
+
+    EXPECT_EQ(LateTaskThread, std::this_thread::get_id());
+    EXPECT_EQ(Executor.GetPendingTaskCount(), 0);
+}
+
+// async++ continuations can be run on the executor through its scheduler adapter.
+CSP_INTERNAL_TEST(CSPEngine, TaskExecutorTests, AsyncSchedulerTest)
+{
+    csp::TaskExecutor Executor(2);
+
+    const std::thread::id CallerThread = std::this_thread::get_id();
+
+    auto Task = async::spawn(Executor.GetAsyncScheduler(), []() { return std::this_thread::get_id(); })
+                    .then(Executor.GetAsyncScheduler(csp::TaskPriority::High), [](std::thread::id WorkerThread) { return WorkerThread; });
+
+    EXPECT_NE(Task.get(), CallerThread);
+
+    Executor.Shutdown();
+}
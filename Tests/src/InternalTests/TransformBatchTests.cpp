@@ -0,0 +1,346 @@
+/*
+ * Copyright 2026 Magnopus LLC
+
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CSP/Multiplayer/SpaceTransform.h"
+#include "Multiplayer/TransformBatch.h"
+#include "TestHelpers.h"
+
+#include "gtest/gtest.h"
+#include <glm/gtc/quaternion.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace csp::multiplayer;
+
+namespace
+{
+
+constexpr float Tolerance = 1e-4f;
+
+csp::common::Vector4 RandomRotation(std::mt19937& Random)
+{
+    std::uniform_real_distribution<float> Distribution(-1.0f, 1.0f);
+
+    const csp::common::Vector4 Rotation { Distribution(Random), Distribution(Random), Distribution(Random), Distribution(Random) };
+    const float Length = std::sqrt(Rotation.X * Rotation.X + Rotation.Y * Rotation.Y + Rotation.Z * Rotation.Z + Rotation.W * Rotation.W);
+
+    return { Rotation.X / Length, Rotation.Y / Length, Rotation.Z / Length, Rotation.W / Length };
+}
+
+SpaceTransform RandomTransform(std::mt19937& Random)
+{
+    std::uniform_real_distribution<float> PositionDistribution(-10.0f, 10.0f);
+    std::uniform_real_distribution<float> ScaleDistribution(0.5f, 2.0f);
+
+    return SpaceTransform { { PositionDistribution(Random), PositionDistribution(Random), PositionDistribution(Random) }, RandomRotation(Random),
+        { ScaleDistribution(Random), ScaleDistribution(Random), ScaleDistribution(Random) } };
+}
+
+void ExpectTransformNear(const SpaceTransform& Actual, const SpaceTransform& Expected)
+{
+    EXPECT_NEAR(Actual.Position.X, Expected.Position.X, Tolerance);
+    EXPECT_NEAR(Actual.Position.Y, Expected.Position.Y, Tolerance);
+    EXPECT_NEAR(Actual.Position.Z, Expected.Position.Z, Tolerance);
+    EXPECT_NEAR(Actual.Rotation.X, Expected.Rotation.X, Tolerance);
+    EXPECT_NEAR(Actual.Rotation.Y, Expected.Rotation.Y, Tolerance);
+    EXPECT_NEAR(Actual.Rotation.Z, Expected.Rotation.Z, Tolerance);
+    EXPECT_NEAR(Actual.Rotation.W, Expected.Rotation.W, Tolerance);
+    EXPECT_NEAR(Actual.Scale.X, Expected.Scale.X, Tolerance);
+    EXPECT_NEAR(Actual.Scale.Y, Expected.Scale.Y, Tolerance);
+    EXPECT_NEAR(Actual.Scale.Z, Expected.Scale.Z, Tolerance);
+}
+
+// Copy of the previous per-entity composition SpaceEntity used for global transforms, kept as a reference and for the benchmark below.
+SpaceTransform LegacyComposeTransform(const SpaceTransform& Parent, const SpaceTransform& Local)
+{
+    const glm::mat4 ParentTranslate = glm::translate(glm::mat4(1.0f), glm::vec3(Parent.Position.X, Parent.Position.Y, Parent.Position.Z));
+    const glm::quat ParentOrientation { Parent.Rotation.W, Parent.Rotation.X, Parent.Rotation.Y, Parent.Rotation.Z };
+    const glm::mat4 ParentRotation(ParentOrientation);
+    const glm::mat4 ParentScale = glm::scale(glm::mat4(1.0f), glm::vec3(Parent.Scale.X, Parent.Scale.Y, Parent.Scale.Z));
+    const glm::mat4 ParentTransform = ParentTranslate * ParentRotation * ParentScale;
+
+    const glm::vec3 Position = ParentTransform * glm::vec4(Local.Position.X, Local.Position.Y, Local.Position.Z, 1.0f);
+    const glm::quat Orientation = ParentOrientation * glm::quat(Local.Rotation.W, Local.Rotation.X, Local.Rotation.Y, Local.Rotation.Z);
+
+    return SpaceTransform { { Position.x, Position.y, Position.z }, { Orientation.x, Orientation.y, Orientation.z, Orientation.w },
+        Parent.Scale * Local.Scale };
+}
+
+/*
+    A synthetic hierarchy in breadth first order, where every entity has BranchingFactor children.
+    Each level is a contiguous range of entities, and parents always come before their children.
+*/
+struct SyntheticHierarchy
+{
+    std::vector<SpaceTransform> LocalTransforms;
+    std::vector<size_t> ParentIndices;
+    std::vector<size_t> LevelOffsets;
+};
+
+SyntheticHierarchy MakeSyntheticHierarchy(size_t EntityCount, size_t BranchingFactor)
+{
+    std::mt19937 Random(1234);
+    SyntheticHierarchy Hierarchy;
+
+    Hierarchy.LevelOffsets.push_back(0);
+    size_t LevelSize = 1;
+
+    for (size_t i = 0; i < EntityCount; ++i)
+    {
+        if (i == Hierarchy.LevelOffsets.back() + LevelSize)
+        {
+            Hierarchy.LevelOffsets.push_back(i);
+            LevelSize *= BranchingFactor;
+        }
+
+        Hierarchy.LocalTransforms.push_back(RandomTransform(Random));
+        Hierarchy.ParentIndices.push_back(i == 0 ? 0 : (i - 1) / BranchingFactor);
+    }
+
+    Hierarchy.LevelOffsets.push_back(EntityCount);
+
+    return Hierarchy;
+}
+
+std::vector<SpaceTransform> ComputeGlobalTransformsPerEntity(const SyntheticHierarchy& Hierarchy)
+{
+    std::vector<SpaceTransform> GlobalTransforms(Hierarchy.LocalTransforms.size());
+    GlobalTransforms[0] = Hierarchy.LocalTransforms[0];
+
+    for (size_t i = 1; i < GlobalTransforms.size(); ++i)
+    {
+        GlobalTransforms[i] = LegacyComposeTransform(GlobalTransforms[Hierarchy.ParentIndices[i]], Hierarchy.LocalTransforms[i]);
+    }
+
+    return GlobalTransforms;
+}
+
+// Mirrors SpaceEntity::RefreshGlobalTransforms, gathering each level's parents and composing the level as one batch.
+TransformBuffer ComputeGlobalTransformsBatched(const SyntheticHierarchy& Hierarchy, const TransformBuffer& LocalTransforms)
+{
+    TransformBuffer GlobalTransforms;
+    GlobalTransforms.Resize(Hierarchy.LocalTransforms.size());
+    GlobalTransforms.Set(0, Hierarchy.LocalTransforms[0]);
+
+    TransformBuffer Parents;
+
+    for (size_t Level = 1; Level + 1 < Hierarchy.LevelOffsets.size(); ++Level)
+    {
+        const size_t Begin = Hierarchy.LevelOffsets[Level];
+        const size_t Count = Hierarchy.LevelOffsets[Level + 1] - Begin;
+        Parents.Resize(Count);
+
+        for (size_t i = 0; i < Count; ++i)
+        {
+            Parents.Set(i, GlobalTransforms.Get(Hierarchy.ParentIndices[Begin + i]));
+        }
+
+        const ConstTransformStreams Locals = LocalTransforms.GetStreams();
+        const TransformStreams Globals = GlobalTransforms.GetStreams();
+
+        ComposeTransforms(std::as_const(Parents).GetStreams(),
+            { Locals.PositionX + Begin, Locals.PositionY + Begin, Locals.PositionZ + Begin, Locals.RotationX + Begin, Locals.RotationY + Begin,
+                Locals.RotationZ + Begin, Locals.RotationW + Begin, Locals.ScaleX + Begin, Locals.ScaleY + Begin, Locals.ScaleZ + Begin },
+            { Globals.PositionX + Begin, Globals.PositionY + Begin, Globals.PositionZ + Begin, Globals.RotationX + Begin,
+                Globals.RotationY + Begin, Globals.RotationZ + Begin, Globals.RotationW + Begin, Globals.ScaleX + Begin, Globals.ScaleY + Begin,
+                Globals.ScaleZ + Begin },
+            Count);
+    }
+
+    return GlobalTransforms;
+}
+
+template <typename Func> double MeasureMilliseconds(Func&& Function)
+{
+    const auto Start = std::chrono::steady_clock::now();
+    Function();
+    const auto End = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(End - Start).count();
+}
+
+} // namespace
+
+CSP_INTERNAL_TEST(CSPEngine, TransformBatchTests, ComposeTransformMatchesLegacyCompositionTest)
+{
+    std::mt19937 Random(42);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        const SpaceTransform Parent = RandomTransform(Random);
+        const SpaceTransform Local = RandomTransform(Random);
+
+        ExpectTransformNear(ComposeTransform(Parent, Local), LegacyComposeTransform(Parent, Local));
+    }
+}
+
+CSP_INTERNAL_TEST(CSPEngine, TransformBatchTests, ComposeTransformsMatchesSingleCompositionTest)
+{
+    // Deliberately not a multiple of any SIMD width, so the scalar tail is covered too.
+    constexpr size_t Count = 37;
+    std::mt19937 Random(7);
+
+    TransformBuffer Parents;
+    TransformBuffer Locals;
+    Parents.Resize(Count);
+    Locals.Resize(Count);
+
+    for (size_t i = 0; i < Count; ++i)
+    {
+        Parents.Set(i, RandomTransform(Random));
+        Locals.Set(i, RandomTransform(Random));
+    }
+
+    TransformBuffer Globals;
+    Globals.Resize(Count);
+    ComposeTransforms(std::as_const(Parents).GetStreams(), std::as_const(Locals).GetStreams(), Globals.GetStreams(), Count);
+
+    for (size_t i = 0; i < Count; ++i)
+    {
+        ExpectTransformNear(Globals.Get(i), ComposeTransform(Parents.Get(i), Locals.Get(i)));
+    }
+
+    // Writing the results over one of the inputs should give the same answer
+    ComposeTransforms(std::as_const(Parents).GetStreams(), std::as_const(Locals).GetStreams(), Locals.GetStreams(), Count);
+
+    for (size_t i = 0; i < Count; ++i)
+    {
+        ExpectTransformNear(Locals.Get(i), Globals.Get(i));
+    }
+}
+
+CSP_INTERNAL_TEST(CSPEngine, TransformBatchTests, InvertTransformsRoundTripTest)
+{
+    constexpr size_t Count = 21;
+    std::mt19937 Random(99);
+
+    TransformBuffer Transforms;
+    Transforms.Resize(Count);
+
+    for (size_t i = 0; i < Count; ++i)
+    {
+        Transforms.Set(i, RandomTransform(Random));
+    }
+
+    TransformBuffer Inverses;
+    Inverses.Resize(Count);
+    InvertTransforms(std::as_const(Transforms).GetStreams(), Inverses.GetStreams(), Count);
+
+    const SpaceTransform Identity;
+
+    for (size_t i = 0; i < Count; ++i)
+    {
+        const SpaceTransform Transform = Transforms.Get(i);
+        const SpaceTransform Inverse = Inverses.Get(i);
+
+        ExpectTransformNear(Inverse, InvertTransform(Transform));
+        ExpectTransformNear(ComposeTransform(Inverse, Transform), Identity);
+    }
+
+    // With uniform scale, taking a global position into local space and back again should give the original position
+    const SpaceTransform UniformlyScaled { { 1.0f, 2.0f, 3.0f }, RandomRotation(Random), { 2.0f, 2.0f, 2.0f } };
+    const SpaceTransform GlobalPoint { { 3.0f, -2.0f, 5.0f }, Identity.Rotation, Identity.Scale };
+
+    const SpaceTransform LocalPoint = ComposeTransform(InvertTransform(UniformlyScaled), GlobalPoint);
+    ExpectTransformNear(ComposeTransform(UniformlyScaled, LocalPoint), GlobalPoint);
+}
+
+// Global transforms computed a level at a time through ComposeTransforms should match composing each entity with its parent in turn.
+CSP_INTERNAL_TEST(CSPEngine, TransformBatchTests, BatchedGlobalTransformsMatchPerEntityTest)
+{
+    // Five full levels with a branching factor of 4.
+    constexpr size_t EntityCount = 341;
+
+    const SyntheticHierarchy Hierarchy = MakeSyntheticHierarchy(EntityCount, 4);
+
+    TransformBuffer LocalTransforms;
+    LocalTransforms.Resize(EntityCount);
+
+    for (size_t i = 0; i < EntityCount; ++i)
+    {
+        LocalTransforms.Set(i, Hierarchy.LocalTransforms[i]);
+    }
+
+    const std::vector<SpaceTransform> PerEntityResults = ComputeGlobalTransformsPerEntity(Hierarchy);
+    const TransformBuffer BatchedResults = ComputeGlobalTransformsBatched(Hierarchy, LocalTransforms);
+
+    ASSERT_EQ(Hierarchy.LevelOffsets.size(), 6);
+
+    // Positions and scales grow down the hierarchy, and rounding error with them, so compare relative to their magnitude
+    for (size_t i = 0; i < EntityCount; ++i)
+    {
+        const SpaceTransform Batched = BatchedResults.Get(i);
+        const SpaceTransform& PerEntity = PerEntityResults[i];
+
+        EXPECT_NEAR(Batched.Position.X, PerEntity.Position.X, Tolerance * std::max(1.0f, std::abs(PerEntity.Position.X)));
+        EXPECT_NEAR(Batched.Position.Y, PerEntity.Position.Y, Tolerance * std::max(1.0f, std::abs(PerEntity.Position.Y)));
+        EXPECT_NEAR(Batched.Position.Z, PerEntity.Position.Z, Tolerance * std::max(1.0f, std::abs(PerEntity.Position.Z)));
+        EXPECT_NEAR(Batched.Rotation.X, PerEntity.Rotation.X, Tolerance);
+        EXPECT_NEAR(Batched.Rotation.Y, PerEntity.Rotation.Y, Tolerance);
+        EXPECT_NEAR(Batched.Rotation.Z, PerEntity.Rotation.Z, Tolerance);
+        EXPECT_NEAR(Batched.Rotation.W, PerEntity.Rotation.W, Tolerance);
+        EXPECT_NEAR(Batched.Scale.X, PerEntity.Scale.X, Tolerance * PerEntity.Scale.X);
+        EXPECT_NEAR(Batched.Scale.Y, PerEntity.Scale.Y, Tolerance * PerEntity.Scale.Y);
+        EXPECT_NEAR(Batched.Scale.Z, PerEntity.Scale.Z, Tolerance * PerEntity.Scale.Z);
+    }
+}
+
+/*
+    Benchmark of computing global transforms for large hierarchies, comparing the previous per-entity glm path with the batched kernels.
+    Timings are reported rather than asserted on, as they're too machine dependent to make a reliable test. Disabled as it's too slow for
+    the unit suite; run it with --gtest_also_run_disabled_tests.
+*/
+CSP_INTERNAL_TEST(DISABLED_CSPEngine, TransformBatchTests, GlobalTransformBenchmark)
+{
+    // A branching factor of 4 gives 8 and 10 levels at these sizes, similar to a deep rig.
+    for (const size_t EntityCount : { static_cast<size_t>(10000), static_cast<size_t>(100000) })
+    {
+        const SyntheticHierarchy Hierarchy = MakeSyntheticHierarchy(EntityCount, 4);
+
+        TransformBuffer LocalTransforms;
+        LocalTransforms.Resize(EntityCount);
+
+        for (size_t i = 0; i < EntityCount; ++i)
+        {
+            LocalTransforms.Set(i, Hierarchy.LocalTransforms[i]);
+        }
+
+        std::vector<SpaceTransform> PerEntityResults;
+        TransformBuffer BatchedResults;
+
+        const double PerEntityMs = MeasureMilliseconds([&]() { PerEntityResults = ComputeGlobalTransformsPerEntity(Hierarchy); });
+        const double BatchedMs = MeasureMilliseconds([&]() { BatchedResults = ComputeGlobalTransformsBatched(Hierarchy, LocalTransforms); });
+
+        std::cout << "Global transform benchmark, " << EntityCount << " entities in " << Hierarchy.LevelOffsets.size() - 1 << " levels ("
+                  << GetTransformKernelName() << "): per-entity " << PerEntityMs << "ms -> batched " << BatchedMs << "ms" << std::endl;
+
+        // Positions and scales grow down the hierarchy, and rounding error with them, so compare relative to their magnitude
+        for (size_t i = 0; i < EntityCount; i += 997)
+        {
+            const SpaceTransform Batched = BatchedResults.Get(i);
+            const SpaceTransform& PerEntity = PerEntityResults[i];
+
+            EXPECT_NEAR(Batched.Position.X, PerEntity.Position.X, Tolerance * std::max(1.0f, std::abs(PerEntity.Position.X)));
+            EXPECT_NEAR(Batched.Rotation.W, PerEntity.Rotation.W, Tolerance);
+            EXPECT_NEAR(Batched.Scale.Z, PerEntity.Scale.Z, Tolerance * PerEntity.Scale.Z);
+        }
+    }
+}
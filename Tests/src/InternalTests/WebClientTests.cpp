@@ -16,6 +16,7 @@
 
 #include "CSP/CSPFoundation.h"
 #include "CSP/Common/fmt_Formatters.h"
+#include "CSP/Systems/Assets/AssetSystem.h"
 #include "CSP/Systems/SystemsManager.h"
 #include "CSP/Systems/Users/UserSystem.h"
 #include "Debug/Logging.h"
@@ -32,6 +33,44 @@
 
 #include "Mocks/WebClientMock.h"
 
+#ifndef CSP_WASM
+#include "Common/Web/POCOWebClient/HTTPSessionPool.h"
+#include "Common/Web/POCOWebClient/MultipartFileContentSource.h"
+#include "Common/Web/POCOWebClient/POCOWebClient.h"
+#include "Common/Web/RequestDispatcher.h"
+#include "Mocks/AuthContextMock.h"
+#include "Services/ApiBase/ApiBase.h"
+#include "Systems/Assets/RangedAssetDownload.h"
+#include "Web/RemoteFileManager.h"
+
+#include <Poco/Base64Encoder.h>
+#include <Poco/MD5Engine.h>
+#include <Poco/Net/HTTPRequest.h>
+#include <Poco/Net/HTTPRequestHandler.h>
+#include <Poco/Net/HTTPRequestHandlerFactory.h>
+#include <Poco/Net/HTTPResponse.h>
+#include <Poco/Net/HTTPServer.h>
+#include <Poco/Net/HTTPServerParams.h>
+#include <Poco/Net/HTTPServerRequest.h>
+#include <Poco/Net/HTTPServerResponse.h>
+#include <Poco/Net/HTTPSessionInstantiator.h>
+#include <Poco/Net/MessageHeader.h>
+#include <Poco/Net/MultipartReader.h>
+#include <Poco/Net/ServerSocket.h>
+#include <Poco/StreamCopier.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
 using namespace csp::web;
 
 inline const char* TESTS_PAYLOAD_RESPONSE_CONTENT = "payloadData";
@@ -232,3 +271,919 @@ CSP_INTERNAL_TEST(CSPEngine, WebClientTests, MockWebClientRequestResponseVeryVer
 
     csp::CSPFoundation::Shutdown();
 }
+
+#ifndef CSP_WASM
+
+namespace
+{
+
+// Replies to every request with a short body, keeping the connection alive if the client asked for it.
+class KeepAliveRequestHandler : public Poco::Net::HTTPRequestHandler
+{
+public:
+    void handleRequest(Poco::Net::HTTPServerRequest& Request, Poco::Net::HTTPServerResponse& Response) override
+    {
+        Response.setKeepAlive(Request.getKeepAlive());
+        Response.setContentLength(5);
+        Response.send() << "hello";
+    }
+};
+
+class KeepAliveRequestHandlerFactory : public Poco::Net::HTTPRequestHandlerFactory
+{
+public:
+    Poco::Net::HTTPRequestHandler* createRequestHandler(const Poco::Net::HTTPServerRequest& /*Request*/) override
+    {
+        return new KeepAliveRequestHandler;
+    }
+};
+
+// Sends a GET on a session acquired from the pool, and releases it back to the pool once the body has been read.
+std::string GetFromPool(HTTPSessionPool& Pool, const Poco::URI& Uri)
+{
+    HTTPSessionPool::Lease Session = Pool.Acquire(Uri);
+
+    Poco::Net::HTTPRequest Request(Poco::Net::HTTPRequest::HTTP_GET, Uri.getPathAndQuery(), Poco::Net::HTTPRequest::HTTP_1_1);
+    Session->sendRequest(Request);
+
+    Poco::Net::HTTPResponse Response;
+    std::istream& ResponseStream = Session->receiveResponse(Response);
+
+    std::string Body;
+    Poco::StreamCopier::copyToString(ResponseStream, Body);
+    Session.Release(Response.getKeepAlive() && ResponseStream.eof());
+
+    return Body;
+}
+
+} // namespace
+
+// Sessions should be reused across requests to the same host, and discarded once the server closes them or they sit idle for too long.
+CSP_INTERNAL_TEST(CSPEngine, WebClientTests, HTTPSessionPoolReusesKeepAliveSessionsTest)
+{
+    Poco::Net::HTTPSessionInstantiator::registerInstantiator();
+
+    Poco::Net::HTTPServerParams::Ptr Params = new Poco::Net::HTTPServerParams;
+    Params->setKeepAlive(true);
+
+    Poco::Net::ServerSocket Socket(Poco::Net::SocketAddress("127.0.0.1", 0));
+    Poco::Net::HTTPServer Server(new KeepAliveRequestHandlerFactory, Socket, Params);
+    Server.start();
+
+    const Poco::URI Uri("http://127.0.0.1:" + std::to_string(Socket.address().port()) + "/");
+
+    HTTPSessionPool Pool;
+
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(GetFromPool(Pool, Uri), "hello");
+    }
+
+    HTTPSessionPool::Stats Stats = Pool.GetStats();
+    EXPECT_EQ(Stats.Misses, 1);
+    EXPECT_EQ(Stats.Hits, 2);
+    EXPECT_EQ(Stats.HandshakesAvoided, 2);
+    EXPECT_EQ(Stats.IdleSessions, 1);
+
+    // Requests that can't safely be resent ask for a new session, leaving the idle one in the pool.
+    {
+        HTTPSessionPool::Lease NewSession = Pool.Acquire(Uri, false);
+        EXPECT_FALSE(NewSession.IsReused());
+    }
+
+    Stats = Pool.GetStats();
+    EXPECT_EQ(Stats.Misses, 2);
+    EXPECT_EQ(Stats.Hits, 2);
+    EXPECT_EQ(Stats.IdleSessions, 1);
+
+    // A session that has been idle for too long should not be handed out again.
+    Pool.SetIdleTimeout(std::chrono::milliseconds(0));
+    EXPECT_EQ(GetFromPool(Pool, Uri), "hello");
+
+    Stats = Pool.GetStats();
+    EXPECT_EQ(Stats.Misses, 3);
+    EXPECT_EQ(Stats.Evictions, 1);
+
+    // Nor should one the server has since closed.
+    Pool.SetIdleTimeout(HTTPSessionPool::DEFAULT_IDLE_TIMEOUT);
+    EXPECT_EQ(GetFromPool(Pool, Uri), "hello");
+    EXPECT_EQ(Pool.GetStats().IdleSessions, 1);
+
+    Server.stopAll(true);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    HTTPSessionPool::Lease Session = Pool.Acquire(Uri);
+    EXPECT_FALSE(Session.IsReused());
+
+    Stats = Pool.GetStats();
+    EXPECT_EQ(Stats.Misses, 4);
+    EXPECT_EQ(Stats.Evictions, 2);
+    EXPECT_EQ(Stats.IdleSessions, 0);
+
+    Poco::Net::HTTPSessionInstantiator::unregisterInstantiator();
+}
+
+// Ready work should be admitted highest priority first, and never more at once than the concurrency limit.
+CSP_INTERNAL_TEST(CSPEngine, WebClientTests, RequestDispatcherAdmitsByPriorityTest)
+{
+    std::mutex OrderMutex;
+    std::vector<int> Order;
+    std::atomic_int Running = 0;
+    std::atomic_int MaxRunning = 0;
+
+    auto MakeWork = [&](int Id)
+    {
+        return [&, Id]()
+        {
+            const int NowRunning = ++Running;
+            MaxRunning = std::max(MaxRunning.load(), NowRunning);
+
+            {
+                std::scoped_lock<std::mutex> OrderLocker(OrderMutex);
+                Order.push_back(Id);
+            }
+
+            --Running;
+        };
+    };
+
+    {
+        csp::TaskExecutor Executor(4);
+        RequestDispatcher Dispatcher(Executor, 1);
+
+        // Hold the only slot, so everything after it queues up in the dispatcher.
+        std::promise<void> Unblock;
+        std::shared_future<void> Blocked = Unblock.get_future().share();
+        Dispatcher.Dispatch([Blocked]() { Blocked.wait(); });
+
+        Dispatcher.Dispatch(MakeWork(3), csp::TaskPriority::Low);
+        Dispatcher.Dispatch(MakeWork(2), csp::TaskPriority::Normal);
+        Dispatcher.Dispatch(MakeWork(1), csp::TaskPriority::High);
+
+        EXPECT_EQ(Dispatcher.GetInFlightCount(), 1);
+        EXPECT_EQ(Dispatcher.GetReadyCount(), 3);
+
+        Unblock.set_value();
+        Dispatcher.Shutdown();
+        Executor.Shutdown();
+    }
+
+    EXPECT_EQ(Order, (std::vector<int> { 1, 2, 3 }));
+    EXPECT_EQ(MaxRunning, 1);
+}
+
+// Work that throws should still give its slot back, so the work queued behind it runs.
+CSP_INTERNAL_TEST(CSPEngine, WebClientTests, RequestDispatcherReleasesSlotWhenWorkThrowsTest)
+{
+    csp::TaskExecutor Executor(1);
+    RequestDispatcher Dispatcher(Executor, 1);
+
+    Dispatcher.Dispatch([]() { throw std::runtime_error("Failed"); });
+
+    std::promise<void> NextRan;
+    std::future<void> NextFuture = NextRan.get_future();
+    Dispatcher.Dispatch([&NextRan]() { NextRan.set_value(); });
+
+    EXPECT_EQ(NextFuture.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+
+    Dispatcher.Shutdown();
+    Executor.Shutdown();
+
+    EXPECT_EQ(Dispatcher.GetInFlightCount(), 0);
+}
+
+// Delayed and gated work should be parked without holding a worker, and released once its delay is up or the gate opens or times out.
+CSP_INTERNAL_TEST(CSPEngine, WebClientTests, RequestDispatcherParksDelayedAndGatedWorkTest)
+{
+    csp::TaskExecutor Executor(1);
+    RequestDispatcher Dispatcher(Executor, 1);
+
+    std::promise<void> DelayedRan;
+    std::future<void> DelayedFuture = DelayedRan.get_future();
+    Dispatcher.Dispatch([&DelayedRan]() { DelayedRan.set_value(); }, csp::TaskPriority::Normal, std::chrono::milliseconds(300));
+
+    // The delayed work must not stop this from running straight away, even with a single worker and slot.
+    std::promise<void> ImmediateRan;
+    std::future<void> ImmediateFuture = ImmediateRan.get_future();
+    Dispatcher.Dispatch([&ImmediateRan]() { ImmediateRan.set_value(); });
+
+    EXPECT_EQ(ImmediateFuture.wait_for(std::chrono::milliseconds(200)), std::future_status::ready);
+    EXPECT_NE(DelayedFuture.wait_for(std::chrono::milliseconds(0)), std::future_status::ready);
+    EXPECT_EQ(DelayedFuture.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+
+    // Gated work waits for the gate, but anything that doesn't wait for it goes ahead.
+    Dispatcher.CloseGate(std::chrono::seconds(30));
+
+    std::promise<void> GatedRan;
+    std::future<void> GatedFuture = GatedRan.get_future();
+    Dispatcher.Dispatch([&GatedRan]() { GatedRan.set_value(); });
+
+    std::promise<void> UngatedRan;
+    std::future<void> UngatedFuture = UngatedRan.get_future();
+    Dispatcher.Dispatch([&UngatedRan]() { UngatedRan.set_value(); }, csp::TaskPriority::High, std::chrono::milliseconds(0), false);
+
+    EXPECT_EQ(UngatedFuture.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_NE(GatedFuture.wait_for(std::chrono::milliseconds(50)), std::future_status::ready);
+    EXPECT_EQ(Dispatcher.GetParkedCount(), 1);
+
+    Dispatcher.OpenGate();
+    EXPECT_EQ(GatedFuture.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+
+    // A gate nobody opens should let work through once it times out.
+    Dispatcher.CloseGate(std::chrono::milliseconds(100));
+
+    std::promise<void> TimedOutRan;
+    std::future<void> TimedOutFuture = TimedOutRan.get_future();
+    Dispatcher.Dispatch([&TimedOutRan]() { TimedOutRan.set_value(); });
+
+    EXPECT_EQ(TimedOutFuture.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_TRUE(Dispatcher.IsGateOpen());
+
+    Dispatcher.Shutdown();
+    Executor.Shutdown();
+}
+
+// A file upload body should be produced from the file as it is read, and parse back into the checksum, version and file parts.
+CSP_INTERNAL_TEST(CSPEngine, WebClientTests, MultipartFileContentSourceStreamsFileUploadTest)
+{
+    const std::string FilePath = std::filesystem::absolute("assets/Fox.glb").string();
+
+    std::ifstream File(FilePath, std::ios::in | std::ios::binary);
+    const std::string FileContents((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
+    ASSERT_FALSE(FileContents.empty());
+
+    Poco::MD5Engine MD5Hasher;
+    MD5Hasher.update(FileContents);
+    const std::string ExpectedChecksum = Poco::DigestEngine::digestToHex(MD5Hasher.digest());
+
+    auto Source = std::make_shared<MultipartFileContentSource>(FilePath, "model/gltf-binary", "3");
+    ASSERT_TRUE(Source->IsValid());
+    EXPECT_EQ(Source->GetChecksum(), ExpectedChecksum);
+
+    // Form files are copied into the request payload, which should take the source rather than a copy of the body.
+    auto FormFile = std::make_shared<HttpPayload>();
+    FormFile->SetContentSource(Source);
+    FormFile->SetBoundary(Source->GetBoundary().c_str());
+
+    HttpPayload Payload;
+    Payload.AddFormParam("FormFile", FormFile);
+    ASSERT_TRUE(Payload.HasContentSource());
+    EXPECT_EQ(Payload.GetContent().Length(), 0);
+
+    const size_t ContentLength = Payload.GetContentLength();
+    EXPECT_GT(ContentLength, FileContents.size());
+
+    // Read the body in small chunks, as the web client does when sending it.
+    std::string Body;
+    char Buffer[2 * 1024];
+
+    while (Body.size() < ContentLength)
+    {
+        const size_t Read = Payload.ReadContent(Body.size(), Buffer, sizeof(Buffer));
+        ASSERT_GT(Read, 0);
+        Body.append(Buffer, Read);
+    }
+
+    EXPECT_EQ(Payload.ReadContent(ContentLength, Buffer, sizeof(Buffer)), 0);
+
+    // A resent request reads the body again from the start, and should get the same bytes.
+    const size_t Reread = Payload.ReadContent(0, Buffer, sizeof(Buffer));
+    EXPECT_EQ(std::string(Buffer, Reread), Body.substr(0, Reread));
+
+    std::istringstream BodyStream(Body);
+    Poco::Net::MultipartReader Reader(BodyStream, Source->GetBoundary());
+    std::vector<std::pair<Poco::Net::MessageHeader, std::string>> Parts;
+
+    while (Reader.hasNextPart())
+    {
+        Poco::Net::MessageHeader PartHeader;
+        Reader.nextPart(PartHeader);
+
+        std::string PartContents;
+        Poco::StreamCopier::copyToString(Reader.stream(), PartContents);
+        Parts.emplace_back(PartHeader, PartContents);
+    }
+
+    ASSERT_EQ(Parts.size(), 3);
+    EXPECT_EQ(Parts[0].first.get("Content-Disposition"), "form-data; name=\"Checksum\"");
+    EXPECT_EQ(Parts[0].second, ExpectedChecksum);
+    EXPECT_EQ(Parts[1].first.get("Content-Disposition"), "form-data; name=\"Version\"");
+    EXPECT_EQ(Parts[1].second, "3");
+    EXPECT_EQ(Parts[2].first.get("Content-Disposition"), "form-data; name=\"FormFile\"; filename=\"Fox.glb\"");
+    EXPECT_EQ(Parts[2].first.get("Content-Type"), "model/gltf-binary");
+    EXPECT_TRUE(Parts[2].second == FileContents);
+}
+
+namespace
+{
+
+// Replies to every request with the same body, using chunked transfer encoding so the client can't know its length up front.
+class ChunkedRequestHandler : public Poco::Net::HTTPRequestHandler
+{
+public:
+    ChunkedRequestHandler(const std::string& InBody)
+        : Body(InBody)
+    {
+    }
+
+    void handleRequest(Poco::Net::HTTPServerRequest& /*Request*/, Poco::Net::HTTPServerResponse& Response) override
+    {
+        Response.setChunkedTransferEncoding(true);
+        Response.send() << Body;
+    }
+
+private:
+    std::string Body;
+};
+
+class ChunkedRequestHandlerFactory : public Poco::Net::HTTPRequestHandlerFactory
+{
+public:
+    ChunkedRequestHandlerFactory(const std::string& InBody)
+        : Body(InBody)
+    {
+    }
+
+    Poco::Net::HTTPRequestHandler* createRequestHandler(const Poco::Net::HTTPServerRequest& /*Request*/) override
+    {
+        return new ChunkedRequestHandler(Body);
+    }
+
+private:
+    std::string Body;
+};
+
+class StringResponseSink : public HttpResponseSink
+{
+public:
+    bool Begin(const std::optional<size_t>& InContentLength) override
+    {
+        ContentLength = InContentLength;
+        Data.clear();
+
+        return true;
+    }
+
+    bool Write(const char* InData, size_t DataLength) override
+    {
+        Data.append(InData, DataLength);
+
+        return Data.size() <= MaxLength;
+    }
+
+    bool End() override
+    {
+        Ended = true;
+
+        return true;
+    }
+
+    std::optional<size_t> ContentLength;
+    std::string Data;
+    size_t MaxLength = std::numeric_limits<size_t>::max();
+    bool Ended = false;
+};
+
+class PromiseResponseHandler : public IHttpResponseHandler
+{
+public:
+    void OnHttpResponse(HttpResponse& Response) override
+    {
+        // Bodies may be binary, so copy the full length rather than stopping at the first null.
+        const csp::common::String& Content = Response.GetPayload().GetContent();
+        Promise.set_value(std::make_pair(Response.GetResponseCode(), std::string(Content.c_str(), Content.Length())));
+    }
+
+    std::promise<std::pair<EResponseCodes, std::string>> Promise;
+};
+
+std::pair<EResponseCodes, std::string> GetWithSink(WebClient& Client, const std::string& Url, const std::shared_ptr<HttpResponseSink>& Sink)
+{
+    PromiseResponseHandler Handler;
+    auto Future = Handler.Promise.get_future();
+
+    HttpPayload Payload;
+    Payload.SetResponseSink(Sink);
+
+    Client.SendRequest(ERequestVerb::Get, Uri(Url.c_str()), Payload, &Handler, csp::common::CancellationToken::Dummy());
+
+    return Future.get();
+}
+
+} // namespace
+
+// Chunked responses should be read in full, and streamed into a response sink when the request has one rather than into the response.
+CSP_INTERNAL_TEST(CSPEngine, WebClientTests, ChunkedResponseStreamsIntoResponseSinkTest)
+{
+    InitialiseFoundationWithUserAgentInfo(EndpointBaseURI());
+
+    // Binary, starting with a null byte, so the body must be handled with its full length everywhere it is copied.
+    std::string Body(100 * 1024, '\0');
+
+    for (size_t i = 0; i < Body.size(); ++i)
+    {
+        Body[i] = static_cast<char>(i * 31);
+    }
+
+    Poco::Net::ServerSocket Socket(Poco::Net::SocketAddress("127.0.0.1", 0));
+    Poco::Net::HTTPServer Server(new ChunkedRequestHandlerFactory(Body), Socket, new Poco::Net::HTTPServerParams);
+    Server.start();
+
+    const std::string Url = "http://127.0.0.1:" + std::to_string(Socket.address().port()) + "/asset.glb";
+
+    {
+        POCOWebClient Client(80, ETransferProtocol::HTTP, nullptr, false);
+
+        auto Sink = std::make_shared<StringResponseSink>();
+        auto [ResponseCode, ResponseContent] = GetWithSink(Client, Url, Sink);
+
+        EXPECT_EQ(ResponseCode, EResponseCodes::ResponseOK);
+        EXPECT_FALSE(Sink->ContentLength.has_value());
+        EXPECT_TRUE(Sink->Ended);
+        EXPECT_TRUE(Sink->Data == Body);
+        EXPECT_TRUE(ResponseContent.empty());
+
+        // Without a sink, the body should still be read despite having no content length.
+        std::tie(ResponseCode, ResponseContent) = GetWithSink(Client, Url, nullptr);
+
+        EXPECT_EQ(ResponseCode, EResponseCodes::ResponseOK);
+        EXPECT_TRUE(ResponseContent == Body);
+
+        // A sink that can't take the whole body should fail the request, without it being retried.
+        auto FullSink = std::make_shared<StringResponseSink>();
+        FullSink->MaxLength = 1024;
+        std::tie(ResponseCode, ResponseContent) = GetWithSink(Client, Url, FullSink);
+
+        EXPECT_EQ(ResponseCode, EResponseCodes::ResponseInsufficientStorage);
+        EXPECT_FALSE(FullSink->Ended);
+    }
+
+    Server.stopAll(true);
+
+    csp::CSPFoundation::Shutdown();
+}
+
+namespace
+{
+
+// The file served by RangedRequestHandler, along with what a test needs to observe and control.
+struct RangedFile
+{
+    std::string Body;
+    std::string ETag;
+    // Sent as a Content-MD5 header when set.
+    std::string ContentMD5;
+    // Whether byte ranges are advertised and honoured. When they aren't, every request is sent the whole file.
+    bool AcceptRanges = true;
+    std::atomic<int> RangeRequests { 0 };
+    std::atomic<int> WholeRequests { 0 };
+    // The offset of a range request to fail once, to interrupt a download. Negative for none.
+    std::atomic<int64_t> FailRangeOffset { -1 };
+    // A token to cancel when the next range request arrives, to cancel a download while it has segments in flight.
+    std::atomic<csp::common::CancellationToken*> CancelOnRangeRequest { nullptr };
+};
+
+// Serves a file with byte range support, as an object store would.
+class RangedRequestHandler : public Poco::Net::HTTPRequestHandler
+{
+public:
+    RangedRequestHandler(RangedFile& InFile)
+        : File(InFile)
+    {
+    }
+
+    void handleRequest(Poco::Net::HTTPServerRequest& Request, Poco::Net::HTTPServerResponse& Response) override
+    {
+        if (File.AcceptRanges)
+        {
+            Response.set("Accept-Ranges", "bytes");
+        }
+
+        Response.set("ETag", "\"" + File.ETag + "\"");
+
+        if (File.ContentMD5.empty() == false)
+        {
+            Response.set("Content-MD5", File.ContentMD5);
+        }
+
+        unsigned long long First = 0;
+        unsigned long long Last = 0;
+
+        if (File.AcceptRanges == false || Request.has("Range") == false
+            || std::sscanf(Request.get("Range").c_str(), "bytes=%llu-%llu", &First, &Last) != 2)
+        {
+            // HEAD requests are sent the headers only.
+            if (Request.getMethod() == Poco::Net::HTTPRequest::HTTP_GET)
+            {
+                ++File.WholeRequests;
+            }
+
+            Response.setContentLength(File.Body.size());
+            Response.send() << File.Body;
+            return;
+        }
+
+        ++File.RangeRequests;
+
+        if (csp::common::CancellationToken* Token = File.CancelOnRangeRequest.exchange(nullptr))
+        {
+            Token->Cancel();
+        }
+
+        int64_t FailOffset = static_cast<int64_t>(First);
+
+        if (File.FailRangeOffset.compare_exchange_strong(FailOffset, -1))
+        {
+            Response.setStatusAndReason(Poco::Net::HTTPResponse::HTTP_NOT_FOUND);
+            Response.setContentLength(0);
+            Response.send();
+            return;
+        }
+
+        const size_t Length = static_cast<size_t>(Last - First + 1);
+
+        Response.setStatusAndReason(Poco::Net::HTTPResponse::HTTP_PARTIAL_CONTENT);
+        Response.set("Content-Range", fmt::format("bytes {}-{}/{}", First, Last, File.Body.size()));
+        Response.setContentLength(Length);
+        Response.send().write(File.Body.data() + First, Length);
+    }
+
+private:
+    RangedFile& File;
+};
+
+class RangedRequestHandlerFactory : public Poco::Net::HTTPRequestHandlerFactory
+{
+public:
+    RangedRequestHandlerFactory(RangedFile& InFile)
+        : File(InFile)
+    {
+    }
+
+    Poco::Net::HTTPRequestHandler* createRequestHandler(const Poco::Net::HTTPServerRequest& /*Request*/) override
+    {
+        return new RangedRequestHandler(File);
+    }
+
+private:
+    RangedFile& File;
+};
+
+// Serves a RangedFile on a free local port for as long as it's alive.
+class RangedFileServer
+{
+public:
+    RangedFileServer(RangedFile& File)
+        : Socket(Poco::Net::SocketAddress("127.0.0.1", 0))
+        , Server(new RangedRequestHandlerFactory(File), Socket, new Poco::Net::HTTPServerParams)
+    {
+        Server.start();
+    }
+
+    ~RangedFileServer() { Server.stopAll(true); }
+
+    csp::common::String GetUrl() const { return ("http://127.0.0.1:" + std::to_string(Socket.address().port()) + "/splat.ply").c_str(); }
+
+private:
+    Poco::Net::ServerSocket Socket;
+    Poco::Net::HTTPServer Server;
+};
+
+// What RangedAssetDownload needs to download from a RangedFileServer, without going through the systems.
+class RangedDownloadClient
+{
+public:
+    using DownloadResult = std::tuple<csp::systems::EResultCode, uint16_t, uint64_t>;
+
+    RangedDownloadClient()
+        : Client(80, ETransferProtocol::HTTP, nullptr, false)
+        , FileManager(&Client, AuthContext)
+        , Api(&Client, Definition)
+    {
+        EXPECT_CALL(AuthContext, GetLoginState).WillRepeatedly(::testing::ReturnRef(LoginState));
+    }
+
+    DownloadResult Download(const csp::common::String& Url, const std::string& FilePath, uint64_t SegmentSize,
+        csp::common::CancellationToken& CancellationToken = csp::common::CancellationToken::Dummy())
+    {
+        std::promise<DownloadResult> Promise;
+        auto Future = Promise.get_future();
+
+        csp::systems::RangedAssetDownload::Start(&FileManager, &Api, Url, FilePath.c_str(), 3, SegmentSize, CancellationToken,
+            [&Promise](csp::systems::EResultCode ResultCode, uint16_t HttpResultCode, uint64_t FileSize)
+            { Promise.set_value(std::make_tuple(ResultCode, HttpResultCode, FileSize)); });
+
+        return Future.get();
+    }
+
+private:
+    POCOWebClient Client;
+    csp::common::LoginState LoginState;
+    MockAuthContext AuthContext;
+    RemoteFileManager FileManager;
+    csp::ServiceDefinition Definition;
+    csp::services::ApiBase Api;
+};
+
+std::string MakeRangedFileBody(size_t Size, size_t Seed)
+{
+    std::string Body(Size, '\0');
+
+    for (size_t i = 0; i < Body.size(); ++i)
+    {
+        Body[i] = static_cast<char>(i * 31 + i / 4096 + Seed);
+    }
+
+    return Body;
+}
+
+std::string MD5Hex(const std::string& Data)
+{
+    Poco::MD5Engine MD5Hasher;
+    MD5Hasher.update(Data);
+
+    return Poco::DigestEngine::digestToHex(MD5Hasher.digest());
+}
+
+// The MD5 as a Content-MD5 header carries it.
+std::string MD5Base64(const std::string& Data)
+{
+    Poco::MD5Engine MD5Hasher;
+    MD5Hasher.update(Data);
+    const Poco::DigestEngine::Digest& Digest = MD5Hasher.digest();
+
+    std::ostringstream Stream;
+    Poco::Base64Encoder Encoder(Stream);
+    Encoder.write(reinterpret_cast<const char*>(Digest.data()), Digest.size());
+    Encoder.close();
+
+    return Stream.str();
+}
+
+std::string ReadFileContents(const std::string& FilePath)
+{
+    std::ifstream File(FilePath, std::ios::in | std::ios::binary);
+
+    return std::string((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
+}
+
+} // namespace
+
+// Large files should be downloaded as parallel byte ranges, resuming from the completed ranges after a failure, and checked once complete.
+CSP_INTERNAL_TEST(CSPEngine, WebClientTests, RangedAssetDownloadResumesAndVerifiesTest)
+{
+    using csp::systems::EResultCode;
+    using csp::systems::RangedAssetDownload;
+
+    InitialiseFoundationWithUserAgentInfo(EndpointBaseURI());
+
+    constexpr uint64_t SegmentSize = 256 * 1024;
+    constexpr int SegmentCount = 6;
+
+    RangedFile File;
+    File.Body = MakeRangedFileBody(SegmentCount * SegmentSize - 1000, 0);
+    File.ETag = MD5Hex(File.Body);
+    File.ContentMD5 = MD5Base64(File.Body);
+
+    const std::string FilePath = (std::filesystem::temp_directory_path() / "RangedAssetDownloadTest.ply").string();
+    const std::string StateFilePath = RangedAssetDownload::GetStateFilePath(FilePath);
+
+    {
+        RangedFileServer Server(File);
+        RangedDownloadClient Client;
+
+        // Interrupt the download part way through.
+        File.FailRangeOffset = 3 * SegmentSize;
+
+        auto [ResultCode, HttpResultCode, FileSize] = Client.Download(Server.GetUrl(), FilePath, SegmentSize);
+
+        EXPECT_EQ(ResultCode, EResultCode::Failed);
+        EXPECT_EQ(HttpResultCode, static_cast<uint16_t>(EResponseCodes::ResponseNotFound));
+        EXPECT_TRUE(std::filesystem::exists(StateFilePath));
+
+        // Trying again should only download the ranges that didn't complete.
+        const int RangeRequestsBeforeResume = File.RangeRequests;
+
+        std::tie(ResultCode, HttpResultCode, FileSize) = Client.Download(Server.GetUrl(), FilePath, SegmentSize);
+
+        EXPECT_EQ(ResultCode, EResultCode::Success);
+        EXPECT_EQ(FileSize, File.Body.size());
+        EXPECT_GT(File.RangeRequests - RangeRequestsBeforeResume, 0);
+        EXPECT_LT(File.RangeRequests - RangeRequestsBeforeResume, SegmentCount);
+        EXPECT_FALSE(std::filesystem::exists(StateFilePath));
+        EXPECT_TRUE(ReadFileContents(FilePath) == File.Body);
+
+        // An ETag that looks like an MD5 isn't always one, so not matching it shouldn't fail the download.
+        File.ETag = std::string(32, '0');
+
+        std::tie(ResultCode, HttpResultCode, FileSize) = Client.Download(Server.GetUrl(), FilePath, SegmentSize);
+
+        EXPECT_EQ(ResultCode, EResultCode::Success);
+
+        // A file that doesn't match the checksum the server declares should fail, and not be resumable.
+        File.ContentMD5 = MD5Base64(std::string());
+
+        std::tie(ResultCode, HttpResultCode, FileSize) = Client.Download(Server.GetUrl(), FilePath, SegmentSize);
+
+        EXPECT_EQ(ResultCode, EResultCode::Failed);
+        EXPECT_FALSE(std::filesystem::exists(StateFilePath));
+    }
+
+    std::filesystem::remove(FilePath);
+
+    csp::CSPFoundation::Shutdown();
+}
+
+// Cancelling a download while ranges are in flight should report the cancellation, and keep the progress so it can be resumed.
+CSP_INTERNAL_TEST(CSPEngine, WebClientTests, RangedAssetDownloadReportsCancellationTest)
+{
+    using csp::systems::EResultCode;
+    using csp::systems::RangedAssetDownload;
+
+    InitialiseFoundationWithUserAgentInfo(EndpointBaseURI());
+
+    constexpr uint64_t SegmentSize = 256 * 1024;
+
+    RangedFile File;
+    File.Body = MakeRangedFileBody(6 * SegmentSize, 0);
+    File.ETag = MD5Hex(File.Body);
+
+    const std::string FilePath = (std::filesystem::temp_directory_path() / "RangedAssetDownloadCancelTest.ply").string();
+    const std::string StateFilePath = RangedAssetDownload::GetStateFilePath(FilePath);
+
+    {
+        RangedFileServer Server(File);
+        RangedDownloadClient Client;
+
+        csp::common::CancellationToken CancellationToken;
+        File.CancelOnRangeRequest = &CancellationToken;
+
+        auto [ResultCode, HttpResultCode, FileSize] = Client.Download(Server.GetUrl(), FilePath, SegmentSize, CancellationToken);
+
+        EXPECT_EQ(ResultCode, EResultCode::Failed);
+        EXPECT_EQ(HttpResultCode, static_cast<uint16_t>(EResponseCodes::ResponseRequestTimeout));
+        EXPECT_TRUE(std::filesystem::exists(StateFilePath));
+
+        std::tie(ResultCode, HttpResultCode, FileSize) = Client.Download(Server.GetUrl(), FilePath, SegmentSize);
+
+        EXPECT_EQ(ResultCode, EResultCode::Success);
+        EXPECT_TRUE(ReadFileContents(FilePath) == File.Body);
+    }
+
+    std::filesystem::remove(FilePath);
+
+    csp::CSPFoundation::Shutdown();
+}
+
+// Progress saved against a file that has since changed on the server should be thrown away, rather than mixing ranges of both.
+CSP_INTERNAL_TEST(CSPEngine, WebClientTests, RangedAssetDownloadRestartsWhenFileChangesTest)
+{
+    using csp::systems::EResultCode;
+    using csp::systems::RangedAssetDownload;
+
+    InitialiseFoundationWithUserAgentInfo(EndpointBaseURI());
+
+    constexpr uint64_t SegmentSize = 256 * 1024;
+    constexpr int SegmentCount = 6;
+
+    RangedFile File;
+    File.Body = MakeRangedFileBody(SegmentCount * SegmentSize - 1000, 0);
+    File.ETag = MD5Hex(File.Body);
+
+    const std::string FilePath = (std::filesystem::temp_directory_path() / "RangedAssetDownloadChangedTest.ply").string();
+    const std::string StateFilePath = RangedAssetDownload::GetStateFilePath(FilePath);
+
+    {
+        RangedFileServer Server(File);
+        RangedDownloadClient Client;
+
+        File.FailRangeOffset = 3 * SegmentSize;
+
+        auto [ResultCode, HttpResultCode, FileSize] = Client.Download(Server.GetUrl(), FilePath, SegmentSize);
+
+        EXPECT_EQ(ResultCode, EResultCode::Failed);
+        EXPECT_TRUE(std::filesystem::exists(StateFilePath));
+
+        // The same size, so only the ETag tells the two apart.
+        File.Body = MakeRangedFileBody(File.Body.size(), 1);
+        File.ETag = MD5Hex(File.Body);
+
+        const int RangeRequestsBeforeRetry = File.RangeRequests;
+
+        std::tie(ResultCode, HttpResultCode, FileSize) = Client.Download(Server.GetUrl(), FilePath, SegmentSize);
+
+        EXPECT_EQ(ResultCode, EResultCode::Success);
+        EXPECT_EQ(File.RangeRequests - RangeRequestsBeforeRetry, SegmentCount);
+        EXPECT_FALSE(std::filesystem::exists(StateFilePath));
+        EXPECT_TRUE(ReadFileContents(FilePath) == File.Body);
+    }
+
+    std::filesystem::remove(FilePath);
+
+    csp::CSPFoundation::Shutdown();
+}
+
+// Files served without byte range support, or too small to split, should be downloaded with a single request.
+CSP_INTERNAL_TEST(CSPEngine, WebClientTests, RangedAssetDownloadFallsBackToSingleRequestTest)
+{
+    using csp::systems::EResultCode;
+    using csp::systems::RangedAssetDownload;
+
+    InitialiseFoundationWithUserAgentInfo(EndpointBaseURI());
+
+    constexpr uint64_t SegmentSize = 256 * 1024;
+
+    RangedFile File;
+    File.Body = MakeRangedFileBody(4 * SegmentSize, 0);
+    File.ETag = MD5Hex(File.Body);
+    File.AcceptRanges = false;
+
+    const std::string FilePath = (std::filesystem::temp_directory_path() / "RangedAssetDownloadSingleTest.ply").string();
+    const std::string StateFilePath = RangedAssetDownload::GetStateFilePath(FilePath);
+
+    {
+        RangedFileServer Server(File);
+        RangedDownloadClient Client;
+
+        // Progress left over from an earlier ranged download doesn't apply to a file downloaded from the start.
+        std::ofstream(StateFilePath) << "stale";
+
+        auto [ResultCode, HttpResultCode, FileSize] = Client.Download(Server.GetUrl(), FilePath, SegmentSize);
+
+        EXPECT_EQ(ResultCode, EResultCode::Success);
+        EXPECT_EQ(FileSize, File.Body.size());
+        EXPECT_EQ(File.RangeRequests, 0);
+        EXPECT_EQ(File.WholeRequests, 1);
+        EXPECT_FALSE(std::filesystem::exists(StateFilePath));
+        EXPECT_TRUE(ReadFileContents(FilePath) == File.Body);
+
+        // A file that fits in one segment isn't worth splitting, even when the server supports ranges.
+        File.AcceptRanges = true;
+        File.Body = MakeRangedFileBody(SegmentSize, 1);
+        File.ETag = MD5Hex(File.Body);
+
+        std::tie(ResultCode, HttpResultCode, FileSize) = Client.Download(Server.GetUrl(), FilePath, SegmentSize);
+
+        EXPECT_EQ(ResultCode, EResultCode::Success);
+        EXPECT_EQ(FileSize, File.Body.size());
+        EXPECT_EQ(File.RangeRequests, 0);
+        EXPECT_EQ(File.WholeRequests, 2);
+        EXPECT_TRUE(ReadFileContents(FilePath) == File.Body);
+    }
+
+    std::filesystem::remove(FilePath);
+
+    csp::CSPFoundation::Shutdown();
+}
+
+// The asset system should download an asset's data to a file in ranges, and report the size of the file.
+CSP_INTERNAL_TEST(CSPEngine, WebClientTests, DownloadAssetDataToFileTest)
+{
+    using csp::systems::EResultCode;
+    using csp::systems::RangedAssetDownload;
+
+    InitialiseFoundationWithUserAgentInfo(EndpointBaseURI());
+
+    auto* AssetSystem = csp::systems::SystemsManager::Get().GetAssetSystem();
+
+    RangedFile File;
+    File.Body = MakeRangedFileBody(RangedAssetDownload::DEFAULT_SEGMENT_SIZE + 1000, 0);
+    File.ETag = MD5Hex(File.Body);
+    File.ContentMD5 = MD5Base64(File.Body);
+
+    const std::string FilePath = (std::filesystem::temp_directory_path() / "DownloadAssetDataToFileTest.ply").string();
+
+    {
+        RangedFileServer Server(File);
+
+        csp::systems::Asset Asset;
+        Asset.Uri = Server.GetUrl();
+
+        std::promise<csp::systems::UInt64Result> Promise;
+        auto Future = Promise.get_future();
+
+        AssetSystem->DownloadAssetDataToFile(Asset, FilePath.c_str(), 4, csp::common::CancellationToken::Dummy(),
+            [&Promise](const csp::systems::UInt64Result& Result)
+            {
+                if (Result.GetResultCode() == EResultCode::InProgress)
+                {
+                    return;
+                }
+
+                Promise.set_value(Result);
+            });
+
+        const csp::systems::UInt64Result Result = Future.get();
+
+        EXPECT_EQ(Result.GetResultCode(), EResultCode::Success);
+        EXPECT_EQ(Result.GetValue(), File.Body.size());
+        EXPECT_EQ(File.RangeRequests, 2);
+        EXPECT_TRUE(ReadFileContents(FilePath) == File.Body);
+    }
+
+    std::filesystem::remove(FilePath);
+
+    csp::CSPFoundation::Shutdown();
+}
+
+#endif
@@ -16,15 +16,34 @@
 
 #include "../PublicAPITests/UserSystemTestHelpers.h"
 #include "CSP/CSPFoundation.h"
+#include "CSP/Common/Systems/Log/LogSystem.h"
 #include "CSP/Systems/SystemsManager.h"
 #include "CSP/Systems/Users/UserSystem.h"
 #include "Multiplayer/SignalR/POCOSignalRClient/POCOSignalRClient.h"
+#include "Multiplayer/SignalR/POCOSignalRClient/ReceiveRingBuffer.h"
 #include "PlatformTestUtils.h"
 #include "Poco/Exception.h"
 #include "TestHelpers.h"
 
 #include "gtest/gtest.h"
 
+#include <string>
+
+#ifndef CSP_WASM
+#include <Poco/Buffer.h>
+#include <Poco/Net/HTTPRequestHandler.h>
+#include <Poco/Net/HTTPRequestHandlerFactory.h>
+#include <Poco/Net/HTTPServer.h>
+#include <Poco/Net/HTTPServerParams.h>
+#include <Poco/Net/HTTPServerRequest.h>
+#include <Poco/Net/HTTPServerResponse.h>
+#include <Poco/Net/ServerSocket.h>
+#include <Poco/Net/WebSocket.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#endif
+
 using namespace csp::multiplayer;
 
 // The WebSocketClientTests will be reviewed as part of OF-1532.
@@ -206,3 +225,176 @@ CSP_INTERNAL_TEST(CSPEngine, WebSocketClientTests, LocalMalformedMultiplayerServ
 
     EXPECT_THROW(CSPWebSocketClientPOCO::ParseMultiplayerServiceUriEndPoint(Endpoints.MultiplayerConnection.GetURI().c_str()), Poco::SyntaxException);
 }
+
+// Every complete length prefixed message at the read end should be found in one pass, leaving partial ones (or partial prefixes) behind.
+CSP_INTERNAL_TEST(CSPEngine, WebSocketClientTests, ReceiveRingBufferFindsCompleteMessagesTest)
+{
+    ReceiveRingBuffer Buffer(64);
+
+    // Handshake first, terminated by 0x1E, with the start of the first message behind it.
+    const std::string Handshake = "{}\x1e";
+    Buffer.Append(Handshake.data(), Handshake.size());
+    Buffer.Append("\x03", 1);
+
+    ASSERT_EQ(Buffer.FindHandshake(), Handshake.size());
+    Buffer.Consume(Handshake.size());
+
+    constexpr size_t MaxMessageSize = 1024;
+
+    size_t MessageCount = 0;
+    EXPECT_EQ(Buffer.FindCompleteMessages(MaxMessageSize, MessageCount), 0);
+
+    // Two complete messages and the first byte of a two byte length prefix (200 bytes).
+    Buffer.Append("abc\x01z\xc8", 6);
+    EXPECT_EQ(Buffer.FindCompleteMessages(MaxMessageSize, MessageCount), 6);
+    EXPECT_EQ(MessageCount, 2);
+    EXPECT_EQ(std::string(Buffer.GetReadPointer(), 6), std::string("\x03" "abc\x01z", 6));
+    Buffer.Consume(6);
+
+    // The rest of the prefix and the message, which needs the buffer to wrap round and then grow.
+    const std::string LargeMessage(200, 'x');
+    Buffer.Append("\x01", 1);
+    EXPECT_EQ(Buffer.FindCompleteMessages(MaxMessageSize, MessageCount), 0);
+    Buffer.Append(LargeMessage.data(), LargeMessage.size());
+
+    EXPECT_EQ(Buffer.FindCompleteMessages(MaxMessageSize, MessageCount), 202);
+    EXPECT_EQ(MessageCount, 1);
+    EXPECT_GE(Buffer.GetCapacity(), 202);
+
+    Buffer.Consume(202);
+    EXPECT_EQ(Buffer.GetReadableSize(), 0);
+
+    // A message longer than the cap is rejected from its prefix alone (2000 bytes), without waiting for the message.
+    Buffer.Append("\xd0\x0f", 2);
+    EXPECT_THROW((void)Buffer.FindCompleteMessages(MaxMessageSize, MessageCount), std::runtime_error);
+    Buffer.Consume(2);
+
+    // A prefix can't run to more than five bytes.
+    Buffer.Append("\xff\xff\xff\xff\xff", 5);
+    EXPECT_THROW((void)Buffer.FindCompleteMessages(MaxMessageSize, MessageCount), std::runtime_error);
+}
+
+#ifndef CSP_WASM
+
+namespace
+{
+
+// Counts the data frames received over a websocket, until the client closes it.
+class FrameCountingRequestHandler : public Poco::Net::HTTPRequestHandler
+{
+public:
+    FrameCountingRequestHandler(std::atomic_int& InFrameCount, std::atomic_size_t& InByteCount)
+        : FrameCount(InFrameCount)
+        , ByteCount(InByteCount)
+    {
+    }
+
+    void handleRequest(Poco::Net::HTTPServerRequest& Request, Poco::Net::HTTPServerResponse& Response) override
+    {
+        try
+        {
+            Poco::Net::WebSocket Socket(Request, Response);
+            Poco::Buffer<char> Buffer(0);
+
+            for (;;)
+            {
+                int Flags = 0;
+                Buffer.resize(0);
+                const int Received = Socket.receiveFrame(Buffer, Flags);
+
+                if ((Received == 0 && Flags == 0) || (Flags & Poco::Net::WebSocket::FRAME_OP_BITMASK) == Poco::Net::WebSocket::FRAME_OP_CLOSE)
+                {
+                    return;
+                }
+
+                ++FrameCount;
+                ByteCount += Received;
+            }
+        }
+        catch (const Poco::Exception&)
+        {
+            // The client going away mid frame is fine.
+        }
+    }
+
+private:
+    std::atomic_int& FrameCount;
+    std::atomic_size_t& ByteCount;
+};
+
+class FrameCountingRequestHandlerFactory : public Poco::Net::HTTPRequestHandlerFactory
+{
+public:
+    FrameCountingRequestHandlerFactory(std::atomic_int& InFrameCount, std::atomic_size_t& InByteCount)
+        : FrameCount(InFrameCount)
+        , ByteCount(InByteCount)
+    {
+    }
+
+    Poco::Net::HTTPRequestHandler* createRequestHandler(const Poco::Net::HTTPServerRequest&) override
+    {
+        return new FrameCountingRequestHandler(FrameCount, ByteCount);
+    }
+
+private:
+    std::atomic_int& FrameCount;
+    std::atomic_size_t& ByteCount;
+};
+
+} // namespace
+
+// Messages sent within the coalescing window should go out as a single frame, with back pressure reported while they are queued.
+CSP_INTERNAL_TEST(CSPEngine, WebSocketClientTests, SendCoalescesQueuedMessagesTest)
+{
+    std::atomic_int FrameCount = 0;
+    std::atomic_size_t ByteCount = 0;
+
+    Poco::Net::ServerSocket Socket(Poco::Net::SocketAddress("127.0.0.1", 0));
+    Poco::Net::HTTPServer Server(new FrameCountingRequestHandlerFactory(FrameCount, ByteCount), Socket, new Poco::Net::HTTPServerParams);
+    Server.start();
+
+    csp::common::LogSystem LogSystem;
+    CSPWebSocketClientPOCO Client("http://127.0.0.1:" + std::to_string(Socket.address().port()) + "/", "Token", "DeviceId", LogSystem);
+
+    bool Started = false;
+    Client.Start("", [&Started](bool Ok) { Started = Ok; });
+    ASSERT_TRUE(Started);
+
+    Client.SetSendCoalescingWindow(std::chrono::milliseconds(50));
+    Client.SetSendQueueByteBudget(16);
+
+    constexpr int MessageCount = 10;
+    std::atomic_int SucceededCount = 0;
+
+    for (int i = 0; i < MessageCount; ++i)
+    {
+        Client.Send(std::string(4, static_cast<char>('a' + i)),
+            [&SucceededCount](bool Ok)
+            {
+                if (Ok)
+                {
+                    ++SucceededCount;
+                }
+            });
+    }
+
+    // Nothing goes out until the window has passed, so all 40 bytes are still queued.
+    EXPECT_TRUE(Client.IsSendBackPressured());
+
+    const auto Deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+    while ((SucceededCount < MessageCount || ByteCount < MessageCount * 4) && std::chrono::steady_clock::now() < Deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    EXPECT_EQ(SucceededCount, MessageCount);
+    EXPECT_EQ(ByteCount, MessageCount * 4);
+    EXPECT_EQ(FrameCount, 1);
+    EXPECT_FALSE(Client.IsSendBackPressured());
+
+    Client.Stop(nullptr);
+    Server.stopAll(true);
+}
+
+#endif
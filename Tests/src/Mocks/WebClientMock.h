@@ -59,6 +59,8 @@ public:
 
     MOCK_METHOD(std::string, MD5Hash, (const void* Data, const size_t Size), (override));
 
+    MOCK_METHOD(std::string, MD5HashFile, (const char* FilePath), (override));
+
     MOCK_METHOD(void, SetFileUploadContentFromFile,
         (csp::web::HttpPayload * Payload, const char* FilePath, const char* Version, const csp::common::String& MediaType), (override));
 
@@ -17,12 +17,20 @@
 #include "CSP/CSPFoundation.h"
 #include "CSP/Common/Systems/Log/LogSystem.h"
 #include "CSP/Systems/SystemsManager.h"
+#include "Common/Systems/Log/AsyncLogSink.h"
+#include "Common/Systems/Log/LogFormat.h"
 #include "Debug/Logging.h"
 #include "TestHelpers.h"
 #include "UserSystemTestHelpers.h"
 
 #include "gtest/gtest.h"
 #include <atomic>
+#include <map>
+#include <mutex>
+#include <rapidjson/document.h>
+#include <string>
+#include <thread>
+#include <vector>
 
 void LogMessageLevelTest(const csp::common::LogLevel Level, const csp::common::String& TestMsg, std::atomic_bool& LogConfirmed, bool Expected)
 {
@@ -584,71 +592,263 @@ CSP_INTERNAL_TEST(CSPEngine, LogSystemTests, LogErrorFormatTest)
     csp::CSPFoundation::Shutdown();
 }
 
+// Checks that events recorded through the profiling macros are exported in the Chrome trace event format.
 CSP_INTERNAL_TEST(CSPEngine, LogSystemTests, ProfileTest)
 {
-    InitialiseFoundationWithUserAgentInfo(EndpointBaseURI());
+#if CSP_PROFILING_ENABLED
+    const char* TestTag = "Profile Marker";
+    const int TestValue = 12345;
 
-    auto& SystemsManager = csp::systems::SystemsManager::Get();
-    auto& LogSystem = *SystemsManager.GetLogSystem();
+    csp::profile::Profiler::Start();
+
+    {
+        CSP_PROFILE_SCOPED_TAG(TestTag);
+
+        CSP_PROFILE_BEGIN(TestTag);
+        CSP_PROFILE_END();
+
+        CSP_PROFILE_BEGIN_FORMAT("Marker %d", TestValue);
+        CSP_PROFILE_END();
+
+        CSP_PROFILE_SCOPED_FORMAT("Scoped Marker %d", TestValue);
+
+        CSP_PROFILE_EVENT_TAG("Event Marker");
+        CSP_PROFILE_EVENT_FORMAT("Event %d", TestValue);
+    }
+
+    csp::profile::Profiler::Stop();
+
+    // Nothing should be recorded once the profiler has stopped.
+    CSP_PROFILE_EVENT_TAG("Ignored Marker");
+
+    const std::string Trace = csp::profile::Profiler::ExportChromeTrace();
+
+    EXPECT_NE(Trace.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(Trace.find("\"name\":\"Profile Marker\""), std::string::npos);
+    EXPECT_NE(Trace.find("\"name\":\"Marker %d\""), std::string::npos);
+    EXPECT_NE(Trace.find("\"detail\":\"Marker 12345\""), std::string::npos);
+    EXPECT_NE(Trace.find("\"detail\":\"Scoped Marker 12345\""), std::string::npos);
+    EXPECT_NE(Trace.find("\"name\":\"Event Marker\""), std::string::npos);
+    EXPECT_NE(Trace.find("\"detail\":\"Event 12345\""), std::string::npos);
+    EXPECT_EQ(Trace.find("Ignored Marker"), std::string::npos);
+
+    EXPECT_NE(Trace.find("\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(Trace.find("\"ph\":\"B\""), std::string::npos);
+    EXPECT_NE(Trace.find("\"ph\":\"E\""), std::string::npos);
+    EXPECT_NE(Trace.find("\"ph\":\"i\""), std::string::npos);
 
-    std::atomic_bool BeginConfirmed = false;
-    std::atomic_bool EndConfirmed = false;
-    std::atomic_bool EventConfirmed = false;
+    csp::profile::Profiler::Clear();
+#endif
+}
 
-    const csp::common::String TestTag = "Profile Marker";
-    const csp::common::String TestEvent = "Event Marker";
+// Checks that events recorded on several threads at once are all exported, and discarded by Clear.
+CSP_INTERNAL_TEST(CSPEngine, LogSystemTests, ProfilerMultipleThreadsTest)
+{
+#if CSP_PROFILING_ENABLED
+    constexpr int NumThreads = 4;
+    constexpr int EventsPerThread = 1000;
 
-    LogSystem.SetBeginMarkerCallback(
-        [&](csp::common::String InMessage)
+    const auto CountOccurrences = [](const std::string& Text, const std::string& Pattern)
+    {
+        int Count = 0;
+
+        for (size_t Pos = Text.find(Pattern); Pos != std::string::npos; Pos = Text.find(Pattern, Pos + Pattern.size()))
         {
-            if (InMessage == TestTag)
+            ++Count;
+        }
+
+        return Count;
+    };
+
+    csp::profile::Profiler::Start();
+
+    // Threads hand their buffers on when they exit, so keep them all alive until every one has recorded its events.
+    std::atomic<int> FinishedThreads = 0;
+    std::vector<std::thread> Threads;
+
+    for (int i = 0; i < NumThreads; ++i)
+    {
+        Threads.emplace_back(
+            [i, &FinishedThreads]()
             {
-                BeginConfirmed = true;
-            }
+                const std::string ThreadName = "Profiler Test Thread " + std::to_string(i);
+                csp::profile::Profiler::SetThreadName(ThreadName.c_str());
 
-            std::cout << InMessage << std::endl;
-        });
+                for (int j = 0; j < EventsPerThread; ++j)
+                {
+                    CSP_PROFILE_SCOPED_NAME("Threaded Marker");
+                }
+
+                ++FinishedThreads;
+
+                while (FinishedThreads < NumThreads)
+                {
+                    std::this_thread::yield();
+                }
+            });
+    }
+
+    for (auto& Thread : Threads)
+    {
+        Thread.join();
+    }
+
+    csp::profile::Profiler::Stop();
+
+    const std::string Trace = csp::profile::Profiler::ExportChromeTrace();
+
+    EXPECT_EQ(CountOccurrences(Trace, "\"name\":\"Threaded Marker\""), NumThreads * EventsPerThread);
+    EXPECT_EQ(CountOccurrences(Trace, "\"name\":\"Profiler Test Thread "), NumThreads);
+    EXPECT_NE(Trace.find("\"droppedEvents\":0"), std::string::npos);
+
+    csp::profile::Profiler::Clear();
+
+    EXPECT_EQ(CountOccurrences(csp::profile::Profiler::ExportChromeTrace(), "\"name\":\"Threaded Marker\""), 0);
+#endif
+}
+
+// Checks that events recorded by threads that have since exited are exported under those threads, rather than the threads their buffers are
+// handed to afterwards.
+CSP_INTERNAL_TEST(CSPEngine, LogSystemTests, ProfilerSequentialThreadsTest)
+{
+#if CSP_PROFILING_ENABLED
+    constexpr int NumThreads = 4;
+    constexpr int EventsPerThread = 10;
+
+    const auto RunThread = [](int Index)
+    {
+        std::thread Thread(
+            [Index]()
+            {
+                const std::string ThreadName = "Sequential Thread " + std::to_string(Index);
+                csp::profile::Profiler::SetThreadName(ThreadName.c_str());
+
+                for (int j = 0; j < EventsPerThread; ++j)
+                {
+                    CSP_PROFILE_SCOPED_FORMAT("Sequential Marker %d", Index);
+                }
+            });
+
+        Thread.join();
+    };
 
-    LogSystem.SetEndMarkerCallback([&](void*) { EndConfirmed = true; });
+    // Maps each exported event's detail to the name of the thread it was exported under.
+    const auto ExportThreadNamesByDetail = []()
+    {
+        rapidjson::Document Trace;
+        Trace.Parse(csp::profile::Profiler::ExportChromeTrace().c_str());
+
+        std::map<unsigned, std::string> ThreadNames;
+        std::multimap<std::string, unsigned> DetailThreads;
 
-    LogSystem.SetEventCallback(
-        [&](csp::common::String InMessage)
+        for (const auto& Event : Trace["traceEvents"].GetArray())
         {
-            if (InMessage == TestEvent)
+            const unsigned ThreadIndex = Event["tid"].GetUint();
+
+            if (std::string(Event["ph"].GetString()) == "M")
+            {
+                ThreadNames[ThreadIndex] = Event["args"]["name"].GetString();
+            }
+            else if (std::string(Event["name"].GetString()) == "Sequential Marker %d")
             {
-                EventConfirmed = true;
+                DetailThreads.emplace(Event["args"]["detail"].GetString(), ThreadIndex);
             }
+        }
 
-            std::cout << InMessage << std::endl;
-        });
+        std::multimap<std::string, std::string> Result;
 
-#if CSP_PROFILING_ENABLED
-    const int TestValue = 12345;
+        for (const auto& [Detail, ThreadIndex] : DetailThreads)
+        {
+            Result.emplace(Detail, ThreadNames[ThreadIndex]);
+        }
+
+        return Result;
+    };
+
+    csp::profile::Profiler::Start();
+
+    // Each thread exits before the next starts, so could be handed the buffer of the one before it.
+    for (int i = 0; i < NumThreads; ++i)
+    {
+        RunThread(i);
+    }
+
+    csp::profile::Profiler::Stop();
+
+    auto ThreadNamesByDetail = ExportThreadNamesByDetail();
+
+    EXPECT_EQ(ThreadNamesByDetail.size(), static_cast<size_t>(NumThreads * EventsPerThread));
 
-    CSP_PROFILE_SCOPED_TAG(TestTag);
+    for (const auto& [Detail, ThreadName] : ThreadNamesByDetail)
+    {
+        EXPECT_EQ(Detail.substr(Detail.find_last_of(' ')), ThreadName.substr(ThreadName.find_last_of(' ')));
+    }
+
+    // Once a capture has been cleared, the buffers of exited threads are reused, and only what the new thread records is exported.
+    csp::profile::Profiler::Start();
 
-    CSP_PROFILE_BEGIN(TestTag);
-    CSP_PROFILE_END();
+    RunThread(NumThreads);
 
-    CSP_PROFILE_BEGIN_FORMAT("Marker %d", TestValue);
-    CSP_PROFILE_END();
+    csp::profile::Profiler::Stop();
 
-    CSP_PROFILE_SCOPED_FORMAT("Marker %d", TestValue);
+    ThreadNamesByDetail = ExportThreadNamesByDetail();
 
-    CSP_PROFILE_EVENT_TAG(TestEvent);
-    CSP_PROFILE_EVENT_FORMAT("Event %d", TestValue)
+    EXPECT_EQ(ThreadNamesByDetail.size(), static_cast<size_t>(EventsPerThread));
 
-    EXPECT_TRUE(BeginConfirmed);
-    EXPECT_TRUE(EndConfirmed);
-    EXPECT_TRUE(EventConfirmed);
-#else
-    EXPECT_FALSE(BeginConfirmed);
-    EXPECT_FALSE(EndConfirmed);
-    EXPECT_FALSE(EventConfirmed);
+    for (const auto& [Detail, ThreadName] : ThreadNamesByDetail)
+    {
+        EXPECT_EQ(Detail, "Sequential Marker " + std::to_string(NumThreads));
+        EXPECT_EQ(ThreadName, "Sequential Thread " + std::to_string(NumThreads));
+    }
+
+    csp::profile::Profiler::Clear();
 #endif
-    LogSystem.ClearAllCallbacks();
+}
 
-    csp::CSPFoundation::Shutdown();
+// Checks that each thread stops recording once it reaches the event limit, and reports what it dropped.
+CSP_INTERNAL_TEST(CSPEngine, LogSystemTests, ProfilerMaxEventsPerThreadTest)
+{
+#if CSP_PROFILING_ENABLED
+    constexpr size_t MaxEvents = 100;
+    constexpr size_t NumEvents = 150;
+
+    const size_t PreviousMaxEvents = csp::profile::Profiler::GetMaxEventsPerThread();
+    csp::profile::Profiler::SetMaxEventsPerThread(MaxEvents);
+
+    csp::profile::Profiler::Start();
+
+    std::thread Thread(
+        []()
+        {
+            for (size_t i = 0; i < NumEvents; ++i)
+            {
+                CSP_PROFILE_EVENT_TAG("Limited Marker");
+            }
+        });
+
+    Thread.join();
+
+    csp::profile::Profiler::Stop();
+
+    rapidjson::Document Trace;
+    Trace.Parse(csp::profile::Profiler::ExportChromeTrace().c_str());
+
+    size_t RecordedEvents = 0;
+
+    for (const auto& Event : Trace["traceEvents"].GetArray())
+    {
+        if (Event.HasMember("name") && std::string(Event["name"].GetString()) == "Limited Marker")
+        {
+            ++RecordedEvents;
+        }
+    }
+
+    EXPECT_EQ(RecordedEvents, MaxEvents);
+    EXPECT_EQ(Trace["otherData"]["droppedEvents"].GetUint64(), NumEvents - MaxEvents);
+
+    csp::profile::Profiler::SetMaxEventsPerThread(PreviousMaxEvents);
+    csp::profile::Profiler::Clear();
+#endif
 }
 
 CSP_INTERNAL_TEST(CSPEngine, LogSystemTests, FailureMessageTest)
@@ -683,4 +883,107 @@ CSP_INTERNAL_TEST(CSPEngine, LogSystemTests, FailureMessageTest)
     EXPECT_TRUE(LogConfirmed);
 
     csp::CSPFoundation::Shutdown();
-}
\ No newline at end of file
+}
+
+// CSP_LOG_FMT shouldn't evaluate its arguments at all unless the level is enabled, and should accept a null log system.
+CSP_INTERNAL_TEST(CSPEngine, LogSystemTests, LogFmtSkipsDisabledLevelsTest)
+{
+    csp::common::LogSystem LogSystem;
+    LogSystem.SetSystemLevel(csp::common::LogLevel::Log);
+
+    std::vector<std::string> Messages;
+    LogSystem.SetLogCallback([&Messages](csp::common::LogLevel, const csp::common::String& InMessage) { Messages.push_back(InMessage.c_str()); });
+
+    int EvaluatedCount = 0;
+    const auto Evaluate = [&EvaluatedCount]()
+    {
+        ++EvaluatedCount;
+        return EvaluatedCount;
+    };
+
+    csp::common::LogSystem* NullLogSystem = nullptr;
+    CSP_LOG_FMT(NullLogSystem, csp::common::LogLevel::Error, "{}", Evaluate());
+    CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Verbose, "{}", Evaluate());
+    CSP_LOG_FMT(&LogSystem, csp::common::LogLevel::VeryVerbose, "{}", Evaluate());
+
+    EXPECT_EQ(EvaluatedCount, 0);
+    EXPECT_TRUE(Messages.empty());
+
+    const csp::common::String Name = "Entity";
+    CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Log, "{} {} {}", Name, "moved", Evaluate());
+
+    EXPECT_EQ(EvaluatedCount, 1);
+    ASSERT_EQ(Messages.size(), 1);
+    EXPECT_EQ(Messages[0], "Entity moved 1");
+}
+
+// With asynchronous logging enabled, messages from several threads should all be delivered, in order per thread, once flushed.
+// Arguments referencing the caller's temporaries must have been copied, as they're formatted after the caller has moved on.
+CSP_INTERNAL_TEST(CSPEngine, LogSystemTests, AsyncLogSinkDeliversAllMessagesTest)
+{
+    constexpr int ThreadCount = 4;
+    constexpr int MessagesPerThread = 1000;
+    static_assert(ThreadCount * MessagesPerThread < csp::common::AsyncLogSink::DEFAULT_CAPACITY);
+
+    std::mutex MessagesMutex;
+    std::vector<std::string> Messages;
+
+    csp::common::LogSystem LogSystem;
+    LogSystem.SetLogCallback(
+        [&MessagesMutex, &Messages](csp::common::LogLevel, const csp::common::String& InMessage)
+        {
+            std::scoped_lock<std::mutex> Lock(MessagesMutex);
+            Messages.push_back(InMessage.c_str());
+        });
+
+    LogSystem.SetAsyncLoggingEnabled(true);
+    ASSERT_NE(LogSystem.GetAsyncLogSink(), nullptr);
+
+    std::vector<std::thread> Threads;
+
+    for (int i = 0; i < ThreadCount; ++i)
+    {
+        Threads.emplace_back(
+            [&LogSystem, i]()
+            {
+                for (int j = 0; j < MessagesPerThread; ++j)
+                {
+                    const std::string ThreadName = std::to_string(i);
+                    CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Log, "{} {}", ThreadName.c_str(), j);
+                }
+            });
+    }
+
+    for (auto& Thread : Threads)
+    {
+        Thread.join();
+    }
+
+    // Disabling waits for everything already queued to be logged.
+    LogSystem.SetAsyncLoggingEnabled(false);
+    EXPECT_EQ(LogSystem.GetAsyncLogSink(), nullptr);
+
+    ASSERT_EQ(Messages.size(), ThreadCount * MessagesPerThread);
+
+    // Fewer messages were logged than the sink can queue, so none of them should have fallen back to being logged out of order.
+    std::vector<int> LastSeen(ThreadCount, -1);
+
+    for (const auto& Message : Messages)
+    {
+        const size_t Space = Message.find(' ');
+        const int Thread = std::stoi(Message.substr(0, Space));
+        const int Index = std::stoi(Message.substr(Space + 1));
+
+        EXPECT_EQ(Index, LastSeen[Thread] + 1);
+        LastSeen[Thread] = Index;
+    }
+
+    for (int i = 0; i < ThreadCount; ++i)
+    {
+        EXPECT_EQ(LastSeen[i], MessagesPerThread - 1);
+    }
+
+    // Once disabled, messages are logged on the calling thread again.
+    CSP_LOG_FMT(LogSystem, csp::common::LogLevel::Log, "{}", "Sync");
+    EXPECT_EQ(Messages.back(), "Sync");
+}
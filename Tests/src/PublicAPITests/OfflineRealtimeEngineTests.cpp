@@ -14,9 +14,11 @@
  * limitations under the License.
  */
 
+#include "CSP/CSPFoundation.h"
 #include "CSP/Common/Systems/Log/LogSystem.h"
 #include "CSP/Multiplayer/CSPSceneDescription.h"
 #include "CSP/Multiplayer/ComponentSchema.h"
+#include "CSP/Multiplayer/Components/ScriptSpaceComponent.h"
 #include "CSP/Multiplayer/OfflineRealtimeEngine.h"
 #include "CSP/Multiplayer/SpaceEntity.h"
 #include "CSP/Multiplayer/SpaceTransform.h"
@@ -31,8 +33,10 @@
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
+#include <vector>
 
 using namespace csp;
 using namespace csp::multiplayer;
@@ -213,6 +217,101 @@ CSP_PUBLIC_TEST(CSPEngine, OfflineRealtimeEngineTests, DestroyEntity)
     EXPECT_EQ(Engine.GetNumEntities(), 0);
 }
 
+/*
+    This tests that OfflineRealtimeEngine::DestroyEntity fails gracefully when given a null entity,
+    leaving the existing entities untouched.
+*/
+CSP_PUBLIC_TEST(CSPEngine, OfflineRealtimeEngineTests, DestroyNullEntity)
+{
+    auto& SystemsManager = csp::systems::SystemsManager::Get();
+
+    CSPSceneDescription SceneDescription;
+    OfflineRealtimeEngine Engine { SceneDescription, *SystemsManager.GetLogSystem(), *SystemsManager.GetScriptSystem() };
+
+    Engine.CreateEntity("", SpaceTransform {}, nullptr, [](SpaceEntity*) {});
+
+    bool DestroyCalled = false;
+
+    Engine.DestroyEntity(nullptr,
+        [&DestroyCalled](bool Destroyed)
+        {
+            EXPECT_FALSE(Destroyed);
+            DestroyCalled = true;
+        });
+
+    EXPECT_TRUE(DestroyCalled);
+    EXPECT_EQ(Engine.GetNumEntities(), 1);
+}
+
+/*
+    This tests that destroying entities from the middle of the engine's lists leaves the remaining entities in the order they were created,
+    both in the entity, object and avatar lists and in the root hierarchy, and that name lookups keep returning the earliest match.
+*/
+CSP_PUBLIC_TEST(CSPEngine, OfflineRealtimeEngineTests, DestroyEntityPreservesListOrder)
+{
+    auto& SystemsManager = csp::systems::SystemsManager::Get();
+
+    CSPSceneDescription SceneDescription;
+    OfflineRealtimeEngine Engine { SceneDescription, *SystemsManager.GetLogSystem(), *SystemsManager.GetScriptSystem() };
+
+    std::vector<SpaceEntity*> Created;
+
+    for (int i = 0; i < 5; ++i)
+    {
+        Engine.CreateEntity("Duplicate", SpaceTransform {}, nullptr, [&Created](SpaceEntity* NewEntity) { Created.push_back(NewEntity); });
+    }
+
+    SpaceEntity* Avatar = nullptr;
+    Engine.CreateAvatar("", nullptr, SpaceTransform {}, false, AvatarState::Idle, "", AvatarPlayMode::Default, LocomotionModel::Grounded,
+        [&Avatar](SpaceEntity* NewEntity) { Avatar = NewEntity; });
+
+    ASSERT_EQ(Created.size(), 5);
+    ASSERT_NE(Avatar, nullptr);
+
+    Engine.DestroyEntity(Created[0], [](bool Destroyed) { EXPECT_TRUE(Destroyed); });
+    Engine.DestroyEntity(Created[2], [](bool Destroyed) { EXPECT_TRUE(Destroyed); });
+
+    const std::vector<SpaceEntity*> ExpectedObjects { Created[1], Created[3], Created[4] };
+    std::vector<SpaceEntity*> ExpectedEntities = ExpectedObjects;
+    ExpectedEntities.push_back(Avatar);
+
+    ASSERT_EQ(Engine.GetNumEntities(), ExpectedEntities.size());
+    ASSERT_EQ(Engine.GetNumObjects(), ExpectedObjects.size());
+    ASSERT_EQ(Engine.GetNumAvatars(), 1);
+
+    for (size_t i = 0; i < ExpectedEntities.size(); ++i)
+    {
+        EXPECT_EQ(Engine.GetEntityByIndex(i), ExpectedEntities[i]);
+    }
+
+    for (size_t i = 0; i < ExpectedObjects.size(); ++i)
+    {
+        EXPECT_EQ(Engine.GetObjectByIndex(i), ExpectedObjects[i]);
+    }
+
+    EXPECT_EQ(Engine.GetAvatarByIndex(0), Avatar);
+
+    // Avatars aren't part of the hierarchy, so the roots are the objects.
+    const csp::common::List<SpaceEntity*>& Roots = *Engine.GetRootHierarchyEntities();
+    ASSERT_EQ(Roots.Size(), ExpectedObjects.size());
+
+    for (size_t i = 0; i < ExpectedObjects.size(); ++i)
+    {
+        EXPECT_EQ(Roots[i], ExpectedObjects[i]);
+    }
+
+    EXPECT_EQ(Engine.FindSpaceEntity("Duplicate"), Created[1]);
+
+    // Renaming an entity away and back doesn't move it behind entities created after it.
+    Created[1]->SetName("Renamed");
+    EXPECT_EQ(Engine.FindSpaceEntity("Duplicate"), Created[3]);
+
+    Created[1]->SetName("Duplicate");
+    EXPECT_EQ(Engine.FindSpaceEntity("Duplicate"), Created[1]);
+
+    EXPECT_EQ(Engine.FindSpaceEntityById(Created[4]->GetId()), Created[4]);
+}
+
 /*
     This tests the behaviour of OfflineRealtimeEngine::DestroyEntity for Avatars.
     This is similar to DestroyEntity test, except it also verifies the avatar is removed
@@ -502,6 +601,52 @@ CSP_PUBLIC_TEST(CSPEngine, OfflineRealtimeEngineTests, FindSpaceObject)
     EXPECT_EQ(FoundEntity3->GetName(), Entity3->GetName());
 }
 
+/*
+    Tests that the Find* lookups stay current when entities are renamed or destroyed:
+       * A renamed entity is found by its new name, and no longer by its old name
+       * When several entities share a name, the first created is returned
+       * A destroyed entity can no longer be found by id or by name
+*/
+CSP_PUBLIC_TEST(CSPEngine, OfflineRealtimeEngineTests, FindSpaceEntityAfterRenameAndDestroy)
+{
+    auto& SystemsManager = csp::systems::SystemsManager::Get();
+
+    CSPSceneDescription SceneDescription;
+    OfflineRealtimeEngine Engine { SceneDescription, *SystemsManager.GetLogSystem(), *SystemsManager.GetScriptSystem() };
+
+    const csp::common::String SharedName = "SharedName";
+    const csp::common::String RenamedName = "RenamedName";
+
+    SpaceEntity* Entity1 = nullptr;
+    SpaceEntity* Entity2 = nullptr;
+
+    Engine.CreateEntity(SharedName, SpaceTransform {}, nullptr, [&Entity1](SpaceEntity* NewEntity) { Entity1 = NewEntity; });
+    Engine.CreateEntity(SharedName, SpaceTransform {}, nullptr, [&Entity2](SpaceEntity* NewEntity) { Entity2 = NewEntity; });
+
+    ASSERT_NE(Entity1, nullptr);
+    ASSERT_NE(Entity2, nullptr);
+
+    // Both share a name, the first created should win.
+    EXPECT_EQ(Engine.FindSpaceEntity(SharedName), Entity1);
+
+    // Renaming the first entity should make the second the only match for the shared name.
+    EXPECT_TRUE(Entity1->SetName(RenamedName));
+
+    EXPECT_EQ(Engine.FindSpaceEntity(RenamedName), Entity1);
+    EXPECT_EQ(Engine.FindSpaceObject(RenamedName), Entity1);
+    EXPECT_EQ(Engine.FindSpaceEntity(SharedName), Entity2);
+
+    const uint64_t Entity2Id = Entity2->GetId();
+
+    bool Destroyed = false;
+    Engine.DestroyEntity(Entity2, [&Destroyed](bool Success) { Destroyed = Success; });
+
+    EXPECT_TRUE(Destroyed);
+    EXPECT_EQ(Engine.FindSpaceEntity(SharedName), nullptr);
+    EXPECT_EQ(Engine.FindSpaceEntityById(Entity2Id), nullptr);
+    EXPECT_EQ(Engine.FindSpaceEntityById(Entity1->GetId()), Entity1);
+}
+
 /*
     This tests the behaviour GetEntityByIndex
     by creating 2 different entities and 1 avatar and checking they can all be retrieved.
@@ -759,6 +904,217 @@ CSP_PUBLIC_TEST(CSPEngine, OfflineRealtimeEngineTests, ParentTest)
     EXPECT_EQ(Engine.GetRootHierarchyEntities()->Size(), 2);
 }
 
+/*
+    Tests that destroying an entity keeps the root hierarchy consistent:
+       * The destroyed entity is no longer a root
+       * Its children are moved to the root
+       * Other roots are unaffected
+*/
+CSP_PUBLIC_TEST(CSPEngine, OfflineRealtimeEngineTests, RootHierarchyAfterDestroy)
+{
+    auto& SystemsManager = csp::systems::SystemsManager::Get();
+
+    CSPSceneDescription SceneDescription;
+    OfflineRealtimeEngine Engine { SceneDescription, *SystemsManager.GetLogSystem(), *SystemsManager.GetScriptSystem() };
+
+    SpaceEntity* Parent = nullptr;
+    SpaceEntity* OtherRoot = nullptr;
+    SpaceEntity* Child1 = nullptr;
+    SpaceEntity* Child2 = nullptr;
+
+    Engine.CreateEntity("Parent", SpaceTransform {}, nullptr, [&Parent](SpaceEntity* NewEntity) { Parent = NewEntity; });
+    Engine.CreateEntity("OtherRoot", SpaceTransform {}, nullptr, [&OtherRoot](SpaceEntity* NewEntity) { OtherRoot = NewEntity; });
+
+    ASSERT_NE(Parent, nullptr);
+    ASSERT_NE(OtherRoot, nullptr);
+
+    Engine.CreateEntity("Child1", SpaceTransform {}, Parent->GetId(), [&Child1](SpaceEntity* NewEntity) { Child1 = NewEntity; });
+    Engine.CreateEntity("Child2", SpaceTransform {}, Parent->GetId(), [&Child2](SpaceEntity* NewEntity) { Child2 = NewEntity; });
+
+    ASSERT_NE(Child1, nullptr);
+    ASSERT_NE(Child2, nullptr);
+
+    EXPECT_EQ(Engine.GetRootHierarchyEntities()->Size(), 2);
+
+    Engine.DestroyEntity(Parent, [](bool) {});
+
+    const auto* Roots = Engine.GetRootHierarchyEntities();
+
+    // Root order isn't guaranteed, so just check membership.
+    EXPECT_EQ(Roots->Size(), 3);
+    EXPECT_TRUE(Roots->Contains(OtherRoot));
+    EXPECT_TRUE(Roots->Contains(Child1));
+    EXPECT_TRUE(Roots->Contains(Child2));
+
+    EXPECT_EQ(Child1->GetParent(), nullptr);
+    EXPECT_EQ(Child2->GetParent(), nullptr);
+}
+
+/*
+    This tests that ticking scripts only calls the tick handlers scripts have subscribed,
+    that the delta time is passed to them as a number,
+    and that an entity stops being ticked once its script no longer subscribes to the tick.
+*/
+CSP_PUBLIC_TEST(CSPEngine, OfflineRealtimeEngineTests, TickOnlySubscribedEntities)
+{
+    auto& SystemsManager = csp::systems::SystemsManager::Get();
+
+    CSPSceneDescription SceneDescription;
+    OfflineRealtimeEngine Engine { SceneDescription, *SystemsManager.GetLogSystem(), *SystemsManager.GetScriptSystem() };
+
+    // Moves the entity to x = 1 when called with a numeric delta time.
+    const std::string TickScriptText = R"xx(
+		var entities = TheEntitySystem.getEntities();
+		var entityIndex = TheEntitySystem.getIndexOfEntity(ThisEntity.id);
+
+		globalThis.onTick = (_evtName, params, deltaTimeMS) => {
+			if (typeof deltaTimeMS === 'number' && deltaTimeMS === JSON.parse(params).deltaTimeMS) {
+				entities[entityIndex].position = [1, 0, 0];
+			}
+		}
+
+		ThisEntity.subscribeToMessage("entityTick", "onTick");
+	)xx";
+
+    // Has a handler, but never subscribes it.
+    const std::string UnsubscribedScriptText = R"xx(
+		var entities = TheEntitySystem.getEntities();
+		var entityIndex = TheEntitySystem.getIndexOfEntity(ThisEntity.id);
+
+		globalThis.onTick = () => {
+			entities[entityIndex].position = [1, 0, 0];
+		}
+	)xx";
+
+    SpaceEntity* Ticked = nullptr;
+    SpaceEntity* NotTicked = nullptr;
+
+    Engine.CreateEntity("Ticked", SpaceTransform {}, nullptr, [&Ticked](SpaceEntity* NewEntity) { Ticked = NewEntity; });
+    Engine.CreateEntity("NotTicked", SpaceTransform {}, nullptr, [&NotTicked](SpaceEntity* NewEntity) { NotTicked = NewEntity; });
+
+    ASSERT_NE(Ticked, nullptr);
+    ASSERT_NE(NotTicked, nullptr);
+
+    auto* TickedScript = static_cast<ScriptSpaceComponent*>(Ticked->AddComponent(ComponentType::ScriptData));
+    auto* NotTickedScript = static_cast<ScriptSpaceComponent*>(NotTicked->AddComponent(ComponentType::ScriptData));
+
+    TickedScript->SetScriptSource(TickScriptText.c_str());
+    Ticked->GetScript().Invoke();
+
+    NotTickedScript->SetScriptSource(UnsubscribedScriptText.c_str());
+    NotTicked->GetScript().Invoke();
+
+    csp::CSPFoundation::Tick();
+
+    EXPECT_FALSE(Ticked->GetScript().HasError());
+    EXPECT_EQ(Ticked->GetPosition(), csp::common::Vector3(1, 0, 0));
+    EXPECT_EQ(NotTicked->GetPosition(), csp::common::Vector3::Zero());
+
+    // Replacing the script drops the subscription, so the entity should no longer be ticked.
+    Ticked->SetPosition(csp::common::Vector3::Zero());
+    TickedScript->SetScriptSource(UnsubscribedScriptText.c_str());
+    Ticked->GetScript().Invoke();
+
+    csp::CSPFoundation::Tick();
+
+    EXPECT_EQ(Ticked->GetPosition(), csp::common::Vector3::Zero());
+}
+
+/*
+    This tests that subscribing to the entity tick again with a different callback
+    has the engine call the new callback from then on, rather than the one first subscribed.
+*/
+CSP_PUBLIC_TEST(CSPEngine, OfflineRealtimeEngineTests, TickResubscribedCallback)
+{
+    auto& SystemsManager = csp::systems::SystemsManager::Get();
+
+    CSPSceneDescription SceneDescription;
+    OfflineRealtimeEngine Engine { SceneDescription, *SystemsManager.GetLogSystem(), *SystemsManager.GetScriptSystem() };
+
+    const std::string ScriptText = R"xx(
+		var entities = TheEntitySystem.getEntities();
+		var entityIndex = TheEntitySystem.getIndexOfEntity(ThisEntity.id);
+
+		globalThis.onTick = () => {
+			entities[entityIndex].position = [1, 0, 0];
+		}
+
+		globalThis.onOtherTick = () => {
+			entities[entityIndex].position = [2, 0, 0];
+		}
+
+		ThisEntity.subscribeToMessage("entityTick", "onTick");
+	)xx";
+
+    SpaceEntity* Entity = nullptr;
+
+    Engine.CreateEntity("Ticked", SpaceTransform {}, nullptr, [&Entity](SpaceEntity* NewEntity) { Entity = NewEntity; });
+
+    ASSERT_NE(Entity, nullptr);
+
+    auto* ScriptComponent = static_cast<ScriptSpaceComponent*>(Entity->AddComponent(ComponentType::ScriptData));
+    ScriptComponent->SetScriptSource(ScriptText.c_str());
+    Entity->GetScript().Invoke();
+
+    csp::CSPFoundation::Tick();
+
+    EXPECT_FALSE(Entity->GetScript().HasError());
+    EXPECT_EQ(Entity->GetPosition(), csp::common::Vector3(1, 0, 0));
+
+    Entity->GetScript().SubscribeToMessage("entityTick", "onOtherTick");
+
+    csp::CSPFoundation::Tick();
+
+    EXPECT_EQ(Entity->GetPosition(), csp::common::Vector3(2, 0, 0));
+}
+
+/*
+    This tests that a tick callback subscribed by a dotted path is called as a method of the object it is read from,
+    and that reassigning the object it is read from is picked up without subscribing again.
+*/
+CSP_PUBLIC_TEST(CSPEngine, OfflineRealtimeEngineTests, TickDottedPathCallback)
+{
+    auto& SystemsManager = csp::systems::SystemsManager::Get();
+
+    CSPSceneDescription SceneDescription;
+    OfflineRealtimeEngine Engine { SceneDescription, *SystemsManager.GetLogSystem(), *SystemsManager.GetScriptSystem() };
+
+    const std::string ScriptText = R"xx(
+		var entities = TheEntitySystem.getEntities();
+		var entityIndex = TheEntitySystem.getIndexOfEntity(ThisEntity.id);
+
+		globalThis.Handlers = {
+			x: 1,
+			onTick() {
+				entities[entityIndex].position = [this.x, 0, 0];
+			}
+		};
+
+		ThisEntity.subscribeToMessage("entityTick", "Handlers.onTick");
+	)xx";
+
+    SpaceEntity* Entity = nullptr;
+
+    Engine.CreateEntity("Ticked", SpaceTransform {}, nullptr, [&Entity](SpaceEntity* NewEntity) { Entity = NewEntity; });
+
+    ASSERT_NE(Entity, nullptr);
+
+    auto* ScriptComponent = static_cast<ScriptSpaceComponent*>(Entity->AddComponent(ComponentType::ScriptData));
+    ScriptComponent->SetScriptSource(ScriptText.c_str());
+    Entity->GetScript().Invoke();
+
+    csp::CSPFoundation::Tick();
+
+    EXPECT_FALSE(Entity->GetScript().HasError());
+    EXPECT_EQ(Entity->GetPosition(), csp::common::Vector3(1, 0, 0));
+
+    Entity->GetScript().RunScript("globalThis.Handlers = { x: 2, onTick: globalThis.Handlers.onTick };");
+
+    csp::CSPFoundation::Tick();
+
+    EXPECT_EQ(Entity->GetPosition(), csp::common::Vector3(2, 0, 0));
+}
+
 /*
     This tests the behaviour of OfflineRealtimeEngine::MarkEntityForUpdate
     by verifying an entity update is queued when ProcessPendingEntityOperations is called
@@ -31,6 +31,7 @@
 #include "signalrclient/signalr_value.h"
 #include "gtest/gtest.h"
 #include <memory>
+#include <vector>
 
 using namespace csp::multiplayer;
 
@@ -488,7 +489,8 @@ CSP_PUBLIC_TEST_WITH_MOCKS(CSPEngine, OnlineRealtimeEngineTests, DestroyEntitySe
                     // Create a space entity patch
                     MockScriptRunner Runner;
                     SpaceEntity Entity { RealtimeEngine.get(), Runner, csp::systems::SystemsManager::Get().GetLogSystem() };
-                    csp::multiplayer::mcs::ObjectPatch Patch = Entity.GetStatePatcher()->CreateObjectPatch();
+                    csp::multiplayer::mcs::ComponentDataArena Arena;
+                    csp::multiplayer::mcs::CompactObjectPatch Patch = Entity.GetStatePatcher()->CreateObjectPatch(Arena);
                     csp::multiplayer::SignalRSerializer Serializer;
                     Serializer.WriteValue(Patch);
 
@@ -522,6 +524,68 @@ CSP_PUBLIC_TEST_WITH_MOCKS(CSPEngine, OnlineRealtimeEngineTests, DestroyEntitySe
     EXPECT_TRUE(SendObjectPatchesCalled);
 }
 
+// This ensures pending updates that don't fit in one SendObjectPatches invocation are split across several, with every patch sent exactly once.
+// Each batch's patches are backed by an arena that is reused between batches, so this is also worth running under a sanitizer.
+CSP_PUBLIC_TEST_WITH_MOCKS(CSPEngine, OnlineRealtimeEngineTests, SendPatchesInMultipleBatchesTest)
+{
+    auto& SystemsManager = csp::systems::SystemsManager::Get();
+
+    std::unique_ptr<csp::multiplayer::OnlineRealtimeEngine> RealtimeEngine { SystemsManager.MakeOnlineRealtimeEngine() };
+
+    uint64_t NextObjectId = 1;
+    std::vector<size_t> BatchSizes;
+
+    EXPECT_CALL(*SignalRMock, Invoke)
+        .WillRepeatedly(
+            [&NextObjectId, &BatchSizes](
+                const std::string& Method, const signalr::value& Args, std::function<void(const signalr::value&, std::exception_ptr)> Callback)
+            {
+                csp::multiplayer::MultiplayerHubMethodMap HubMethods;
+
+                signalr::value Result {};
+
+                if (Method == HubMethods.Get(csp::multiplayer::MultiplayerHubMethod::GENERATE_OBJECT_IDS))
+                {
+                    std::vector<signalr::value> ParamsV { signalr::value { NextObjectId++ } };
+                    Result = signalr::value { ParamsV };
+                }
+                else if (Method == HubMethods.Get(csp::multiplayer::MultiplayerHubMethod::SEND_OBJECT_PATCHES))
+                {
+                    // Patches are sent as a single argument, holding the array of patches.
+                    BatchSizes.push_back(Args.as_array()[0].as_array().size());
+                }
+
+                Callback(Result, nullptr);
+
+                return async::make_task(std::make_tuple(Result, std::exception_ptr { nullptr }));
+            });
+
+    constexpr size_t EntityCount = 5;
+    constexpr uint32_t MaxPatchesPerBatch = 2;
+
+    RealtimeEngine->SetEntityPatchRateLimitEnabled(false);
+    RealtimeEngine->SetMaxEntityPatchesPerBatch(MaxPatchesPerBatch);
+
+    for (size_t i = 0; i < EntityCount; ++i)
+    {
+        SpaceEntity* Entity = nullptr;
+        RealtimeEngine->CreateEntity("Mock Entity", SpaceTransform {}, nullptr, [&Entity](SpaceEntity* CreatedEntity) { Entity = CreatedEntity; });
+        ASSERT_NE(Entity, nullptr);
+
+        Entity->SetPosition(csp::common::Vector3 { static_cast<float>(i + 1), 0.0f, 0.0f });
+        Entity->QueueUpdate();
+    }
+
+    RealtimeEngine->ProcessPendingEntityOperations();
+
+    EXPECT_EQ(BatchSizes, (std::vector<size_t> { 2, 2, 1 }));
+
+    for (size_t i = 0; i < EntityCount; ++i)
+    {
+        EXPECT_EQ(RealtimeEngine->GetEntityByIndex(i)->GetPosition().X, static_cast<float>(i + 1));
+    }
+}
+
 // This ensures the callback fires only once, with nullptr if the internal GenerateObjectIds fails.
 CSP_PUBLIC_TEST_WITH_MOCKS(CSPEngine, OnlineRealtimeEngineTests, CreateAvatarGenerateObjectIdsFailureTest)
 {
@@ -58,9 +58,11 @@ set(CSP_COMMON_SOURCES
     ${CSP_COMMON_SOURCE_DIR}/Scheduler.cpp
     ${CSP_COMMON_SOURCE_DIR}/Settings.cpp
     ${CSP_COMMON_SOURCE_DIR}/String.cpp
+    ${CSP_COMMON_SOURCE_DIR}/TaskExecutor.cpp
     ${CSP_COMMON_SOURCE_DIR}/Variant.cpp
     ${CSP_COMMON_SOURCE_DIR}/Vector.cpp
 
+    ${CSP_COMMON_SOURCE_DIR}/Systems/Log/AsyncLogSink.cpp
     ${CSP_COMMON_SOURCE_DIR}/Systems/Log/LogSystem.cpp
 
     ${CSP_COMMON_SOURCE_DIR}/Web/HttpAuth.cpp
@@ -69,11 +71,14 @@ set(CSP_COMMON_SOURCES
     ${CSP_COMMON_SOURCE_DIR}/Web/HttpRequest.cpp
     ${CSP_COMMON_SOURCE_DIR}/Web/HttpResponse.cpp
     ${CSP_COMMON_SOURCE_DIR}/Web/Json.cpp
+    ${CSP_COMMON_SOURCE_DIR}/Web/RequestDispatcher.cpp
     ${CSP_COMMON_SOURCE_DIR}/Web/Uri.cpp
     ${CSP_COMMON_SOURCE_DIR}/Web/WebClient.cpp
 
     ${CSP_COMMON_SOURCE_DIR}/Web/EmscriptenWebClient/EmscriptenWebClient.cpp
 
+    ${CSP_COMMON_SOURCE_DIR}/Web/POCOWebClient/HTTPSessionPool.cpp
+    ${CSP_COMMON_SOURCE_DIR}/Web/POCOWebClient/MultipartFileContentSource.cpp
     ${CSP_COMMON_SOURCE_DIR}/Web/POCOWebClient/POCOWebClient.cpp
 
     # Files that exist at the root of the Library folder.
@@ -82,6 +87,8 @@ set(CSP_COMMON_SOURCES
     ${CSP_SOURCE_DIR}/CSPFoundation.cpp
     ${CSP_SOURCE_DIR}/ExplicitTypes.cpp
 
+    ${CSP_SOURCE_DIR}/Debug/Profiler.cpp
+
     ${CSP_SOURCE_DIR}/EmscriptenBindings/CallbackQueue.cpp
 
     ${CSP_SOURCE_DIR}/Events/Event.cpp
@@ -116,10 +123,13 @@ set(CSP_COMMON_PRIVATE_INCLUDES
     ${CSP_COMMON_SOURCE_DIR}/NumberFormatter.h
     ${CSP_COMMON_SOURCE_DIR}/Queue.h
     ${CSP_COMMON_SOURCE_DIR}/Scheduler.h
-    ${CSP_COMMON_SOURCE_DIR}/ThreadPool.h
+    ${CSP_COMMON_SOURCE_DIR}/TaskExecutor.h
     ${CSP_COMMON_SOURCE_DIR}/UUIDGenerator.h
     ${CSP_COMMON_SOURCE_DIR}/Wrappers.h
 
+    ${CSP_COMMON_SOURCE_DIR}/Systems/Log/AsyncLogSink.h
+    ${CSP_COMMON_SOURCE_DIR}/Systems/Log/LogFormat.h
+
     ${CSP_COMMON_SOURCE_DIR}/Web/HttpAuth.h
     ${CSP_COMMON_SOURCE_DIR}/Web/HttpPayload.h
     ${CSP_COMMON_SOURCE_DIR}/Web/HttpProgress.h
@@ -127,11 +137,14 @@ set(CSP_COMMON_PRIVATE_INCLUDES
     ${CSP_COMMON_SOURCE_DIR}/Web/HttpResponse.h
     ${CSP_COMMON_SOURCE_DIR}/Web/Json.h
     ${CSP_COMMON_SOURCE_DIR}/Web/Json_HttpPayload.h
+    ${CSP_COMMON_SOURCE_DIR}/Web/RequestDispatcher.h
     ${CSP_COMMON_SOURCE_DIR}/Web/Uri.h
     ${CSP_COMMON_SOURCE_DIR}/Web/WebClient.h
 
     ${CSP_COMMON_SOURCE_DIR}/Web/EmscriptenWebClient/EmscriptenWebClient.h
 
+    ${CSP_COMMON_SOURCE_DIR}/Web/POCOWebClient/HTTPSessionPool.h
+    ${CSP_COMMON_SOURCE_DIR}/Web/POCOWebClient/MultipartFileContentSource.h
     ${CSP_COMMON_SOURCE_DIR}/Web/POCOWebClient/POCOWebClient.h
 
 
@@ -141,6 +154,7 @@ set(CSP_COMMON_PRIVATE_INCLUDES
     ${CSP_SOURCE_DIR}/WrapperGenUtils.h
 
     ${CSP_SOURCE_DIR}/Debug/Logging.h
+    ${CSP_SOURCE_DIR}/Debug/Profiler.h
 
     ${CSP_SOURCE_DIR}/EmscriptenBindings/CallbackQueue.h
 
@@ -150,6 +164,7 @@ set(CSP_COMMON_PRIVATE_INCLUDES
     ${CSP_SOURCE_DIR}/Events/EventListener.h
     ${CSP_SOURCE_DIR}/Events/EventSystem.h
 
+    ${CSP_SOURCE_DIR}/Json/JsonChunkedStream.h
     ${CSP_SOURCE_DIR}/Json/JsonParseHelper.h
     ${CSP_SOURCE_DIR}/Json/JsonSerializer.h
 
@@ -98,6 +98,7 @@ set(CSP_CORE_SOURCES
     ${CSP_CORE_SOURCE_DIR}/Assets/LOD.cpp
     ${CSP_CORE_SOURCE_DIR}/Assets/LODHelpers.cpp
     ${CSP_CORE_SOURCE_DIR}/Assets/Material.cpp
+    ${CSP_CORE_SOURCE_DIR}/Assets/RangedAssetDownload.cpp
     ${CSP_CORE_SOURCE_DIR}/Assets/TextureInfo.cpp
 
     ${CSP_CORE_SOURCE_DIR}/Conversation/ConversationSystemHelpers.cpp
@@ -167,6 +168,7 @@ set(CSP_CORE_PRIVATE_INCLUDES
     ${CSP_CORE_SOURCE_DIR}/ResultHelpers.h
 
     ${CSP_CORE_SOURCE_DIR}/Assets/LODHelpers.h
+    ${CSP_CORE_SOURCE_DIR}/Assets/RangedAssetDownload.h
 
     ${CSP_CORE_SOURCE_DIR}/Conversation/ConversationSystemHelpers.h
     ${CSP_CORE_SOURCE_DIR}/Conversation/ConversationSystemInternal.h
@@ -69,9 +69,11 @@ set(CSP_MULTIPLAYER_PUBLIC_INCLUDES
 set(CSP_MULTIPLAYER_SOURCES
     ${CSP_MULTIPLAYER_SOURCE_DIR}/ComponentBase.cpp
     ${CSP_MULTIPLAYER_SOURCE_DIR}/ComponentProperty.cpp
+    ${CSP_MULTIPLAYER_SOURCE_DIR}/ComponentPropertyIndex.cpp
     ${CSP_MULTIPLAYER_SOURCE_DIR}/ComponentSchema.cpp
     ${CSP_MULTIPLAYER_SOURCE_DIR}/ComponentSchemaRegistry.cpp
     ${CSP_MULTIPLAYER_SOURCE_DIR}/CSPSceneDescription.cpp
+    ${CSP_MULTIPLAYER_SOURCE_DIR}/IncomingPatchBatch.cpp
     ${CSP_MULTIPLAYER_SOURCE_DIR}/MCSComponentPacker.cpp
     ${CSP_MULTIPLAYER_SOURCE_DIR}/MultiplayerConnection.cpp
     ${CSP_MULTIPLAYER_SOURCE_DIR}/MultiplayerConstants.cpp
@@ -81,11 +83,16 @@ set(CSP_MULTIPLAYER_SOURCES
     ${CSP_MULTIPLAYER_SOURCE_DIR}/NetworkEventSerialisation.cpp
     ${CSP_MULTIPLAYER_SOURCE_DIR}/OfflineRealtimeEngine.cpp
     ${CSP_MULTIPLAYER_SOURCE_DIR}/OnlineRealtimeEngine.cpp
+    ${CSP_MULTIPLAYER_SOURCE_DIR}/OutgoingPatchScheduler.cpp
     ${CSP_MULTIPLAYER_SOURCE_DIR}/RealtimeEngineUtils.cpp
     ${CSP_MULTIPLAYER_SOURCE_DIR}/SignalRSerializer.cpp
     ${CSP_MULTIPLAYER_SOURCE_DIR}/SpaceEntity.cpp
+    ${CSP_MULTIPLAYER_SOURCE_DIR}/SpaceEntityHierarchy.cpp
+    ${CSP_MULTIPLAYER_SOURCE_DIR}/SpaceEntityIndex.cpp
+    ${CSP_MULTIPLAYER_SOURCE_DIR}/SpaceEntityTickList.cpp
     ${CSP_MULTIPLAYER_SOURCE_DIR}/SpaceEntityStatePatcher.cpp
     ${CSP_MULTIPLAYER_SOURCE_DIR}/SpaceTransform.cpp
+    ${CSP_MULTIPLAYER_SOURCE_DIR}/TransformBatch.cpp
 
     ${CSP_MULTIPLAYER_SOURCE_DIR}/Components/AIChatbotComponent.cpp
     ${CSP_MULTIPLAYER_SOURCE_DIR}/Components/AnimatedModelSpaceComponent.cpp
@@ -117,6 +124,7 @@ set(CSP_MULTIPLAYER_SOURCES
 
     ${CSP_MULTIPLAYER_SOURCE_DIR}/Election/ScopeLeadershipManager.cpp
 
+    ${CSP_MULTIPLAYER_SOURCE_DIR}/MCS/MCSCompactTypes.cpp
     ${CSP_MULTIPLAYER_SOURCE_DIR}/MCS/MCSSceneDescription.cpp
     ${CSP_MULTIPLAYER_SOURCE_DIR}/MCS/MCSTypes.cpp
 
@@ -140,24 +148,33 @@ set(CSP_MULTIPLAYER_SOURCES
     ${CSP_MULTIPLAYER_SOURCE_DIR}/SignalR/EmscriptenSignalRClient/EmscriptenSignalRClient.cpp
 
     ${CSP_MULTIPLAYER_SOURCE_DIR}/SignalR/POCOSignalRClient/POCOSignalRClient.cpp
+    ${CSP_MULTIPLAYER_SOURCE_DIR}/SignalR/POCOSignalRClient/ReceiveRingBuffer.cpp
 )
 
 set(CSP_MULTIPLAYER_PRIVATE_INCLUDES 
     ${CSP_MULTIPLAYER_SOURCE_DIR}/ComponentBaseKeys.h
+    ${CSP_MULTIPLAYER_SOURCE_DIR}/ComponentPropertyIndex.h
+    ${CSP_MULTIPLAYER_SOURCE_DIR}/IncomingPatchBatch.h
     ${CSP_MULTIPLAYER_SOURCE_DIR}/MCSComponentPacker.h
     ${CSP_MULTIPLAYER_SOURCE_DIR}/MultiplayerConstants.h
     ${CSP_MULTIPLAYER_SOURCE_DIR}/NetworkEventManagerImpl.h
     ${CSP_MULTIPLAYER_SOURCE_DIR}/NetworkEventSerialisation.h
+    ${CSP_MULTIPLAYER_SOURCE_DIR}/OutgoingPatchScheduler.h
     ${CSP_MULTIPLAYER_SOURCE_DIR}/PatchUtils.h
     ${CSP_MULTIPLAYER_SOURCE_DIR}/RealtimeEngineUtils.h
     ${CSP_MULTIPLAYER_SOURCE_DIR}/SignalRSerializer.h
     ${CSP_MULTIPLAYER_SOURCE_DIR}/SignalRSerializerTypeTraits.h
+    ${CSP_MULTIPLAYER_SOURCE_DIR}/SpaceEntityHierarchy.h
+    ${CSP_MULTIPLAYER_SOURCE_DIR}/SpaceEntityIndex.h
+    ${CSP_MULTIPLAYER_SOURCE_DIR}/SpaceEntityTickList.h
     ${CSP_MULTIPLAYER_SOURCE_DIR}/SpaceEntityKeys.h
     ${CSP_MULTIPLAYER_SOURCE_DIR}/SpaceEntityStatePatcher.h
+    ${CSP_MULTIPLAYER_SOURCE_DIR}/TransformBatch.h
     ${CSP_MULTIPLAYER_SOURCE_DIR}/WebSocketClient.h
 
     ${CSP_MULTIPLAYER_SOURCE_DIR}/Election/ScopeLeadershipManager.h
 
+    ${CSP_MULTIPLAYER_SOURCE_DIR}/MCS/MCSCompactTypes.h
     ${CSP_MULTIPLAYER_SOURCE_DIR}/MCS/MCSSceneDescription.h
     ${CSP_MULTIPLAYER_SOURCE_DIR}/MCS/MCSTypes.h
 
@@ -183,4 +200,5 @@ set(CSP_MULTIPLAYER_PRIVATE_INCLUDES
     ${CSP_MULTIPLAYER_SOURCE_DIR}/SignalR/EmscriptenSignalRClient/EmscriptenSignalRClient.h
 
     ${CSP_MULTIPLAYER_SOURCE_DIR}/SignalR/POCOSignalRClient/POCOSignalRClient.h
+    ${CSP_MULTIPLAYER_SOURCE_DIR}/SignalR/POCOSignalRClient/ReceiveRingBuffer.h
 )
\ No newline at end of file